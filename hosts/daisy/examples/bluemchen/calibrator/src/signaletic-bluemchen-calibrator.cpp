@@ -1,5 +1,6 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../shared/include/display-telemetry.h"
 
 #define SAMPLERATE 48000
 #define HEAP_SIZE 1024 * 256 // 256KB
@@ -36,6 +37,12 @@ struct sig_dsp_Oscillator* sine1;
 struct sig_dsp_LinearToFreq* sine1Voct;
 struct sig_dsp_Oscillator* sine2;
 struct sig_dsp_LinearToFreq* sine2Voct;
+struct sig_dsp_Telemetry* sine1Telemetry;
+struct sig_dsp_Telemetry* sine2Telemetry;
+struct sig_dsp_Telemetry* calibrationSideTelemetry;
+float displayedSine1Hz = 0.0f;
+float displayedSine2Hz = 0.0f;
+float displayedCalibrationSide = 0.0f;
 
 struct sig_host_AudioOut* audio1Out;
 struct sig_host_AudioOut* audio2Out;
@@ -48,19 +55,21 @@ void UpdateOled() {
     host.device.display.SetCursor(0, 0);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
-    float sine1Hz = sine1Voct->outputs.main[0];
-    float sine2Hz = sine2Voct->outputs.main[0];
-    float calibrationSide = (int) encoderAccumulator->outputs.main[0];
+    sig_dsp_Telemetry_readLatest(sine1Telemetry, &displayedSine1Hz);
+    sig_dsp_Telemetry_readLatest(sine2Telemetry, &displayedSine2Hz);
+    sig_dsp_Telemetry_readLatest(calibrationSideTelemetry,
+        &displayedCalibrationSide);
+    float calibrationSide = (int) displayedCalibrationSide;
     int stage = (int) (calibrationSide == 0.0f ?
         cv1Calibrator->stage : cv2Calibrator->stage);
     displayStr.Clear();
-    displayStr.AppendFloat(sine1Hz, 3);
+    displayStr.AppendFloat(displayedSine1Hz, 3);
     displayStr.Append("Hz");
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
-    displayStr.AppendFloat(sine2Hz, 3);
+    displayStr.AppendFloat(displayedSine2Hz, 3);
     displayStr.Append("Hz");
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
@@ -96,6 +105,9 @@ void buildSignalGraph(struct sig_SignalContext* context, struct sig_Status* stat
     encoderAccumulator->parameters.wrap = 1.0f;
     encoderAccumulator->inputs.source = encoderIn->outputs.increment;
 
+    calibrationSideTelemetry = sig_host_DisplayTelemetry_new(&allocator,
+        context, &signals, encoderAccumulator->outputs.main, status);
+
     leftCalibrationSelector = sig_dsp_Branch_new(&allocator, context);
     sig_List_append(&signals, leftCalibrationSelector, status);
     leftCalibrationSelector->inputs.condition =
@@ -138,6 +150,9 @@ void buildSignalGraph(struct sig_SignalContext* context, struct sig_Status* stat
     sig_List_append(&signals, sine1Voct, status);
     sine1Voct->inputs.source = cv1Calibrator->outputs.main;
 
+    sine1Telemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, sine1Voct->outputs.main, status);
+
     sine1 = sig_dsp_SineOscillator_new(&allocator, context);
     sig_List_append(&signals, sine1, status);
     sine1->inputs.freq = sine1Voct->outputs.main;
@@ -153,6 +168,9 @@ void buildSignalGraph(struct sig_SignalContext* context, struct sig_Status* stat
     sig_List_append(&signals, sine2Voct, status);
     sine2Voct->inputs.source = cv2Calibrator->outputs.main;
 
+    sine2Telemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, sine2Voct->outputs.main, status);
+
     sine2 = sig_dsp_SineOscillator_new(&allocator, context);
     sig_List_append(&signals, sine2, status);
     sine2->inputs.freq = sine2Voct->outputs.main;
@@ -1,5 +1,6 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../shared/include/display-telemetry.h"
 
 #define SAMPLERATE 48000
 #define DELAY_LINE_LENGTH 48000 // 1 second
@@ -38,6 +39,10 @@ sig::libdaisy::DaisyHost<kxmx::bluemchen::BluemchenDevice> host;
 
 struct sig_host_FilteredCVIn* mixKnob;
 struct sig_host_FilteredCVIn* lfoSpeedKnob;
+struct sig_dsp_Telemetry* mixTelemetry;
+struct sig_dsp_Telemetry* lfoSpeedTelemetry;
+float displayedMix = 0.0f;
+float displayedLFOSpeed = 0.0f;
 struct sig_dsp_ConstantValue* lfoDepth;
 struct sig_dsp_ConstantValue* lfoOffset;
 struct sig_host_AudioIn* leftIn;
@@ -61,13 +66,15 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("Mix ");
-    displayStr.AppendFloat(mixKnob->outputs.main[0], 2);
+    sig_dsp_Telemetry_readLatest(mixTelemetry, &displayedMix);
+    displayStr.AppendFloat(displayedMix, 2);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
     displayStr.Append("LFO ");
-    displayStr.AppendFloat(lfoSpeedKnob->outputs.main[0], 2);
+    sig_dsp_Telemetry_readLatest(lfoSpeedTelemetry, &displayedLFOSpeed);
+    displayStr.AppendFloat(displayedLFOSpeed, 2);
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
@@ -98,6 +105,13 @@ void buildSignalGraph(struct sig_SignalContext* context,
     lfoSpeedKnob->parameters.scale = 9.75f;
     lfoSpeedKnob->parameters.time = 0.1f;
 
+    // The display reads the knobs' values from Telemetry queues,
+    // rather than from blocks that the audio callback is writing to.
+    mixTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, mixKnob->outputs.main, status);
+    lfoSpeedTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, lfoSpeedKnob->outputs.main, status);
+
     lfoDepth = sig_dsp_ConstantValue_new(&allocator, context, 0.001845f);
     lfoOffset = sig_dsp_ConstantValue_new(&allocator, context, 0.003505f);
 
@@ -1,5 +1,6 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-nehcmeulb-device.hpp"
+#include "../../../shared/include/display-telemetry.h"
 
 #define SAMPLERATE 48000
 #define HEAP_SIZE 1024 * 256 // 256KB
@@ -31,6 +32,10 @@ struct sig_dsp_BinaryOp* clockPulseSum;
 struct sig_dsp_ClockDetector* clock;
 struct sig_dsp_BinaryOp* densityClockSum;
 struct sig_dsp_DustGate* cvDustGate;
+struct sig_dsp_Telemetry* densityTelemetry;
+struct sig_dsp_Telemetry* gateTelemetry;
+float displayedDensity = 0.0f;
+float displayedGateState = 0.0f;
 struct sig_dsp_BinaryOp* audioDensity;
 struct sig_dsp_ConstantValue* audioDensityScale;
 struct sig_dsp_DustGate* audioDustGate;
@@ -48,7 +53,8 @@ void UpdateOled() {
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
-    float density = densityClockSum->outputs.main[0];
+    sig_dsp_Telemetry_readLatest(densityTelemetry, &displayedDensity);
+    float density = displayedDensity;
     float formatted = 0.0f;
     if (density < 6.0f) {
         formatted = density * 60.0f;
@@ -66,8 +72,8 @@ void UpdateOled() {
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_11x18, true);
 
-    float gateState = cvDustGate->outputs.main[0];
-    if (gateState > 0.0f) {
+    sig_dsp_Telemetry_readLatest(gateTelemetry, &displayedGateState);
+    if (displayedGateState > 0.0f) {
         displayStr.Clear();
         displayStr.Append("o");
         host.device.display.SetCursor(28, 24);
@@ -124,6 +130,15 @@ void buildGraph(struct sig_SignalContext* context, struct sig_Status* status) {
     cvDustGate->inputs.density = densityClockSum->outputs.main;
     cvDustGate->inputs.durationPercentage = durationKnob->outputs.main;
 
+    // The display reads the density and gate from Telemetry queues,
+    // rather than from blocks that the audio callback is writing to.
+    densityTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, densityClockSum->outputs.main, status);
+    gateTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, cvDustGate->outputs.main, status);
+    // Short gates would be missed by reading only the last value.
+    gateTelemetry->parameters.mode = sig_dsp_Telemetry_Mode_PEAK;
+
     dustCVOut = sig_host_CVOut_new(&allocator, context);
     dustCVOut->hardware = &host.device.hardware;
     sig_List_append(&signals, dustCVOut, status);
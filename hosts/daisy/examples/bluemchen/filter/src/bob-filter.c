@@ -137,6 +137,10 @@ void sig_dsp_Bob_generate(void* signal) {
         FLOAT_ARRAY(self->outputs.fourPole)[i] = self->state[3];
         FLOAT_ARRAY(self->outputs.twoPole)[i] = self->state[1];
     }
+
+    for (size_t i = 0; i < 4; i++) {
+        self->state[i] = sig_denormals_flush(self->state[i]);
+    }
 }
 
 void sig_dsp_Bob_destroy(struct sig_Allocator* allocator,
@@ -1,5 +1,6 @@
 #include "../include/bob-filter.h"
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../shared/include/display-telemetry.h"
 
 FixedCapStr<20> displayStr;
 
@@ -96,8 +97,18 @@ struct sig_dsp_Tanh* leftSaturation;
 struct sig_dsp_Tanh* rightSaturation;
 struct sig_host_AudioOut* leftOut;
 struct sig_host_AudioOut* rightOut;
+struct sig_dsp_Telemetry* frequencyTelemetry;
+struct sig_dsp_Telemetry* resonanceTelemetry;
+struct sig_dsp_Telemetry* filterModeTelemetry;
+float displayedFrequency = 0.0f;
+float displayedResonance = 0.0f;
+float displayedFilterMode = 0.0f;
 
 void UpdateOled() {
+    sig_dsp_Telemetry_readLatest(frequencyTelemetry, &displayedFrequency);
+    sig_dsp_Telemetry_readLatest(resonanceTelemetry, &displayedResonance);
+    sig_dsp_Telemetry_readLatest(filterModeTelemetry, &displayedFilterMode);
+
     host.device.display.Fill(false);
 
     displayStr.Clear();
@@ -107,7 +118,7 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("F: ");
-    displayStr.AppendFloat(leftFrequency->outputs.main[0], 0);
+    displayStr.AppendFloat(displayedFrequency, 0);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
@@ -118,12 +129,12 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("R: ");
-    displayStr.AppendFloat(resonanceKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedResonance, 2);
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
-    displayStr.Append(filterModeStrings[(size_t) aList->outputs.index[0]]);
+    displayStr.Append(filterModeStrings[(size_t) displayedFilterMode]);
     host.device.display.SetCursor(0, 24);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
@@ -145,6 +156,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     aList->parameters.normalizeIndex = 0.0f;
     aList->inputs.index = encoderIn->outputs.main;
 
+    filterModeTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, aList->outputs.index, status);
+
     aSmooth = sig_dsp_Smooth_new(&allocator, context);
     sig_List_append(&signals, aSmooth, status);
     aSmooth->inputs.source = aList->outputs.main;
@@ -250,6 +264,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     sig_List_append(&signals, leftFrequency, status);
     leftFrequency->inputs.source = leftFrequencyCVSkewed->outputs.main;
 
+    frequencyTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, leftFrequency->outputs.main, status);
+
     rightFrequencyCVSkewed = sig_dsp_Branch_new(&allocator, context);
     sig_List_append(&signals, rightFrequencyCVSkewed, status);
     rightFrequencyCVSkewed->inputs.condition = skewCV->outputs.main;
@@ -266,6 +283,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     resonanceKnob->parameters.control = sig_host_KNOB_2;
     resonanceKnob->parameters.scale = 4.0f; // 1.8f for Ladder
 
+    resonanceTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, resonanceKnob->outputs.main, status);
+
     leftIn = sig_host_AudioIn_new(&allocator, context);
     leftIn->hardware = &host.device.hardware;
     sig_List_append(&signals, leftIn, status);
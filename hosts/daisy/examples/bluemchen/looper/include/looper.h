@@ -16,6 +16,12 @@ struct sig_dsp_Looper_Inputs {
     float_array_ptr clear;
 };
 
+struct sig_dsp_Looper_Outputs {
+    float_array_ptr main;
+    // The playback position, in samples, after each sample is played.
+    float_array_ptr playbackPos;
+};
+
 struct sig_dsp_Looper_Loop {
     struct sig_Buffer* buffer;
     size_t startIdx;
@@ -26,7 +32,7 @@ struct sig_dsp_Looper_Loop {
 struct sig_dsp_Looper {
     struct sig_dsp_Signal signal;
     struct sig_dsp_Looper_Inputs inputs;
-    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    struct sig_dsp_Looper_Outputs outputs;
     struct sig_dsp_Looper_Loop loop;
     size_t loopLastIdx;
     float playbackPos;
@@ -26,12 +26,28 @@ void sig_dsp_Looper_init(struct sig_dsp_Looper* self,
     sig_CONNECT_TO_SILENCE(self, clear, context);
 }
 
+void sig_dsp_Looper_Outputs_newAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_Looper_Outputs* outputs) {
+    outputs->main = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->playbackPos = sig_AudioBlock_newSilent(allocator,
+        audioSettings);
+}
+
+void sig_dsp_Looper_Outputs_destroyAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_dsp_Looper_Outputs* outputs) {
+    sig_AudioBlock_destroy(allocator, outputs->main);
+    sig_AudioBlock_destroy(allocator, outputs->playbackPos);
+}
+
 struct sig_dsp_Looper* sig_dsp_Looper_new(struct sig_Allocator* allocator,
     struct sig_SignalContext* context) {
     struct sig_dsp_Looper* self = sig_MALLOC(allocator,
         struct sig_dsp_Looper);
     sig_dsp_Looper_init(self, context);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+    sig_dsp_Looper_Outputs_newAudioBlocks(allocator,
         context->audioSettings, &self->outputs);
 
     return self;
@@ -190,6 +206,7 @@ void sig_dsp_Looper_generate(void* signal) {
 
         self->playbackPos = sig_dsp_Looper_nextPosition(self->playbackPos,
             startPos, endPos, speed);
+        FLOAT_ARRAY(self->outputs.playbackPos)[i] = self->playbackPos;
 
         self->previousRecord = FLOAT_ARRAY(self->inputs.record)[i];
         self->previousClear = FLOAT_ARRAY(self->inputs.clear)[i];
@@ -198,7 +215,6 @@ void sig_dsp_Looper_generate(void* signal) {
 
 void sig_dsp_Looper_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Looper* self) {
-    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
-        &self->outputs);
+    sig_dsp_Looper_Outputs_destroyAudioBlocks(allocator, &self->outputs);
     sig_dsp_Signal_destroy(allocator, self);
 }
@@ -1,6 +1,7 @@
 #include "../include/looper.h"
 #include "../../../../include/kxmx-bluemchen-device.hpp"
 #include "../../../../include/looper-view.h"
+#include "../../../shared/include/display-telemetry.h"
 #include <string>
 
 #define SAMPLERATE 48000
@@ -50,6 +51,16 @@ struct sig_dsp_BinaryOp* speedAdder;
 struct sig_dsp_Invert* leftSpeedSkewInverter;
 struct sig_dsp_BinaryOp* leftSpeed;
 struct sig_dsp_BinaryOp* rightSpeed;
+struct sig_dsp_Telemetry* leftSpeedTelemetry;
+struct sig_dsp_Telemetry* rightSpeedTelemetry;
+struct sig_dsp_Telemetry* startTelemetry;
+struct sig_dsp_Telemetry* endTelemetry;
+struct sig_dsp_Telemetry* recordGateTelemetry;
+struct sig_dsp_Telemetry* playbackPosTelemetry;
+float displayedStart = 0.0f;
+float displayedEnd = 1.0f;
+float displayedRecordGate = 0.0f;
+float displayedPlaybackPos = 0.0f;
 struct sig_dsp_ConstantValue* tapDuration;
 struct sig_dsp_ConstantValue* longPressDuration;
 struct sig_dsp_TimedTriggerCounter* encoderTap;
@@ -65,20 +76,22 @@ struct sig_host_AudioOut* leftOut;
 struct sig_host_AudioOut* rightOut;
 
 void UpdateOled() {
-    // Note: this is required until we have something that
-    // offers some way to get the current value from a Signal.
-    // See https://github.com/continuing-creativity/signaletic/issues/19
-    size_t lastSampIdx = leftSpeed->signal.audioSettings->blockSize - 1;
-    looperView.leftSpeed = leftSpeed->outputs.main[lastSampIdx];
-    looperView.rightSpeed = rightSpeed->outputs.main[lastSampIdx];
-
-    bool foregroundOn = !recordGate->isGateOpen;
+    sig_dsp_Telemetry_readLatest(leftSpeedTelemetry, &looperView.leftSpeed);
+    sig_dsp_Telemetry_readLatest(rightSpeedTelemetry,
+        &looperView.rightSpeed);
+    sig_dsp_Telemetry_readLatest(startTelemetry, &displayedStart);
+    sig_dsp_Telemetry_readLatest(endTelemetry, &displayedEnd);
+    sig_dsp_Telemetry_readLatest(recordGateTelemetry, &displayedRecordGate);
+    sig_dsp_Telemetry_readLatest(playbackPosTelemetry,
+        &displayedPlaybackPos);
+
+    bool foregroundOn = displayedRecordGate <= 0.0f;
     host.device.display.Fill(!foregroundOn);
 
     sig_ui_daisy_LooperView_render(&looperView,
-        startKnob->filter->previousSample,
-        endKnob->filter->previousSample,
-        leftLooper->playbackPos,
+        displayedStart,
+        displayedEnd,
+        displayedPlaybackPos,
         foregroundOn);
 
     host.device.display.Update();
@@ -91,11 +104,17 @@ void buildSignalGraph(struct sig_SignalContext* context,
     sig_List_append(&signals, startKnob, status);
     startKnob->parameters.control = sig_host_KNOB_1;
 
+    startTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, startKnob->outputs.main, status);
+
     endKnob = sig_host_FilteredCVIn_new(&allocator, context);
     endKnob->hardware = &host.device.hardware;
     sig_List_append(&signals, endKnob, status);
     endKnob->parameters.control = sig_host_KNOB_2;
 
+    endTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, endKnob->outputs.main, status);
+
     encoder = sig_host_EncoderIn_new(&allocator, context);
     encoder->hardware = &host.device.hardware;
     sig_List_append(&signals, encoder, status);
@@ -145,6 +164,12 @@ void buildSignalGraph(struct sig_SignalContext* context,
     rightSpeed->inputs.left = speedAdder->outputs.main;
     rightSpeed->inputs.right = skewCV->outputs.main;
 
+    leftSpeedTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, leftSpeed->outputs.main, status);
+
+    rightSpeedTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, rightSpeed->outputs.main, status);
+
     tapDuration = sig_dsp_ConstantValue_new(&allocator, context, 0.5f);
 
     encoderTap = sig_dsp_TimedTriggerCounter_new(&allocator, context);
@@ -157,6 +182,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     sig_List_append(&signals, recordGate, status);
     recordGate->inputs.trigger = encoderTap->outputs.main;
 
+    recordGateTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, recordGate->outputs.main, status);
+
     longPressDuration = sig_dsp_ConstantValue_new(&allocator, context,
         LONG_ENCODER_PRESS);
 
@@ -179,6 +207,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     leftLooper->inputs.record = recordGate->outputs.main;
     leftLooper->inputs.clear = encoderLongPress->outputs.main;
 
+    playbackPosTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, leftLooper->outputs.playbackPos, status);
+
     // TODO: Need better buffer management.
     sig_fillWithSilence(leftSamples, LOOP_LENGTH);
     sig_dsp_Looper_setBuffer(leftLooper, &leftBuffer);
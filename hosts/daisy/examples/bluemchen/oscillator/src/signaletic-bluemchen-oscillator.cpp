@@ -1,5 +1,6 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../shared/include/display-telemetry.h"
 
 using namespace sig::libdaisy;
 
@@ -31,6 +32,8 @@ struct sig_host_CVIn* vOctCVIn;
 struct sig_dsp_BinaryOp* coarsePlusVOct;
 struct sig_dsp_BinaryOp* coarseVOctPlusFine;
 struct sig_dsp_LinearToFreq* frequency;
+struct sig_dsp_Telemetry* frequencyTelemetry;
+float displayedFrequency = 0.0f;
 struct sig_dsp_Oscillator* osc;
 struct sig_dsp_ConstantValue* gainLevel;
 struct sig_dsp_BinaryOp* gain;
@@ -46,7 +49,8 @@ void UpdateOled() {
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
-    displayStr.AppendFloat(frequency->outputs.main[0], 1);
+    sig_dsp_Telemetry_readLatest(frequencyTelemetry, &displayedFrequency);
+    displayStr.AppendFloat(displayedFrequency, 1);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
@@ -98,6 +102,11 @@ void buildSignalGraph(struct sig_SignalContext* context,
     sig_List_append(&signals, frequency, status);
     frequency->inputs.source = coarseVOctPlusFine->outputs.main;
 
+    // The display reads the frequency from a Telemetry queue,
+    // rather than from a block that the audio callback is writing to.
+    frequencyTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, frequency->outputs.main, status);
+
     osc = sig_dsp_SineOscillator_new(&allocator, context);
     sig_List_append(&signals, osc, status);
     osc->inputs.freq = frequency->outputs.main;
@@ -1,5 +1,6 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../../shared/include/display-telemetry.h"
 
 FixedCapStr<20> displayStr;
 
@@ -63,8 +64,16 @@ struct sig_dsp_Allpass* ap5;
 struct sig_dsp_LinearXFade* wetDryMixer;
 struct sig_host_AudioOut* leftOut;
 struct sig_host_AudioOut* rightOut;
+struct sig_dsp_Telemetry* mixTelemetry;
+struct sig_dsp_Telemetry* delayTimeScaleTelemetry;
+float displayedMix = 0.0f;
+float displayedDelayTimeScale = 0.0f;
 
 void UpdateOled() {
+    sig_dsp_Telemetry_readLatest(mixTelemetry, &displayedMix);
+    sig_dsp_Telemetry_readLatest(delayTimeScaleTelemetry,
+        &displayedDelayTimeScale);
+
     host.device.display.Fill(false);
 
     displayStr.Clear();
@@ -74,13 +83,13 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("Mix ");
-    displayStr.AppendFloat(mixKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedMix, 2);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
     displayStr.Append("Time ");
-    displayStr.AppendFloat(delayTimeScale1->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedDelayTimeScale, 2);
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
@@ -97,6 +106,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     mixKnob->parameters.offset = -1.0f;
     mixKnob->parameters.time = 0.1f;
 
+    mixTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, mixKnob->outputs.main, status);
+
     timeScaleKnob = sig_host_FilteredCVIn_new(&allocator, context);
     timeScaleKnob->hardware = &host.device.hardware;
     sig_List_append(&signals, timeScaleKnob, status);
@@ -131,6 +143,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     ap1->inputs.delayTime = delayTimeScale1->outputs.main;
     ap1->inputs.g = ohSeven->outputs.main;
 
+    delayTimeScaleTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, delayTimeScale1->outputs.main, status);
+
     dl2 = sig_DelayLine_new(&delayLineAllocator, MAX_DELAY_LINE_LENGTH);
     delayTime2 = sig_dsp_ConstantValue_new(&allocator, context, 0.068f);
     delayTimeScale2 = sig_dsp_Mul_new(&allocator, context);
@@ -9,6 +9,7 @@
 */
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../../shared/include/display-telemetry.h"
 
 FixedCapStr<20> displayStr;
 
@@ -78,8 +79,15 @@ struct sig_dsp_BinaryOp* dry;
 struct sig_dsp_BinaryOp* wetDryMix;
 struct sig_host_AudioOut* leftOut;
 struct sig_host_AudioOut* rightOut;
+struct sig_dsp_Telemetry* delayTimeTelemetry;
+struct sig_dsp_Telemetry* gTelemetry;
+float displayedDelayTime = 0.0f;
+float displayedG = 0.0f;
 
 void UpdateOled() {
+    sig_dsp_Telemetry_readLatest(delayTimeTelemetry, &displayedDelayTime);
+    sig_dsp_Telemetry_readLatest(gTelemetry, &displayedG);
+
     host.device.display.Fill(false);
 
     displayStr.Clear();
@@ -89,13 +97,13 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("Delay ");
-    displayStr.AppendFloat(delayTimeKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedDelayTime, 2);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
     displayStr.Append("g ");
-    displayStr.AppendFloat(gKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedG, 2);
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
@@ -118,6 +126,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     // when modulating a delay line.
     delayTimeKnob->parameters.time = 0.25f;
 
+    delayTimeTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, delayTimeKnob->outputs.main, status);
+
     gKnob = sig_host_FilteredCVIn_new(&allocator, context);
     gKnob->hardware = &host.device.hardware;
     sig_List_append(&signals, gKnob, status);
@@ -125,6 +136,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     gKnob->parameters.scale = 0.999f;
     gKnob->parameters.time = 0.001f;
 
+    gTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, gKnob->outputs.main, status);
+
     audioIn = sig_host_AudioIn_new(&allocator, context);
     audioIn->hardware = &host.device.hardware;
     sig_List_append(&signals, audioIn, status);
@@ -1,5 +1,6 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
+#include "../../../../shared/include/display-telemetry.h"
 
 FixedCapStr<20> displayStr;
 
@@ -70,8 +71,17 @@ struct sig_dsp_Allpass* ap2;
 struct sig_host_AudioOut* leftOut;
 struct sig_dsp_Invert* ap2Inverted;
 struct sig_host_AudioOut* rightOut;
+struct sig_dsp_Telemetry* delayTimeScaleTelemetry;
+struct sig_dsp_Telemetry* feedbackGainScaleTelemetry;
+float displayedDelayTimeScale = 0.0f;
+float displayedFeedbackGainScale = 0.0f;
 
 void UpdateOled() {
+    sig_dsp_Telemetry_readLatest(delayTimeScaleTelemetry,
+        &displayedDelayTimeScale);
+    sig_dsp_Telemetry_readLatest(feedbackGainScaleTelemetry,
+        &displayedFeedbackGainScale);
+
     host.device.display.Fill(false);
 
     displayStr.Clear();
@@ -81,13 +91,13 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("Del ");
-    displayStr.AppendFloat(delayTimeScaleKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedDelayTimeScale, 2);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
     displayStr.Append("g ");
-    displayStr.AppendFloat(feedbackGainScaleKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedFeedbackGainScale, 2);
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
     host.device.display.Update();
@@ -122,6 +132,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     // when modulating a delay line.
     delayTimeScaleKnob->parameters.time = 0.25f;
 
+    delayTimeScaleTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, delayTimeScaleKnob->outputs.main, status);
+
     feedbackGainScaleKnob = sig_host_FilteredCVIn_new(&allocator, context);
     feedbackGainScaleKnob->hardware = &host.device.hardware;
     sig_List_append(&signals, feedbackGainScaleKnob, status);
@@ -129,6 +142,10 @@ void buildSignalGraph(struct sig_SignalContext* context,
     feedbackGainScaleKnob->parameters.scale = 0.999f;
     feedbackGainScaleKnob->parameters.offset = 0.001f;
 
+    feedbackGainScaleTelemetry = sig_host_DisplayTelemetry_new(
+        &allocator, context, &signals, feedbackGainScaleKnob->outputs.main,
+        status);
+
     apGain = sig_dsp_ConstantValue_new(&allocator, context, 0.7f);
     combLPFCoefficient = sig_dsp_ConstantValue_new(&allocator, context, 0.55f);
 
@@ -1,6 +1,7 @@
 #include <libsignaletic.h>
 #include "../../../../include/kxmx-bluemchen-device.hpp"
 #include "../../../../shared/include/multi-tap-delay.h"
+#include "../../../../shared/include/display-telemetry.h"
 
 FixedCapStr<20> displayStr;
 
@@ -123,15 +124,7 @@ struct sig_dsp_BinaryOp* oneMinusC6G1;
 struct sig_dsp_BinaryOp* c6G2;
 struct sig_dsp_Comb* c6;
 
-// TODO: Oof, need multichannel inputs.
-struct sig_dsp_BinaryOp* sum1;
-struct sig_dsp_BinaryOp* sum2;
-struct sig_dsp_BinaryOp* sum3;
-struct sig_dsp_BinaryOp* sum4;
-struct sig_dsp_BinaryOp* sum5;
-
-struct sig_dsp_ConstantValue* combMixGain;
-struct sig_dsp_BinaryOp* scaledCombMix;
+struct sig_dsp_Mixer* combMix;
 
 struct sig_DelayLine* dl7;
 struct sig_dsp_ConstantValue* apDelayTime;
@@ -142,8 +135,16 @@ struct sig_dsp_BinaryOp* reverberatorMixScale;
 struct sig_dsp_BinaryOp* earlyEchoesReverberatorMix;
 struct sig_host_AudioOut* leftOut;
 struct sig_host_AudioOut* rightOut;
+struct sig_dsp_Telemetry* delayTimeScaleTelemetry;
+struct sig_dsp_Telemetry* combGainTelemetry;
+float displayedDelayTimeScale = 0.0f;
+float displayedCombGain = 0.0f;
 
 void UpdateOled() {
+    sig_dsp_Telemetry_readLatest(delayTimeScaleTelemetry,
+        &displayedDelayTimeScale);
+    sig_dsp_Telemetry_readLatest(combGainTelemetry, &displayedCombGain);
+
     host.device.display.Fill(false);
 
     displayStr.Clear();
@@ -153,13 +154,13 @@ void UpdateOled() {
 
     displayStr.Clear();
     displayStr.Append("Del ");
-    displayStr.AppendFloat(delayTimeScaleKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedDelayTimeScale, 2);
     host.device.display.SetCursor(0, 8);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
 
     displayStr.Clear();
     displayStr.Append("g ");
-    displayStr.AppendFloat(combGainKnob->outputs.main[0], 2);
+    displayStr.AppendFloat(displayedCombGain, 2);
     host.device.display.SetCursor(0, 16);
     host.device.display.WriteString(displayStr.Cstr(), Font_6x8, true);
     host.device.display.Update();
@@ -198,6 +199,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     delayTimeScaleKnob->parameters.offset = 0.001f;
     delayTimeScaleKnob->parameters.time = 0.25f; // Smoother mod pitch shift
 
+    delayTimeScaleTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, delayTimeScaleKnob->outputs.main, status);
+
     combGainKnob = sig_host_FilteredCVIn_new(&allocator, context);
     combGainKnob->hardware = &host.device.hardware;
     sig_List_append(&signals, combGainKnob, status);
@@ -205,6 +209,9 @@ void buildSignalGraph(struct sig_SignalContext* context,
     combGainKnob->parameters.scale = 1.6999f;
     combGainKnob->parameters.offset = 0.001f;
 
+    combGainTelemetry = sig_host_DisplayTelemetry_new(&allocator, context,
+        &signals, combGainKnob->outputs.main, status);
+
     audioIn = sig_host_AudioIn_new(&allocator, context);
     audioIn->hardware = &host.device.hardware;
     sig_List_append(&signals, audioIn, status);
@@ -364,36 +371,15 @@ void buildSignalGraph(struct sig_SignalContext* context,
     c6->inputs.delayTime = c6ScaledDelayTime->outputs.main;
     c6->inputs.lpfCoefficient = c6LPFGain->outputs.main;
 
-    sum1 = sig_dsp_Add_new(&allocator, context);
-    sig_List_append(&signals, sum1, status);
-    sum1->inputs.left = c1->outputs.main;
-    sum1->inputs.right = c2->outputs.main;
-
-    sum2 = sig_dsp_Add_new(&allocator, context);
-    sig_List_append(&signals, sum2, status);
-    sum2->inputs.left = sum1->outputs.main;
-    sum2->inputs.right = c3->outputs.main;
-
-    sum3 = sig_dsp_Add_new(&allocator, context);
-    sig_List_append(&signals, sum3, status);
-    sum3->inputs.left = sum2->outputs.main;
-    sum3->inputs.right = c4->outputs.main;
-
-    sum4 = sig_dsp_Add_new(&allocator, context);
-    sig_List_append(&signals, sum4, status);
-    sum4->inputs.left = sum3->outputs.main;
-    sum4->inputs.right = c5->outputs.main;
-
-    sum5 = sig_dsp_Add_new(&allocator, context);
-    sig_List_append(&signals, sum5, status);
-    sum5->inputs.left = sum4->outputs.main;
-    sum5->inputs.right = c6->outputs.main;
-
-    combMixGain = sig_dsp_ConstantValue_new(&allocator, context, 0.2f);
-    scaledCombMix = sig_dsp_Mul_new(&allocator, context);
-    sig_List_append(&signals, scaledCombMix, status);
-    scaledCombMix->inputs.left = sum5->outputs.main;
-    scaledCombMix->inputs.right = combMixGain->outputs.main;
+    combMix = sig_dsp_Mixer_new(&allocator, context, 6);
+    sig_List_append(&signals, combMix, status);
+    combMix->inputs.sources[0] = c1->outputs.main;
+    combMix->inputs.sources[1] = c2->outputs.main;
+    combMix->inputs.sources[2] = c3->outputs.main;
+    combMix->inputs.sources[3] = c4->outputs.main;
+    combMix->inputs.sources[4] = c5->outputs.main;
+    combMix->inputs.sources[5] = c6->outputs.main;
+    combMix->parameters.masterGain = 0.2f;
 
     /** All Pass **/
     // Note: I don't scale the all pass delay time with the delay time knob,
@@ -406,7 +392,7 @@ void buildSignalGraph(struct sig_SignalContext* context,
     ap = sig_dsp_Allpass_new(&allocator, context);
     sig_List_append(&signals, ap, status);
     ap->delayLine = dl7;
-    ap->inputs.source = scaledCombMix->outputs.main;
+    ap->inputs.source = combMix->outputs.main;
     ap->inputs.delayTime = apDelayTime->outputs.main;
     ap->inputs.g = apGain->outputs.main;
 
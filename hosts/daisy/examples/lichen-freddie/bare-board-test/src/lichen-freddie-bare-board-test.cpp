@@ -3,7 +3,6 @@
 #include <array>
 #include "../../../../include/signaletic-daisy-host.hpp"
 #include "../../../../include/lichen-freddie-device.hpp"
-#include "../include/ring-buffer.hpp"
 
 #define SAMPLERATE 48000
 #define HEAP_SIZE 1024 * 384 // 384 KB
@@ -42,12 +41,11 @@ sig::libdaisy::GPIOOutput leds[NUM_CONTROLS];
 float previousButtonValues[NUM_CONTROLS] = {0.0f};
 uint8_t previousSliderMIDIValues[NUM_CONTROLS] = {0};
 bool buttonState[NUM_CONTROLS] = {false};
-sig::RingBuffer<std::array<uint8_t, MIDI_MESSAGE_SIZE>, MIDI_QUEUE_SIZE>
-     midiEvents;
+struct sig_RingBuffer* midiEvents;
 struct sig_filter_Smooth sliderFilters[NUM_CONTROLS];
 
 void enqueueMIDIMessage(std::array<uint8_t, 3> msg) {
-    midiEvents.write(msg);
+    sig_RingBuffer_push(midiEvents, msg.data());
 }
 
 void sendMIDIMessage(std::array<uint8_t, 3> msg) {
@@ -148,9 +146,9 @@ void AudioCallback(daisy::AudioHandle::InputBuffer in,
 }
 
 void processMIDIEvents() {
-    size_t eventsToRead = midiEvents.readable();
-    for (size_t i = 0; i < eventsToRead; i++) {
-        sendMIDIMessage(midiEvents.read());
+    std::array<uint8_t, MIDI_MESSAGE_SIZE> msg;
+    while (sig_RingBuffer_pop(midiEvents, msg.data())) {
+        sendMIDIMessage(msg);
     }
 }
 
@@ -166,7 +164,8 @@ void initMIDI() {
         UartHandler::Config::Peripheral::USART_1;
     trsMIDI.Init(trsConfig);
 
-    midiEvents.Init();
+    midiEvents = sig_RingBuffer_new(&allocator, MIDI_QUEUE_SIZE,
+        MIDI_MESSAGE_SIZE);
 }
 
 void initSliderFilters() {
@@ -1,4 +1,5 @@
 #include <libsignaletic.h>
+#include <libsignaletic-tables.h>
 #include "../../../../include/electrosmith-patch-init-device.hpp"
 
 #define SAMPLERATE 96000
@@ -314,6 +315,9 @@ int main(void) {
 
     struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
         &audioSettings);
+    // Read the FM operators' sine table from flash
+    // instead of building it on the heap.
+    sig_tables_provide(context->tables, &allocator);
     evaluator = sig_dsp_SignalListEvaluator_new(&allocator, &signals);
     host.Init(&audioSettings, (struct sig_dsp_SignalEvaluator*) evaluator);
 
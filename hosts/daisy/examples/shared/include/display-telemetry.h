@@ -0,0 +1,35 @@
+#include <libsignaletic.h>
+
+#define sig_host_DISPLAY_REPORTS_PER_SEC 30.0f
+#define sig_host_DISPLAY_TELEMETRY_CAPACITY 4
+
+/**
+ * @brief Creates a Telemetry Signal that reports the last value of
+ * a source about 30 times per second, and appends it to a signal list.
+ *
+ * Display loops should read values with sig_dsp_Telemetry_readLatest(),
+ * rather than from blocks that the audio callback is writing to.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param signals the list to append the Telemetry Signal to,
+ * after the Signal whose output it reports
+ * @param source the output to report
+ * @param status the status to report errors to
+ * @return struct sig_dsp_Telemetry* the new Telemetry Signal
+ */
+struct sig_dsp_Telemetry* sig_host_DisplayTelemetry_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    struct sig_List* signals, float_array_ptr source,
+    struct sig_Status* status) {
+    struct sig_dsp_Telemetry* self = sig_dsp_Telemetry_new(allocator,
+        context, sig_host_DISPLAY_TELEMETRY_CAPACITY);
+    sig_List_append(signals, self, status);
+    self->inputs.source = source;
+    self->parameters.mode = sig_dsp_Telemetry_Mode_LAST;
+    self->parameters.blocksPerReport = context->audioSettings->sampleRate /
+        (context->audioSettings->blockSize *
+        sig_host_DISPLAY_REPORTS_PER_SEC);
+
+    return self;
+}
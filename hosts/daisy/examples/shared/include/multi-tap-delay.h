@@ -6,7 +6,9 @@ struct sig_dsp_MultiTapDelay_Inputs {
 };
 
 
-// FIXME: Need multichannel inputs so these delay taps can be modulatable.
+// Tap times are read from a buffer, so they can't be modulated.
+// For modulatable taps, use a multichannel DelayTap
+// (see sig_dsp_DelayTap_newMultichannel), and mix its channels.
 struct sig_dsp_MultiTapDelay {
     struct sig_dsp_Signal signal;
     struct sig_dsp_MultiTapDelay_Inputs inputs;
@@ -65,7 +65,14 @@ namespace bluemchen {
             InputBank<sig::libdaisy::Encoder, NUM_ENCODERS> encoderBank;
             daisy::OledDisplay<daisy::SSD130xI2c64x32Driver>
                 display;
-            daisy::MidiUartHandler midi;
+            daisy::MidiUartTransport midi;
+
+            /**
+             * MIDI messages received over the TRS input, for
+             * the MIDI Signals. If it is set, the queue is cleared
+             * and refilled at the start of every block.
+             */
+            struct sig_midi_EventQueue* midiEvents = NULL;
             struct sig_host_HardwareInterface hardware;
 
         void Init(struct sig_AudioSettings* audioSettings,
@@ -123,12 +130,13 @@ namespace bluemchen {
         }
 
         void InitMidi() {
-            daisy::MidiUartHandler::Config config;
+            daisy::MidiUartTransport::Config config;
             midi.Init(config);
         }
 
         void Start(daisy::AudioHandle::AudioCallback callback) {
             adcController.Start();
+            midi.StartRx();
             board.audio.Start(callback);
         }
 
@@ -137,10 +145,26 @@ namespace bluemchen {
             board.audio.Stop();
         }
 
+        inline void ReadMidi() {
+            if (midiEvents == NULL) {
+                return;
+            }
+
+            // The UART doesn't timestamp the bytes it receives,
+            // so everything that arrived during the previous block
+            // takes effect at the start of this one.
+            sig_midi_EventQueue_clear(midiEvents);
+            while (midi.Readable() > 0) {
+                uint8_t byte = midi.Rx();
+                sig_midi_EventQueue_writeBytes(midiEvents, &byte, 1, 0);
+            }
+        }
+
         inline void Read() {
             adcController.Read();
             buttonBank.Read();
             encoderBank.Read();
+            ReadMidi();
         }
 
         inline void Write() {}
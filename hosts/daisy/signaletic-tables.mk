@@ -0,0 +1,30 @@
+# Generates Signaletic's precomputed lookup tables (libsignaletic-tables.c
+# and .h) using the build machine's compiler, and links them into
+# the firmware so that they are stored in flash instead of being
+# built in RAM at startup. Patches must register them by calling
+# sig_tables_provide(context->tables, &allocator) before creating
+# any Signals.
+#
+# Include this file after setting TARGET, but before libDaisy's Makefile.
+
+SIGNALETIC_TABLES_DIR = build/tables
+SIGNALETIC_TABLE_GENERATOR_SOURCE = $(dir $(lastword $(MAKEFILE_LIST)))../../libsignaletic/tools/table-generator/src/generate-tables.c
+SIGNALETIC_TABLE_GENERATOR = $(SIGNALETIC_TABLES_DIR)/signaletic-table-generator
+HOST_CC ?= cc
+
+C_SOURCES += $(SIGNALETIC_TABLES_DIR)/libsignaletic-tables.c
+C_INCLUDES += -I$(SIGNALETIC_TABLES_DIR)
+
+# Keep libDaisy's all target as the default.
+.DEFAULT_GOAL := all
+
+$(SIGNALETIC_TABLE_GENERATOR): $(SIGNALETIC_TABLE_GENERATOR_SOURCE)
+	mkdir -p $(SIGNALETIC_TABLES_DIR)
+	$(HOST_CC) -std=c11 -O2 -o $@ $< -lm
+
+$(SIGNALETIC_TABLES_DIR)/libsignaletic-tables.c: $(SIGNALETIC_TABLE_GENERATOR)
+	$(SIGNALETIC_TABLE_GENERATOR) $@ $(SIGNALETIC_TABLES_DIR)/libsignaletic-tables.h
+
+$(SIGNALETIC_TABLES_DIR)/libsignaletic-tables.h: $(SIGNALETIC_TABLES_DIR)/libsignaletic-tables.c
+
+build/$(TARGET).o: $(SIGNALETIC_TABLES_DIR)/libsignaletic-tables.h
@@ -0,0 +1,197 @@
+/*! \file signaletic-linux-oscillator.c
+    \brief The bluemchen oscillator example, running on the Linux host.
+
+    Knobs 1 and 2 (ADC channels 0 and 1) set the coarse and fine
+    frequency, and CV input 1 (ADC channel 2) adds V/Oct CV.
+    The frequency that would have been shown on the bluemchen's display
+    is read from a Telemetry Signal and printed when the run finishes,
+    along with the host's timing statistics.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <libsignaletic.h>
+#include <signaletic-linux-host.h>
+
+#define HEAP_SIZE 1024 * 256 // 256KB
+#define MAX_NUM_SIGNALS 32
+#define DISPLAY_REPORTS_PER_SEC 30.0f
+// There's no display loop to read reports while the patch is running,
+// so the Telemetry queue holds a couple of minutes of them.
+#define MAX_NUM_REPORTS 4096
+
+enum {
+    sig_host_KNOB_1 = 0,
+    sig_host_KNOB_2
+};
+
+enum {
+    sig_host_CV_IN_1 = 2,
+    sig_host_CV_IN_2
+};
+
+enum {
+    sig_host_AUDIO_OUT_1 = 0,
+    sig_host_AUDIO_OUT_2
+};
+
+uint8_t memory[HEAP_SIZE];
+struct sig_AllocatorHeap heap = {
+    .length = HEAP_SIZE,
+    .memory = (void*) memory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &heap
+};
+
+struct sig_host_linux_Config config = {
+    .numAudioInputChannels = 2,
+    .numAudioOutputChannels = 2,
+    .numADCChannels = 4,
+    .numDACChannels = 0,
+    .numGateInputs = 0,
+    .numGPIOOutputs = 0,
+    .numToggles = 1,
+    .numTriSwitches = 0,
+    .numEncoders = 1
+};
+
+struct sig_dsp_Signal* listStorage[MAX_NUM_SIGNALS];
+struct sig_List signals;
+struct sig_dsp_SignalListEvaluator* evaluator;
+
+struct sig_host_linux_Host host;
+
+struct sig_host_FilteredCVIn* coarseFreqKnob;
+struct sig_host_FilteredCVIn* fineFreqKnob;
+struct sig_host_CVIn* vOctCVIn;
+struct sig_dsp_BinaryOp* coarsePlusVOct;
+struct sig_dsp_BinaryOp* coarseVOctPlusFine;
+struct sig_dsp_LinearToFreq* frequency;
+struct sig_dsp_Telemetry* frequencyTelemetry;
+struct sig_dsp_Oscillator* osc;
+struct sig_dsp_ConstantValue* gainLevel;
+struct sig_dsp_BinaryOp* gain;
+struct sig_host_AudioOut* leftOut;
+struct sig_host_AudioOut* rightOut;
+
+void buildSignalGraph(struct sig_SignalContext* context,
+     struct sig_Status* status) {
+    /** Frequency controls **/
+    coarseFreqKnob = sig_host_FilteredCVIn_new(&allocator, context);
+    coarseFreqKnob->hardware = &host.hardware;
+    sig_List_append(&signals, coarseFreqKnob, status);
+    coarseFreqKnob->parameters.control = sig_host_KNOB_1;
+    coarseFreqKnob->parameters.scale = 17.27f; // Nearly 20 KHz
+    coarseFreqKnob->parameters.offset = -11.0f; // 0.1 Hz
+    coarseFreqKnob->parameters.time = 0.01f;
+
+    fineFreqKnob = sig_host_FilteredCVIn_new(&allocator, context);
+    fineFreqKnob->hardware = &host.hardware;
+    sig_List_append(&signals, fineFreqKnob, status);
+    fineFreqKnob->parameters.control = sig_host_KNOB_2;
+    // Fine frequency knob range is scaled to +/- 1 semitone
+    fineFreqKnob->parameters.scale = 2.0f/12.0f;
+    fineFreqKnob->parameters.offset = -(1.0f/12.0f);
+    fineFreqKnob->parameters.time = 0.01f;
+
+    vOctCVIn = sig_host_CVIn_new(&allocator, context);
+    vOctCVIn->hardware = &host.hardware;
+    sig_List_append(&signals, vOctCVIn, status);
+    vOctCVIn->parameters.control = sig_host_CV_IN_1;
+    vOctCVIn->parameters.scale = 5.0f;
+
+    coarsePlusVOct = sig_dsp_Add_new(&allocator, context);
+    sig_List_append(&signals, coarsePlusVOct, status);
+    coarsePlusVOct->inputs.left = coarseFreqKnob->outputs.main;
+    coarsePlusVOct->inputs.right = vOctCVIn->outputs.main;
+
+    coarseVOctPlusFine = sig_dsp_Add_new(&allocator, context);
+    sig_List_append(&signals, coarseVOctPlusFine, status);
+    coarseVOctPlusFine->inputs.left = coarsePlusVOct->outputs.main;
+    coarseVOctPlusFine->inputs.right = fineFreqKnob->outputs.main;
+
+    frequency = sig_dsp_LinearToFreq_new(&allocator, context);
+    sig_List_append(&signals, frequency, status);
+    frequency->inputs.source = coarseVOctPlusFine->outputs.main;
+
+    frequencyTelemetry = sig_dsp_Telemetry_new(&allocator, context,
+        MAX_NUM_REPORTS);
+    sig_List_append(&signals, frequencyTelemetry, status);
+    frequencyTelemetry->inputs.source = frequency->outputs.main;
+    frequencyTelemetry->parameters.mode = sig_dsp_Telemetry_Mode_LAST;
+    frequencyTelemetry->parameters.blocksPerReport =
+        context->audioSettings->sampleRate /
+        (context->audioSettings->blockSize * DISPLAY_REPORTS_PER_SEC);
+
+    osc = sig_dsp_SineOscillator_new(&allocator, context);
+    sig_List_append(&signals, osc, status);
+    osc->inputs.freq = frequency->outputs.main;
+
+    /** Gain **/
+    // Matches the gain used on the bluemchen,
+    // so that recordings can be compared.
+    gainLevel = sig_dsp_ConstantValue_new(&allocator, context, 0.70f);
+
+    gain = sig_dsp_Mul_new(&allocator, context);
+    sig_List_append(&signals, gain, status);
+    gain->inputs.left = osc->outputs.main;
+    gain->inputs.right = gainLevel->outputs.main;
+
+    leftOut = sig_host_AudioOut_new(&allocator, context);
+    leftOut->hardware = &host.hardware;
+    leftOut->parameters.channel = sig_host_AUDIO_OUT_1;
+    leftOut->inputs.source = gain->outputs.main;
+    sig_List_append(&signals, leftOut, status);
+
+    rightOut = sig_host_AudioOut_new(&allocator, context);
+    rightOut->hardware = &host.hardware;
+    rightOut->parameters.channel = sig_host_AUDIO_OUT_2;
+    rightOut->inputs.source = gain->outputs.main;
+    sig_List_append(&signals, rightOut, status);
+}
+
+int main(int argc, char* argv[]) {
+    allocator.impl->init(&allocator);
+
+    struct sig_host_linux_Options options;
+    sig_host_linux_Options_init(&options);
+    options.sampleRate = 96000;
+    options.blockSize = 1;
+    if (!sig_host_linux_Options_parse(&options, argc, argv)) {
+        return EXIT_FAILURE;
+    }
+
+    struct sig_AudioSettings audioSettings = {
+        .sampleRate = options.sampleRate,
+        .numChannels = 2,
+        .blockSize = options.blockSize
+    };
+
+    struct sig_Status status;
+    sig_Status_init(&status);
+    sig_List_init(&signals, (void**) &listStorage, MAX_NUM_SIGNALS);
+
+    evaluator = sig_dsp_SignalListEvaluator_new(&allocator, &signals);
+    bool isRunning = sig_host_linux_Host_init(&host, &config, &options,
+        &audioSettings, (struct sig_dsp_SignalEvaluator*) evaluator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    buildSignalGraph(context, &status);
+
+    isRunning = isRunning && sig_host_linux_Host_run(&host);
+    if (isRunning) {
+        float displayedFrequency = 0.0f;
+        sig_dsp_Telemetry_readLatest(frequencyTelemetry,
+            &displayedFrequency);
+        sig_host_linux_TimingStats_print(&host.stats, stdout);
+        printf("Frequency: %.1f Hz\n", displayedFrequency);
+    }
+
+    sig_host_linux_Host_destroy(&host);
+
+    return isRunning ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,266 @@
+/*! \file signaletic-linux-host.h
+    \brief A headless Host for running Signaletic patches natively
+    on Linux, for profiling and regression testing on workstations
+    and CI machines.
+
+    The Host implements sig_host_HardwareInterface using audio
+    that is either read from a WAV file or synthesized, control
+    inputs (ADCs, gates, toggles, switches and encoders) that are
+    driven by a script, and a thread that evaluates the signal graph
+    once per block, either on a realtime schedule with the period of
+    a hardware audio callback or as quickly as possible.
+    Audio and control outputs are written to files by the main thread,
+    so the audio thread never blocks on I/O.
+*/
+
+#ifndef SIGNALETIC_LINUX_HOST_H
+#define SIGNALETIC_LINUX_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <libsignaletic.h>
+#include <signaletic-host.h>
+
+#define sig_host_linux_NUM_QUEUED_BLOCKS 256
+
+/**
+ * @brief The number of each kind of hardware control that a patch
+ * expects, which usually match the device it was written for.
+ */
+struct sig_host_linux_Config {
+    size_t numAudioInputChannels;
+    size_t numAudioOutputChannels;
+    size_t numADCChannels;
+    size_t numDACChannels;
+    size_t numGateInputs;
+    size_t numGPIOOutputs;
+    size_t numToggles;
+    size_t numTriSwitches;
+    size_t numEncoders;
+};
+
+/**
+ * @brief Options that can be set from the command line
+ * by sig_host_linux_Options_parse.
+ */
+struct sig_host_linux_Options {
+    float sampleRate;
+    size_t blockSize;
+
+    /**
+     * @brief The number of seconds to run for.
+     */
+    float duration;
+
+    /**
+     * @brief A WAV file to read audio input from, or NULL
+     * to synthesize a sine wave at inputFrequency on every channel.
+     */
+    const char* inputPath;
+
+    /**
+     * @brief The frequency of the synthesized input, in Hz.
+     * A frequency of 0 produces silence.
+     */
+    float inputFrequency;
+
+    /**
+     * @brief A 32-bit float WAV file to write audio output to, or NULL.
+     */
+    const char* outputPath;
+
+    /**
+     * @brief A control script to read, or NULL.
+     */
+    const char* scriptPath;
+
+    /**
+     * @brief A CSV file to write the DAC and GPIO outputs
+     * of every block to, or NULL.
+     */
+    const char* controlOutputPath;
+
+    /**
+     * @brief If true, blocks are evaluated on a realtime thread
+     * at the rate of a hardware audio callback; otherwise, they are
+     * evaluated as quickly as possible.
+     */
+    bool isRealtime;
+};
+
+void sig_host_linux_Options_init(struct sig_host_linux_Options* self);
+
+/**
+ * @brief Parses command line options, printing usage information
+ * to stderr if they are invalid.
+ *
+ * @param self the options to update
+ * @param argc the number of arguments
+ * @param argv the arguments
+ * @return true if the options were valid
+ */
+bool sig_host_linux_Options_parse(struct sig_host_linux_Options* self,
+    int argc, char* argv[]);
+
+enum sig_host_linux_Control {
+    sig_host_linux_Control_ADC,
+    sig_host_linux_Control_GATE,
+    sig_host_linux_Control_TOGGLE,
+    sig_host_linux_Control_TRI_SWITCH,
+    sig_host_linux_Control_ENCODER
+};
+
+/**
+ * @brief A change to a control input, which takes effect
+ * at the start of a block.
+ *
+ * Encoder events are increments that last for a single block,
+ * as they do on hardware; all other controls hold their value
+ * until they are changed again.
+ */
+struct sig_host_linux_ScriptEvent {
+    size_t block;
+    enum sig_host_linux_Control control;
+    size_t index;
+    float value;
+};
+
+/**
+ * @brief A list of control changes, sorted by block.
+ *
+ * Scripts are text files with one event per line, in the form
+ * "<seconds> <adc|gate|toggle|triswitch|encoder> <index> <value>".
+ * Blank lines and lines starting with # are ignored.
+ */
+struct sig_host_linux_Script {
+    size_t length;
+    struct sig_host_linux_ScriptEvent* events;
+};
+
+/**
+ * @brief Reads a control script.
+ *
+ * @param self the script to read into
+ * @param path the path of the script file
+ * @param audioSettings the audio settings used to convert times
+ * to blocks
+ * @return true if the script was read successfully
+ */
+bool sig_host_linux_Script_read(struct sig_host_linux_Script* self,
+    const char* path, struct sig_AudioSettings* audioSettings);
+void sig_host_linux_Script_destroy(struct sig_host_linux_Script* self);
+
+/**
+ * @brief Timing measurements for every block the Host evaluated.
+ * All times are in nanoseconds.
+ *
+ * A block misses its deadline if it finishes more than one block
+ * period after it was scheduled to start. Jitter is the delay
+ * between when a block was scheduled to start and when it did;
+ * it is always zero when not running in realtime.
+ */
+struct sig_host_linux_TimingStats {
+    uint64_t periodNs;
+    size_t numBlocks;
+    size_t numDeadlineMisses;
+    size_t numDroppedBlocks;
+    uint64_t totalCallbackNs;
+    uint64_t maxCallbackNs;
+    uint64_t totalJitterNs;
+    uint64_t maxJitterNs;
+};
+
+void sig_host_linux_TimingStats_init(
+    struct sig_host_linux_TimingStats* self, uint64_t periodNs);
+void sig_host_linux_TimingStats_record(
+    struct sig_host_linux_TimingStats* self, uint64_t jitterNs,
+    uint64_t callbackNs);
+void sig_host_linux_TimingStats_print(
+    struct sig_host_linux_TimingStats* self, FILE* file);
+
+struct sig_host_linux_Host {
+    struct sig_host_HardwareInterface hardware;
+    struct sig_host_linux_Options options;
+    struct sig_AudioSettings* audioSettings;
+    struct sig_host_linux_Script script;
+    struct sig_host_linux_TimingStats stats;
+
+    // Whether the audio thread was given a realtime scheduling policy.
+    bool isRealtimeScheduled;
+
+    size_t numBlocks;
+    size_t nextScriptEvent;
+
+    // The input, which is read entirely into memory ahead of time,
+    // as interleaved frames.
+    float* inputSamples;
+    size_t inputNumFrames;
+    size_t inputNumChannels;
+    size_t inputFrame;
+    float inputPhase;
+
+    // Each evaluated block is copied into a single queue item,
+    // consisting of its block number, followed by its interleaved
+    // audio output frames, the DAC values and then the GPIO values.
+    // The block number lets the writer fill in any blocks
+    // that were dropped.
+    // The queue has its own heap, so that it doesn't take up
+    // memory that a patch written for hardware expects to have.
+    void* queueMemory;
+    struct sig_AllocatorHeap queueHeap;
+    struct sig_Allocator queueAllocator;
+    struct sig_RingBuffer* outputQueue;
+    size_t outputItemLength;
+    uint8_t* evaluatedItem;
+    uint8_t* writtenItem;
+
+    // The number of blocks the audio thread has finished with,
+    // which tells the main thread when to stop writing output.
+    sig_AtomicSize numBlocksEvaluated;
+
+    // The block that the main thread will write next.
+    size_t nextBlockToWrite;
+
+    FILE* outputFile;
+    size_t outputNumFrames;
+    FILE* controlOutputFile;
+};
+
+/**
+ * @brief Initializes a Host and registers it as the global
+ * hardware interface. The Host's hardware interface should be
+ * connected to the Signals of a patch before it is run.
+ *
+ * @param self the Host
+ * @param config the number of each kind of control
+ * @param options the Host's options
+ * @param audioSettings the audio settings of the patch
+ * @param evaluator the evaluator for the patch's signal graph
+ * @return true if the Host's input and output files were opened
+ */
+bool sig_host_linux_Host_init(struct sig_host_linux_Host* self,
+    struct sig_host_linux_Config* config,
+    struct sig_host_linux_Options* options,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_SignalEvaluator* evaluator);
+
+/**
+ * @brief Evaluates the patch for the Host's duration,
+ * writing its output to files as it runs.
+ *
+ * @param self the Host
+ * @return true if all the Host's output was written
+ */
+bool sig_host_linux_Host_run(struct sig_host_linux_Host* self);
+void sig_host_linux_Host_destroy(struct sig_host_linux_Host* self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIGNALETIC_LINUX_HOST_H */
@@ -0,0 +1,31 @@
+# Shared rules for building Signaletic patches for the Linux host.
+# Examples set TARGET, then include this file.
+
+HOST_DIR := $(dir $(lastword $(MAKEFILE_LIST)))
+LIBSIGNALETIC_DIR = $(HOST_DIR)../../libsignaletic
+DAISY_HOST_DIR = $(HOST_DIR)../daisy
+BUILD_DIR ?= build
+
+CC ?= cc
+OPT ?= -O3
+CFLAGS += -std=gnu11 $(OPT) -Wall
+CFLAGS += -I$(LIBSIGNALETIC_DIR)/include -I$(LIBSIGNALETIC_DIR)/vendor/tlsf
+CFLAGS += -I$(HOST_DIR)include -I$(DAISY_HOST_DIR)/include
+LDLIBS += -lm -lpthread
+
+C_SOURCES += $(LIBSIGNALETIC_DIR)/vendor/tlsf/tlsf.c
+C_SOURCES += $(LIBSIGNALETIC_DIR)/src/libsignaletic.c
+C_SOURCES += $(DAISY_HOST_DIR)/src/signaletic-host.c
+C_SOURCES += $(HOST_DIR)src/signaletic-linux-host.c
+C_SOURCES += src/$(TARGET).c
+
+all: $(BUILD_DIR)/$(TARGET)
+
+$(BUILD_DIR)/$(TARGET): $(C_SOURCES) $(wildcard $(HOST_DIR)include/*.h)
+	mkdir -p $(BUILD_DIR)
+	$(CC) $(CFLAGS) -o $@ $(C_SOURCES) $(LDFLAGS) $(LDLIBS)
+
+clean:
+	rm -rf $(BUILD_DIR)
+
+.PHONY: all clean
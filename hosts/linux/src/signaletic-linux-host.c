@@ -0,0 +1,946 @@
+#include <errno.h>
+#include <getopt.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include "../include/signaletic-linux-host.h"
+
+#define sig_host_linux_MAX_SCRIPT_LINE_LENGTH 256
+#define sig_host_linux_WAV_HEADER_LENGTH 44
+#define sig_host_linux_WRITER_SLEEP_NS 1000000
+#define sig_host_linux_ITEM_HEADER_SIZE sizeof(size_t)
+
+static const struct option sig_host_linux_longOptions[] = {
+    {"sample-rate", required_argument, NULL, 'r'},
+    {"block-size", required_argument, NULL, 'b'},
+    {"duration", required_argument, NULL, 'd'},
+    {"input", required_argument, NULL, 'i'},
+    {"input-frequency", required_argument, NULL, 'f'},
+    {"output", required_argument, NULL, 'o'},
+    {"script", required_argument, NULL, 's'},
+    {"control-output", required_argument, NULL, 'c'},
+    {"realtime", no_argument, NULL, 'R'},
+    {"help", no_argument, NULL, 'h'},
+    {NULL, 0, NULL, 0}
+};
+
+void sig_host_linux_Options_init(struct sig_host_linux_Options* self) {
+    self->sampleRate = 48000.0f;
+    self->blockSize = 48;
+    self->duration = 10.0f;
+    self->inputPath = NULL;
+    self->inputFrequency = 0.0f;
+    self->outputPath = NULL;
+    self->scriptPath = NULL;
+    self->controlOutputPath = NULL;
+    self->isRealtime = false;
+}
+
+static void sig_host_linux_Options_printUsage(const char* command) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -r, --sample-rate HZ       the sample rate\n"
+        "  -b, --block-size FRAMES    the number of frames per block\n"
+        "  -d, --duration SECONDS     how long to run for\n"
+        "  -i, --input FILE           a WAV file to use as audio input\n"
+        "  -f, --input-frequency HZ   the frequency of a sine wave\n"
+        "                             to use as audio input instead\n"
+        "  -o, --output FILE          a WAV file to write audio output to\n"
+        "  -s, --script FILE          a script of control changes\n"
+        "  -c, --control-output FILE  a CSV file to write DAC and GPIO\n"
+        "                             outputs to\n"
+        "  -R, --realtime             run on a realtime schedule instead\n"
+        "                             of as quickly as possible\n"
+        "  -h, --help                 print this message\n",
+        command);
+}
+
+static bool sig_host_linux_parseFloat(const char* arg, float* value) {
+    char* end;
+    errno = 0;
+    float parsed = strtof(arg, &end);
+    if (errno != 0 || end == arg || *end != '\0' || !(parsed >= 0.0f)) {
+        return false;
+    }
+
+    *value = parsed;
+    return true;
+}
+
+bool sig_host_linux_Options_parse(struct sig_host_linux_Options* self,
+    int argc, char* argv[]) {
+    float value;
+    int option;
+    bool isValid = true;
+
+    optind = 1;
+    while ((option = getopt_long(argc, argv, "r:b:d:i:f:o:s:c:Rh",
+        sig_host_linux_longOptions, NULL)) != -1) {
+        if (option == 'r' && sig_host_linux_parseFloat(optarg, &value) &&
+            value > 0.0f) {
+            self->sampleRate = value;
+        } else if (option == 'b' &&
+            sig_host_linux_parseFloat(optarg, &value) && value >= 1.0f) {
+            self->blockSize = (size_t) value;
+        } else if (option == 'd' &&
+            sig_host_linux_parseFloat(optarg, &value)) {
+            self->duration = value;
+        } else if (option == 'i') {
+            self->inputPath = optarg;
+        } else if (option == 'f' &&
+            sig_host_linux_parseFloat(optarg, &value)) {
+            self->inputFrequency = value;
+        } else if (option == 'o') {
+            self->outputPath = optarg;
+        } else if (option == 's') {
+            self->scriptPath = optarg;
+        } else if (option == 'c') {
+            self->controlOutputPath = optarg;
+        } else if (option == 'R') {
+            self->isRealtime = true;
+        } else {
+            isValid = false;
+            break;
+        }
+    }
+
+    if (!isValid || optind < argc) {
+        sig_host_linux_Options_printUsage(argv[0]);
+        return false;
+    }
+
+    return true;
+}
+
+
+static bool sig_host_linux_parseControl(const char* name,
+    enum sig_host_linux_Control* control) {
+    if (strcmp(name, "adc") == 0) {
+        *control = sig_host_linux_Control_ADC;
+    } else if (strcmp(name, "gate") == 0) {
+        *control = sig_host_linux_Control_GATE;
+    } else if (strcmp(name, "toggle") == 0) {
+        *control = sig_host_linux_Control_TOGGLE;
+    } else if (strcmp(name, "triswitch") == 0) {
+        *control = sig_host_linux_Control_TRI_SWITCH;
+    } else if (strcmp(name, "encoder") == 0) {
+        *control = sig_host_linux_Control_ENCODER;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool sig_host_linux_Script_read(struct sig_host_linux_Script* self,
+    const char* path, struct sig_AudioSettings* audioSettings) {
+    self->length = 0;
+    self->events = NULL;
+
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Couldn't open the script %s: %s\n", path,
+            strerror(errno));
+        return false;
+    }
+
+    char line[sig_host_linux_MAX_SCRIPT_LINE_LENGTH];
+    size_t capacity = 0;
+    size_t lineNumber = 0;
+    bool isValid = true;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+
+        char* start = line + strspn(line, " \t");
+        if (*start == '#' || *start == '\n' || *start == '\0') {
+            continue;
+        }
+
+        float time;
+        char controlName[16];
+        size_t index;
+        float value;
+        struct sig_host_linux_ScriptEvent event;
+        if (sscanf(start, "%f %15s %zu %f", &time, controlName, &index,
+            &value) != 4 || time < 0.0f ||
+            !sig_host_linux_parseControl(controlName, &event.control)) {
+            fprintf(stderr, "%s:%zu: Expected "
+                "<seconds> <adc|gate|toggle|triswitch|encoder> "
+                "<index> <value>\n", path, lineNumber);
+            isValid = false;
+            break;
+        }
+
+        event.block = (size_t) (time * audioSettings->sampleRate /
+            (float) audioSettings->blockSize);
+        event.index = index;
+        event.value = value;
+
+        if (self->length == capacity) {
+            capacity = capacity == 0 ? 64 : capacity * 2;
+            self->events = (struct sig_host_linux_ScriptEvent*) realloc(
+                self->events, capacity * sizeof(*self->events));
+        }
+
+        // Keep events sorted by block, but otherwise
+        // in the order they were written.
+        size_t i = self->length;
+        while (i > 0 && self->events[i - 1].block > event.block) {
+            self->events[i] = self->events[i - 1];
+            i--;
+        }
+        self->events[i] = event;
+        self->length++;
+    }
+
+    fclose(file);
+
+    return isValid;
+}
+
+void sig_host_linux_Script_destroy(struct sig_host_linux_Script* self) {
+    free(self->events);
+    self->events = NULL;
+    self->length = 0;
+}
+
+
+void sig_host_linux_TimingStats_init(
+    struct sig_host_linux_TimingStats* self, uint64_t periodNs) {
+    self->periodNs = periodNs;
+    self->numBlocks = 0;
+    self->numDeadlineMisses = 0;
+    self->numDroppedBlocks = 0;
+    self->totalCallbackNs = 0;
+    self->maxCallbackNs = 0;
+    self->totalJitterNs = 0;
+    self->maxJitterNs = 0;
+}
+
+void sig_host_linux_TimingStats_record(
+    struct sig_host_linux_TimingStats* self, uint64_t jitterNs,
+    uint64_t callbackNs) {
+    self->numBlocks++;
+    self->totalCallbackNs += callbackNs;
+    self->totalJitterNs += jitterNs;
+
+    if (callbackNs > self->maxCallbackNs) {
+        self->maxCallbackNs = callbackNs;
+    }
+
+    if (jitterNs > self->maxJitterNs) {
+        self->maxJitterNs = jitterNs;
+    }
+
+    if (jitterNs + callbackNs > self->periodNs) {
+        self->numDeadlineMisses++;
+    }
+}
+
+void sig_host_linux_TimingStats_print(
+    struct sig_host_linux_TimingStats* self, FILE* file) {
+    double numBlocks = self->numBlocks > 0 ? (double) self->numBlocks : 1.0;
+    double meanCallbackUs = (double) self->totalCallbackNs /
+        numBlocks / 1000.0;
+
+    fprintf(file, "Blocks: %zu (period %.3f us)\n", self->numBlocks,
+        (double) self->periodNs / 1000.0);
+    fprintf(file, "Callback: mean %.3f us, max %.3f us, "
+        "mean load %.1f%%\n", meanCallbackUs,
+        (double) self->maxCallbackNs / 1000.0,
+        100.0 * meanCallbackUs * 1000.0 / (double) self->periodNs);
+    fprintf(file, "Jitter: mean %.3f us, max %.3f us\n",
+        (double) self->totalJitterNs / numBlocks / 1000.0,
+        (double) self->maxJitterNs / 1000.0);
+    fprintf(file, "Deadline misses: %zu\n", self->numDeadlineMisses);
+    fprintf(file, "Dropped output blocks: %zu\n", self->numDroppedBlocks);
+}
+
+
+static uint16_t sig_host_linux_readUInt16(const uint8_t* bytes) {
+    return (uint16_t) (bytes[0] | (bytes[1] << 8));
+}
+
+static uint32_t sig_host_linux_readUInt32(const uint8_t* bytes) {
+    return (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8) |
+        ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+}
+
+static void sig_host_linux_writeUInt16(uint8_t* bytes, uint16_t value) {
+    bytes[0] = (uint8_t) (value & 0xFF);
+    bytes[1] = (uint8_t) (value >> 8);
+}
+
+static void sig_host_linux_writeUInt32(uint8_t* bytes, uint32_t value) {
+    for (size_t i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t) ((value >> (i * 8)) & 0xFF);
+    }
+}
+
+// Converts the samples of a WAV data chunk to floats.
+// 16 and 24 bit integer and 32 bit float samples are supported.
+static bool sig_host_linux_convertWAVSamples(const uint8_t* data,
+    size_t numSamples, uint16_t format, uint16_t bitsPerSample,
+    float* samples) {
+    if (format == 1 && bitsPerSample == 16) {
+        for (size_t i = 0; i < numSamples; i++) {
+            int16_t sample = (int16_t) sig_host_linux_readUInt16(
+                data + i * 2);
+            samples[i] = (float) sample / 32768.0f;
+        }
+    } else if (format == 1 && bitsPerSample == 24) {
+        for (size_t i = 0; i < numSamples; i++) {
+            const uint8_t* bytes = data + i * 3;
+            int32_t sample = (int32_t) ((uint32_t) bytes[0] << 8 |
+                (uint32_t) bytes[1] << 16 | (uint32_t) bytes[2] << 24) >> 8;
+            samples[i] = (float) sample / 8388608.0f;
+        }
+    } else if (format == 3 && bitsPerSample == 32) {
+        for (size_t i = 0; i < numSamples; i++) {
+            uint32_t bits = sig_host_linux_readUInt32(data + i * 4);
+            memcpy(&samples[i], &bits, sizeof(float));
+        }
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+static bool sig_host_linux_Host_readInput(struct sig_host_linux_Host* self,
+    const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Couldn't open the input %s: %s\n", path,
+            strerror(errno));
+        return false;
+    }
+
+    uint8_t header[12];
+    uint8_t chunkHeader[8];
+    uint8_t fmt[40];
+    uint16_t format = 0;
+    uint16_t numChannels = 0;
+    uint32_t sampleRate = 0;
+    uint16_t bitsPerSample = 0;
+    bool isValid = fread(header, 1, sizeof(header), file) ==
+        sizeof(header) && memcmp(header, "RIFF", 4) == 0 &&
+        memcmp(header + 8, "WAVE", 4) == 0;
+
+    while (isValid && fread(chunkHeader, 1, sizeof(chunkHeader), file) ==
+        sizeof(chunkHeader)) {
+        uint32_t chunkLength = sig_host_linux_readUInt32(chunkHeader + 4);
+        // Chunks are padded to an even number of bytes.
+        long paddedLength = (long) chunkLength + (long) (chunkLength & 1);
+
+        if (memcmp(chunkHeader, "fmt ", 4) == 0 && chunkLength >= 16 &&
+            chunkLength <= sizeof(fmt)) {
+            isValid = fread(fmt, 1, chunkLength, file) == chunkLength &&
+                fseek(file, paddedLength - (long) chunkLength,
+                    SEEK_CUR) == 0;
+            format = sig_host_linux_readUInt16(fmt);
+            numChannels = sig_host_linux_readUInt16(fmt + 2);
+            sampleRate = sig_host_linux_readUInt32(fmt + 4);
+            bitsPerSample = sig_host_linux_readUInt16(fmt + 14);
+
+            // WAVE_FORMAT_EXTENSIBLE stores the real format
+            // at the start of its sub format GUID.
+            if (format == 0xFFFE && chunkLength >= 26) {
+                format = sig_host_linux_readUInt16(fmt + 24);
+            }
+        } else if (memcmp(chunkHeader, "data", 4) == 0 && numChannels > 0) {
+            // Check the sample size before it's divided by.
+            if (bitsPerSample != 16 && bitsPerSample != 24 &&
+                bitsPerSample != 32) {
+                isValid = false;
+                break;
+            }
+
+            size_t bytesPerSample = bitsPerSample / 8;
+            size_t numSamples = chunkLength / bytesPerSample;
+            uint8_t* data = (uint8_t*) malloc(chunkLength);
+            self->inputSamples = (float*) malloc(
+                (numSamples > 0 ? numSamples : 1) * sizeof(float));
+            isValid = fread(data, 1, chunkLength, file) == chunkLength &&
+                sig_host_linux_convertWAVSamples(data, numSamples, format,
+                    bitsPerSample, self->inputSamples);
+            free(data);
+
+            self->inputNumChannels = numChannels;
+            self->inputNumFrames = numSamples / numChannels;
+            break;
+        } else {
+            isValid = fseek(file, paddedLength, SEEK_CUR) == 0;
+        }
+    }
+
+    fclose(file);
+
+    if (!isValid || self->inputNumChannels == 0) {
+        fprintf(stderr, "Couldn't read the input %s: only 16 or 24 bit "
+            "integer and 32 bit float WAV files are supported.\n", path);
+        return false;
+    }
+
+    if ((float) sampleRate != self->audioSettings->sampleRate) {
+        fprintf(stderr, "Warning: the input %s has a sample rate of %u Hz,"
+            " but the patch is running at %g Hz.\n", path, sampleRate,
+            self->audioSettings->sampleRate);
+    }
+
+    return true;
+}
+
+// Writes the header of a 32 bit float WAV file.
+// The lengths in the header are updated when the file is closed.
+static bool sig_host_linux_writeWAVHeader(FILE* file, size_t numChannels,
+    float sampleRate, size_t numFrames) {
+    uint8_t header[sig_host_linux_WAV_HEADER_LENGTH];
+    uint32_t blockAlign = (uint32_t) (numChannels * sizeof(float));
+    uint32_t dataLength = (uint32_t) (numFrames * blockAlign);
+
+    memcpy(header, "RIFF", 4);
+    sig_host_linux_writeUInt32(header + 4, 36 + dataLength);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    sig_host_linux_writeUInt32(header + 16, 16);
+    sig_host_linux_writeUInt16(header + 20, 3);
+    sig_host_linux_writeUInt16(header + 22, (uint16_t) numChannels);
+    sig_host_linux_writeUInt32(header + 24, (uint32_t) sampleRate);
+    sig_host_linux_writeUInt32(header + 28,
+        (uint32_t) sampleRate * blockAlign);
+    sig_host_linux_writeUInt16(header + 32, (uint16_t) blockAlign);
+    sig_host_linux_writeUInt16(header + 34, 32);
+    memcpy(header + 36, "data", 4);
+    sig_host_linux_writeUInt32(header + 40, dataLength);
+
+    return fwrite(header, 1, sizeof(header), file) == sizeof(header);
+}
+
+static float** sig_host_linux_newChannels(size_t numChannels,
+    size_t blockSize) {
+    float** channels = (float**) calloc(numChannels > 0 ? numChannels : 1,
+        sizeof(float*));
+    for (size_t i = 0; i < numChannels; i++) {
+        channels[i] = (float*) calloc(blockSize, sizeof(float));
+    }
+
+    return channels;
+}
+
+static void sig_host_linux_destroyChannels(float** channels,
+    size_t numChannels) {
+    if (channels == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < numChannels; i++) {
+        free(channels[i]);
+    }
+    free(channels);
+}
+
+static float* sig_host_linux_newControls(size_t numControls) {
+    return (float*) calloc(numControls > 0 ? numControls : 1,
+        sizeof(float));
+}
+
+static bool sig_host_linux_Host_validateScript(
+    struct sig_host_linux_Host* self) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+    size_t numControls[] = {
+        hardware->numADCChannels,
+        hardware->numGateInputs,
+        hardware->numToggles,
+        hardware->numTriSwitches,
+        hardware->numEncoders
+    };
+
+    for (size_t i = 0; i < self->script.length; i++) {
+        struct sig_host_linux_ScriptEvent* event = &self->script.events[i];
+        if (event->index >= numControls[event->control]) {
+            fprintf(stderr, "The script refers to control %zu, "
+                "but the patch only has %zu of that kind.\n",
+                event->index, numControls[event->control]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool sig_host_linux_Host_openOutputs(
+    struct sig_host_linux_Host* self) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+
+    if (self->options.outputPath != NULL) {
+        self->outputFile = fopen(self->options.outputPath, "wb");
+        if (self->outputFile == NULL ||
+            !sig_host_linux_writeWAVHeader(self->outputFile,
+                hardware->numAudioOutputChannels,
+                self->audioSettings->sampleRate, 0)) {
+            fprintf(stderr, "Couldn't open the output %s: %s\n",
+                self->options.outputPath, strerror(errno));
+            return false;
+        }
+    }
+
+    if (self->options.controlOutputPath != NULL) {
+        self->controlOutputFile = fopen(self->options.controlOutputPath,
+            "w");
+        if (self->controlOutputFile == NULL) {
+            fprintf(stderr, "Couldn't open the control output %s: %s\n",
+                self->options.controlOutputPath, strerror(errno));
+            return false;
+        }
+
+        fprintf(self->controlOutputFile, "block,time");
+        for (size_t i = 0; i < hardware->numDACChannels; i++) {
+            fprintf(self->controlOutputFile, ",dac%zu", i);
+        }
+        for (size_t i = 0; i < hardware->numGPIOOutputs; i++) {
+            fprintf(self->controlOutputFile, ",gpio%zu", i);
+        }
+        fprintf(self->controlOutputFile, "\n");
+    }
+
+    return true;
+}
+
+bool sig_host_linux_Host_init(struct sig_host_linux_Host* self,
+    struct sig_host_linux_Config* config,
+    struct sig_host_linux_Options* options,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_SignalEvaluator* evaluator) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+    size_t blockSize = audioSettings->blockSize;
+
+    memset(self, 0, sizeof(*self));
+    self->options = *options;
+    self->audioSettings = audioSettings;
+
+    hardware->evaluator = evaluator;
+    hardware->onEvaluateSignals = sig_host_noOpAudioEventCallback;
+    hardware->afterEvaluateSignals = sig_host_noOpAudioEventCallback;
+    hardware->userData = self;
+    hardware->numAudioInputChannels = config->numAudioInputChannels;
+    hardware->audioInputChannels = sig_host_linux_newChannels(
+        config->numAudioInputChannels, blockSize);
+    hardware->numAudioOutputChannels = config->numAudioOutputChannels;
+    hardware->audioOutputChannels = sig_host_linux_newChannels(
+        config->numAudioOutputChannels, blockSize);
+    hardware->numADCChannels = config->numADCChannels;
+    hardware->adcChannels = sig_host_linux_newControls(
+        config->numADCChannels);
+    hardware->numDACChannels = config->numDACChannels;
+    hardware->dacChannels = sig_host_linux_newControls(
+        config->numDACChannels);
+    hardware->numGateInputs = config->numGateInputs;
+    hardware->gateInputs = sig_host_linux_newControls(
+        config->numGateInputs);
+    hardware->numGPIOOutputs = config->numGPIOOutputs;
+    hardware->gpioOutputs = sig_host_linux_newControls(
+        config->numGPIOOutputs);
+    hardware->numToggles = config->numToggles;
+    hardware->toggles = sig_host_linux_newControls(config->numToggles);
+    hardware->numTriSwitches = config->numTriSwitches;
+    hardware->triSwitches = sig_host_linux_newControls(
+        config->numTriSwitches);
+    hardware->numEncoders = config->numEncoders;
+    hardware->encoders = sig_host_linux_newControls(config->numEncoders);
+    sig_host_registerGlobalHardwareInterface(hardware);
+
+    self->numBlocks = (size_t) ceilf(options->duration *
+        audioSettings->sampleRate / (float) blockSize);
+    sig_host_linux_TimingStats_init(&self->stats,
+        (uint64_t) ((double) blockSize * 1000000000.0 /
+            (double) audioSettings->sampleRate));
+    atomic_init(&self->numBlocksEvaluated, 0);
+
+    self->outputItemLength = blockSize * config->numAudioOutputChannels +
+        config->numDACChannels + config->numGPIOOutputs;
+    size_t itemSize = sig_host_linux_ITEM_HEADER_SIZE +
+        self->outputItemLength * sizeof(float);
+    self->evaluatedItem = (uint8_t*) calloc(1, itemSize);
+    self->writtenItem = (uint8_t*) calloc(1, itemSize);
+    self->nextBlockToWrite = 0;
+
+    // Leave room for the allocator's own bookkeeping.
+    size_t queueMemoryLength = sig_host_linux_NUM_QUEUED_BLOCKS *
+        itemSize + 64 * 1024;
+    self->queueMemory = malloc(queueMemoryLength);
+    self->queueHeap.length = queueMemoryLength;
+    self->queueHeap.memory = self->queueMemory;
+    self->queueAllocator.impl = &sig_TLSFAllocatorImpl;
+    self->queueAllocator.heap = &self->queueHeap;
+    self->queueAllocator.impl->init(&self->queueAllocator);
+    self->outputQueue = sig_RingBuffer_new(&self->queueAllocator,
+        sig_host_linux_NUM_QUEUED_BLOCKS, itemSize);
+
+    if (options->scriptPath != NULL &&
+        (!sig_host_linux_Script_read(&self->script, options->scriptPath,
+            audioSettings) || !sig_host_linux_Host_validateScript(self))) {
+        return false;
+    }
+
+    if (options->inputPath != NULL &&
+        !sig_host_linux_Host_readInput(self, options->inputPath)) {
+        return false;
+    }
+
+    return sig_host_linux_Host_openOutputs(self);
+}
+
+static void sig_host_linux_Host_applyScript(
+    struct sig_host_linux_Host* self, size_t block) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+
+    while (self->nextScriptEvent < self->script.length &&
+        self->script.events[self->nextScriptEvent].block <= block) {
+        struct sig_host_linux_ScriptEvent* event =
+            &self->script.events[self->nextScriptEvent];
+
+        if (event->control == sig_host_linux_Control_ADC) {
+            hardware->adcChannels[event->index] = event->value;
+        } else if (event->control == sig_host_linux_Control_GATE) {
+            hardware->gateInputs[event->index] = event->value;
+        } else if (event->control == sig_host_linux_Control_TOGGLE) {
+            hardware->toggles[event->index] = event->value;
+        } else if (event->control == sig_host_linux_Control_TRI_SWITCH) {
+            hardware->triSwitches[event->index] = event->value;
+        } else {
+            hardware->encoders[event->index] += event->value;
+        }
+
+        self->nextScriptEvent++;
+    }
+}
+
+static void sig_host_linux_Host_fillInputs(
+    struct sig_host_linux_Host* self) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+    size_t blockSize = self->audioSettings->blockSize;
+    size_t numChannels = hardware->numAudioInputChannels;
+
+    if (numChannels == 0) {
+        return;
+    }
+
+    if (self->inputSamples != NULL) {
+        for (size_t c = 0; c < numChannels; c++) {
+            size_t fileChannel = c % self->inputNumChannels;
+            for (size_t i = 0; i < blockSize; i++) {
+                size_t frame = self->inputFrame + i;
+                hardware->audioInputChannels[c][i] =
+                    frame < self->inputNumFrames ?
+                    self->inputSamples[frame * self->inputNumChannels +
+                        fileChannel] : 0.0f;
+            }
+        }
+        self->inputFrame += blockSize;
+
+        return;
+    }
+
+    float phaseIncrement = sig_TWOPI * self->options.inputFrequency /
+        self->audioSettings->sampleRate;
+    float* first = hardware->audioInputChannels[0];
+    for (size_t i = 0; i < blockSize; i++) {
+        first[i] = phaseIncrement > 0.0f ? sinf(self->inputPhase) : 0.0f;
+        self->inputPhase += phaseIncrement;
+        if (self->inputPhase >= sig_TWOPI) {
+            self->inputPhase -= sig_TWOPI;
+        }
+    }
+
+    for (size_t c = 1; c < numChannels; c++) {
+        memcpy(hardware->audioInputChannels[c], first,
+            blockSize * sizeof(float));
+    }
+}
+
+static inline float* sig_host_linux_itemOutputs(uint8_t* item) {
+    return (float*) (item + sig_host_linux_ITEM_HEADER_SIZE);
+}
+
+// Evaluates a block in the same way as a hardware audio callback,
+// and copies its outputs into the next queue item.
+static void sig_host_linux_Host_evaluateBlock(
+    struct sig_host_linux_Host* self, size_t block) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+    size_t blockSize = self->audioSettings->blockSize;
+    size_t numOutputChannels = hardware->numAudioOutputChannels;
+
+    sig_host_linux_Host_applyScript(self, block);
+    sig_host_linux_Host_fillInputs(self);
+    for (size_t c = 0; c < numOutputChannels; c++) {
+        memset(hardware->audioOutputChannels[c], 0,
+            blockSize * sizeof(float));
+    }
+
+    hardware->onEvaluateSignals(blockSize, hardware);
+    hardware->evaluator->evaluate(hardware->evaluator);
+    hardware->afterEvaluateSignals(blockSize, hardware);
+
+    // Encoders report their increment for a single block.
+    memset(hardware->encoders, 0, hardware->numEncoders * sizeof(float));
+
+    memcpy(self->evaluatedItem, &block, sizeof(size_t));
+    float* item = sig_host_linux_itemOutputs(self->evaluatedItem);
+    for (size_t i = 0; i < blockSize; i++) {
+        for (size_t c = 0; c < numOutputChannels; c++) {
+            *item++ = hardware->audioOutputChannels[c][i];
+        }
+    }
+    memcpy(item, hardware->dacChannels,
+        hardware->numDACChannels * sizeof(float));
+    item += hardware->numDACChannels;
+    memcpy(item, hardware->gpioOutputs,
+        hardware->numGPIOOutputs * sizeof(float));
+}
+
+static uint64_t sig_host_linux_now() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+}
+
+static void sig_host_linux_sleepUntil(uint64_t timeNs) {
+    struct timespec time = {
+        .tv_sec = (time_t) (timeNs / 1000000000u),
+        .tv_nsec = (long) (timeNs % 1000000000u)
+    };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time,
+        NULL) == EINTR) {}
+}
+
+static void* sig_host_linux_Host_runAudioThread(void* host) {
+    struct sig_host_linux_Host* self = (struct sig_host_linux_Host*) host;
+    bool isRealtime = self->options.isRealtime;
+    uint64_t periodNs = self->stats.periodNs;
+    uint64_t scheduledNs = sig_host_linux_now() + periodNs;
+
+    for (size_t block = 0; block < self->numBlocks; block++) {
+        if (isRealtime) {
+            sig_host_linux_sleepUntil(scheduledNs);
+        }
+
+        uint64_t startNs = sig_host_linux_now();
+        sig_host_linux_Host_evaluateBlock(self, block);
+        uint64_t endNs = sig_host_linux_now();
+        uint64_t jitterNs = isRealtime && startNs > scheduledNs ?
+            startNs - scheduledNs : 0;
+        sig_host_linux_TimingStats_record(&self->stats, jitterNs,
+            endNs - startNs);
+
+        // Hardware can't wait for the writer, so blocks are dropped
+        // if it falls behind. Otherwise, there's no need to.
+        while (!sig_RingBuffer_push(self->outputQueue,
+            self->evaluatedItem)) {
+            if (isRealtime) {
+                self->stats.numDroppedBlocks++;
+                break;
+            }
+            sched_yield();
+        }
+
+        atomic_store_explicit(&self->numBlocksEvaluated, block + 1,
+            memory_order_release);
+        scheduledNs += periodNs;
+    }
+
+    return NULL;
+}
+
+static bool sig_host_linux_Host_startAudioThread(
+    struct sig_host_linux_Host* self, pthread_t* thread) {
+    self->isRealtimeScheduled = false;
+
+    if (self->options.isRealtime) {
+        pthread_attr_t attributes;
+        struct sched_param schedule = {
+            .sched_priority = sched_get_priority_max(SCHED_FIFO) - 10
+        };
+
+        // Avoid page faults in the audio thread, if we're allowed to.
+        mlockall(MCL_CURRENT | MCL_FUTURE);
+
+        pthread_attr_init(&attributes);
+        pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attributes, SCHED_FIFO);
+        pthread_attr_setschedparam(&attributes, &schedule);
+        self->isRealtimeScheduled = pthread_create(thread, &attributes,
+            sig_host_linux_Host_runAudioThread, self) == 0;
+        pthread_attr_destroy(&attributes);
+
+        if (self->isRealtimeScheduled) {
+            return true;
+        }
+
+        fprintf(stderr, "Warning: couldn't give the audio thread "
+            "realtime priority, so its timing will be less reliable.\n");
+    }
+
+    return pthread_create(thread, NULL, sig_host_linux_Host_runAudioThread,
+        self) == 0;
+}
+
+// Writes a block's outputs. Dropped blocks are written as silence,
+// with empty control values, so that the outputs stay in time.
+static bool sig_host_linux_Host_writeBlock(struct sig_host_linux_Host* self,
+    size_t block, bool isDropped) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+    size_t numAudioSamples = self->audioSettings->blockSize *
+        hardware->numAudioOutputChannels;
+    float* outputs = sig_host_linux_itemOutputs(self->writtenItem);
+    bool isWritten = true;
+
+    if (isDropped) {
+        memset(outputs, 0, self->outputItemLength * sizeof(float));
+    }
+
+    if (self->outputFile != NULL) {
+        isWritten = fwrite(outputs, sizeof(float),
+            numAudioSamples, self->outputFile) == numAudioSamples;
+        self->outputNumFrames += self->audioSettings->blockSize;
+    }
+
+    if (self->controlOutputFile != NULL) {
+        size_t numControls = hardware->numDACChannels +
+            hardware->numGPIOOutputs;
+        fprintf(self->controlOutputFile, "%zu,%.6f", block,
+            (double) block * (double) self->audioSettings->blockSize /
+            (double) self->audioSettings->sampleRate);
+        for (size_t i = 0; i < numControls; i++) {
+            if (isDropped) {
+                fprintf(self->controlOutputFile, ",");
+            } else {
+                fprintf(self->controlOutputFile, ",%g",
+                    outputs[numAudioSamples + i]);
+            }
+        }
+        fprintf(self->controlOutputFile, "\n");
+    }
+
+    return isWritten;
+}
+
+// Writes every dropped block before the given one.
+static bool sig_host_linux_Host_writeDroppedBlocks(
+    struct sig_host_linux_Host* self, size_t nextBlock) {
+    bool isWritten = true;
+
+    while (self->nextBlockToWrite < nextBlock) {
+        isWritten = sig_host_linux_Host_writeBlock(self,
+            self->nextBlockToWrite, true) && isWritten;
+        self->nextBlockToWrite++;
+    }
+
+    return isWritten;
+}
+
+// Writes the item that was just popped from the queue,
+// after any blocks that were dropped before it.
+static bool sig_host_linux_Host_writeItem(struct sig_host_linux_Host* self) {
+    size_t block;
+    memcpy(&block, self->writtenItem, sizeof(size_t));
+
+    bool isWritten = sig_host_linux_Host_writeDroppedBlocks(self, block);
+    isWritten = sig_host_linux_Host_writeBlock(self, block, false) &&
+        isWritten;
+    self->nextBlockToWrite = block + 1;
+
+    return isWritten;
+}
+
+static bool sig_host_linux_Host_closeOutputs(
+    struct sig_host_linux_Host* self) {
+    bool isClosed = true;
+
+    if (self->outputFile != NULL) {
+        isClosed = fseek(self->outputFile, 0, SEEK_SET) == 0 &&
+            sig_host_linux_writeWAVHeader(self->outputFile,
+                self->hardware.numAudioOutputChannels,
+                self->audioSettings->sampleRate, self->outputNumFrames);
+        isClosed = fclose(self->outputFile) == 0 && isClosed;
+        self->outputFile = NULL;
+    }
+
+    if (self->controlOutputFile != NULL) {
+        isClosed = fclose(self->controlOutputFile) == 0 && isClosed;
+        self->controlOutputFile = NULL;
+    }
+
+    return isClosed;
+}
+
+bool sig_host_linux_Host_run(struct sig_host_linux_Host* self) {
+    pthread_t audioThread;
+    if (!sig_host_linux_Host_startAudioThread(self, &audioThread)) {
+        fprintf(stderr, "Couldn't start the audio thread.\n");
+        return false;
+    }
+
+    const struct timespec writerSleep = {
+        .tv_sec = 0,
+        .tv_nsec = sig_host_linux_WRITER_SLEEP_NS
+    };
+    bool isWritten = true;
+
+    while (true) {
+        // Once every block has been evaluated,
+        // any that haven't been popped are already in the queue.
+        size_t numEvaluated = atomic_load_explicit(
+            &self->numBlocksEvaluated, memory_order_acquire);
+
+        if (sig_RingBuffer_pop(self->outputQueue, self->writtenItem)) {
+            isWritten = sig_host_linux_Host_writeItem(self) && isWritten;
+        } else if (numEvaluated == self->numBlocks) {
+            break;
+        } else {
+            nanosleep(&writerSleep, NULL);
+        }
+    }
+
+    pthread_join(audioThread, NULL);
+
+    // Fill in any blocks that were dropped at the end.
+    isWritten = sig_host_linux_Host_writeDroppedBlocks(self,
+        self->numBlocks) && isWritten;
+
+    if (!sig_host_linux_Host_closeOutputs(self) || !isWritten) {
+        fprintf(stderr, "Couldn't write all of the output.\n");
+        return false;
+    }
+
+    return true;
+}
+
+void sig_host_linux_Host_destroy(struct sig_host_linux_Host* self) {
+    struct sig_host_HardwareInterface* hardware = &self->hardware;
+
+    sig_host_linux_Host_closeOutputs(self);
+    sig_host_linux_Script_destroy(&self->script);
+    free(self->inputSamples);
+    free(self->evaluatedItem);
+    free(self->writtenItem);
+    free(self->queueMemory);
+
+    sig_host_linux_destroyChannels(hardware->audioInputChannels,
+        hardware->numAudioInputChannels);
+    sig_host_linux_destroyChannels(hardware->audioOutputChannels,
+        hardware->numAudioOutputChannels);
+    free(hardware->adcChannels);
+    free(hardware->dacChannels);
+    free(hardware->gateInputs);
+    free(hardware->gpioOutputs);
+    free(hardware->toggles);
+    free(hardware->triSwitches);
+    free(hardware->encoders);
+}
@@ -0,0 +1,192 @@
+/*! \file combbank-benchmark.c
+    \brief Compares the cost of the CombBank and AllpassChain Signals
+    to the graphs of Combs, Allpasses and Adds that they replace.
+
+    The graphs follow the structure of the Moorer and 1962a
+    reverb examples in hosts/daisy/examples/bluemchen/reverb.
+    Each fused Signal is expected to cost less than
+    MAX_RELATIVE_COST times as much as its graph.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 16
+#define DURATION_SECS 10.0f
+#define MAX_NUM_SIGNALS 64
+#define MAX_DELAY_SECS 0.1f
+#define NUM_COMBS 6
+#define NUM_ALLPASSES 5
+#define MAX_RELATIVE_COST 0.6
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+struct sig_dsp_Value* input;
+
+float combDelayTimes[] = {0.05f, 0.056f, 0.061f, 0.068f, 0.072f, 0.078f};
+float combLPFGains[] = {0.44f, 0.46f, 0.48f, 0.50f, 0.52f, 0.54f};
+float allpassDelayTimes[] = {0.1f, 0.068f, 0.06f, 0.0197f, 0.00585f};
+
+float_array_ptr newConstant(struct sig_SignalContext* context,
+    struct sig_List* signals, float value) {
+    struct sig_dsp_ConstantValue* constant = sig_dsp_ConstantValue_new(
+        &allocator, context, value);
+    sig_List_append(signals, constant, NULL);
+
+    return constant->outputs.main;
+}
+
+float_array_ptr buildCombGraph(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    float_array_ptr sum = NULL;
+
+    for (size_t i = 0; i < NUM_COMBS; i++) {
+        struct sig_dsp_Comb* comb = sig_dsp_Comb_new(&allocator, context);
+        comb->delayLine = sig_DelayLine_newSeconds(&allocator,
+            context->audioSettings, MAX_DELAY_SECS);
+        comb->inputs.source = input->outputs.main;
+        comb->inputs.delayTime = newConstant(context, signals,
+            combDelayTimes[i]);
+        comb->inputs.feedbackGain = newConstant(context, signals,
+            0.84f * (1.0f - combLPFGains[i]));
+        comb->inputs.lpfCoefficient = newConstant(context, signals,
+            combLPFGains[i]);
+        sig_List_append(signals, comb, NULL);
+
+        if (sum == NULL) {
+            sum = comb->outputs.main;
+        } else {
+            struct sig_dsp_BinaryOp* add = sig_dsp_Add_new(&allocator,
+                context);
+            add->inputs.left = sum;
+            add->inputs.right = comb->outputs.main;
+            sig_List_append(signals, add, NULL);
+            sum = add->outputs.main;
+        }
+    }
+
+    struct sig_dsp_BinaryOp* mix = sig_dsp_Mul_new(&allocator, context);
+    mix->inputs.left = sum;
+    mix->inputs.right = newConstant(context, signals, 1.0f / NUM_COMBS);
+    sig_List_append(signals, mix, NULL);
+
+    return mix->outputs.main;
+}
+
+float_array_ptr buildCombBank(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    struct sig_dsp_CombBank* bank = sig_dsp_CombBank_new(&allocator,
+        context, NUM_COMBS, MAX_DELAY_SECS);
+    bank->inputs.source = input->outputs.main;
+    for (size_t i = 0; i < NUM_COMBS; i++) {
+        bank->parameters.delayTimes[i] = combDelayTimes[i];
+        bank->parameters.feedbackGains[i] = 0.84f * (1.0f - combLPFGains[i]);
+        bank->parameters.lpfCoefficients[i] = combLPFGains[i];
+    }
+    sig_List_append(signals, bank, NULL);
+
+    return bank->outputs.main;
+}
+
+float_array_ptr buildAllpassGraph(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    float_array_ptr g = newConstant(context, signals, 0.7f);
+    float_array_ptr source = input->outputs.main;
+
+    for (size_t i = 0; i < NUM_ALLPASSES; i++) {
+        struct sig_dsp_Allpass* allpass = sig_dsp_Allpass_new(&allocator,
+            context);
+        allpass->delayLine = sig_DelayLine_newSeconds(&allocator,
+            context->audioSettings, MAX_DELAY_SECS + 0.01f);
+        allpass->inputs.source = source;
+        allpass->inputs.delayTime = newConstant(context, signals,
+            allpassDelayTimes[i]);
+        allpass->inputs.g = g;
+        sig_List_append(signals, allpass, NULL);
+        source = allpass->outputs.main;
+    }
+
+    return source;
+}
+
+float_array_ptr buildAllpassChain(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    struct sig_dsp_AllpassChain* chain = sig_dsp_AllpassChain_new(
+        &allocator, context, NUM_ALLPASSES, MAX_DELAY_SECS + 0.01f);
+    chain->inputs.source = input->outputs.main;
+    sig_List_append(signals, chain, NULL);
+
+    return chain->outputs.main;
+}
+
+// Returns the average time, in seconds, taken by each block
+// when evaluating a graph built by the specified function.
+double measure(struct sig_SignalContext* context,
+    float_array_ptr (*buildGraph)(struct sig_SignalContext* context,
+        struct sig_List* signals),
+    const char* label) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    struct sig_List* signals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    sig_List_append(signals, input, NULL);
+    float_array_ptr output = buildGraph(context, signals);
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        input->parameters.value = sig_randf() * 2.0f - 1.0f;
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+    double blockTime = ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numBlocks;
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("%s: %.3f us/block (output sample: %g)\n", label,
+        blockTime * 1000000.0,
+        FLOAT_ARRAY(output)[audioSettings->blockSize - 1]);
+
+    return blockTime;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    input = sig_dsp_Value_new(&allocator, context);
+
+    double combCost = measure(context, buildCombBank, "CombBank") /
+        measure(context, buildCombGraph, "Comb graph");
+    printf("  The CombBank costs %.2fx as much.\n", combCost);
+
+    double allpassCost = measure(context, buildAllpassChain,
+        "AllpassChain") / measure(context, buildAllpassGraph,
+        "Allpass graph");
+    printf("  The AllpassChain costs %.2fx as much.\n", allpassCost);
+
+    if (combCost > MAX_RELATIVE_COST || allpassCost > MAX_RELATIVE_COST) {
+        printf("A fused Signal cost more than %.2fx as much as its graph.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+/*! \file convolver-benchmark.c
+    \brief Measures the CPU cost of sig_dsp_Convolver
+    per second of impulse response.
+
+    Noise is convolved with decaying noise impulse responses
+    of increasing length. The time taken to render is reported
+    as a percentage of the real time duration of the audio,
+    divided by the length of the impulse response in seconds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 16
+#define BLOCK_SIZE 128
+#define RENDER_SECS 10.0f
+#define MAX_ACCEPTABLE_CPU_PER_IR_SEC 5.0
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+static const float irSecs[] = {0.25f, 0.5f, 1.0f, 2.0f, 4.0f};
+
+// Returns the percentage of real time used
+// per second of impulse response.
+double measureCPUPerIRSecond(struct sig_SignalContext* context,
+    struct sig_Random* random, float irDuration) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    size_t irLength = (size_t) (irDuration * audioSettings->sampleRate);
+    size_t numBlocks = (size_t) (RENDER_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    struct sig_Buffer* ir = sig_Buffer_new(&allocator, irLength);
+    sig_Random_fillBipolar(random, ir->samples, irLength);
+    for (size_t i = 0; i < irLength; i++) {
+        FLOAT_ARRAY(ir->samples)[i] *= expf(-6.0f * (float) i /
+            (float) irLength);
+    }
+
+    struct sig_dsp_Convolver* convolver = sig_dsp_Convolver_new(&allocator,
+        context, irLength);
+    convolver->inputs.source = sig_AudioBlock_new(&allocator,
+        audioSettings);
+    sig_dsp_Convolver_loadIR(convolver, ir);
+
+    clock_t start = clock();
+    for (size_t i = 0; i < numBlocks; i++) {
+        sig_Random_fillBipolar(random, convolver->inputs.source,
+            audioSettings->blockSize);
+        convolver->signal.generate(convolver);
+    }
+    clock_t end = clock();
+
+    double elapsed = (double) (end - start) / CLOCKS_PER_SEC;
+    double cpu = 100.0 * elapsed / RENDER_SECS;
+    double cpuPerIRSecond = cpu / irDuration;
+
+    printf("%.2f s IR: %.3f%% CPU, %.3f%% CPU per IR second\n",
+        irDuration, cpu, cpuPerIRSecond);
+    printf("  final output sample: %g\n",
+        FLOAT_ARRAY(convolver->outputs.main)[audioSettings->blockSize - 1]);
+
+    sig_AudioBlock_destroy(&allocator, convolver->inputs.source);
+    sig_dsp_Convolver_destroy(&allocator, convolver);
+    sig_Buffer_destroy(&allocator, ir);
+
+    return cpuPerIRSecond;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+    audioSettings.blockSize = BLOCK_SIZE;
+    struct sig_Random random;
+    double maxCPUPerIRSecond = 0.0;
+
+    allocator.impl->init(&allocator);
+    sig_Random_init(&random, sig_DEFAULT_RANDOM_SEED);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+
+    for (size_t i = 0; i < sizeof(irSecs) / sizeof(irSecs[0]); i++) {
+        double cpuPerIRSecond = measureCPUPerIRSecond(context, &random,
+            irSecs[i]);
+        if (cpuPerIRSecond > maxCPUPerIRSecond) {
+            maxCPUPerIRSecond = cpuPerIRSecond;
+        }
+    }
+
+    if (maxCPUPerIRSecond > MAX_ACCEPTABLE_CPU_PER_IR_SEC) {
+        printf("Convolution used more than %.1f%% CPU per IR second.\n",
+            MAX_ACCEPTABLE_CPU_PER_IR_SEC);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
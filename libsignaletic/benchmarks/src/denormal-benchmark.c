@@ -0,0 +1,167 @@
+/*! \file denormal-benchmark.c
+    \brief Measures the cost of rendering the silent tails
+    of recursive Signals, which are prone to denormal slowdowns.
+
+    A chain of filters and feedback delays is first rendered
+    with a sustained noise input, and then with a short burst of noise
+    followed by a long period of silence. The time taken to render
+    each block of the silent tail is compared to the time taken
+    to render the same graph normally, so that the result
+    doesn't depend on the speed of the machine.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 4
+#define BURST_SECS 2.0f
+#define RENDER_SECS 60.0f
+#define MAX_NUM_SIGNALS 16
+#define MAX_TAIL_TO_NORMAL_RATIO 1.5
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+struct sig_dsp_Value* input;
+struct sig_dsp_OnePole* onePole;
+struct sig_dsp_Ladder* ladder;
+struct sig_dsp_Comb* comb;
+struct sig_dsp_Allpass* allpass;
+struct sig_dsp_Smooth* smooth;
+struct sig_dsp_ConstantValue* cutoff;
+struct sig_dsp_ConstantValue* resonance;
+struct sig_dsp_ConstantValue* delayTime;
+struct sig_dsp_ConstantValue* feedbackGain;
+struct sig_dsp_ConstantValue* lpfCoefficient;
+struct sig_dsp_ConstantValue* allpassG;
+struct sig_DelayLine* combDelayLine;
+struct sig_DelayLine* allpassDelayLine;
+
+void buildGraph(struct sig_SignalContext* context, struct sig_List* signals) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+
+    input = sig_dsp_Value_new(&allocator, context);
+    cutoff = sig_dsp_ConstantValue_new(&allocator, context, 2000.0f);
+    resonance = sig_dsp_ConstantValue_new(&allocator, context, 0.7f);
+    delayTime = sig_dsp_ConstantValue_new(&allocator, context, 0.0371f);
+    feedbackGain = sig_dsp_ConstantValue_new(&allocator, context, 0.97f);
+    lpfCoefficient = sig_dsp_ConstantValue_new(&allocator, context, 0.2f);
+    allpassG = sig_dsp_ConstantValue_new(&allocator, context, 0.7f);
+
+    onePole = sig_dsp_OnePole_new(&allocator, context);
+    onePole->inputs.source = input->outputs.main;
+    onePole->inputs.frequency = cutoff->outputs.main;
+
+    ladder = sig_dsp_Ladder_new(&allocator, context);
+    ladder->inputs.source = onePole->outputs.main;
+    ladder->inputs.frequency = cutoff->outputs.main;
+    ladder->inputs.resonance = resonance->outputs.main;
+
+    combDelayLine = sig_DelayLine_newSeconds(&allocator, audioSettings, 0.1f);
+    comb = sig_dsp_Comb_new(&allocator, context);
+    comb->delayLine = combDelayLine;
+    comb->inputs.source = ladder->outputs.main;
+    comb->inputs.delayTime = delayTime->outputs.main;
+    comb->inputs.feedbackGain = feedbackGain->outputs.main;
+    comb->inputs.lpfCoefficient = lpfCoefficient->outputs.main;
+
+    allpassDelayLine = sig_DelayLine_newSeconds(&allocator, audioSettings,
+        0.1f);
+    allpass = sig_dsp_Allpass_new(&allocator, context);
+    allpass->delayLine = allpassDelayLine;
+    allpass->inputs.source = comb->outputs.main;
+    allpass->inputs.delayTime = delayTime->outputs.main;
+    allpass->inputs.g = allpassG->outputs.main;
+
+    smooth = sig_dsp_Smooth_new(&allocator, context);
+    smooth->inputs.source = allpass->outputs.main;
+    smooth->parameters.time = 0.5f;
+
+    struct sig_dsp_Signal* graph[] = {
+        &input->signal, &onePole->signal, &ladder->signal,
+        &comb->signal, &allpass->signal, &smooth->signal
+    };
+
+    for (size_t i = 0; i < sizeof(graph) / sizeof(graph[0]); i++) {
+        sig_List_append(signals, graph[i], NULL);
+    }
+}
+
+double renderSeconds(struct sig_dsp_SignalListEvaluator* evaluator,
+    struct sig_AudioSettings* audioSettings, float duration, bool isActive) {
+    size_t numBlocks = (size_t) (duration * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    // Noise is generated for silent renders too,
+    // so that both do the same amount of work outside the graph.
+    float gain = isActive ? 1.0f : 0.0f;
+    clock_t start = clock();
+    for (size_t i = 0; i < numBlocks; i++) {
+        input->parameters.value = (sig_randf() * 2.0f - 1.0f) * gain;
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+
+    return ((double) (end - start) / CLOCKS_PER_SEC) / (double) numBlocks;
+}
+
+double measureTailRatio(struct sig_dsp_SignalListEvaluator* evaluator,
+    struct sig_AudioSettings* audioSettings, const char* label) {
+    double normalTime = renderSeconds(evaluator, audioSettings,
+        RENDER_SECS, true);
+    renderSeconds(evaluator, audioSettings, BURST_SECS, true);
+    double tailTime = renderSeconds(evaluator, audioSettings,
+        RENDER_SECS, false);
+    double ratio = tailTime / normalTime;
+
+    printf("%s: normal %.3f us/block, silent tail %.3f us/block (%.2fx)\n",
+        label, normalTime * 1000000.0, tailTime * 1000000.0, ratio);
+    printf("  final output sample: %g\n",
+        FLOAT_ARRAY(smooth->outputs.main)[audioSettings->blockSize - 1]);
+
+    return ratio;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    struct sig_List* signals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+
+    buildGraph(context, signals);
+
+    evaluator->flushDenormals = true;
+    double ftzRatio = measureTailRatio(evaluator, &audioSettings,
+        "Flush-to-zero enabled");
+
+    // The per-block state flushing in each Signal
+    // should protect against denormals even without hardware support.
+    evaluator->flushDenormals = false;
+    double noFTZRatio = measureTailRatio(evaluator, &audioSettings,
+        "Flush-to-zero disabled");
+
+    if (ftzRatio > MAX_TAIL_TO_NORMAL_RATIO ||
+        noFTZRatio > MAX_TAIL_TO_NORMAL_RATIO) {
+        printf("Rendering silent tails was more than %.1fx slower "
+            "than rendering normally.\n", MAX_TAIL_TO_NORMAL_RATIO);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
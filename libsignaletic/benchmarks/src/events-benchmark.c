@@ -0,0 +1,153 @@
+/*! \file events-benchmark.c
+    \brief Compares the cost of timing and gate Signals
+    when they read a sparse clock as events
+    to their cost when they scan it as dense blocks.
+
+    A clock with short pulses drives a ToggleGate, a TimedGate,
+    a TimedTriggerCounter, and a ClockDetector. The clock is written
+    in both forms before every block in both measurements,
+    so only the cost of the Signals themselves differs.
+    Reading events is expected to cost less than MAX_RELATIVE_COST
+    times as much as reading blocks.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 4
+#define DURATION_SECS 600.0f
+#define MAX_NUM_SIGNALS 16
+#define CLOCK_FREQ 8.0f
+#define PULSE_SECS 0.001f
+#define MAX_RELATIVE_COST 0.8
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+float_array_ptr clockBlock;
+struct sig_EventBlock* clockEvents;
+float clockValue = 0.0f;
+size_t clockSamples = 0;
+
+// Writes the next block of the clock both as samples and as events.
+void writeClock(struct sig_AudioSettings* audioSettings) {
+    size_t period = (size_t) (audioSettings->sampleRate / CLOCK_FREQ);
+    size_t pulseLength = (size_t) (audioSettings->sampleRate * PULSE_SECS);
+
+    sig_EventBlock_clear(clockEvents);
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        float value = clockSamples % period < pulseLength ? 1.0f : 0.0f;
+        if (value != clockValue) {
+            sig_EventBlock_push(clockEvents, (uint32_t) i, value);
+            clockValue = value;
+        }
+
+        FLOAT_ARRAY(clockBlock)[i] = value;
+        clockSamples++;
+    }
+}
+
+float_array_ptr buildGraph(struct sig_SignalContext* context,
+    struct sig_List* signals, bool useEvents) {
+    struct sig_dsp_ConstantValue* duration = sig_dsp_ConstantValue_new(
+        &allocator, context, 0.05f);
+    struct sig_dsp_ConstantValue* count = sig_dsp_ConstantValue_new(
+        &allocator, context, 2.0f);
+    sig_List_append(signals, duration, NULL);
+    sig_List_append(signals, count, NULL);
+
+    struct sig_dsp_ToggleGate* toggle = sig_dsp_ToggleGate_new(&allocator,
+        context);
+    struct sig_dsp_TimedGate* gate = sig_dsp_TimedGate_new(&allocator,
+        context);
+    gate->inputs.duration = duration->outputs.main;
+    struct sig_dsp_TimedTriggerCounter* counter =
+        sig_dsp_TimedTriggerCounter_new(&allocator, context);
+    counter->inputs.duration = duration->outputs.main;
+    counter->inputs.count = count->outputs.main;
+    struct sig_dsp_ClockDetector* detector = sig_dsp_ClockDetector_new(
+        &allocator, context);
+
+    if (useEvents) {
+        toggle->inputs.triggerEvents = clockEvents;
+        gate->inputs.triggerEvents = clockEvents;
+        counter->inputs.sourceEvents = clockEvents;
+        detector->inputs.sourceEvents = clockEvents;
+    } else {
+        toggle->inputs.trigger = clockBlock;
+        gate->inputs.trigger = clockBlock;
+        counter->inputs.source = clockBlock;
+        detector->inputs.source = clockBlock;
+    }
+
+    sig_List_append(signals, toggle, NULL);
+    sig_List_append(signals, gate, NULL);
+    sig_List_append(signals, counter, NULL);
+    sig_List_append(signals, detector, NULL);
+
+    return detector->outputs.bpm;
+}
+
+// Returns the average time, in seconds, taken by each block.
+double measure(struct sig_SignalContext* context, bool useEvents,
+    const char* label) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    struct sig_List* signals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    float_array_ptr output = buildGraph(context, signals, useEvents);
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        writeClock(audioSettings);
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+    double blockTime = ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numBlocks;
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("%s: %.3f us/block (output sample: %g)\n", label,
+        blockTime * 1000000.0,
+        FLOAT_ARRAY(output)[audioSettings->blockSize - 1]);
+
+    return blockTime;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    clockBlock = sig_AudioBlock_newSilent(&allocator, &audioSettings);
+    clockEvents = sig_EventBlock_new(&allocator, audioSettings.blockSize);
+
+    double blockTime = measure(context, false, "Dense blocks");
+    double eventTime = measure(context, true, "Events");
+    double relativeCost = eventTime / blockTime;
+    printf("  Reading events costs %.2fx as much.\n", relativeCost);
+
+    if (relativeCost > MAX_RELATIVE_COST) {
+        printf("Reading events cost more than %.2fx as much as blocks.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
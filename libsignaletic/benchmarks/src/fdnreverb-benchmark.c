@@ -0,0 +1,249 @@
+/*! \file fdnreverb-benchmark.c
+    \brief Compares the cost of the fused FDNReverb Signal
+    to reverbs of similar density built from graphs of Signals.
+
+    The graphs follow the structure of the reverb examples
+    in hosts/daisy/examples/bluemchen/reverb:
+    a 1962a-style chain of five Allpasses is compared to a
+    four line FDNReverb, and a Moorer-style bank of six
+    low-pass-filtered Combs followed by an Allpass is compared to
+    an eight line FDNReverb. Each FDNReverb is expected to be
+    no more expensive than the graph it replaces.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 16
+#define DURATION_SECS 10.0f
+#define MAX_NUM_SIGNALS 64
+#define MAX_DELAY_SECS 0.15f
+#define MAX_RELATIVE_COST 1.0
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+struct sig_dsp_Value* input;
+
+float allpassDelayTimes[] = {0.1f, 0.068f, 0.06f, 0.0197f, 0.00585f};
+float combDelayTimes[] = {0.05f, 0.056f, 0.061f, 0.068f, 0.072f, 0.078f};
+float combLPFGains[] = {0.44f, 0.46f, 0.48f, 0.50f, 0.52f, 0.54f};
+
+struct sig_dsp_Allpass* addAllpass(struct sig_SignalContext* context,
+    struct sig_List* signals, float_array_ptr source, float delayTime,
+    struct sig_dsp_ConstantValue* g) {
+    struct sig_dsp_ConstantValue* time = sig_dsp_ConstantValue_new(
+        &allocator, context, delayTime);
+    struct sig_dsp_Allpass* allpass = sig_dsp_Allpass_new(&allocator,
+        context);
+    allpass->delayLine = sig_DelayLine_newSeconds(&allocator,
+        context->audioSettings, MAX_DELAY_SECS);
+    allpass->inputs.source = source;
+    allpass->inputs.delayTime = time->outputs.main;
+    allpass->inputs.g = g->outputs.main;
+    sig_List_append(signals, time, NULL);
+    sig_List_append(signals, allpass, NULL);
+
+    return allpass;
+}
+
+float_array_ptr build1962aGraph(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    struct sig_dsp_ConstantValue* g = sig_dsp_ConstantValue_new(&allocator,
+        context, 0.7f);
+    sig_List_append(signals, g, NULL);
+
+    float_array_ptr source = input->outputs.main;
+    for (size_t i = 0; i < 5; i++) {
+        struct sig_dsp_Allpass* allpass = addAllpass(context, signals,
+            source, allpassDelayTimes[i], g);
+        source = allpass->outputs.main;
+    }
+
+    return source;
+}
+
+float_array_ptr buildMoorerGraph(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    struct sig_dsp_ConstantValue* one = sig_dsp_ConstantValue_new(
+        &allocator, context, 1.0f);
+    struct sig_dsp_ConstantValue* combGain = sig_dsp_ConstantValue_new(
+        &allocator, context, 0.84f);
+    struct sig_dsp_ConstantValue* timeScale = sig_dsp_ConstantValue_new(
+        &allocator, context, 1.0f);
+    sig_List_append(signals, one, NULL);
+    sig_List_append(signals, combGain, NULL);
+    sig_List_append(signals, timeScale, NULL);
+
+    float_array_ptr sum = NULL;
+    for (size_t i = 0; i < 6; i++) {
+        struct sig_dsp_ConstantValue* time = sig_dsp_ConstantValue_new(
+            &allocator, context, combDelayTimes[i]);
+        struct sig_dsp_BinaryOp* scaledTime = sig_dsp_Mul_new(&allocator,
+            context);
+        scaledTime->inputs.left = time->outputs.main;
+        scaledTime->inputs.right = timeScale->outputs.main;
+
+        struct sig_dsp_ConstantValue* g1 = sig_dsp_ConstantValue_new(
+            &allocator, context, combLPFGains[i]);
+        struct sig_dsp_BinaryOp* oneMinusG1 = sig_dsp_Sub_new(&allocator,
+            context);
+        oneMinusG1->inputs.left = one->outputs.main;
+        oneMinusG1->inputs.right = g1->outputs.main;
+        struct sig_dsp_BinaryOp* g2 = sig_dsp_Mul_new(&allocator, context);
+        g2->inputs.left = combGain->outputs.main;
+        g2->inputs.right = oneMinusG1->outputs.main;
+
+        struct sig_dsp_Comb* comb = sig_dsp_Comb_new(&allocator, context);
+        comb->delayLine = sig_DelayLine_newSeconds(&allocator,
+            context->audioSettings, MAX_DELAY_SECS);
+        comb->inputs.source = input->outputs.main;
+        comb->inputs.feedbackGain = g2->outputs.main;
+        comb->inputs.delayTime = scaledTime->outputs.main;
+        comb->inputs.lpfCoefficient = g1->outputs.main;
+
+        struct sig_dsp_Signal* combSignals[] = {
+            &time->signal, &scaledTime->signal, &g1->signal,
+            &oneMinusG1->signal, &g2->signal, &comb->signal
+        };
+        for (size_t j = 0; j < 6; j++) {
+            sig_List_append(signals, combSignals[j], NULL);
+        }
+
+        if (sum == NULL) {
+            sum = comb->outputs.main;
+        } else {
+            struct sig_dsp_BinaryOp* add = sig_dsp_Add_new(&allocator,
+                context);
+            add->inputs.left = sum;
+            add->inputs.right = comb->outputs.main;
+            sig_List_append(signals, add, NULL);
+            sum = add->outputs.main;
+        }
+    }
+
+    struct sig_dsp_ConstantValue* combMixGain = sig_dsp_ConstantValue_new(
+        &allocator, context, 0.25f);
+    struct sig_dsp_BinaryOp* combMix = sig_dsp_Mul_new(&allocator, context);
+    combMix->inputs.left = sum;
+    combMix->inputs.right = combMixGain->outputs.main;
+    sig_List_append(signals, combMixGain, NULL);
+    sig_List_append(signals, combMix, NULL);
+
+    struct sig_dsp_ConstantValue* g = sig_dsp_ConstantValue_new(&allocator,
+        context, 0.7f);
+    sig_List_append(signals, g, NULL);
+    struct sig_dsp_Allpass* allpass = addAllpass(context, signals,
+        combMix->outputs.main, 0.006f, g);
+
+    return allpass->outputs.main;
+}
+
+float_array_ptr buildFDNReverb(struct sig_SignalContext* context,
+    struct sig_List* signals, size_t numLines) {
+    struct sig_dsp_ConstantValue* decayTime = sig_dsp_ConstantValue_new(
+        &allocator, context, 2.0f);
+    struct sig_dsp_ConstantValue* damping = sig_dsp_ConstantValue_new(
+        &allocator, context, 0.3f);
+    struct sig_dsp_FDNReverb* reverb = sig_dsp_FDNReverb_new(&allocator,
+        context, numLines);
+    reverb->inputs.source = input->outputs.main;
+    reverb->inputs.decayTime = decayTime->outputs.main;
+    reverb->inputs.damping = damping->outputs.main;
+    reverb->parameters.modulationDepth = 4.0f;
+    sig_List_append(signals, decayTime, NULL);
+    sig_List_append(signals, damping, NULL);
+    sig_List_append(signals, reverb, NULL);
+
+    return reverb->outputs.left;
+}
+
+// Returns the average time, in seconds, taken by each block
+// when evaluating the specified list of signals.
+double measure(struct sig_List* signals,
+    struct sig_AudioSettings* audioSettings, float_array_ptr output,
+    const char* label) {
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        input->parameters.value = sig_randf() * 2.0f - 1.0f;
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+    double blockTime = ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numBlocks;
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("%s: %.3f us/block (output sample: %g)\n", label,
+        blockTime * 1000000.0,
+        FLOAT_ARRAY(output)[audioSettings->blockSize - 1]);
+
+    return blockTime;
+}
+
+double compare(struct sig_SignalContext* context, const char* graphLabel,
+    float_array_ptr (*buildGraph)(struct sig_SignalContext* context,
+        struct sig_List* signals),
+    size_t numLines) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    struct sig_List* graphSignals = sig_List_new(&allocator,
+        MAX_NUM_SIGNALS);
+    sig_List_append(graphSignals, input, NULL);
+    float_array_ptr graphOutput = buildGraph(context, graphSignals);
+
+    struct sig_List* fdnSignals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    sig_List_append(fdnSignals, input, NULL);
+    float_array_ptr fdnOutput = buildFDNReverb(context, fdnSignals,
+        numLines);
+
+    double graphTime = measure(graphSignals, audioSettings, graphOutput,
+        graphLabel);
+    char fdnLabel[64];
+    snprintf(fdnLabel, sizeof(fdnLabel), "%zu line FDNReverb", numLines);
+    double fdnTime = measure(fdnSignals, audioSettings, fdnOutput,
+        fdnLabel);
+    double relativeCost = fdnTime / graphTime;
+    printf("  The FDNReverb costs %.2fx as much.\n", relativeCost);
+
+    return relativeCost;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    input = sig_dsp_Value_new(&allocator, context);
+
+    double schroederCost = compare(context, "1962a-style Allpass chain",
+        build1962aGraph, 4);
+    double moorerCost = compare(context, "Moorer-style Comb bank",
+        buildMoorerGraph, 8);
+
+    if (schroederCost > MAX_RELATIVE_COST ||
+        moorerCost > MAX_RELATIVE_COST) {
+        printf("The FDNReverb cost more than %.2fx as much as a graph.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
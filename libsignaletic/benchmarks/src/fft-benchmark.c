@@ -0,0 +1,85 @@
+/*! \file fft-benchmark.c
+    \brief Measures the cost of forward and inverse real FFTs
+    at each supported length.
+
+    The 512-point transform is used for block-based spectral processing
+    and partitioned convolution, so it is held to a time budget.
+    The budget is intended for desktop hosts; embedded targets
+    should be profiled on the hardware itself.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024
+#define TOTAL_SAMPLES_PER_LENGTH 1024 * 1024 * 16
+#define BUDGET_LENGTH 512
+#define MAX_BUDGET_MICROSECONDS 50.0
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+// Returns the average time, in seconds, taken by
+// a forward and an inverse transform of the specified length.
+double measureRoundTrip(size_t length) {
+    struct sig_FFT* fft = sig_FFT_new(&allocator, length);
+    struct sig_Buffer* buffer = sig_Buffer_new(&allocator, length);
+    struct sig_Random random;
+    size_t numIterations = TOTAL_SAMPLES_PER_LENGTH / length;
+
+    sig_Random_init(&random, sig_DEFAULT_RANDOM_SEED);
+    sig_Random_fillBipolar(&random, buffer->samples, length);
+
+    clock_t start = clock();
+    for (size_t i = 0; i < numIterations; i++) {
+        sig_FFT_forward(fft, buffer->samples);
+        sig_FFT_inverse(fft, buffer->samples);
+    }
+    clock_t end = clock();
+
+    // Print a sample to prevent the transforms from being optimized away.
+    printf("  (%zu-point output sample: %g)\n", length,
+        FLOAT_ARRAY(buffer->samples)[length / 2]);
+
+    sig_Buffer_destroy(&allocator, buffer);
+    sig_FFT_destroy(&allocator, fft);
+
+    return ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numIterations;
+}
+
+int main(int argc, char *argv[]) {
+    double budgetTime = 0.0;
+
+    allocator.impl->init(&allocator);
+
+    for (size_t length = sig_FFT_MIN_LENGTH; length <= sig_FFT_MAX_LENGTH;
+        length *= 2) {
+        double time = measureRoundTrip(length);
+        printf("%zu points: %.3f us per forward + inverse transform\n",
+            length, time * 1000000.0);
+
+        if (length == BUDGET_LENGTH) {
+            budgetTime = time;
+        }
+    }
+
+    if (budgetTime * 1000000.0 > MAX_BUDGET_MICROSECONDS) {
+        printf("The %d-point transforms took longer than %.1f us.\n",
+            BUDGET_LENGTH, MAX_BUDGET_MICROSECONDS);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*! \file fmoperatorbank-benchmark.c
+    \brief Compares the cost of a six operator FMOperatorBank
+    to the equivalent number of TwoOpFM Signals.
+
+    The FMOperatorBank is expected to cost less than
+    MAX_RELATIVE_COST times as much as three TwoOpFMs.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 4
+#define DURATION_SECS 10.0f
+#define NUM_TWO_OP_FMS 3
+#define MAX_RELATIVE_COST 0.5
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+// Returns the average time, in seconds, taken by each block
+// when rendering the specified signals.
+double measure(struct sig_dsp_Signal** signals, size_t numSignals,
+    struct sig_AudioSettings* audioSettings, float_array_ptr output) {
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        for (size_t i = 0; i < numSignals; i++) {
+            signals[i]->generate(signals[i]);
+        }
+    }
+    clock_t end = clock();
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("  (output sample: %g)\n",
+        FLOAT_ARRAY(output)[audioSettings->blockSize - 1]);
+
+    return ((double) (end - start) / CLOCKS_PER_SEC) / (double) numBlocks;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    float_array_ptr freq = sig_AudioBlock_newWithValue(&allocator,
+        &audioSettings, 220.0f);
+    float_array_ptr index = sig_AudioBlock_newWithValue(&allocator,
+        &audioSettings, 0.5f);
+    float_array_ptr ratio = sig_AudioBlock_newWithValue(&allocator,
+        &audioSettings, 2.0f);
+    float_array_ptr feedbackGain = sig_AudioBlock_newWithValue(&allocator,
+        &audioSettings, 0.1f);
+
+    struct sig_dsp_FMOperatorBank* bank = sig_dsp_FMOperatorBank_new(
+        &allocator, context, sig_dsp_FMOperatorBank_MAX_OPERATORS);
+    bank->inputs.frequency = freq;
+    bank->inputs.index = index;
+    bank->parameters.algorithm = sig_dsp_FMOperatorBank_Algorithm_PAIRS;
+    for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+        bank->parameters.ratios[j] = (float) (j % 2 + 1);
+        bank->parameters.feedbackGains[j] = 0.1f;
+    }
+
+    struct sig_dsp_Signal* twoOpSignals[NUM_TWO_OP_FMS];
+    struct sig_dsp_TwoOpFM* twoOps[NUM_TWO_OP_FMS];
+    for (size_t i = 0; i < NUM_TWO_OP_FMS; i++) {
+        twoOps[i] = sig_dsp_TwoOpFM_new(&allocator, context);
+        twoOps[i]->inputs.frequency = freq;
+        twoOps[i]->inputs.index = index;
+        twoOps[i]->inputs.ratio = ratio;
+        twoOps[i]->inputs.feedbackGain = feedbackGain;
+        twoOpSignals[i] = &twoOps[i]->signal;
+    }
+
+    struct sig_dsp_Signal* bankSignals[] = {&bank->signal};
+
+    double bankTime = measure(bankSignals, 1, &audioSettings,
+        bank->outputs.main);
+    double twoOpTime = measure(twoOpSignals, NUM_TWO_OP_FMS, &audioSettings,
+        twoOps[0]->outputs.main);
+    double relativeCost = bankTime / twoOpTime;
+
+    printf("FMOperatorBank (%d operators): %.3f us/block\n",
+        sig_dsp_FMOperatorBank_MAX_OPERATORS, bankTime * 1000000.0);
+    printf("%d TwoOpFMs: %.3f us/block\n", NUM_TWO_OP_FMS,
+        twoOpTime * 1000000.0);
+    printf("The FMOperatorBank costs %.2fx as much.\n", relativeCost);
+
+    if (relativeCost > MAX_RELATIVE_COST) {
+        printf("The FMOperatorBank cost more than %.2fx as much.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
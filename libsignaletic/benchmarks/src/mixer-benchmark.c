@@ -0,0 +1,126 @@
+/*! \file mixer-benchmark.c
+    \brief Compares the cost of the Mixer Signal to
+    the chain of Adds (followed by a Mul) that it replaces.
+
+    The inputs are static blocks, so that only the cost of
+    mixing is measured. The Mixer is expected to cost less than
+    MAX_RELATIVE_COST times as much as the chain of Adds.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 4
+#define DURATION_SECS 600.0f
+#define MAX_NUM_SIGNALS 32
+#define NUM_INPUTS 8
+#define MAX_RELATIVE_COST 0.8
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+float_array_ptr sources[NUM_INPUTS];
+
+float_array_ptr buildAddChain(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    float_array_ptr sum = sources[0];
+
+    for (size_t j = 1; j < NUM_INPUTS; j++) {
+        struct sig_dsp_BinaryOp* add = sig_dsp_Add_new(&allocator, context);
+        add->inputs.left = sum;
+        add->inputs.right = sources[j];
+        sig_List_append(signals, add, NULL);
+        sum = add->outputs.main;
+    }
+
+    struct sig_dsp_ConstantValue* gain = sig_dsp_ConstantValue_new(
+        &allocator, context, 1.0f / NUM_INPUTS);
+    struct sig_dsp_BinaryOp* mix = sig_dsp_Mul_new(&allocator, context);
+    mix->inputs.left = sum;
+    mix->inputs.right = gain->outputs.main;
+    sig_List_append(signals, gain, NULL);
+    sig_List_append(signals, mix, NULL);
+
+    return mix->outputs.main;
+}
+
+float_array_ptr buildMixer(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    struct sig_dsp_Mixer* mixer = sig_dsp_Mixer_new(&allocator, context,
+        NUM_INPUTS);
+    for (size_t j = 0; j < NUM_INPUTS; j++) {
+        mixer->inputs.sources[j] = sources[j];
+    }
+    mixer->parameters.masterGain = 1.0f / NUM_INPUTS;
+    sig_List_append(signals, mixer, NULL);
+
+    return mixer->outputs.main;
+}
+
+// Returns the average time, in seconds, taken by each block
+// when evaluating a graph built by the specified function.
+double measure(struct sig_SignalContext* context,
+    float_array_ptr (*buildGraph)(struct sig_SignalContext* context,
+        struct sig_List* signals),
+    const char* label) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    struct sig_List* signals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    float_array_ptr output = buildGraph(context, signals);
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        FLOAT_ARRAY(sources[block % NUM_INPUTS])[0] = sig_randf();
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+    double blockTime = ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numBlocks;
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("%s: %.3f us/block (output sample: %g)\n", label,
+        blockTime * 1000000.0, FLOAT_ARRAY(output)[0]);
+
+    return blockTime;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    for (size_t j = 0; j < NUM_INPUTS; j++) {
+        sources[j] = sig_AudioBlock_newWithValue(&allocator, &audioSettings,
+            (float) j);
+    }
+
+    double addChainTime = measure(context, buildAddChain, "Add chain");
+    double relativeCost = measure(context, buildMixer, "Mixer") /
+        addChainTime;
+    printf("  The Mixer costs %.2fx as much.\n", relativeCost);
+
+    if (relativeCost > MAX_RELATIVE_COST) {
+        printf("The Mixer cost more than %.2fx as much as the Add chain.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
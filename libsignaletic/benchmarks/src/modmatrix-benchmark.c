@@ -0,0 +1,151 @@
+/*! \file modmatrix-benchmark.c
+    \brief Compares the cost of the ModMatrix Signal to
+    the graph of Muls and Adds that it replaces.
+
+    NUM_SOURCES modulation sources are each routed to
+    NUM_DESTINATIONS / 2 destinations, so that every destination
+    has two routes. The sources are static blocks,
+    so that only the cost of routing is measured.
+    The ModMatrix is expected to cost less than MAX_RELATIVE_COST
+    times as much as the graph.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 4
+#define DURATION_SECS 600.0f
+#define MAX_NUM_SIGNALS 128
+#define NUM_SOURCES 4
+#define NUM_DESTINATIONS 12
+#define MAX_RELATIVE_COST 0.8
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+float_array_ptr sources[NUM_SOURCES];
+
+// The sources that are routed to each destination.
+size_t routeSource(size_t destination, size_t route) {
+    return (destination + route * (NUM_SOURCES / 2)) % NUM_SOURCES;
+}
+
+float routeDepth(size_t destination, size_t route) {
+    return 0.1f * (float) (destination + 1) * (route == 0 ? 1.0f : -0.5f);
+}
+
+float_array_ptr buildGraph(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    float_array_ptr output = NULL;
+
+    for (size_t d = 0; d < NUM_DESTINATIONS; d++) {
+        float_array_ptr scaled[2];
+
+        for (size_t r = 0; r < 2; r++) {
+            struct sig_dsp_ConstantValue* depth = sig_dsp_ConstantValue_new(
+                &allocator, context, routeDepth(d, r));
+            struct sig_dsp_BinaryOp* mul = sig_dsp_Mul_new(&allocator,
+                context);
+            mul->inputs.left = sources[routeSource(d, r)];
+            mul->inputs.right = depth->outputs.main;
+            sig_List_append(signals, depth, NULL);
+            sig_List_append(signals, mul, NULL);
+            scaled[r] = mul->outputs.main;
+        }
+
+        struct sig_dsp_BinaryOp* add = sig_dsp_Add_new(&allocator, context);
+        add->inputs.left = scaled[0];
+        add->inputs.right = scaled[1];
+        sig_List_append(signals, add, NULL);
+        output = add->outputs.main;
+    }
+
+    return output;
+}
+
+float_array_ptr buildModMatrix(struct sig_SignalContext* context,
+    struct sig_List* signals) {
+    struct sig_dsp_ModMatrix* matrix = sig_dsp_ModMatrix_new(&allocator,
+        context, NUM_SOURCES, NUM_DESTINATIONS);
+    for (size_t s = 0; s < NUM_SOURCES; s++) {
+        matrix->inputs.sources[s] = sources[s];
+    }
+
+    for (size_t d = 0; d < NUM_DESTINATIONS; d++) {
+        for (size_t r = 0; r < 2; r++) {
+            sig_dsp_ModMatrix_setDepth(matrix, routeSource(d, r), d,
+                routeDepth(d, r));
+        }
+    }
+    sig_List_append(signals, matrix, NULL);
+
+    return matrix->outputs.destinations[NUM_DESTINATIONS - 1];
+}
+
+// Returns the average time, in seconds, taken by each block
+// when evaluating a graph built by the specified function.
+double measure(struct sig_SignalContext* context,
+    float_array_ptr (*build)(struct sig_SignalContext* context,
+        struct sig_List* signals),
+    const char* label) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    struct sig_List* signals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    float_array_ptr output = build(context, signals);
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        FLOAT_ARRAY(sources[block % NUM_SOURCES])[0] = sig_randf();
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+    double blockTime = ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numBlocks;
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("%s: %.3f us/block (output sample: %g)\n", label,
+        blockTime * 1000000.0, FLOAT_ARRAY(output)[0]);
+
+    return blockTime;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    for (size_t s = 0; s < NUM_SOURCES; s++) {
+        sources[s] = sig_AudioBlock_newWithValue(&allocator, &audioSettings,
+            (float) s);
+    }
+
+    double graphTime = measure(context, buildGraph, "Mul and Add graph");
+    double relativeCost = measure(context, buildModMatrix, "ModMatrix") /
+        graphTime;
+    printf("  The ModMatrix costs %.2fx as much.\n", relativeCost);
+
+    if (relativeCost > MAX_RELATIVE_COST) {
+        printf("The ModMatrix cost more than %.2fx as much as the graph.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+/*! \file sinebank-benchmark.c
+    \brief Compares the cost of rendering an additive voice
+    with a SineBank to the cost of separate SineOscillators.
+
+    A SineBank with NUM_PARTIALS partials is expected to cost less
+    than MAX_EQUIVALENT_OSCILLATORS individual SineOscillators.
+    The SineBank relies on auto-vectorization, so this comparison
+    is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 4
+#define DURATION_SECS 10.0f
+#define NUM_PARTIALS 64
+#define MAX_EQUIVALENT_OSCILLATORS 4.0
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+// Returns the average time, in seconds, taken by each block
+// when rendering the specified signals.
+double measure(struct sig_dsp_Signal** signals, size_t numSignals,
+    struct sig_AudioSettings* audioSettings, float_array_ptr output) {
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        for (size_t i = 0; i < numSignals; i++) {
+            signals[i]->generate(signals[i]);
+        }
+    }
+    clock_t end = clock();
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("  (output sample: %g)\n",
+        FLOAT_ARRAY(output)[audioSettings->blockSize - 1]);
+
+    return ((double) (end - start) / CLOCKS_PER_SEC) / (double) numBlocks;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+    float_array_ptr freq = sig_AudioBlock_newWithValue(&allocator,
+        &audioSettings, 110.0f);
+
+    struct sig_dsp_SineBank* bank = sig_dsp_SineBank_new(&allocator,
+        context, NUM_PARTIALS);
+    bank->inputs.freq = freq;
+    for (size_t k = 0; k < NUM_PARTIALS; k++) {
+        FLOAT_ARRAY(bank->amplitudes)[k] = 1.0f / (float) (k + 1);
+    }
+
+    struct sig_dsp_Oscillator* sine = sig_dsp_SineOscillator_new(
+        &allocator, context);
+    sine->inputs.freq = freq;
+
+    struct sig_dsp_Signal* bankSignals[] = {&bank->signal};
+    struct sig_dsp_Signal* sineSignals[] = {&sine->signal};
+
+    double bankTime = measure(bankSignals, 1, &audioSettings,
+        bank->outputs.main);
+    double sineTime = measure(sineSignals, 1, &audioSettings,
+        sine->outputs.main);
+    double equivalentOscillators = bankTime / sineTime;
+
+    printf("SineBank (%d partials): %.3f us/block\n", NUM_PARTIALS,
+        bankTime * 1000000.0);
+    printf("SineOscillator: %.3f us/block\n", sineTime * 1000000.0);
+    printf("The SineBank costs as much as %.2f SineOscillators.\n",
+        equivalentOscillators);
+
+    if (equivalentOscillators > MAX_EQUIVALENT_OSCILLATORS) {
+        printf("The SineBank cost more than %.1f SineOscillators.\n",
+            MAX_EQUIVALENT_OSCILLATORS);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+/*! \file voicebank-benchmark.c
+    \brief Compares the cost of the VoiceBank Signal to a graph
+    of BLEPSaws, Ladders, Muls and Adds that plays the same number
+    of voices, and reports how much of each block's duration
+    is spent rendering them.
+
+    The VoiceBank is expected to cost less than MAX_RELATIVE_COST
+    times as much as the graph when every voice is playing,
+    and to skip the batches of voices that are idle.
+    This comparison is only meaningful in optimized (e.g. release) builds.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libsignaletic.h"
+
+#define HEAP_SIZE 1024 * 1024 * 16
+#define DURATION_SECS 10.0f
+#define MAX_NUM_SIGNALS 128
+#define NUM_VOICES 16
+#define NUM_SPARSE_VOICES 4
+#define MAX_RELATIVE_COST 0.8
+
+char allocatorMemory[HEAP_SIZE];
+
+struct sig_AllocatorHeap allocatorHeap = {
+    .length = HEAP_SIZE,
+    .memory = allocatorMemory
+};
+
+struct sig_Allocator allocator = {
+    .impl = &sig_TLSFAllocatorImpl,
+    .heap = &allocatorHeap
+};
+
+float_array_ptr newConstant(struct sig_SignalContext* context,
+    struct sig_List* signals, float value) {
+    struct sig_dsp_ConstantValue* constant = sig_dsp_ConstantValue_new(
+        &allocator, context, value);
+    sig_List_append(signals, constant, NULL);
+
+    return constant->outputs.main;
+}
+
+float voiceFrequency(size_t voice) {
+    return sig_midiToFreq(48.0f + (float) voice * 2.0f);
+}
+
+float_array_ptr buildVoiceGraph(struct sig_SignalContext* context,
+    struct sig_List* signals, size_t numActiveVoices) {
+    float_array_ptr cutoff = newConstant(context, signals, 1200.0f);
+    float_array_ptr resonance = newConstant(context, signals, 0.4f);
+    float_array_ptr sum = NULL;
+
+    // Each voice's envelope is represented by a constant gain.
+    for (size_t v = 0; v < numActiveVoices; v++) {
+        struct sig_dsp_BLEPOscillator* saw = sig_dsp_BLEPSaw_new(
+            &allocator, context);
+        saw->inputs.freq = newConstant(context, signals, voiceFrequency(v));
+        sig_List_append(signals, saw, NULL);
+
+        struct sig_dsp_Ladder* ladder = sig_dsp_Ladder_new(&allocator,
+            context);
+        ladder->inputs.source = saw->outputs.main;
+        ladder->inputs.frequency = cutoff;
+        ladder->inputs.resonance = resonance;
+        sig_List_append(signals, ladder, NULL);
+
+        struct sig_dsp_BinaryOp* vca = sig_dsp_Mul_new(&allocator, context);
+        vca->inputs.left = ladder->outputs.main;
+        vca->inputs.right = newConstant(context, signals,
+            1.0f / NUM_VOICES);
+        sig_List_append(signals, vca, NULL);
+
+        if (sum == NULL) {
+            sum = vca->outputs.main;
+        } else {
+            struct sig_dsp_BinaryOp* add = sig_dsp_Add_new(&allocator,
+                context);
+            add->inputs.left = sum;
+            add->inputs.right = vca->outputs.main;
+            sig_List_append(signals, add, NULL);
+            sum = add->outputs.main;
+        }
+    }
+
+    return sum;
+}
+
+float_array_ptr buildVoiceBank(struct sig_SignalContext* context,
+    struct sig_List* signals, size_t numActiveVoices) {
+    struct sig_dsp_VoiceBank* bank = sig_dsp_VoiceBank_new(&allocator,
+        context, NUM_VOICES);
+    bank->inputs.cutoff = newConstant(context, signals, 1200.0f);
+    bank->inputs.resonance = newConstant(context, signals, 0.4f);
+    bank->inputs.attack = newConstant(context, signals, 0.005f);
+    bank->inputs.release = newConstant(context, signals, 0.5f);
+    bank->parameters.filterEnvelopeAmount = 1.0f;
+    sig_List_append(signals, bank, NULL);
+
+    for (size_t v = 0; v < numActiveVoices; v++) {
+        sig_dsp_VoiceBank_noteOn(bank, (int32_t) v, voiceFrequency(v),
+            1.0f);
+    }
+
+    return bank->outputs.main;
+}
+
+// Returns the proportion of each block's duration that is taken
+// to evaluate a graph built by the specified function.
+double measure(struct sig_SignalContext* context,
+    float_array_ptr (*buildGraph)(struct sig_SignalContext* context,
+        struct sig_List* signals, size_t numActiveVoices),
+    size_t numActiveVoices, const char* label) {
+    struct sig_AudioSettings* audioSettings = context->audioSettings;
+    struct sig_List* signals = sig_List_new(&allocator, MAX_NUM_SIGNALS);
+    float_array_ptr output = buildGraph(context, signals, numActiveVoices);
+    struct sig_dsp_SignalListEvaluator* evaluator =
+        sig_dsp_SignalListEvaluator_new(&allocator, signals);
+    size_t numBlocks = (size_t) (DURATION_SECS * audioSettings->sampleRate /
+        audioSettings->blockSize);
+
+    clock_t start = clock();
+    for (size_t block = 0; block < numBlocks; block++) {
+        evaluator->evaluate((struct sig_dsp_SignalEvaluator*) evaluator);
+    }
+    clock_t end = clock();
+    double blockTime = ((double) (end - start) / CLOCKS_PER_SEC) /
+        (double) numBlocks;
+    double load = blockTime / ((double) audioSettings->blockSize /
+        (double) audioSettings->sampleRate);
+
+    // Print a sample to prevent rendering from being optimized away.
+    printf("%s: %.3f us/block, %.1f%% of each block (output sample: %g)\n",
+        label, blockTime * 1000000.0, load * 100.0,
+        FLOAT_ARRAY(output)[audioSettings->blockSize - 1]);
+
+    return load;
+}
+
+int main(int argc, char *argv[]) {
+    struct sig_AudioSettings audioSettings = sig_DEFAULT_AUDIOSETTINGS;
+
+    allocator.impl->init(&allocator);
+
+    struct sig_SignalContext* context = sig_SignalContext_new(&allocator,
+        &audioSettings);
+
+    double graphLoad = measure(context, buildVoiceGraph, NUM_VOICES,
+        "16 voice graph");
+    double bankLoad = measure(context, buildVoiceBank, NUM_VOICES,
+        "16 voice VoiceBank, 16 playing");
+    double sparseLoad = measure(context, buildVoiceBank, NUM_SPARSE_VOICES,
+        "16 voice VoiceBank, 4 playing");
+
+    double relativeCost = bankLoad / graphLoad;
+    printf("  The VoiceBank costs %.2fx as much as the graph.\n",
+        relativeCost);
+    printf("  With idle voices, it costs %.2fx as much as when all play.\n",
+        sparseLoad / bankLoad);
+
+    if (relativeCost > MAX_RELATIVE_COST) {
+        printf("The VoiceBank cost more than %.2fx as much as the graph.\n",
+            MAX_RELATIVE_COST);
+        return EXIT_FAILURE;
+    }
+
+    if (sparseLoad >= bankLoad) {
+        printf("Idle voices were not skipped.\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -15,6 +15,9 @@ extern "C" {
 #include <stddef.h> // For size_t
 #include <stdbool.h>
 #include <stdint.h> // For int32_t, uint32_t
+#ifndef __cplusplus
+#include <stdatomic.h> // For atomic_size_t
+#endif
 
 // This typedef is necessary because Emscripten's
 // WebIDL binder is unable to produce viable
@@ -90,12 +93,95 @@ float sig_clamp(float value, float min, float max);
 float sig_flooredfmodf(float num, float denom);
 
 /**
- * Generates a random float between 0.0 and 1.0.
+ * @brief A fast, seedable pseudorandom number generator.
+ *
+ * This is an implementation of xoshiro128+ by David Blackman and
+ * Sebastiano Vigna (https://prng.di.unimi.it/). Each instance holds its
+ * own state, so Signals that generate random values can be rendered
+ * deterministically from a seed, and in parallel, without sharing
+ * any hidden global state.
+ */
+struct sig_Random {
+    uint32_t state[4];
+};
+
+/**
+ * The seed used by each SignalContext's random number generator.
+ */
+static const uint32_t sig_DEFAULT_RANDOM_SEED = 1;
+
+/**
+ * @brief Seeds a random number generator.
+ * Generators with the same seed will produce identical sequences.
+ *
+ * @param self the generator
+ * @param seed the seed value
+ */
+void sig_Random_init(struct sig_Random* self, uint32_t seed);
+
+/**
+ * @brief Generates a uniformly distributed 32-bit integer.
+ *
+ * @param self the generator
+ * @return uint32_t the random value
+ */
+uint32_t sig_Random_nextUInt32(struct sig_Random* self);
+
+/**
+ * @brief Generates a random float in the range [0.0, 1.0).
+ *
+ * @param self the generator
+ * @return float the random value
+ */
+float sig_Random_nextf(struct sig_Random* self);
+
+/**
+ * @brief Generates a random float in the range [-1.0, 1.0).
+ *
+ * @param self the generator
+ * @return float the random value
+ */
+float sig_Random_nextBipolarf(struct sig_Random* self);
+
+/**
+ * @brief Fills an array with random floats in the range [0.0, 1.0).
+ *
+ * @param self the generator
+ * @param array the array to fill
+ * @param length the number of values to generate
+ */
+void sig_Random_fill(struct sig_Random* self, float_array_ptr array,
+    size_t length);
+
+/**
+ * @brief Fills an array with random floats in the range [-1.0, 1.0).
+ *
+ * @param self the generator
+ * @param array the array to fill
+ * @param length the number of values to generate
+ */
+void sig_Random_fillBipolar(struct sig_Random* self, float_array_ptr array,
+    size_t length);
+
+/**
+ * Generates a random float between 0.0 and 1.0
+ * using the library's shared random number generator.
+ *
+ * The shared generator is not thread safe; Signals should
+ * use their own sig_Random instance instead.
  *
  * @return a random value
  */
 float sig_randf(void);
 
+/**
+ * @brief Seeds the shared random number generator used by
+ * sig_randf() and sig_randomFill().
+ *
+ * @param seed the seed value
+ */
+void sig_randSeed(uint32_t seed);
+
 /**
  * @brief A fast tanh approximation
  *
@@ -104,6 +190,62 @@ float sig_randf(void);
  */
 float sig_fastTanhf(float x);
 
+/**
+ * The magnitude below which sig_denormals_flush() will flush values to zero.
+ * This is well above the denormal range, but far below audibility,
+ * so that decaying feedback loops are stopped before they
+ * reach denormal values.
+ */
+static const float sig_DENORMAL_THRESHOLD = 1.0e-15f;
+
+/**
+ * @brief Flushes very small values (including denormals) to zero.
+ * This is intended to be used on the recursive state of filters
+ * and delays once per block, on platforms that don't support
+ * a hardware flush-to-zero mode.
+ *
+ * @param value the value to flush
+ * @return float the value, or zero if its magnitude
+ * is less than sig_DENORMAL_THRESHOLD
+ */
+float sig_denormals_flush(float value);
+
+/**
+ * @brief Tracks how long a delay line has only been written values
+ * below sig_DENORMAL_THRESHOLD, and reports when everything that can
+ * be read from it has become that quiet, so that it can be zeroed
+ * in a single pass. Recursive delays (combs and allpasses) should call
+ * this once per block instead of flushing every sample they write.
+ *
+ * @param numQuietSamples the number of quiet samples written in a row,
+ * which will be updated
+ * @param blockPeak the largest magnitude written during the block
+ * @param blockSize the number of samples written during the block
+ * @param readDistance the furthest distance (in samples) behind
+ * the write position that the line was read from during the block
+ * @return true if the line should now be zeroed
+ */
+bool sig_denormals_shouldFlushLine(size_t* numQuietSamples,
+    float blockPeak, size_t blockSize, size_t readDistance);
+
+/**
+ * @brief Enables the processor's flush-to-zero (and on x86,
+ * denormals-are-zero) floating point mode, if the platform supports it.
+ * On other platforms (e.g. Web Assembly), this function does nothing.
+ *
+ * @return uint32_t the previous floating point control state,
+ * which should be passed to sig_denormals_restore()
+ */
+uint32_t sig_denormals_enableFlushToZero(void);
+
+/**
+ * @brief Restores the floating point control state
+ * returned by sig_denormals_enableFlushToZero().
+ *
+ * @param previousState the state to restore
+ */
+void sig_denormals_restore(uint32_t previousState);
+
 /**
  * @brief Linearly maps a value from one range to another,
  * clamping out of range values to the min and max.
@@ -259,7 +401,8 @@ size_t sig_indexOfMax(float_array_ptr values, size_t length);
 typedef float (*sig_array_filler)(size_t i, float_array_ptr array);
 
 /**
- * A fill function that returns random floats.
+ * A fill function that returns random floats
+ * from the shared random number generator (see sig_randf()).
  *
  * @param i unused
  * @param array unused
@@ -557,6 +700,32 @@ float sig_osc_Oscillator_wrapPhase(float phase);
 void sig_osc_Oscillator_accumulatePhase(float* phaseAccumulator,
     float frequency, float sampleRate);
 
+/**
+ * @brief Calculates the two-sample polynomial band-limited step (PolyBLEP)
+ * residual for a unit step located at phase 0.0. Adding the residual,
+ * scaled by the height of the step, to a naive waveform
+ * band-limits the step.
+ *
+ * @param phase the oscillator's phase, between 0.0 and 1.0
+ * @param phaseIncrement the (positive) change in phase per sample
+ * @return float the residual, which is zero unless the phase
+ * is within one sample of the step
+ */
+float sig_osc_polyBLEP(float phase, float phaseIncrement);
+
+/**
+ * @brief Calculates the two-sample polynomial band-limited ramp (PolyBLAMP)
+ * residual for a corner at phase 0.0. Adding the residual,
+ * scaled by the change in slope (per sample) at the corner,
+ * to a naive waveform band-limits the corner.
+ *
+ * @param phase the oscillator's phase, between 0.0 and 1.0
+ * @param phaseIncrement the (positive) change in phase per sample
+ * @return float the residual, which is zero unless the phase
+ * is within one sample of the corner
+ */
+float sig_osc_polyBLAMP(float phase, float phaseIncrement);
+
 /**
  * @brief The state for a wavetable oscillator.
  */
@@ -598,6 +767,12 @@ float sig_osc_Wavetable_generate(struct sig_osc_Wavetable* self,
 struct sig_osc_WavetableBank {
     float phaseAccumulator;
     struct sig_WavetableBank* wavetables;
+
+    // The mipmap level and crossfade are only selected again
+    // when the phase increment changes.
+    float previousPhaseIncrement;
+    size_t mipmapLevel;
+    float mipmapFade;
 };
 
 /**
@@ -613,6 +788,7 @@ void sig_osc_WavetableBank_init(struct sig_osc_WavetableBank* self,
  * @brief Generates a single sample of the wavetable bank's output.
  * Using the normalized (0..1) tableIndex input, his oscillator will
  * linearly inteprlate between tables in the bank.
+ * If the bank has mipmaps, they are used to avoid aliasing.
  * This function has side effects, in that in addition to returning
  * the oscillator's output sample, it will also write the current end of
  * cycle sample to the eocOut pointer.
@@ -927,12 +1103,47 @@ struct sig_SignalContext {
     struct sig_DelayLine* oneSampleDelayLine;
     struct sig_dsp_ConstantValue* silence;
     struct sig_dsp_ConstantValue* unity;
+    struct sig_LookupTableCache* tables;
+
+    /**
+     * The source of seeds for Signals that generate random values.
+     * Reseed it before instantiating Signals to produce
+     * different (but repeatable) random sequences.
+     */
+    struct sig_Random random;
+
+    /**
+     * The context that this context's lookup tables are shared with,
+     * or NULL if it owns them.
+     */
+    struct sig_SignalContext* parent;
 };
 
 struct sig_SignalContext* sig_SignalContext_new(
     struct sig_Allocator* allocator,
     struct sig_AudioSettings* audioSettings);
 
+/**
+ * @brief Creates a context for Signals that run with different
+ * audio settings to those of a parent context, such as the children
+ * of an Oversampler.
+ *
+ * The child shares the parent's lookup tables, so tables
+ * that were already acquired or provided aren't built again.
+ * Its random number generator is seeded from the parent's,
+ * so that reseeding the parent before the child is created
+ * also changes the child's random sequences.
+ * The parent must outlive the child.
+ *
+ * @param allocator the allocator to use
+ * @param parent the context to share lookup tables with
+ * @param audioSettings the child's audio settings
+ * @return struct sig_SignalContext* the new child context
+ */
+struct sig_SignalContext* sig_SignalContext_newChild(
+    struct sig_Allocator* allocator, struct sig_SignalContext* parent,
+    struct sig_AudioSettings* audioSettings);
+
 void sig_SignalContext_destroy(
     struct sig_Allocator* allocator, struct sig_SignalContext* self);
 
@@ -1072,14 +1283,46 @@ struct sig_Buffer* sig_BufferView_new(
 void sig_BufferView_destroy(struct sig_Allocator* allocator,
     struct sig_Buffer* self);
 
+/**
+ * Creates a new Buffer that references an existing array of samples,
+ * such as a constant table stored in read-only memory.
+ * The samples are not copied, and must outlive the Buffer.
+ * Destroy it using sig_BufferView_destroy().
+ *
+ * @param allocator the allocator to use
+ * @param samples the samples to reference
+ * @param length the number of samples
+ */
+struct sig_Buffer* sig_BufferView_newWithSamples(
+    struct sig_Allocator* allocator, const float* samples, size_t length);
+
+
+#define sig_WavetableBank_MIN_MIPMAP_LENGTH 64
+#define sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES 0.25f
 
 /**
  * @brief An array of sig_Buffers representing a wavetable.
  *
+ * Banks may optionally contain per-octave mipmap levels for each wave,
+ * in which level l is band-limited to (tableLength / 2) >> l harmonics,
+ * allowing oscillators to read from them without aliasing.
  */
 struct sig_WavetableBank {
     size_t length;
     struct sig_Buffer** waves;
+
+    /**
+     * The number of mipmap levels per wave, including the waves themselves.
+     * Banks without mipmaps have a single level.
+     */
+    size_t numLevels;
+
+    /**
+     * The mipmap levels of each wave, stored level by level
+     * (i.e. mipmaps[level * length + waveIdx]), or NULL if the bank
+     * has no mipmaps. The first level references the waves.
+     */
+    struct sig_Buffer** mipmaps;
 };
 
 struct sig_WavetableBank* sig_WavetableBank_new(struct sig_Allocator* allocator,
@@ -1088,169 +1331,973 @@ struct sig_WavetableBank* sig_WavetableBank_new(struct sig_Allocator* allocator,
 float sig_WavetableBank_readLinearAtPhase(struct sig_WavetableBank* self,
     float tableIdx, float phase);
 
-void sig_WavetableBank_destroy(struct sig_Allocator* allocator,
+/**
+ * @brief Generates per-octave mipmap levels for each wave in the bank,
+ * by truncating the harmonics of each wave's spectrum.
+ * Each level is stored in the smallest table that can be accurately
+ * interpolated, down to sig_WavetableBank_MIN_MIPMAP_LENGTH.
+ *
+ * Waves must have the same power of two length, between
+ * sig_FFT_MIN_LENGTH and sig_FFT_MAX_LENGTH; otherwise
+ * the bank is left without mipmaps. This allocates memory
+ * and should be called when the waves are loaded,
+ * rather than in a time-critical context.
+ *
+ * @param allocator the allocator to use
+ * @param self the bank to generate mipmaps for
+ */
+void sig_WavetableBank_generateMipmaps(struct sig_Allocator* allocator,
     struct sig_WavetableBank* self);
 
+/**
+ * @brief Selects the mipmap levels whose harmonics all lie below
+ * the Nyquist frequency for the specified phase increment, and
+ * the amount to crossfade to the next level by. Adjacent levels are
+ * crossfaded over the last sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES
+ * of each octave. This is relatively expensive, so callers should only
+ * select levels again when the phase increment changes.
+ *
+ * @param self the bank to read from
+ * @param phaseIncrement the change in phase per sample
+ * (i.e. frequency / sampleRate)
+ * @param levelOut a pointer into which the level will be written
+ * (0 for banks without mipmaps)
+ * @param fadeOut a pointer into which the crossfade to the next level,
+ * between 0.0 and 1.0, will be written
+ */
+void sig_WavetableBank_selectMipmapLevel(struct sig_WavetableBank* self,
+    float phaseIncrement, size_t* levelOut, float* fadeOut);
 
-float_array_ptr sig_AudioBlock_new(struct sig_Allocator* allocator,
-    struct sig_AudioSettings* audioSettings);
-float_array_ptr sig_AudioBlock_newWithValue(
-    struct sig_Allocator* allocator,
-    struct sig_AudioSettings* audioSettings,
-    float value);
-float_array_ptr sig_AudioBlock_newSilent(struct sig_Allocator* allocator,
-    struct sig_AudioSettings* audioSettings);
-void sig_AudioBlock_destroy(struct sig_Allocator* allocator,
-    float_array_ptr self);
-
-
+/**
+ * @brief Reads from the bank at a mipmap level that was selected with
+ * sig_WavetableBank_selectMipmapLevel(). Banks without mipmaps
+ * are read using sig_WavetableBank_readLinearAtPhase().
+ *
+ * @param self the bank to read from
+ * @param level the mipmap level to read from
+ * @param fade the crossfade to the next level
+ * @param tableIdx the (fractional) index of the wave to read
+ * @param phase the phase to read at, between 0.0 and 1.0
+ * @return float the sample
+ */
+float sig_WavetableBank_readMipmapLevelAtPhase(
+    struct sig_WavetableBank* self, size_t level, float fade,
+    float tableIdx, float phase);
 
 /**
- * @brief A modulatable delay line
- * with support for comb and allpass configurations.
+ * @brief Reads from the bank without aliasing, by choosing the
+ * mipmap levels whose harmonics all lie below the Nyquist frequency
+ * for the specified phase increment. Adjacent levels are crossfaded
+ * over the last sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES of each octave.
+ * Banks without mipmaps are read using
+ * sig_WavetableBank_readLinearAtPhase().
  *
+ * @param self the bank to read from
+ * @param tableIdx the (fractional) index of the wave to read
+ * @param phase the phase to read at, between 0.0 and 1.0
+ * @param phaseIncrement the change in phase per sample
+ * (i.e. frequency / sampleRate)
+ * @return float the sample
  */
-struct sig_DelayLine {
-    struct sig_Buffer* buffer;
-    size_t writeIdx;
-};
+float sig_WavetableBank_readBandlimitedAtPhase(struct sig_WavetableBank* self,
+    float tableIdx, float phase, float phaseIncrement);
 
-struct sig_DelayLine* sig_DelayLine_new(struct sig_Allocator* allocator,
-    size_t maxDelayLength);
+void sig_WavetableBank_destroy(struct sig_Allocator* allocator,
+    struct sig_WavetableBank* self);
 
-struct sig_DelayLine* sig_DelayLine_newSeconds(struct sig_Allocator* allocator,
-    struct sig_AudioSettings* audioSettings, float maxDelaySecs);
+/**
+ * @brief Creates a WavetableBank that references a contiguous array
+ * of equal-length tables, such as the precomputed mipmaps
+ * in read-only memory. The samples are not copied.
+ *
+ * @param allocator the allocator to use
+ * @param samples the tables' samples, stored one after another
+ * @param numTables the number of tables
+ * @param tableLength the length of each table
+ * @return struct sig_WavetableBank* the new bank
+ */
+struct sig_WavetableBank* sig_WavetableBankView_new(
+    struct sig_Allocator* allocator, const float* samples,
+    size_t numTables, size_t tableLength);
 
-struct sig_DelayLine* sig_DelayLine_newWithTransferredBuffer(
-    struct sig_Allocator* allocator, struct sig_Buffer* buffer);
+/**
+ * @brief Creates a single-wave WavetableBank whose mipmap levels
+ * reference a contiguous array of equal-length tables, such as the
+ * precomputed sig_tables_sawMipmaps. Level l of the array must contain
+ * (tableLength / 2) >> l harmonics. The samples are not copied.
+ *
+ * @param allocator the allocator to use
+ * @param samples the levels' samples, stored one after another
+ * @param numLevels the number of levels
+ * @param tableLength the length of each level
+ * @return struct sig_WavetableBank* the new bank
+ */
+struct sig_WavetableBank* sig_WavetableBankView_newMipmapped(
+    struct sig_Allocator* allocator, const float* samples,
+    size_t numLevels, size_t tableLength);
 
-void sig_DelayLine_init(struct sig_DelayLine* self);
+/**
+ * @brief Destroys a WavetableBank that was created with
+ * sig_WavetableBankView_new() or sig_WavetableBankView_newMipmapped(),
+ * without freeing the samples that it references.
+ *
+ * @param allocator the allocator to use
+ * @param self the bank to destroy
+ */
+void sig_WavetableBankView_destroy(struct sig_Allocator* allocator,
+    struct sig_WavetableBank* self);
 
-typedef void (*sig_DelayLine_readFn)(void* signal);
 
 /**
- * @brief Reads from the delay line without interpolation.
- * This function does not support fractional delay times.
+ * Type definition for a lookup table generator function.
  *
- * @param self the delay line to read from
- * @param readPos the position (in samples) at which to read from the delay
- * @return float the output of the delay line
+ * @param x the normalized position (0.0 to 1.0) within the table's domain
+ * @return the value of the function at the specified position
  */
-float sig_DelayLine_readAt(struct sig_DelayLine* self, size_t readPos);
+typedef float (*sig_table_generator)(float x);
 
 /**
- * @brief Reads from the delay line using linear interpolation.
- * This function supports fractional delay times.
- *
- * @param self the delay line to read from
- * @param readPos the position (in samples) at which to read from the delay
- * @return float the output of the delay line
+ * The input range covered by sig_table_tanh.
+ * A table generated with it spans -sig_TABLE_TANH_RANGE
+ * to +sig_TABLE_TANH_RANGE.
  */
-float sig_DelayLine_linearReadAt(struct sig_DelayLine* self, float readPos);
+static const float sig_TABLE_TANH_RANGE = 4.0f;
 
 /**
- * @brief Reads from the delay line using cubic interpolation.
- * This function supports fractional delay times.
+ * Generates one cycle of a sine wave.
  *
- * @param self the delay line to read from
- * @param readPos the position (in samples) at which to read from the delay
- * @return float the output of the delay line
+ * @param x the normalized phase (0.0 to 1.0)
+ * @return sin(x * 2π)
  */
-float sig_DelayLine_cubicReadAt(struct sig_DelayLine* self, float readPos);
+float sig_table_sine(float x);
 
 /**
- * @brief Reads from the delay line using allpass interpolation.
- * This function supports fractional delay times.
+ * Generates the hyperbolic tangent over the range
+ * -sig_TABLE_TANH_RANGE to +sig_TABLE_TANH_RANGE.
  *
- * @param self the delay line to read from
- * @param readPos the position (in samples) to read from the delay at
- * @param previousSample the previous interpolated sample from the delay line
- * @return float the output of the delay line
+ * @param x the normalized position (0.0 to 1.0)
+ * @return the hyperbolic tangent at the scaled position
  */
-float sig_DelayLine_allpassReadAt(struct sig_DelayLine* self,
-    float readPos, float previousSample);
+float sig_table_tanh(float x);
 
 /**
- * @brief Reads from the delay line without interpolation.
- * This function does not support fractional delay times, and will truncate
- * the delay time tap down to the nearest sample.
+ * Generates one octave of the base-two exponential function.
  *
- * @param self the delay line to read from
- * @param tapTime the time (in seconds) at which to read from the delay
- * @param sampleRate the current sample rate
- * @return float the output of the delay line
+ * @param x the normalized position (0.0 to 1.0)
+ * @return 2^x
  */
-float sig_DelayLine_readAtTime(struct sig_DelayLine* self, float source,
-    float tapTime, float sampleRate);
+float sig_table_exp2(float x);
 
 /**
- * @brief Reads from the delay line at the specified time
- * (in seconds) using linear interpolation.
- * This function supports fractional delay times.
+ * Generates a periodic Hann window.
  *
- * @param self the delay line to read from
- * @param tapTime the time (in seconds) at which to read from the delay
- * @param sampleRate the current sample rate
- * @return float the output of the delay line
+ * @param x the normalized position (0.0 to 1.0)
+ * @return the window's value at the specified position
  */
-float sig_DelayLine_linearReadAtTime(struct sig_DelayLine* self, float source,
-    float tapTime, float sampleRate);
+float sig_table_hann(float x);
 
 /**
- * @brief Reads from the delay line at the specified time
- * (in seconds) using cubic interpolation.
- * This function supports fractional delay times.
+ * @brief A lookup table that is stored in a sig_LookupTableCache.
  *
- * @param self the delay line to read from
- * @param tapTime the time (in seconds) at which to read from the delay
- * @param sampleRate the current sample rate
- * @return float the output of the delay line
+ * The table's Buffer has a length equal to the number of points
+ * in the table, but its samples array contains an additional
+ * numGuardPoints values at the end, which continue the generator
+ * function past the end of the table's domain. These allow
+ * interpolators to read past the end without having to wrap.
  */
-float sig_DelayLine_cubicReadAtTime(struct sig_DelayLine* self, float source,
-    float tapTime, float sampleRate);
+struct sig_LookupTable {
+    sig_table_generator generator;
+    size_t numGuardPoints;
+    size_t refCount;
+    bool isPrecomputed;
+    struct sig_Buffer table;
+    struct sig_LookupTable* next;
+};
 
 /**
- * @brief Reads from the delay line at the specified time
- * (in seconds) using allpass interpolation.
- * This function supports fractional delay times.
+ * @brief A registry of read-only lookup tables, which are
+ * built lazily and shared among all Signals that request them.
  *
- * @param self the delay line to read from
- * @param tapTime the time (in seconds) at which to read from the delay
- * @param sampleRate the current sample rate
- * @param previousSample the previous interpolated sample from the delay line
- * @return float the output of the delay line
+ * Tables are identified by their generator function, length,
+ * and number of guard points. Each table is reference counted, and
+ * its samples are freed when the last Signal using it releases it,
+ * unless they were precomputed.
  */
-float sig_DelayLine_allpassReadAtTime(struct sig_DelayLine* self,
-    float source, float tapTime, float sampleRate, float previousSample);
-
-float sig_DelayLine_readAtTimes(struct sig_DelayLine* self, float source,
-    float_array_ptr tapTimes, float_array_ptr tapGains, size_t numTaps,
-    float sampleRate, float timeScale);
+struct sig_LookupTableCache {
+    struct sig_LookupTable* tables;
+};
 
-float sig_DelayLine_linearReadAtTimes(struct sig_DelayLine* self,
-    float source, float_array_ptr tapTimes, float_array_ptr tapGains,
-    size_t numTaps, float sampleRate, float timeScale);
+struct sig_LookupTableCache* sig_LookupTableCache_new(
+    struct sig_Allocator* allocator);
 
-float sig_DelayLine_cubicReadAtTimes(struct sig_DelayLine* self,
-    float source, float_array_ptr tapTimes, float_array_ptr tapGains,
-    size_t numTaps, float sampleRate, float timeScale);
+void sig_LookupTableCache_init(struct sig_LookupTableCache* self);
 
-void sig_DelayLine_write(struct sig_DelayLine* self, float sample);
+/**
+ * @brief Finds the cache entry for the specified table, if it exists.
+ *
+ * @param self the cache
+ * @param generator the table's generator function
+ * @param length the number of points in the table
+ * @param numGuardPoints the number of extra points past the end
+ * @return struct sig_LookupTable* the entry, or NULL if there is none
+ */
+struct sig_LookupTable* sig_LookupTableCache_find(
+    struct sig_LookupTableCache* self, sig_table_generator generator,
+    size_t length, size_t numGuardPoints);
 
-float sig_DelayLine_calcFeedbackGain(float delayTime, float decayTime);
+/**
+ * @brief Returns a shared lookup table, building it if it isn't
+ * already present in the cache. Each call to this function must
+ * be balanced by a call to sig_LookupTableCache_release().
+ *
+ * The returned table must be treated as read only.
+ *
+ * @param self the cache
+ * @param allocator the allocator to use if the table needs to be built
+ * @param generator the function used to generate the table's values
+ * @param length the number of points in the table
+ * @param numGuardPoints the number of extra points to store past the end
+ * @return struct sig_Buffer* the shared table
+ */
+struct sig_Buffer* sig_LookupTableCache_acquire(
+    struct sig_LookupTableCache* self, struct sig_Allocator* allocator,
+    sig_table_generator generator, size_t length, size_t numGuardPoints);
 
-float sig_DelayLine_feedback(float sample, float read, float g);
+/**
+ * @brief Registers a precomputed table (for example, one stored as
+ * a constant in flash memory), which will be returned in place of
+ * a generated one by subsequent calls to sig_LookupTableCache_acquire().
+ * The samples are not copied, and will never be freed by the cache.
+ *
+ * Precomputed tables should be registered before any Signals that use
+ * them are created. If a table with the same key is already in use,
+ * the precomputed table will be ignored.
+ *
+ * @param self the cache
+ * @param allocator the allocator to use
+ * @param generator the function that the table was computed from
+ * @param length the number of points in the table
+ * @param numGuardPoints the number of extra points past the end
+ * @param samples the table's values, which must contain
+ * length + numGuardPoints values
+ */
+void sig_LookupTableCache_provide(struct sig_LookupTableCache* self,
+    struct sig_Allocator* allocator, sig_table_generator generator,
+    size_t length, size_t numGuardPoints, float_array_ptr samples);
 
-float sig_DelayLine_comb(struct sig_DelayLine* self, float sample,
-    size_t readPos, float g);
+/**
+ * @brief Releases a table that was acquired from the cache.
+ *
+ * @param self the cache
+ * @param allocator the allocator to use
+ * @param table the table to release
+ */
+void sig_LookupTableCache_release(struct sig_LookupTableCache* self,
+    struct sig_Allocator* allocator, struct sig_Buffer* table);
 
-float sig_DelayLine_cubicComb(struct sig_DelayLine* self, float sample,
-    float readPos, float g);
+/**
+ * @brief Destroys the cache and any tables it has built,
+ * regardless of whether or not they have been released.
+ *
+ * @param allocator the allocator to use
+ * @param self the cache to destroy
+ */
+void sig_LookupTableCache_destroy(struct sig_Allocator* allocator,
+    struct sig_LookupTableCache* self);
 
-float sig_DelayLine_allpass(struct sig_DelayLine* self, float sample,
-    size_t readPos, float g);
 
-float sig_DelayLine_linearAllpass(struct sig_DelayLine* self,
+float_array_ptr sig_AudioBlock_new(struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings);
+float_array_ptr sig_AudioBlock_newWithValue(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    float value);
+float_array_ptr sig_AudioBlock_newSilent(struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings);
+void sig_AudioBlock_destroy(struct sig_Allocator* allocator,
+    float_array_ptr self);
+
+/**
+ * @brief The maximum number of channels in a multichannel audio block.
+ *
+ * The signal context's silence and unity Signals provide this many
+ * channels, so that unconnected inputs of multichannel Signals
+ * can always be read safely.
+ */
+#define sig_MAX_CHANNELS 8
+
+/**
+ * @brief Allocates a new, silent multichannel audio block.
+ *
+ * Channels are stored one after another (i.e. in planar layout),
+ * so that each channel is itself an ordinary audio block
+ * that can be connected to any mono input
+ * using sig_AudioBlock_channel().
+ *
+ * @param allocator the allocator to use
+ * @param audioSettings the audio settings
+ * @param numChannels the number of channels,
+ * between 1 and sig_MAX_CHANNELS
+ * @return float_array_ptr the new block
+ */
+float_array_ptr sig_AudioBlock_newMultichannel(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    size_t numChannels);
+
+/**
+ * @brief Returns the specified channel of a multichannel audio block.
+ *
+ * @param audioSettings the audio settings
+ * @param block the multichannel block
+ * @param channel the index of the channel
+ * @return float_array_ptr the channel's samples
+ */
+float_array_ptr sig_AudioBlock_channel(
+    struct sig_AudioSettings* audioSettings, float_array_ptr block,
+    size_t channel);
+
+
+/**
+ * @brief A sample-accurate change in the value of a signal.
+ */
+struct sig_Event {
+    /**
+     * @brief The index of the sample within the block
+     * at which the signal changes.
+     */
+    uint32_t offset;
+
+    /**
+     * @brief The signal's value from that sample onwards.
+     */
+    float value;
+};
+
+/**
+ * @brief A sparse representation of a block of a piecewise-constant
+ * signal, such as a trigger, gate, or clock.
+ *
+ * Instead of storing every sample, an EventBlock lists only the
+ * samples at which the signal's value changes, in order. Signals that
+ * accept events can process them without scanning every sample of
+ * a mostly-silent block for edges, so their cost scales with the
+ * number of events rather than with the block size.
+ *
+ * Whichever Signal or host writes an EventBlock is responsible for
+ * clearing it at the start of each block.
+ */
+struct sig_EventBlock {
+    /**
+     * @brief The maximum number of events the block can hold.
+     */
+    size_t capacity;
+
+    /**
+     * @brief The number of events in the current block.
+     */
+    size_t length;
+
+    /**
+     * @brief The events, sorted by offset.
+     */
+    struct sig_Event* events;
+};
+
+/**
+ * @brief Allocates a new, empty EventBlock.
+ *
+ * A capacity equal to the block size is always sufficient
+ * to represent any block of samples.
+ *
+ * @param allocator the allocator to use
+ * @param capacity the maximum number of events per block
+ * @return struct sig_EventBlock* the new EventBlock
+ */
+struct sig_EventBlock* sig_EventBlock_new(struct sig_Allocator* allocator,
+    size_t capacity);
+
+/**
+ * @brief Removes all events from the block.
+ *
+ * @param self the EventBlock
+ */
+void sig_EventBlock_clear(struct sig_EventBlock* self);
+
+/**
+ * @brief Appends an event to the block.
+ *
+ * Events must be pushed in order. An event that is
+ * earlier than the last one, or that doesn't fit, is dropped.
+ *
+ * @param self the EventBlock
+ * @param offset the index of the sample at which the event occurs
+ * @param value the signal's value from that sample onwards
+ * @return true if the event was added, false if it was dropped
+ */
+bool sig_EventBlock_push(struct sig_EventBlock* self, uint32_t offset,
+    float value);
+
+/**
+ * @brief Replaces the contents of the block with an event
+ * for every sample at which a dense block of samples changes value.
+ *
+ * @param self the EventBlock
+ * @param source the dense block to read
+ * @param blockSize the number of samples in the block
+ * @param previousValue the value of the sample before the block;
+ * it is updated to the value of the block's last sample
+ */
+void sig_EventBlock_readBlock(struct sig_EventBlock* self,
+    float_array_ptr source, size_t blockSize, float* previousValue);
+
+/**
+ * @brief Renders the block's events as a dense block of samples,
+ * holding each event's value until the next one.
+ *
+ * @param self the EventBlock
+ * @param output the dense block to write
+ * @param blockSize the number of samples in the block
+ * @param currentValue the value to hold until the first event;
+ * it is updated to the value held at the end of the block
+ */
+void sig_EventBlock_writeBlock(struct sig_EventBlock* self,
+    float_array_ptr output, size_t blockSize, float* currentValue);
+
+void sig_EventBlock_destroy(struct sig_Allocator* allocator,
+    struct sig_EventBlock* self);
+
+
+/**
+ * @brief MIDI status bytes, with the channel bits cleared.
+ */
+enum sig_midi_Status {
+    sig_midi_Status_NOTE_OFF = 0x80,
+    sig_midi_Status_NOTE_ON = 0x90,
+    sig_midi_Status_POLY_PRESSURE = 0xA0,
+    sig_midi_Status_CONTROL_CHANGE = 0xB0,
+    sig_midi_Status_PROGRAM_CHANGE = 0xC0,
+    sig_midi_Status_CHANNEL_PRESSURE = 0xD0,
+    sig_midi_Status_PITCH_BEND = 0xE0,
+    sig_midi_Status_SYSEX_START = 0xF0,
+    sig_midi_Status_SYSEX_END = 0xF7,
+    sig_midi_Status_TIMING_CLOCK = 0xF8,
+    sig_midi_Status_START = 0xFA,
+    sig_midi_Status_CONTINUE = 0xFB,
+    sig_midi_Status_STOP = 0xFC
+};
+
+/**
+ * @brief The controller number of the "All Notes Off" channel mode message.
+ */
+#define sig_midi_CC_ALL_NOTES_OFF 123
+
+/**
+ * @brief A complete MIDI message, excluding system exclusive messages.
+ */
+struct sig_midi_Message {
+    /**
+     * @brief The status byte, including the channel (if any).
+     */
+    uint8_t status;
+
+    /**
+     * @brief The message's data bytes,
+     * which are zero if the message has fewer than two.
+     */
+    uint8_t data[2];
+};
+
+/**
+ * @brief Returns the message's type, with the channel bits cleared
+ * (e.g. sig_midi_Status_NOTE_ON).
+ *
+ * @param message the message
+ * @return uint8_t the message type
+ */
+uint8_t sig_midi_Message_type(struct sig_midi_Message* message);
+
+/**
+ * @brief Returns the channel of a channel message,
+ * numbered from 1 to 16.
+ *
+ * @param message the message
+ * @return uint8_t the channel, or 0 for system messages
+ */
+uint8_t sig_midi_Message_channel(struct sig_midi_Message* message);
+
+/**
+ * @brief Parses a stream of raw MIDI bytes into messages.
+ *
+ * The parser supports running status, and real-time messages
+ * (such as clock) that are interleaved within other messages.
+ * System exclusive messages are skipped.
+ */
+struct sig_midi_Parser {
+    uint8_t status;
+    uint8_t data[2];
+    uint8_t numData;
+    bool isInSysEx;
+};
+
+void sig_midi_Parser_init(struct sig_midi_Parser* self);
+
+/**
+ * @brief Parses the next byte of the stream.
+ *
+ * @param self the parser
+ * @param byte the byte
+ * @param message a message that will be written to
+ * if the byte completes one
+ * @return true if a message was completed
+ */
+bool sig_midi_Parser_parse(struct sig_midi_Parser* self, uint8_t byte,
+    struct sig_midi_Message* message);
+
+/**
+ * @brief A MIDI message that occurs at a particular sample of a block.
+ */
+struct sig_midi_Event {
+    /**
+     * @brief The index of the sample within the block
+     * at which the message takes effect.
+     */
+    uint32_t offset;
+
+    struct sig_midi_Message message;
+};
+
+/**
+ * @brief A timestamped queue of the MIDI messages received
+ * for a block, which can be connected to the MIDI Signals.
+ *
+ * Hosts write raw bytes into the queue as they are received,
+ * along with the offset of the sample within the next block
+ * at which they should take effect. Events are kept in order,
+ * so bytes must be written in the order they were received;
+ * an offset that is earlier than the previous one is moved
+ * forward to it. Offsets beyond the end of the block take effect
+ * at its last sample.
+ *
+ * Like an EventBlock, the queue must be cleared at the start of
+ * each block by whichever host writes to it.
+ */
+struct sig_midi_EventQueue {
+    /**
+     * @brief The maximum number of events the queue can hold.
+     */
+    size_t capacity;
+
+    /**
+     * @brief The number of events in the queue.
+     */
+    size_t length;
+
+    /**
+     * @brief The number of events that were dropped because
+     * the queue was full, since it was created.
+     */
+    size_t numDropped;
+
+    struct sig_midi_Event* events;
+
+    struct sig_midi_Parser parser;
+};
+
+struct sig_midi_EventQueue* sig_midi_EventQueue_new(
+    struct sig_Allocator* allocator, size_t capacity);
+
+void sig_midi_EventQueue_init(struct sig_midi_EventQueue* self);
+
+/**
+ * @brief Removes all events from the queue. The parser's state
+ * is retained, so that messages can span more than one block.
+ *
+ * @param self the queue
+ */
+void sig_midi_EventQueue_clear(struct sig_midi_EventQueue* self);
+
+/**
+ * @brief Adds an already-parsed message to the queue.
+ *
+ * @param self the queue
+ * @param offset the sample at which the message takes effect
+ * @param message the message
+ * @return true if the message was added, false if the queue was full
+ */
+bool sig_midi_EventQueue_push(struct sig_midi_EventQueue* self,
+    uint32_t offset, struct sig_midi_Message message);
+
+/**
+ * @brief Parses raw MIDI bytes and adds any messages they complete
+ * to the queue.
+ *
+ * @param self the queue
+ * @param bytes the bytes to parse
+ * @param numBytes the number of bytes
+ * @param offset the sample at which the bytes' messages take effect
+ * @return size_t the number of messages that were added
+ */
+size_t sig_midi_EventQueue_writeBytes(struct sig_midi_EventQueue* self,
+    const uint8_t* bytes, size_t numBytes, uint32_t offset);
+
+void sig_midi_EventQueue_destroy(struct sig_Allocator* allocator,
+    struct sig_midi_EventQueue* self);
+
+
+/**
+ * @brief The size, in bytes, of the cache lines that the indices
+ * of a RingBuffer are kept apart by. This is the line size of
+ * most desktop and application processors, and a multiple of the
+ * 32 byte line size of the Cortex-M7.
+ */
+#define sig_CACHE_LINE_SIZE 64
+
+// _Atomic is a C11 keyword that C++ doesn't share.
+// C++ hosts only use RingBuffers and ModMatrices through their
+// functions, which are compiled as C, so they see fields of the same
+// size.
+#ifdef __cplusplus
+    typedef size_t sig_AtomicSize;
+    typedef uint32_t sig_AtomicUInt32;
+    typedef float sig_AtomicFloat;
+#else
+    typedef atomic_size_t sig_AtomicSize;
+    typedef _Atomic uint32_t sig_AtomicUInt32;
+    typedef _Atomic float sig_AtomicFloat;
+#endif
+
+/**
+ * @brief A lock-free, wait-free queue of fixed-size items for
+ * passing data from exactly one producer thread to exactly one
+ * consumer thread, such as from an audio callback to a UI loop
+ * or the reverse.
+ *
+ * The capacity is always a power of two. The read and write
+ * indices count up forever and are only masked when items are
+ * accessed, so a full buffer (whose indices are capacity apart)
+ * is distinct from an empty one (whose indices are equal).
+ * The producer publishes items by storing its index with release
+ * ordering, and the consumer observes them by loading it with
+ * acquire ordering (and vice versa when space is freed).
+ * Each index is kept together with a cached copy of the other
+ * side's index, and each pair is surrounded by a full cache line
+ * of padding. Allocators only guarantee the alignment of a size_t,
+ * so this keeps each pair off the lines used by the other thread
+ * (and by the capacity and items fields, which both threads read)
+ * regardless of where the buffer is placed. The two threads
+ * therefore don't contend for the same line while the buffer is
+ * neither full nor empty.
+ */
+struct sig_RingBuffer {
+    /**
+     * @brief The maximum number of items the buffer can hold.
+     */
+    size_t capacity;
+
+    /**
+     * @brief The size, in bytes, of each item.
+     */
+    size_t itemSize;
+
+    uint8_t* items;
+
+    char producerPadding[sig_CACHE_LINE_SIZE];
+    sig_AtomicSize writeIdx;
+    size_t cachedReadIdx;
+
+    char consumerPadding[sig_CACHE_LINE_SIZE];
+    sig_AtomicSize readIdx;
+    size_t cachedWriteIdx;
+
+    char endPadding[sig_CACHE_LINE_SIZE];
+};
+
+/**
+ * @brief Creates a new, empty ring buffer.
+ *
+ * @param allocator the allocator to use
+ * @param capacity the minimum number of items the buffer must hold;
+ * this is rounded up to the next power of two
+ * @param itemSize the size, in bytes, of each item
+ * @return struct sig_RingBuffer* the new ring buffer
+ */
+struct sig_RingBuffer* sig_RingBuffer_new(struct sig_Allocator* allocator,
+    size_t capacity, size_t itemSize);
+
+/**
+ * @brief Empties the buffer. This is not thread safe, and should
+ * only be called before the producer and consumer have started.
+ *
+ * @param self the ring buffer
+ */
+void sig_RingBuffer_init(struct sig_RingBuffer* self);
+
+/**
+ * @brief Returns the number of items that can be read.
+ * This should only be called by the consumer; the producer
+ * may add more items at any time.
+ *
+ * @param self the ring buffer
+ * @return size_t the number of readable items
+ */
+size_t sig_RingBuffer_readable(struct sig_RingBuffer* self);
+
+/**
+ * @brief Returns the number of items that can be written
+ * without overwriting unread items. This should only be called
+ * by the producer; the consumer may free more space at any time.
+ *
+ * @param self the ring buffer
+ * @return size_t the number of writeable items
+ */
+size_t sig_RingBuffer_writeable(struct sig_RingBuffer* self);
+
+/**
+ * @brief Writes as many of the specified items as will fit.
+ * Only the producer may call this.
+ *
+ * @param self the ring buffer
+ * @param items the items to copy into the buffer
+ * @param numItems the number of items to write
+ * @return size_t the number of items that were written
+ */
+size_t sig_RingBuffer_pushSpan(struct sig_RingBuffer* self,
+    const void* items, size_t numItems);
+
+/**
+ * @brief Reads up to the specified number of items.
+ * Only the consumer may call this.
+ *
+ * @param self the ring buffer
+ * @param items the memory to copy the items into
+ * @param maxItems the maximum number of items to read
+ * @return size_t the number of items that were read
+ */
+size_t sig_RingBuffer_popSpan(struct sig_RingBuffer* self,
+    void* items, size_t maxItems);
+
+/**
+ * @brief Writes a single item. Only the producer may call this.
+ *
+ * @param self the ring buffer
+ * @param item the item to copy into the buffer
+ * @return true if the item was written, false if the buffer was full
+ */
+bool sig_RingBuffer_push(struct sig_RingBuffer* self, const void* item);
+
+/**
+ * @brief Reads a single item. Only the consumer may call this.
+ *
+ * @param self the ring buffer
+ * @param item the memory to copy the item into
+ * @return true if an item was read, false if the buffer was empty
+ */
+bool sig_RingBuffer_pop(struct sig_RingBuffer* self, void* item);
+
+/**
+ * @brief Discards all readable items. Only the consumer may call this.
+ *
+ * @param self the ring buffer
+ * @return size_t the number of items that were discarded
+ */
+size_t sig_RingBuffer_flush(struct sig_RingBuffer* self);
+
+void sig_RingBuffer_destroy(struct sig_Allocator* allocator,
+    struct sig_RingBuffer* self);
+
+
+
+/**
+ * @brief A modulatable delay line
+ * with support for comb and allpass configurations.
+ *
+ * Delay lines are not zeroed when they are initialized. Instead,
+ * they track how many samples have been written since
+ * initialization (up to the length of the buffer), and any
+ * read from a position that hasn't yet been written will return
+ * silence. This keeps initialization constant-time, even for very
+ * long delay lines stored in slow memory.
+ */
+struct sig_DelayLine {
+    struct sig_Buffer* buffer;
+    size_t writeIdx;
+    size_t numWritten;
+
+    // The number of samples written in a row
+    // whose magnitudes were below sig_DENORMAL_THRESHOLD.
+    size_t numQuietSamples;
+};
+
+struct sig_DelayLine* sig_DelayLine_new(struct sig_Allocator* allocator,
+    size_t maxDelayLength);
+
+struct sig_DelayLine* sig_DelayLine_newSeconds(struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings, float maxDelaySecs);
+
+struct sig_DelayLine* sig_DelayLine_newWithTransferredBuffer(
+    struct sig_Allocator* allocator, struct sig_Buffer* buffer);
+
+/**
+ * @brief Initializes (or resets) the delay line.
+ * This function does not write to the delay line's buffer; see
+ * the documentation for sig_DelayLine for details.
+ *
+ * @param self the delay line to initialize
+ */
+void sig_DelayLine_init(struct sig_DelayLine* self);
+
+/**
+ * @brief Reads the sample stored at the specified index
+ * of the delay line's buffer, returning silence
+ * if it hasn't been written since the delay line was initialized.
+ *
+ * @param self the delay line to read from
+ * @param idx the buffer index to read from
+ * @return float the stored sample, or 0.0f if it hasn't been written yet
+ */
+float sig_DelayLine_sampleAt(struct sig_DelayLine* self, size_t idx);
+
+typedef void (*sig_DelayLine_readFn)(void* signal);
+
+/**
+ * @brief Reads from the delay line without interpolation.
+ * This function does not support fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param readPos the position (in samples) at which to read from the delay
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_readAt(struct sig_DelayLine* self, size_t readPos);
+
+/**
+ * @brief Reads from the delay line using linear interpolation.
+ * This function supports fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param readPos the position (in samples) at which to read from the delay
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_linearReadAt(struct sig_DelayLine* self, float readPos);
+
+/**
+ * @brief Reads from the delay line using cubic interpolation.
+ * This function supports fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param readPos the position (in samples) at which to read from the delay
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_cubicReadAt(struct sig_DelayLine* self, float readPos);
+
+/**
+ * @brief Reads from the delay line using allpass interpolation.
+ * This function supports fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param readPos the position (in samples) to read from the delay at
+ * @param previousSample the previous interpolated sample from the delay line
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_allpassReadAt(struct sig_DelayLine* self,
+    float readPos, float previousSample);
+
+/**
+ * @brief Reads from the delay line without interpolation.
+ * This function does not support fractional delay times, and will truncate
+ * the delay time tap down to the nearest sample.
+ *
+ * @param self the delay line to read from
+ * @param tapTime the time (in seconds) at which to read from the delay
+ * @param sampleRate the current sample rate
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_readAtTime(struct sig_DelayLine* self, float source,
+    float tapTime, float sampleRate);
+
+/**
+ * @brief Reads from the delay line at the specified time
+ * (in seconds) using linear interpolation.
+ * This function supports fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param tapTime the time (in seconds) at which to read from the delay
+ * @param sampleRate the current sample rate
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_linearReadAtTime(struct sig_DelayLine* self, float source,
+    float tapTime, float sampleRate);
+
+/**
+ * @brief Reads from the delay line at the specified time
+ * (in seconds) using cubic interpolation.
+ * This function supports fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param tapTime the time (in seconds) at which to read from the delay
+ * @param sampleRate the current sample rate
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_cubicReadAtTime(struct sig_DelayLine* self, float source,
+    float tapTime, float sampleRate);
+
+/**
+ * @brief Reads from the delay line at the specified time
+ * (in seconds) using allpass interpolation.
+ * This function supports fractional delay times.
+ *
+ * @param self the delay line to read from
+ * @param tapTime the time (in seconds) at which to read from the delay
+ * @param sampleRate the current sample rate
+ * @param previousSample the previous interpolated sample from the delay line
+ * @return float the output of the delay line
+ */
+float sig_DelayLine_allpassReadAtTime(struct sig_DelayLine* self,
+    float source, float tapTime, float sampleRate, float previousSample);
+
+float sig_DelayLine_readAtTimes(struct sig_DelayLine* self, float source,
+    float_array_ptr tapTimes, float_array_ptr tapGains, size_t numTaps,
+    float sampleRate, float timeScale);
+
+float sig_DelayLine_linearReadAtTimes(struct sig_DelayLine* self,
+    float source, float_array_ptr tapTimes, float_array_ptr tapGains,
+    size_t numTaps, float sampleRate, float timeScale);
+
+float sig_DelayLine_cubicReadAtTimes(struct sig_DelayLine* self,
+    float source, float_array_ptr tapTimes, float_array_ptr tapGains,
+    size_t numTaps, float sampleRate, float timeScale);
+
+void sig_DelayLine_write(struct sig_DelayLine* self, float sample);
+
+float sig_DelayLine_calcFeedbackGain(float delayTime, float decayTime);
+
+/**
+ * @brief Zeroes the delay line once every sample that can be read
+ * from it has decayed below sig_DENORMAL_THRESHOLD, so that
+ * decaying feedback doesn't fill it with denormals. The comb and
+ * allpass functions below don't flush the samples they write;
+ * Signals that use them should call this once per block instead.
+ *
+ * @param self the delay line
+ * @param blockPeak the largest magnitude written during the block
+ * @param blockSize the number of samples written during the block
+ * @param maxReadPos the furthest position read from during the block
+ */
+void sig_DelayLine_flushDenormals(struct sig_DelayLine* self,
+    float blockPeak, size_t blockSize, float maxReadPos);
+
+float sig_DelayLine_feedback(float sample, float read, float g);
+
+float sig_DelayLine_comb(struct sig_DelayLine* self, float sample,
+    size_t readPos, float g);
+
+float sig_DelayLine_cubicComb(struct sig_DelayLine* self, float sample,
+    float readPos, float g);
+
+float sig_DelayLine_allpass(struct sig_DelayLine* self, float sample,
+    size_t readPos, float g);
+
+float sig_DelayLine_linearAllpass(struct sig_DelayLine* self,
     float sample, float readPos, float g);
 
 float sig_DelayLine_cubicAllpass(struct sig_DelayLine* self, float sample,
@@ -1259,6 +2306,157 @@ float sig_DelayLine_cubicAllpass(struct sig_DelayLine* self, float sample,
 void sig_DelayLine_destroy(struct sig_Allocator* allocator,
     struct sig_DelayLine* self);
 
+
+/**
+ * @brief The number of unique coefficients in the halfband filters
+ * used between the base sample rate and twice the base rate,
+ * where the sharpest transition band is required.
+ */
+#define sig_filter_Halfband_SHARP_HALF_LENGTH 16
+
+/**
+ * @brief The number of unique coefficients in the halfband filters
+ * used between higher oversampling rates, where the signal
+ * occupies only a fraction of the spectrum and
+ * a much wider transition band is acceptable.
+ */
+#define sig_filter_Halfband_RELAXED_HALF_LENGTH 6
+
+/**
+ * @brief A halfband low pass filter that can upsample or downsample
+ * a signal by a factor of two, in polyphase form.
+ *
+ * The filter is a Kaiser-windowed sinc with 4 * halfLength - 1 taps.
+ * Every other tap of a halfband filter is zero, and in polyphase form
+ * one of the two branches reduces to a pure delay, so each output
+ * sample costs only 2 * halfLength multiplications.
+ * Its stopband attenuation is approximately 80 dB.
+ */
+struct sig_filter_Halfband {
+    size_t halfLength;
+
+    // The 2 * halfLength non-zero taps of the polyphase branch.
+    float_array_ptr coefficients;
+
+    // Double-buffered histories, so that
+    // they can be read without wrapping.
+    float_array_ptr history;
+    float_array_ptr delayHistory;
+    size_t writeIdx;
+};
+
+struct sig_filter_Halfband* sig_filter_Halfband_new(
+    struct sig_Allocator* allocator, size_t halfLength);
+
+void sig_filter_Halfband_init(struct sig_filter_Halfband* self);
+
+/**
+ * @brief Upsamples a block by a factor of two.
+ *
+ * @param self the filter
+ * @param input the input samples
+ * @param output the output samples, which must be twice as long as the input
+ * @param inputLength the number of input samples
+ */
+void sig_filter_Halfband_upsample(struct sig_filter_Halfband* self,
+    float_array_ptr input, float_array_ptr output, size_t inputLength);
+
+/**
+ * @brief Downsamples a block by a factor of two.
+ *
+ * @param self the filter
+ * @param input the input samples, which must be twice as long as the output
+ * @param output the output samples
+ * @param outputLength the number of output samples
+ */
+void sig_filter_Halfband_downsample(struct sig_filter_Halfband* self,
+    float_array_ptr input, float_array_ptr output, size_t outputLength);
+
+/**
+ * @brief Returns the delay, in samples at the higher of its two rates,
+ * that the filter introduces.
+ */
+size_t sig_filter_Halfband_latency(struct sig_filter_Halfband* self);
+
+void sig_filter_Halfband_destroy(struct sig_Allocator* allocator,
+    struct sig_filter_Halfband* self);
+
+
+#define sig_FFT_MIN_LENGTH 32
+#define sig_FFT_MAX_LENGTH 8192
+
+/**
+ * @brief An in-place, allocation-free real Fast Fourier Transform
+ * for power of two lengths between sig_FFT_MIN_LENGTH and
+ * sig_FFT_MAX_LENGTH.
+ *
+ * A real signal of length N is transformed using a complex FFT of
+ * length N / 2, which is computed using radix-4 butterflies (with a
+ * single radix-2 stage when N / 2 is not a power of four).
+ * Twiddle factors and the bit reversal table are calculated when
+ * the FFT is created, so no allocation or trigonometry
+ * takes place when transforming.
+ *
+ * Spectra are stored in the packed format used by CMSIS-DSP:
+ * [Re(0), Re(N/2), Re(1), Im(1), Re(2), Im(2), ... Re(N/2-1), Im(N/2-1)],
+ * since the imaginary parts of the DC and Nyquist bins are always zero.
+ */
+struct sig_FFT {
+    size_t length;
+
+    // Interleaved twiddle factors for the complex FFT of length / 2.
+    float_array_ptr twiddles;
+
+    // Interleaved twiddle factors used to separate the real spectrum
+    // from the half-length complex spectrum.
+    float_array_ptr realTwiddles;
+
+    uint16_t* bitReversal;
+};
+
+/**
+ * @brief Creates a new FFT.
+ *
+ * @param allocator the allocator to use
+ * @param length the transform length, which must be a power of two
+ * between sig_FFT_MIN_LENGTH and sig_FFT_MAX_LENGTH
+ * @return struct sig_FFT* the new FFT, or NULL if the length is unsupported
+ */
+struct sig_FFT* sig_FFT_new(struct sig_Allocator* allocator, size_t length);
+
+/**
+ * @brief Transforms a real signal into its packed spectrum, in place.
+ *
+ * @param self the FFT
+ * @param samples the FFT's length worth of samples
+ * (e.g. a sig_Buffer's samples) to transform
+ */
+void sig_FFT_forward(struct sig_FFT* self, float_array_ptr samples);
+
+/**
+ * @brief Transforms a packed spectrum back into a real signal, in place.
+ * The result is scaled such that the inverse of a forward
+ * transform reproduces the original signal.
+ *
+ * @param self the FFT
+ * @param samples the packed spectrum to transform
+ */
+void sig_FFT_inverse(struct sig_FFT* self, float_array_ptr samples);
+
+/**
+ * @brief Multiplies two packed spectra and adds the result
+ * to a third packed spectrum.
+ *
+ * @param self the FFT that produced the spectra
+ * @param a the first spectrum
+ * @param b the second spectrum
+ * @param accumulator the spectrum to add the product to
+ */
+void sig_FFT_multiplyAccumulate(struct sig_FFT* self, float_array_ptr a,
+    float_array_ptr b, float_array_ptr accumulator);
+
+void sig_FFT_destroy(struct sig_Allocator* allocator, struct sig_FFT* self);
+
 float sig_linearXFade(float left, float right, float mix);
 
 float sig_sineWavefolder(float x, float gain, float factor);
@@ -1309,6 +2507,36 @@ void sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(
     struct sig_Allocator* allocator,
     struct sig_dsp_Signal_SingleMonoOutput* outputs);
 
+/**
+ * @brief Describes how an input changed over the course of a block.
+ * The values are ordered by severity, so the changes
+ * to several inputs can be combined by taking their maximum.
+ */
+enum sig_dsp_InputChange {
+    // The input is constant and unchanged since the previous block.
+    sig_dsp_InputChange_NONE,
+    // The input is constant, but changed since the previous block.
+    sig_dsp_InputChange_STEP,
+    // The input changed within the block (i.e. audio rate modulation).
+    sig_dsp_InputChange_MODULATED
+};
+
+/**
+ * @brief Detects how an input has changed since the previous block.
+ *
+ * Signals with expensive coefficient calculations can use this to
+ * recalculate them at most once per block: not at all if the input
+ * hasn't changed, immediately for a step change, and for modulated
+ * inputs, at the end of the block, interpolating linearly across it.
+ *
+ * @param input the input's samples
+ * @param blockSize the number of samples in the block
+ * @param previousValue the value of the input at the end of the previous block
+ * @return enum sig_dsp_InputChange the kind of change
+ */
+enum sig_dsp_InputChange sig_dsp_detectInputChange(float_array_ptr input,
+    size_t blockSize, float previousValue);
+
 
 void sig_dsp_evaluateSignals(struct sig_List* signalList);
 
@@ -1321,9 +2549,17 @@ struct sig_dsp_SignalEvaluator {
     sig_dsp_SignalEvaluator_evaluate evaluate;
 };
 
+/**
+ * @brief Evaluates a list of Signals in order.
+ *
+ * When flushDenormals is true (the default), the processor's
+ * flush-to-zero mode will be enabled while the Signals are evaluated,
+ * on platforms that support it.
+ */
 struct sig_dsp_SignalListEvaluator {
     sig_dsp_SignalEvaluator_evaluate evaluate;
     struct sig_List* signalList;
+    bool flushDenormals;
 };
 
 struct sig_dsp_SignalListEvaluator* sig_dsp_SignalListEvaluator_new(
@@ -1371,11 +2607,27 @@ void sig_dsp_Value_destroy(struct sig_Allocator* allocator,
 struct sig_dsp_ConstantValue {
     struct sig_dsp_Signal signal;
     struct sig_dsp_Signal_SingleMonoOutput outputs;
+    size_t numChannels;
 };
 
 struct sig_dsp_ConstantValue* sig_dsp_ConstantValue_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context,
     float value);
+
+/**
+ * @brief Allocates a new ConstantValue whose output
+ * contains the specified number of channels.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of channels,
+ * between 1 and sig_MAX_CHANNELS
+ * @param value the value of every channel
+ * @return struct sig_dsp_ConstantValue* the new ConstantValue
+ */
+struct sig_dsp_ConstantValue* sig_dsp_ConstantValue_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels, float value);
 void sig_dsp_ConstantValue_init(struct sig_dsp_ConstantValue* self,
     struct sig_SignalContext* context, float value);
 void sig_dsp_ConstantValue_destroy(struct sig_Allocator* allocator,
@@ -1428,10 +2680,26 @@ struct sig_dsp_ScaleOffset {
     struct sig_dsp_Signal_SingleSourceInput inputs;
     struct sig_dsp_ScaleOffset_Parameters parameters;
     struct sig_dsp_Signal_SingleMonoOutput outputs;
+    size_t numChannels;
 };
 
 struct sig_dsp_ScaleOffset* sig_dsp_ScaleOffset_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+
+/**
+ * @brief Allocates a new ScaleOffset that processes
+ * a multichannel source, whose output
+ * has the same number of channels.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of channels,
+ * between 1 and sig_MAX_CHANNELS
+ * @return struct sig_dsp_ScaleOffset* the new ScaleOffset
+ */
+struct sig_dsp_ScaleOffset* sig_dsp_ScaleOffset_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_ScaleOffset_init(struct sig_dsp_ScaleOffset* self,
     struct sig_SignalContext* context);
 void sig_dsp_ScaleOffset_generate(void* signal);
@@ -1459,19 +2727,37 @@ struct sig_dsp_BinaryOp_Inputs {
     float_array_ptr right;
 };
 
+/**
+ * @brief A Signal that combines two inputs sample by sample.
+ *
+ * Each input of a multichannel BinaryOp is treated as mono by default,
+ * and is shared by every channel of the output (e.g. a mono gain
+ * applied to a stereo signal). Set numLeftChannels or numRightChannels
+ * to the number of channels in a multichannel input when connecting it;
+ * inputs with fewer channels than the output are repeated across it.
+ */
 struct sig_dsp_BinaryOp {
     struct sig_dsp_Signal signal;
     struct sig_dsp_BinaryOp_Inputs inputs;
     struct sig_dsp_Signal_SingleMonoOutput outputs;
+    size_t numChannels;
+    size_t numLeftChannels;
+    size_t numRightChannels;
 };
 
 struct sig_dsp_BinaryOp* sig_dsp_BinaryOp_new(struct sig_Allocator* allocator,
     struct sig_SignalContext* context, sig_dsp_generateFn generate);
+struct sig_dsp_BinaryOp* sig_dsp_BinaryOp_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels, sig_dsp_generateFn generate);
 void sig_dsp_BinaryOp_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context, sig_dsp_generateFn generate);
 
 struct sig_dsp_BinaryOp* sig_dsp_Add_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+struct sig_dsp_BinaryOp* sig_dsp_Add_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Add_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context);
 void sig_dsp_Add_generate(void* signal);
@@ -1480,6 +2766,9 @@ void sig_dsp_Add_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_BinaryOp* sig_dsp_Sub_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+struct sig_dsp_BinaryOp* sig_dsp_Sub_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Sub_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context);
 void sig_dsp_Sub_generate(void* signal);
@@ -1488,6 +2777,9 @@ void sig_dsp_Sub_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_BinaryOp* sig_dsp_Mul_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+struct sig_dsp_BinaryOp* sig_dsp_Mul_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Mul_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context);
 void sig_dsp_Mul_generate(void* signal);
@@ -1496,6 +2788,9 @@ void sig_dsp_Mul_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_BinaryOp* sig_dsp_Div_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+struct sig_dsp_BinaryOp* sig_dsp_Div_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Div_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context);
 void sig_dsp_Div_generate(void* signal);
@@ -1571,6 +2866,71 @@ void sig_dsp_Accumulate_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Accumulate* self);
 
 
+struct sig_dsp_BlockToEvents_Inputs {
+    float_array_ptr source;
+};
+
+struct sig_dsp_BlockToEvents_Outputs {
+    /**
+     * @brief An event for each sample at which the source changes.
+     */
+    struct sig_EventBlock* main;
+};
+
+/**
+ * @brief Converts a dense trigger, gate, or clock signal into events,
+ * so that it can be connected to the event inputs of other Signals.
+ *
+ * Inputs:
+ *  - source the dense signal to convert
+ */
+struct sig_dsp_BlockToEvents {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_BlockToEvents_Inputs inputs;
+    struct sig_dsp_BlockToEvents_Outputs outputs;
+    float previousValue;
+};
+
+struct sig_dsp_BlockToEvents* sig_dsp_BlockToEvents_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_BlockToEvents_init(struct sig_dsp_BlockToEvents* self,
+    struct sig_SignalContext* context);
+void sig_dsp_BlockToEvents_generate(void* signal);
+void sig_dsp_BlockToEvents_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BlockToEvents* self);
+
+
+struct sig_dsp_EventsToBlock_Inputs {
+    /**
+     * @brief The events to convert.
+     */
+    struct sig_EventBlock* source;
+};
+
+/**
+ * @brief Renders events as a dense signal,
+ * holding the value of each event until the next one.
+ *
+ * Inputs:
+ *  - source the events to render; while unconnected,
+ *    the output holds its last value
+ */
+struct sig_dsp_EventsToBlock {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_EventsToBlock_Inputs inputs;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    float currentValue;
+};
+
+struct sig_dsp_EventsToBlock* sig_dsp_EventsToBlock_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_EventsToBlock_init(struct sig_dsp_EventsToBlock* self,
+    struct sig_SignalContext* context);
+void sig_dsp_EventsToBlock_generate(void* signal);
+void sig_dsp_EventsToBlock_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_EventsToBlock* self);
+
+
 /**
  * Inputs for a GatedTimer.
  */
@@ -1590,6 +2950,12 @@ struct sig_dsp_GatedTimer_Inputs {
      * after it has finished. Values >0.0 denote true.
      */
     float_array_ptr loop;
+
+    /**
+     * Optional gate events to read instead of the gate input.
+     * When connected, the gate input is ignored.
+     */
+    struct sig_EventBlock* gateEvents;
 };
 
 /**
@@ -1606,6 +2972,7 @@ struct sig_dsp_GatedTimer {
     unsigned long timer;
     bool hasFired;
     float prevGate;
+    float currentGate;
 };
 
 struct sig_dsp_GatedTimer* sig_dsp_GatedTimer_new(
@@ -1638,6 +3005,12 @@ struct sig_dsp_TimedTriggerCounter_Inputs {
      * Decimal points will be truncated and ignored.
      */
     float_array_ptr count;
+
+    /**
+     * Optional trigger events to count instead of the source input.
+     * When connected, the source input is ignored.
+     */
+    struct sig_EventBlock* sourceEvents;
 };
 
 /**
@@ -1680,6 +3053,12 @@ struct sig_dsp_ToggleGate_Inputs {
      * to a positive value will be interpreted as a trigger.
      */
     float_array_ptr trigger;
+
+    /**
+     * Optional trigger events to read instead of the trigger input.
+     * When connected, the trigger input is ignored.
+     */
+    struct sig_EventBlock* triggerEvents;
 };
 
 /**
@@ -1745,43 +3124,244 @@ void sig_dsp_Oscillator_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Oscillator* self);
 
 
-void sig_dsp_SineOscillator_init(struct sig_dsp_Oscillator* self,
-    struct sig_SignalContext* context);
-struct sig_dsp_Oscillator* sig_dsp_SineOscillator_new(struct sig_Allocator* allocator,
+void sig_dsp_SineOscillator_init(struct sig_dsp_Oscillator* self,
+    struct sig_SignalContext* context);
+struct sig_dsp_Oscillator* sig_dsp_SineOscillator_new(struct sig_Allocator* allocator,
+    struct sig_SignalContext* context);
+void sig_dsp_SineOscillator_generate(void* signal);
+void sig_dsp_SineOscillator_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Oscillator* self);
+
+struct sig_dsp_FastLFSineOscillator_Inputs {
+    float_array_ptr frequency;
+    float_array_ptr mul;
+    float_array_ptr add;
+};
+
+struct sig_dsp_FastLFSineOscillator {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_FastLFSineOscillator_Inputs inputs;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    struct sig_osc_FastLFSine state;
+};
+
+void sig_dsp_FastLFSineOscillator_init(struct sig_dsp_FastLFSineOscillator* self,
+    struct sig_SignalContext* context);
+struct sig_dsp_FastLFSineOscillator* sig_dsp_FastLFSineOscillator_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_FastLFSineOscillator_generate(void* signal);
+void sig_dsp_FastLFSineOscillator_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_FastLFSineOscillator* self);
+
+#define sig_dsp_SineBank_MAX_PARTIALS 256
+
+// The number of partials that are rendered together in each
+// vectorized step; partial storage is padded to a multiple of it.
+#define sig_dsp_SineBank_LANES 16
+
+struct sig_dsp_SineBank_Inputs {
+    float_array_ptr freq;
+    float_array_ptr mul;
+    float_array_ptr add;
+};
+
+/**
+ * @brief An additive oscillator bank that renders up to
+ * sig_dsp_SineBank_MAX_PARTIALS sine partials,
+ * each with its own frequency ratio, amplitude and starting phase.
+ *
+ * Each partial is a recursive quadrature oscillator (a rotating
+ * complex phasor), which only requires a few multiplies per sample.
+ * Partials are rendered in groups of sig_dsp_SineBank_LANES
+ * so that they vectorize, and are renormalized at the end of
+ * each block so that their amplitudes remain stable indefinitely.
+ *
+ * The fundamental frequency is read once per block, and changes to
+ * the amplitude of each partial are interpolated linearly over
+ * the block (so partials fade in during the first block).
+ * Partials at or above the Nyquist frequency are faded out
+ * and are not rendered.
+ *
+ * Inputs:
+ *  - freq: the fundamental frequency, read at the start of each block
+ *  - mul: the amount to scale the output by
+ *  - add: the amount to offset the output by
+ *
+ * Outputs:
+ *  - main: the sum of all partials
+ */
+struct sig_dsp_SineBank {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_SineBank_Inputs inputs;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+
+    size_t numPartials;
+
+    // The frequency of each partial, relative to the fundamental.
+    // Defaults to the harmonic series.
+    float_array_ptr ratios;
+
+    // The amplitude of each partial.
+    // Defaults to 1.0 for the fundamental and 0.0 for all others.
+    float_array_ptr amplitudes;
+
+    // The starting phase of each partial, in cycles,
+    // which is applied when the Signal is initialized and
+    // when sig_dsp_SineBank_resetPhases() is called.
+    float_array_ptr phases;
+
+    // The per-partial oscillator state, padded to a multiple of
+    // sig_dsp_SineBank_LANES partials.
+    size_t paddedNumPartials;
+    float_array_ptr increments;
+    float_array_ptr cosIncrements;
+    float_array_ptr sinIncrements;
+    float_array_ptr cosZ;
+    float_array_ptr sinZ;
+    float_array_ptr currentAmplitudes;
+    float_array_ptr amplitudeSteps;
+
+    // Per-lane sums of the partials for each sample in the block.
+    float_array_ptr mix;
+};
+
+/**
+ * @brief Allocates a new SineBank with the specified number of partials.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numPartials the number of partials, between 1 and
+ * sig_dsp_SineBank_MAX_PARTIALS (larger values will be clamped)
+ * @return struct sig_dsp_SineBank* the new SineBank
+ */
+struct sig_dsp_SineBank* sig_dsp_SineBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numPartials);
+void sig_dsp_SineBank_init(struct sig_dsp_SineBank* self,
+    struct sig_SignalContext* context);
+
+/**
+ * @brief Resets each partial's oscillator to its starting phase.
+ *
+ * @param self the SineBank
+ */
+void sig_dsp_SineBank_resetPhases(struct sig_dsp_SineBank* self);
+void sig_dsp_SineBank_generate(void* signal);
+void sig_dsp_SineBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_SineBank* self);
+
+
+void sig_dsp_LFTriangle_init(struct sig_dsp_Oscillator* self,
     struct sig_SignalContext* context);
-void sig_dsp_SineOscillator_generate(void* signal);
-void sig_dsp_SineOscillator_destroy(struct sig_Allocator* allocator,
+struct sig_dsp_Oscillator* sig_dsp_LFTriangle_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_LFTriangle_generate(void* signal);
+void sig_dsp_LFTriangle_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Oscillator* self);
 
-struct sig_dsp_FastLFSineOscillator_Inputs {
-    float_array_ptr frequency;
+
+struct sig_dsp_BLEPOscillator_Inputs {
+    float_array_ptr freq;
+    float_array_ptr phaseOffset;
     float_array_ptr mul;
     float_array_ptr add;
+
+    /**
+     * Pulse width modulation, between -1.0 and 1.0,
+     * where 0.0 produces a square wave. Only used by BLEPSquare.
+     */
+    float_array_ptr pwm;
+
+    /**
+     * Resets the oscillator's phase when it changes
+     * from zero or below to a positive value (i.e. hard sync).
+     */
+    float_array_ptr sync;
 };
 
-struct sig_dsp_FastLFSineOscillator {
+/**
+ * @brief An audio rate oscillator whose discontinuities are band-limited
+ * using PolyBLEP and PolyBLAMP residuals.
+ *
+ * Each block is rendered in three passes: the phase is accumulated,
+ * the naive waveform is calculated (which vectorizes),
+ * and then residuals are added only to the samples that lie within
+ * a sample of a discontinuity. Hard sync resets take effect
+ * at the start of the sample in which they are received, and are
+ * band-limited accordingly. Band-limiting assumes positive frequencies.
+ *
+ * Inputs:
+ *  - freq: the frequency of the oscillator
+ *  - phaseOffset: an offset to the phase, in cycles
+ *  - mul: the amount to scale the waveform by
+ *  - add: the amount to offset the waveform by
+ *  - pwm: the pulse width modulation (BLEPSquare only)
+ *  - sync: a hard sync input
+ *
+ * Outputs:
+ *  - main: the oscillator's output
+ *  - eoc: an end of cycle trigger
+ */
+struct sig_dsp_BLEPOscillator {
     struct sig_dsp_Signal signal;
-    struct sig_dsp_FastLFSineOscillator_Inputs inputs;
-    struct sig_dsp_Signal_SingleMonoOutput outputs;
-    struct sig_osc_FastLFSine state;
+    struct sig_dsp_BLEPOscillator_Inputs inputs;
+    struct sig_dsp_Oscillator_Outputs outputs;
+    struct sig_osc_Oscillator state;
+
+    float previousSync;
+
+    // The wrapped phase of each sample in the current block.
+    float_array_ptr phases;
+
+    // The phase at which the oscillator was reset by sync,
+    // or -1.0 if it wasn't reset, for each sample in the current block.
+    float_array_ptr syncPhases;
 };
 
-void sig_dsp_FastLFSineOscillator_init(struct sig_dsp_FastLFSineOscillator* self,
-    struct sig_SignalContext* context);
-struct sig_dsp_FastLFSineOscillator* sig_dsp_FastLFSineOscillator_new(
-    struct sig_Allocator* allocator, struct sig_SignalContext* context);
-void sig_dsp_FastLFSineOscillator_generate(void* signal);
-void sig_dsp_FastLFSineOscillator_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_FastLFSineOscillator* self);
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPOscillator_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    sig_dsp_generateFn generate);
+void sig_dsp_BLEPOscillator_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context, sig_dsp_generateFn generate);
+void sig_dsp_BLEPOscillator_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self);
 
+/**
+ * @brief A band-limited saw wave oscillator,
+ * with the same phase and polarity as sig_waveform_saw.
+ */
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPSaw_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_BLEPSaw_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context);
+void sig_dsp_BLEPSaw_generate(void* signal);
+void sig_dsp_BLEPSaw_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self);
 
-void sig_dsp_LFTriangle_init(struct sig_dsp_Oscillator* self,
+/**
+ * @brief A band-limited pulse wave oscillator, which produces
+ * a square wave with the same phase and polarity as
+ * sig_waveform_square when its pwm input is 0.0.
+ */
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPSquare_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_BLEPSquare_init(struct sig_dsp_BLEPOscillator* self,
     struct sig_SignalContext* context);
-struct sig_dsp_Oscillator* sig_dsp_LFTriangle_new(
+void sig_dsp_BLEPSquare_generate(void* signal);
+void sig_dsp_BLEPSquare_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self);
+
+/**
+ * @brief A band-limited triangle wave oscillator,
+ * with the same phase and polarity as sig_waveform_triangle.
+ */
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPTriangle_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
-void sig_dsp_LFTriangle_generate(void* signal);
-void sig_dsp_LFTriangle_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_Oscillator* self);
+void sig_dsp_BLEPTriangle_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context);
+void sig_dsp_BLEPTriangle_generate(void* signal);
+void sig_dsp_BLEPTriangle_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self);
 
 
 struct sig_dsp_WavetableOscillator {
@@ -1923,6 +3503,17 @@ struct sig_dsp_OnePole_Inputs {
     float_array_ptr frequency;
 };
 
+/**
+ * @brief A one pole low pass or high pass filter.
+ *
+ * Coefficients are recalculated at most once per block,
+ * and are interpolated across the block when the frequency
+ * is modulated at audio rate.
+ *
+ * Inputs:
+ *  - source: the input to filter
+ *  - frequency: the cutoff frequency in Hz
+ */
 struct sig_dsp_OnePole {
     struct sig_dsp_Signal signal;
     struct sig_dsp_OnePole_Inputs inputs;
@@ -1932,13 +3523,29 @@ struct sig_dsp_OnePole {
     float a1;
     enum sig_dsp_OnePole_Mode previousMode;
     float previousFrequency;
-    float previousSample;
+    size_t numChannels;
+    float previousSamples[sig_MAX_CHANNELS];
 };
 
 void sig_dsp_OnePole_init(struct sig_dsp_OnePole* self,
     struct sig_SignalContext* context);
 struct sig_dsp_OnePole* sig_dsp_OnePole_new(struct sig_Allocator* allocator,
     struct sig_SignalContext* context);
+
+/**
+ * @brief Allocates a new OnePole that filters each channel
+ * of a multichannel source. The frequency input is mono,
+ * and is shared by all channels.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of channels,
+ * between 1 and sig_MAX_CHANNELS
+ * @return struct sig_dsp_OnePole* the new OnePole
+ */
+struct sig_dsp_OnePole* sig_dsp_OnePole_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_OnePole_recalculateCoefficients(struct sig_dsp_OnePole* self,
     float frequency);
 void sig_dsp_OnePole_generate(void* signal);
@@ -1973,6 +3580,8 @@ struct sig_dsp_Dust_Inputs {
     float_array_ptr density;
 };
 
+#define sig_dsp_Dust_NEVER SIZE_MAX
+
 /**
  * Generates random impulses.
  *
@@ -1980,6 +3589,12 @@ struct sig_dsp_Dust_Inputs {
  * the output will be in the range of 0 to 1.
  * If bipolar >0, impulses between -1 and 1 will be generated.
  *
+ * Rather than testing every sample for an impulse, the interval
+ * until the next impulse is drawn from a geometric distribution
+ * (the discrete equivalent of an exponential distribution),
+ * so the cost of generating a block is proportional to the
+ * number of impulses it contains.
+ *
  * Inputs:
  * - density: the number of impulses per second
  *
@@ -1996,8 +3611,9 @@ struct sig_dsp_Dust {
     float sampleDuration;
 
     float previousDensity;
-    float threshold;
-    float scale;
+    float logNoImpulseProbability;
+    size_t samplesUntilImpulse;
+    struct sig_Random random;
 };
 
 void sig_dsp_Dust_init(struct sig_dsp_Dust* self,
@@ -2009,6 +3625,74 @@ void sig_dsp_Dust_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Dust* self);
 
 
+/**
+ * @brief Generates white noise in the range of -1 to 1.
+ *
+ * Each instance is seeded from its SignalContext's random number
+ * generator when it is initialized.
+ */
+struct sig_dsp_WhiteNoise {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    struct sig_Random random;
+};
+
+void sig_dsp_WhiteNoise_init(struct sig_dsp_WhiteNoise* self,
+    struct sig_SignalContext* context);
+struct sig_dsp_WhiteNoise* sig_dsp_WhiteNoise_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_WhiteNoise_generate(void* signal);
+void sig_dsp_WhiteNoise_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_WhiteNoise* self);
+
+
+#define sig_dsp_PinkNoise_NUM_POLES 7
+
+/**
+ * @brief Generates pink (1/f) noise, roughly in the range of -1 to 1.
+ *
+ * White noise is filtered using Paul Kellet's refined method
+ * (https://www.firstpr.com.au/dsp/pink-noise/), which is
+ * accurate to within 0.05 dB above 9.2 Hz at a 44.1 KHz sample rate.
+ */
+struct sig_dsp_PinkNoise {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    struct sig_Random random;
+    float poles[sig_dsp_PinkNoise_NUM_POLES];
+};
+
+void sig_dsp_PinkNoise_init(struct sig_dsp_PinkNoise* self,
+    struct sig_SignalContext* context);
+struct sig_dsp_PinkNoise* sig_dsp_PinkNoise_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_PinkNoise_generate(void* signal);
+void sig_dsp_PinkNoise_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_PinkNoise* self);
+
+
+/**
+ * @brief Generates brown (1/f^2) noise, roughly in the range of -1 to 1.
+ *
+ * White noise is integrated using a leaky integrator,
+ * which prevents the output from drifting away from zero.
+ */
+struct sig_dsp_BrownNoise {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    struct sig_Random random;
+    float previousSample;
+};
+
+void sig_dsp_BrownNoise_init(struct sig_dsp_BrownNoise* self,
+    struct sig_SignalContext* context);
+struct sig_dsp_BrownNoise* sig_dsp_BrownNoise_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_BrownNoise_generate(void* signal);
+void sig_dsp_BrownNoise_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BrownNoise* self);
+
+
 
 struct sig_dsp_TimedGate_Parameters {
     float resetOnTrigger;
@@ -2018,6 +3702,12 @@ struct sig_dsp_TimedGate_Parameters {
 struct sig_dsp_TimedGate_Inputs {
     float_array_ptr trigger;
     float_array_ptr duration;
+
+    /**
+     * Optional trigger events to read instead of the trigger input.
+     * When connected, the trigger input is ignored.
+     */
+    struct sig_EventBlock* triggerEvents;
 };
 
 /**
@@ -2106,6 +3796,14 @@ struct sig_dsp_Clock_Parameters {
 struct sig_dsp_ClockSource_Inputs {
     float_array_ptr pulse;
     float_array_ptr tap;
+
+    /**
+     * Optional pulse and tap events to read instead of
+     * the pulse and tap inputs. Both must be connected
+     * for either to be used; the dense inputs are then ignored.
+     */
+    struct sig_EventBlock* pulseEvents;
+    struct sig_EventBlock* tapEvents;
 };
 
 /**
@@ -2135,6 +3833,7 @@ struct sig_dsp_ClockSource {
     uint32_t samplesSinceLastTap;
     bool isLatching;
     uint32_t latchedTapSamplesRemaining;
+    float currentPulseValue;
 };
 
 void sig_dsp_ClockSource_init(
@@ -2148,68 +3847,251 @@ void sig_dsp_ClockSource_destroy(struct sig_Allocator* allocator,
 
 
 
-/**
- * @brief Inputs for a ClockDetector.
- */
-struct sig_dsp_ClockDetector_Inputs {
+/**
+ * @brief Inputs for a ClockDetector.
+ */
+struct sig_dsp_ClockDetector_Inputs {
+    /**
+     * @brief The incoming clock signal.
+     */
+    float_array_ptr source;
+
+    /**
+     * @brief Optional clock events to read instead of the source input.
+     * When connected, the source input is ignored.
+     */
+    struct sig_EventBlock* sourceEvents;
+};
+
+struct sig_dsp_ClockDetector_Outputs {
+    /**
+     * @brief The detected clock frequency in pulses per second (i.e. Hz).
+     */
+    float_array_ptr main;
+
+    /**
+     * @brief The detected clock frequency in beats per minute.
+     */
+    float_array_ptr bpm;
+};
+
+void sig_dsp_ClockDetector_Outputs_newAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_ClockDetector_Outputs* outputs);
+
+void sig_dsp_ClockDetector_Outputs_destroyAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_dsp_ClockDetector_Outputs* outputs);
+
+
+/**
+ * Detects the number of pulses per second of an incoming clock signal
+ * (i.e. any signal that outputs a rising edge to denote clock pulses)
+ * and outputs the clock's tempo in pulses per second.
+ *
+ * Inputs:
+ *  - source the incoming clock signal
+ */
+struct sig_dsp_ClockDetector {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_ClockDetector_Inputs inputs;
+    struct sig_dsp_Clock_Parameters parameters;
+    struct sig_dsp_ClockDetector_Outputs outputs;
+
+    float previousTrigger;
+    bool isRisingEdge;
+    uint8_t numPulsesDetected;
+    uint32_t samplesSinceLastPulse;
+    float clockFreq;
+    uint32_t pulseDurSamples;
+};
+
+void sig_dsp_ClockDetector_init(
+    struct sig_dsp_ClockDetector* self,
+    struct sig_SignalContext* context);
+struct sig_dsp_ClockDetector* sig_dsp_ClockDetector_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_ClockDetector_generate(void* signal);
+void sig_dsp_ClockDetector_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_ClockDetector* self);
+
+
+
+#define sig_dsp_MidiNote_MAX_HELD_NOTES 16
+
+struct sig_dsp_Midi_Inputs {
+    /**
+     * @brief The MIDI events to respond to.
+     * While unconnected, the outputs hold their current values.
+     */
+    struct sig_midi_EventQueue* source;
+};
+
+struct sig_dsp_MidiNote_Parameters {
+    /**
+     * @brief The MIDI channel to listen to, from 1 to 16,
+     * or 0 to listen to all channels.
+     */
+    float channel;
+};
+
+struct sig_dsp_MidiNote_Outputs {
+    /**
+     * @brief The MIDI number of the current note.
+     */
+    float_array_ptr note;
+
+    /**
+     * @brief The velocity of the most recent note on, from 0 to 1.
+     */
+    float_array_ptr velocity;
+
+    /**
+     * @brief 1 while any note is held, and 0 otherwise.
+     */
+    float_array_ptr gate;
+
+    /**
+     * @brief A single-sample trigger for each note on.
+     */
+    float_array_ptr trigger;
+};
+
+/**
+ * @brief A monophonic MIDI note input with last-note priority.
+ *
+ * Each note on and note off takes effect at the sample at which it
+ * occurs. When the current note is released while others are still
+ * held, the most recent of them becomes the current note again
+ * without retriggering. A note on with a velocity of zero is treated
+ * as a note off, and an "All Notes Off" message releases every note.
+ *
+ * Inputs:
+ *  - source the MIDI events to respond to
+ */
+struct sig_dsp_MidiNote {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Midi_Inputs inputs;
+    struct sig_dsp_MidiNote_Parameters parameters;
+    struct sig_dsp_MidiNote_Outputs outputs;
+    uint8_t heldNotes[sig_dsp_MidiNote_MAX_HELD_NOTES];
+    size_t numHeldNotes;
+    float note;
+    float velocity;
+};
+
+struct sig_dsp_MidiNote* sig_dsp_MidiNote_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_MidiNote_init(struct sig_dsp_MidiNote* self,
+    struct sig_SignalContext* context);
+void sig_dsp_MidiNote_Outputs_newAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_MidiNote_Outputs* outputs);
+void sig_dsp_MidiNote_Outputs_destroyAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_dsp_MidiNote_Outputs* outputs);
+void sig_dsp_MidiNote_generate(void* signal);
+void sig_dsp_MidiNote_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_MidiNote* self);
+
+
+struct sig_dsp_MidiCC_Parameters {
+    /**
+     * @brief The MIDI channel to listen to, from 1 to 16,
+     * or 0 to listen to all channels.
+     */
+    float channel;
+
+    /**
+     * @brief The controller number to listen to, from 0 to 127.
+     */
+    float controller;
+};
+
+/**
+ * @brief Outputs the value of a MIDI continuous controller,
+ * scaled to the range 0 to 1.
+ *
+ * Each change takes effect at the sample at which it occurs,
+ * and the value is held until the next one.
+ *
+ * Inputs:
+ *  - source the MIDI events to respond to
+ */
+struct sig_dsp_MidiCC {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Midi_Inputs inputs;
+    struct sig_dsp_MidiCC_Parameters parameters;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+    float value;
+};
+
+struct sig_dsp_MidiCC* sig_dsp_MidiCC_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context);
+void sig_dsp_MidiCC_init(struct sig_dsp_MidiCC* self,
+    struct sig_SignalContext* context);
+void sig_dsp_MidiCC_generate(void* signal);
+void sig_dsp_MidiCC_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_MidiCC* self);
+
+
+struct sig_dsp_MidiClock_Parameters {
     /**
-     * @brief The incoming clock signal.
+     * @brief The number of MIDI clock messages per output pulse.
+     * MIDI clock runs at 24 pulses per quarter note, so
+     * a divisor of 24 outputs a pulse for every beat.
      */
-    float_array_ptr source;
+    float divisor;
 };
 
-struct sig_dsp_ClockDetector_Outputs {
+struct sig_dsp_MidiClock_Outputs {
     /**
-     * @brief The detected clock frequency in pulses per second (i.e. Hz).
+     * @brief A single-sample pulse for every divisor clock messages.
      */
     float_array_ptr main;
 
     /**
-     * @brief The detected clock frequency in beats per minute.
+     * @brief 1 after a start or continue message,
+     * and 0 after a stop message.
      */
-    float_array_ptr bpm;
-};
-
-void sig_dsp_ClockDetector_Outputs_newAudioBlocks(
-    struct sig_Allocator* allocator,
-    struct sig_AudioSettings* audioSettings,
-    struct sig_dsp_ClockDetector_Outputs* outputs);
-
-void sig_dsp_ClockDetector_Outputs_destroyAudioBlocks(
-    struct sig_Allocator* allocator,
-    struct sig_dsp_ClockDetector_Outputs* outputs);
+    float_array_ptr running;
 
+    /**
+     * @brief The pulses as events, for Signals with event inputs
+     * such as ClockDetector.
+     */
+    struct sig_EventBlock* pulseEvents;
+};
 
 /**
- * Detects the number of pulses per second of an incoming clock signal
- * (i.e. any signal that outputs a rising edge to denote clock pulses)
- * and outputs the clock's tempo in pulses per second.
+ * @brief Outputs pulses from MIDI clock messages.
+ *
+ * Each pulse occurs at the sample at which its clock message
+ * takes effect. A start message resets the divisor's count,
+ * so that the next clock message produces a pulse.
  *
  * Inputs:
- *  - source the incoming clock signal
+ *  - source the MIDI events to respond to
  */
-struct sig_dsp_ClockDetector {
+struct sig_dsp_MidiClock {
     struct sig_dsp_Signal signal;
-    struct sig_dsp_ClockDetector_Inputs inputs;
-    struct sig_dsp_Clock_Parameters parameters;
-    struct sig_dsp_ClockDetector_Outputs outputs;
-
-    float previousTrigger;
-    bool isRisingEdge;
-    uint8_t numPulsesDetected;
-    uint32_t samplesSinceLastPulse;
-    float clockFreq;
-    uint32_t pulseDurSamples;
+    struct sig_dsp_Midi_Inputs inputs;
+    struct sig_dsp_MidiClock_Parameters parameters;
+    struct sig_dsp_MidiClock_Outputs outputs;
+    uint32_t tickCount;
+    float isRunning;
+    bool isPulseHigh;
 };
 
-void sig_dsp_ClockDetector_init(
-    struct sig_dsp_ClockDetector* self,
-    struct sig_SignalContext* context);
-struct sig_dsp_ClockDetector* sig_dsp_ClockDetector_new(
+struct sig_dsp_MidiClock* sig_dsp_MidiClock_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
-void sig_dsp_ClockDetector_generate(void* signal);
-void sig_dsp_ClockDetector_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_ClockDetector* self);
+void sig_dsp_MidiClock_init(struct sig_dsp_MidiClock* self,
+    struct sig_SignalContext* context);
+void sig_dsp_MidiClock_generate(void* signal);
+void sig_dsp_MidiClock_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_MidiClock* self);
 
 
 
@@ -2328,6 +4210,13 @@ void sig_dsp_LinearMap_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_LinearMap* self);
 
 
+/**
+ * @brief The length of the sine table that the FM Signals acquire
+ * from their context's sig_LookupTableCache (with no guard points).
+ * Precomputed tables must have the same length to be used by them.
+ */
+#define sig_dsp_FM_SINE_TABLE_LENGTH 8192
+
 struct sig_dsp_TwoOpFM_Inputs {
     float_array_ptr frequency;
     float_array_ptr index;
@@ -2362,6 +4251,7 @@ struct sig_dsp_TwoOpFM {
     struct sig_osc_Wavetable modulatorState;
     struct sig_DelayLine feedbackDelay;
 
+    struct sig_LookupTableCache* tables;
     struct sig_Buffer* sineTable;
 };
 
@@ -2374,6 +4264,147 @@ void sig_dsp_TwoOpFM_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_TwoOpFM* self);
 
 
+#define sig_dsp_FMOperatorBank_MIN_OPERATORS 4
+#define sig_dsp_FMOperatorBank_MAX_OPERATORS 6
+
+/**
+ * @brief Routing algorithms for an FMOperatorBank.
+ * Operators are numbered from zero.
+ */
+enum sig_dsp_FMOperatorBank_Algorithm {
+    /**
+     * Each operator modulates the one before it;
+     * operator 0 is the only carrier.
+     */
+    sig_dsp_FMOperatorBank_Algorithm_STACK,
+
+    /**
+     * The operators are split into two stacks; the first operator
+     * of each stack is a carrier.
+     */
+    sig_dsp_FMOperatorBank_Algorithm_TWO_STACKS,
+
+    /**
+     * Each odd-numbered operator modulates the even-numbered
+     * operator before it, which is a carrier.
+     */
+    sig_dsp_FMOperatorBank_Algorithm_PAIRS,
+
+    /**
+     * All other operators modulate operator 0, which is the only carrier.
+     */
+    sig_dsp_FMOperatorBank_Algorithm_BRANCH,
+
+    /**
+     * Every operator is an unmodulated carrier.
+     */
+    sig_dsp_FMOperatorBank_Algorithm_ADDITIVE,
+
+    /**
+     * The modulation matrix and carrier mix are left as they are,
+     * so that they can be specified directly.
+     */
+    sig_dsp_FMOperatorBank_Algorithm_CUSTOM
+};
+
+struct sig_dsp_FMOperatorBank_Parameters {
+    enum sig_dsp_FMOperatorBank_Algorithm algorithm;
+
+    // The frequency of each operator, relative to the fundamental.
+    float ratios[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+
+    // The output level of each operator, which scales both
+    // its modulation of other operators and its carrier output.
+    float levels[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+
+    // The amount that each operator modulates its own phase.
+    float feedbackGains[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+};
+
+struct sig_dsp_FMOperatorBank_Inputs {
+    float_array_ptr frequency;
+    float_array_ptr index;
+};
+
+/**
+ * @brief A phase modulation synthesizer with four to six sine
+ * operators, selectable routing algorithms, and per-operator feedback.
+ *
+ * Operator state is stored as a structure of arrays, and
+ * all modulation between operators is delayed by one sample,
+ * so that each operator's phase and modulation can be computed
+ * together (and vectorized) for each sample, regardless of the routing.
+ * Routing is expressed as a modulation matrix, which can be
+ * set from one of the preset algorithms or specified directly.
+ * Feedback is calculated from the average of each operator's
+ * two previous samples. All operators share a sine table with
+ * sig_dsp_TwoOpFM.
+ *
+ * Inputs:
+ *  - frequency: the fundamental frequency
+ *  - index: the modulation index, in cycles, which scales
+ *    all modulation between operators
+ *
+ * Outputs:
+ *  - main: the mix of all carriers
+ */
+struct sig_dsp_FMOperatorBank {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_FMOperatorBank_Inputs inputs;
+    struct sig_dsp_FMOperatorBank_Parameters parameters;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+
+    size_t numOperators;
+
+    // The amount that each operator (column) modulates
+    // each other operator (row).
+    float modulation[sig_dsp_FMOperatorBank_MAX_OPERATORS]
+        [sig_dsp_FMOperatorBank_MAX_OPERATORS];
+
+    // The amount of each operator that is mixed into the output.
+    float carriers[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+
+    enum sig_dsp_FMOperatorBank_Algorithm previousAlgorithm;
+    float phaseAccumulators[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float previousOutputs[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float olderOutputs[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+
+    struct sig_LookupTableCache* tables;
+    struct sig_Buffer* sineTable;
+};
+
+/**
+ * @brief Allocates a new FMOperatorBank.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numOperators the number of operators, between
+ * sig_dsp_FMOperatorBank_MIN_OPERATORS and
+ * sig_dsp_FMOperatorBank_MAX_OPERATORS (other values will be clamped)
+ * @return struct sig_dsp_FMOperatorBank* the new FMOperatorBank
+ */
+struct sig_dsp_FMOperatorBank* sig_dsp_FMOperatorBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numOperators);
+void sig_dsp_FMOperatorBank_init(struct sig_dsp_FMOperatorBank* self,
+    struct sig_SignalContext* context);
+
+/**
+ * @brief Fills the modulation matrix and carrier mix
+ * for the specified algorithm. The carrier mix is scaled so that
+ * the output remains within -1.0 to 1.0 when all levels are 1.0.
+ * This is called automatically when parameters.algorithm changes.
+ *
+ * @param self the FMOperatorBank
+ * @param algorithm the algorithm
+ */
+void sig_dsp_FMOperatorBank_setAlgorithm(struct sig_dsp_FMOperatorBank* self,
+    enum sig_dsp_FMOperatorBank_Algorithm algorithm);
+void sig_dsp_FMOperatorBank_generate(void* signal);
+void sig_dsp_FMOperatorBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_FMOperatorBank* self);
+
+
 struct sig_dsp_FourPoleFilter_Inputs {
     float_array_ptr source;
     float_array_ptr frequency;
@@ -2408,6 +4439,20 @@ void sig_dsp_FourPoleFilter_Outputs_newAudioBlocks(
     struct sig_AudioSettings* audioSettings,
     struct sig_dsp_FourPoleFilter_Outputs* outputs);
 
+/**
+ * @brief Allocates planar multichannel blocks for each output.
+ *
+ * @param allocator the allocator to use
+ * @param audioSettings the audio settings
+ * @param numChannels the number of channels in each output
+ * @param outputs the outputs to allocate blocks for
+ */
+void sig_dsp_FourPoleFilter_Outputs_newMultichannelAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    size_t numChannels,
+    struct sig_dsp_FourPoleFilter_Outputs* outputs);
+
 void sig_dsp_FourPoleFilter_Outputs_destroyAudioBlocks(
     struct sig_Allocator* allocator,
     struct sig_dsp_FourPoleFilter_Outputs* outputs);
@@ -2431,6 +4476,14 @@ struct sig_dsp_Ladder_Parameters {
  *  - source: the input to filter
  *  - frequency: the cutoff frequency in Hz
  *  - resonance: the resonance (stable values in the range 0 - 1.8)
+ *
+ * Coefficients are recalculated at most once per block,
+ * and are interpolated across the block when the frequency
+ * is modulated at audio rate.
+ *
+ * Multichannel Ladders filter each channel of a planar source
+ * and write planar outputs; all other inputs are mono,
+ * and are shared by every channel.
  */
 struct sig_dsp_Ladder {
     struct sig_dsp_Signal signal;
@@ -2442,29 +4495,196 @@ struct sig_dsp_Ladder {
     float interpolationRecip;
     float alpha;
     float beta[4];
-    float z0[4];
-    float z1[4];
     float k;
     float fBase;
     float qAdjust;
     float prevFrequency;
-    float prevInput;
+    size_t numChannels;
+    float z0[sig_MAX_CHANNELS][4];
+    float z1[sig_MAX_CHANNELS][4];
+    float prevInputs[sig_MAX_CHANNELS];
 };
 
 struct sig_dsp_Ladder* sig_dsp_Ladder_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+
+/**
+ * @brief Allocates a new Ladder that filters each channel
+ * of a multichannel source.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of channels,
+ * between 1 and sig_MAX_CHANNELS
+ * @return struct sig_dsp_Ladder* the new Ladder
+ */
+struct sig_dsp_Ladder* sig_dsp_Ladder_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Ladder_init(
     struct sig_dsp_Ladder* self,
     struct sig_SignalContext* context);
 void sig_dsp_Ladder_calcCoefficients(
     struct sig_dsp_Ladder* self, float freq);
 float sig_dsp_Ladder_calcStage(
-    struct sig_dsp_Ladder* self, float s, uint8_t i);
+    struct sig_dsp_Ladder* self, size_t channel, float s, uint8_t i);
 void sig_dsp_Ladder_generate(void* signal);
 void sig_dsp_Ladder_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Ladder* self);
 
 
+#define sig_dsp_VoiceBank_MAX_VOICES 32
+
+// The number of voices that are rendered together.
+// sig_dsp_VoiceBank_MAX_VOICES must be a multiple of it.
+#define sig_dsp_VoiceBank_BATCH_SIZE 4
+
+enum sig_dsp_VoiceBank_Stage {
+    sig_dsp_VoiceBank_Stage_IDLE,
+    sig_dsp_VoiceBank_Stage_ATTACK,
+    sig_dsp_VoiceBank_Stage_DECAY,
+    sig_dsp_VoiceBank_Stage_RELEASE
+};
+
+struct sig_dsp_VoiceBank_Parameters {
+    // The amount, in octaves, that each voice's envelope
+    // raises its filter's cutoff frequency.
+    float filterEnvelopeAmount;
+
+    // The passband gain of each voice's filter (see sig_dsp_Ladder).
+    float passbandGain;
+
+    // The gain applied to the sum of all voices.
+    float outputGain;
+};
+
+struct sig_dsp_VoiceBank_Inputs {
+    float_array_ptr frequencyScale;
+    float_array_ptr cutoff;
+    float_array_ptr resonance;
+    float_array_ptr attack;
+    float_array_ptr decay;
+    float_array_ptr sustain;
+    float_array_ptr release;
+};
+
+/**
+ * @brief A polyphonic synthesizer voice container, which plays
+ * up to sig_dsp_VoiceBank_MAX_VOICES instances of a
+ * band-limited saw (see sig_dsp_BLEPSaw) into a Ladder filter
+ * (see sig_dsp_Ladder) and an envelope-controlled amplifier.
+ *
+ * The state of every voice is stored as a structure of arrays,
+ * and voices are rendered together in batches of
+ * sig_dsp_VoiceBank_BATCH_SIZE. Batches in which every voice is
+ * idle are skipped entirely, and new notes are allocated to
+ * the lowest-numbered idle voice so that active voices are packed
+ * into as few batches as possible. When no voice is idle,
+ * the oldest released voice is stolen, followed by the oldest voice.
+ *
+ * The envelope's attack approaches an overshoot target so that
+ * it reaches full level in the attack time, while the decay
+ * and release times are the time taken to fall by 60 dB.
+ * A voice becomes idle when its release falls below -80 dB.
+ *
+ * Notes are played by calling sig_dsp_VoiceBank_noteOn() and
+ * sig_dsp_VoiceBank_noteOff() between blocks (i.e. from
+ * the same thread that evaluates the Signal).
+ * All inputs are read once per block.
+ *
+ * Inputs:
+ *  - frequencyScale: a multiplier for every voice's frequency
+ *  - cutoff: the filter's cutoff frequency in Hz
+ *  - resonance: the filter's resonance (stable values in the range 0 - 1.8)
+ *  - attack: the attack time, in seconds
+ *  - decay: the decay time, in seconds
+ *  - sustain: the sustain level, between 0.0 and 1.0
+ *  - release: the release time, in seconds
+ *
+ * Outputs:
+ *  - main: the sum of all voices, multiplied by the output gain
+ */
+struct sig_dsp_VoiceBank {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_VoiceBank_Inputs inputs;
+    struct sig_dsp_VoiceBank_Parameters parameters;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+
+    size_t numVoices;
+    uint32_t noteCounter;
+
+    int32_t notes[sig_dsp_VoiceBank_MAX_VOICES];
+    uint32_t noteAges[sig_dsp_VoiceBank_MAX_VOICES];
+    enum sig_dsp_VoiceBank_Stage stages[sig_dsp_VoiceBank_MAX_VOICES];
+    float frequencies[sig_dsp_VoiceBank_MAX_VOICES];
+    float velocities[sig_dsp_VoiceBank_MAX_VOICES];
+    float levels[sig_dsp_VoiceBank_MAX_VOICES];
+    float phaseAccumulators[sig_dsp_VoiceBank_MAX_VOICES];
+    float alphas[sig_dsp_VoiceBank_MAX_VOICES];
+    float qAdjusts[sig_dsp_VoiceBank_MAX_VOICES];
+    float previousCutoffs[sig_dsp_VoiceBank_MAX_VOICES];
+    float previousInputs[sig_dsp_VoiceBank_MAX_VOICES];
+    float z0[4][sig_dsp_VoiceBank_MAX_VOICES];
+    float z1[4][sig_dsp_VoiceBank_MAX_VOICES];
+};
+
+/**
+ * @brief Allocates a new VoiceBank.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numVoices the number of voices,
+ * up to sig_dsp_VoiceBank_MAX_VOICES
+ * @return struct sig_dsp_VoiceBank* the new VoiceBank
+ */
+struct sig_dsp_VoiceBank* sig_dsp_VoiceBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numVoices);
+void sig_dsp_VoiceBank_init(struct sig_dsp_VoiceBank* self,
+    struct sig_SignalContext* context);
+
+/**
+ * @brief Starts playing a note, either by retriggering the voice
+ * that is already playing it, by allocating an idle voice,
+ * or by stealing a voice.
+ *
+ * @param self the VoiceBank
+ * @param note an identifier for the note (e.g. a MIDI note number)
+ * @param frequency the note's frequency in Hz
+ * @param velocity the note's level, between 0.0 and 1.0
+ * @return size_t the index of the voice that will play the note
+ */
+size_t sig_dsp_VoiceBank_noteOn(struct sig_dsp_VoiceBank* self,
+    int32_t note, float frequency, float velocity);
+
+/**
+ * @brief Releases every voice that is playing the specified note.
+ *
+ * @param self the VoiceBank
+ * @param note the note's identifier
+ */
+void sig_dsp_VoiceBank_noteOff(struct sig_dsp_VoiceBank* self,
+    int32_t note);
+
+/**
+ * @brief Releases every voice.
+ *
+ * @param self the VoiceBank
+ */
+void sig_dsp_VoiceBank_allNotesOff(struct sig_dsp_VoiceBank* self);
+
+/**
+ * @brief Returns the number of voices that are not idle.
+ *
+ * @param self the VoiceBank
+ * @return size_t the number of active voices
+ */
+size_t sig_dsp_VoiceBank_numActiveVoices(struct sig_dsp_VoiceBank* self);
+void sig_dsp_VoiceBank_generate(void* signal);
+void sig_dsp_VoiceBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_VoiceBank* self);
+
+
 
 struct sig_dsp_TiltEQ_Inputs {
     float_array_ptr source;
@@ -2490,6 +4710,10 @@ struct sig_dsp_TiltEQ_Inputs {
  *  - source: the input to filter
  *  - frequency: the centre frequency in Hz (20-20000 Hz)
  *  - gain: the EQ gain, in dB (-6.0 to +6.0 dB)
+ *
+ * Coefficients are recalculated at most once per block,
+ * and are interpolated across the block when the frequency
+ * or gain are modulated at audio rate.
  */
 struct sig_dsp_TiltEQ {
     struct sig_dsp_Signal signal;
@@ -2498,33 +4722,279 @@ struct sig_dsp_TiltEQ {
 
     float sr3;
     float lpOut;
+    float previousFrequency;
+    float previousGain;
+    float lgain;
+    float hgain;
+    float a0;
+    float b1;
 };
 
 struct sig_dsp_TiltEQ* sig_dsp_TiltEQ_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
 void sig_dsp_TiltEQ_init(struct sig_dsp_TiltEQ* self,
     struct sig_SignalContext* context);
+void sig_dsp_TiltEQ_calcCoefficients(struct sig_dsp_TiltEQ* self,
+    float frequency, float gain);
 void sig_dsp_TiltEQ_generate(void* signal);
 void sig_dsp_TiltEQ_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_TiltEQ* self);
 
 
 
+#define sig_dsp_Oversampler_MAX_NUM_STAGES 3
+
+struct sig_dsp_Oversampler_Inputs {
+    /**
+     * The input at the base sample rate,
+     * which will be upsampled for the child Signals.
+     */
+    float_array_ptr source;
+
+    /**
+     * The output of the child Signals at the oversampled rate,
+     * which will be downsampled to produce the main output.
+     */
+    float_array_ptr childOutput;
+};
+
+struct sig_dsp_Oversampler_Outputs {
+    /**
+     * The downsampled output of the child Signals.
+     */
+    float_array_ptr main;
+
+    /**
+     * The source, upsampled to the oversampled rate.
+     * Child Signals should read from this output.
+     */
+    float_array_ptr upsampled;
+};
+
+/**
+ * @brief Runs a list of child Signals at 2, 4, or 8 times the sample rate,
+ * to reduce the aliasing produced by nonlinear processes such as
+ * waveshaping, saturation, and wavefolding.
+ *
+ * Child Signals should be created using the Oversampler's context,
+ * whose audio settings have a sample rate and block size that are
+ * scaled by the oversampling factor. They should be appended
+ * to the Oversampler's signals list in the order they are to
+ * be evaluated, read from outputs.upsampled, and the last child's output
+ * should be connected to inputs.childOutput.
+ *
+ * The source is upsampled and the child output is downsampled
+ * using a cascade of polyphase halfband filters, one per doubling.
+ *
+ * Inputs:
+ *  - source: the input to upsample
+ *  - childOutput: the oversampled output of the child Signals
+ *
+ * Outputs:
+ *  - main: the downsampled output
+ *  - upsampled: the upsampled source
+ */
+struct sig_dsp_Oversampler {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Oversampler_Inputs inputs;
+    struct sig_dsp_Oversampler_Outputs outputs;
+
+    size_t factor;
+    size_t numStages;
+    struct sig_AudioSettings* audioSettings;
+    struct sig_SignalContext* context;
+    struct sig_List* signals;
+    struct sig_filter_Halfband* upsamplers[sig_dsp_Oversampler_MAX_NUM_STAGES];
+    struct sig_filter_Halfband* downsamplers[
+        sig_dsp_Oversampler_MAX_NUM_STAGES];
+    float_array_ptr scratch[2];
+};
+
+/**
+ * @brief Creates a new Oversampler, whose child context shares
+ * the base rate context's lookup tables (see
+ * sig_SignalContext_newChild()).
+ *
+ * @param allocator the allocator to use
+ * @param context the base rate signal context
+ * @param factor the oversampling factor (2, 4, or 8); other factors are
+ * rounded up to the next of these, so a factor of 1 (or 0) oversamples
+ * by 2, and factors above 8 oversample by 8. The factor field holds
+ * the factor that is used.
+ * @param maxNumSignals the maximum number of child Signals
+ * @return struct sig_dsp_Oversampler* the new Oversampler
+ */
+struct sig_dsp_Oversampler* sig_dsp_Oversampler_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t factor, size_t maxNumSignals);
+void sig_dsp_Oversampler_init(struct sig_dsp_Oversampler* self,
+    struct sig_SignalContext* context);
+void sig_dsp_Oversampler_generate(void* signal);
+
+/**
+ * @brief Returns the total delay, in samples at the base rate,
+ * introduced by upsampling and downsampling.
+ */
+float sig_dsp_Oversampler_latency(struct sig_dsp_Oversampler* self);
+
+void sig_dsp_Oversampler_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Oversampler* self);
+
+
+#define sig_dsp_Convolver_MIN_PARTITION_SIZE (sig_FFT_MIN_LENGTH / 2)
+#define sig_dsp_Convolver_MAX_HEAD_PARTITION_SIZE 512
+#define sig_dsp_Convolver_TAIL_PARTITION_RATIO 8
+
+struct sig_dsp_Convolver_Inputs {
+    float_array_ptr source;
+};
+
+/**
+ * @brief A uniformly partitioned section of an impulse response,
+ * along with a frequency-domain delay line containing the spectra
+ * of the most recent input partitions.
+ */
+struct sig_dsp_Convolver_Segment {
+    struct sig_FFT* fft;
+    size_t partitionSize;
+    size_t maxNumPartitions;
+    size_t numPartitions;
+    size_t delayLineIdx;
+
+    // The spectra of each partition of the impulse response.
+    float_array_ptr irSpectra;
+
+    // A circular buffer of the spectra of past input partitions.
+    float_array_ptr delayLine;
+
+    // The previous and current partitions of input.
+    float_array_ptr input;
+
+    float_array_ptr accumulator;
+
+    // The most recently calculated partition of output.
+    float_array_ptr output;
+};
+
+/**
+ * @brief Convolves its source with an impulse response
+ * using partitioned overlap-save convolution
+ * in the frequency domain.
+ *
+ * The impulse response is split into a "head" of small partitions,
+ * which are processed whenever a head partition of input has arrived,
+ * and a "tail" of partitions that are
+ * sig_dsp_Convolver_TAIL_PARTITION_RATIO times larger,
+ * whose outputs aren't needed until a full tail partition later.
+ * The tail is processed during the same block in which
+ * its input is completed.
+ *
+ * The head partition size is the largest power of two
+ * (up to sig_dsp_Convolver_MAX_HEAD_PARTITION_SIZE) that divides the
+ * block size, in which case the Convolver has no latency. Block sizes
+ * that aren't a multiple of sig_dsp_Convolver_MIN_PARTITION_SIZE
+ * are delayed by one head partition (see latency).
+ *
+ * Inputs:
+ *  - source: the signal to convolve
+ *
+ * Outputs:
+ *  - main: the convolved signal
+ */
+struct sig_dsp_Convolver {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Convolver_Inputs inputs;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+
+    size_t maxIRLength;
+
+    /**
+     * The number of samples by which the output is delayed.
+     */
+    size_t latency;
+
+    size_t headFill;
+    size_t tailFill;
+    struct sig_dsp_Convolver_Segment head;
+    struct sig_dsp_Convolver_Segment tail;
+};
+
+/**
+ * @brief Creates a new Convolver.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param maxIRLength the length, in samples, of the longest
+ * impulse response that will be loaded
+ * @return struct sig_dsp_Convolver* the new Convolver
+ */
+struct sig_dsp_Convolver* sig_dsp_Convolver_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t maxIRLength);
+void sig_dsp_Convolver_init(struct sig_dsp_Convolver* self,
+    struct sig_SignalContext* context);
+
+/**
+ * @brief Loads an impulse response, replacing the current one.
+ * No allocation takes place, but every partition
+ * of the impulse response is transformed, so this should not
+ * be called in a time-critical context.
+ * Impulse responses longer than the Convolver's maxIRLength
+ * are truncated.
+ *
+ * @param self the Convolver
+ * @param ir the impulse response
+ */
+void sig_dsp_Convolver_loadIR(struct sig_dsp_Convolver* self,
+    struct sig_Buffer* ir);
+
+void sig_dsp_Convolver_generate(void* signal);
+void sig_dsp_Convolver_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Convolver* self);
+
+
+
 struct sig_dsp_Delay_Inputs {
     float_array_ptr source;
     float_array_ptr delayTime;
 };
 
+/**
+ * @brief Reads from (and, for Delay, writes to) a mono delay line.
+ *
+ * Multichannel Delays and DelayTaps read one tap per channel,
+ * each at the delay time in the corresponding channel of the
+ * delayTime input, and write them to a planar output.
+ * The source is always mono. The delayTime input is treated as mono
+ * by default and shared by every tap; set numDelayTimeChannels
+ * when connecting a multichannel delayTime.
+ */
 struct sig_dsp_Delay {
     struct sig_dsp_Signal signal;
     struct sig_dsp_Delay_Inputs inputs;
     struct sig_dsp_Signal_SingleMonoOutput outputs;
 
     struct sig_DelayLine* delayLine;
+    size_t numChannels;
+    size_t numDelayTimeChannels;
 };
 
 struct sig_dsp_Delay* sig_dsp_Delay_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+
+/**
+ * @brief Allocates a new Delay that reads numChannels taps
+ * from its delay line.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of taps,
+ * between 1 and sig_MAX_CHANNELS
+ * @return struct sig_dsp_Delay* the new Delay
+ */
+struct sig_dsp_Delay* sig_dsp_Delay_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Delay_init(struct sig_dsp_Delay* self,
     struct sig_SignalContext* context);
 void sig_dsp_Delay_read(struct sig_dsp_Delay* self, float source,
@@ -2535,6 +5005,20 @@ void sig_dsp_Delay_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_Delay* sig_dsp_DelayTap_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+
+/**
+ * @brief Allocates a new DelayTap that reads numChannels taps
+ * from a delay line written elsewhere (e.g. by a DelayWrite).
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of taps,
+ * between 1 and sig_MAX_CHANNELS
+ * @return struct sig_dsp_Delay* the new DelayTap
+ */
+struct sig_dsp_Delay* sig_dsp_DelayTap_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_DelayTap_init(struct sig_dsp_Delay* self,
     struct sig_SignalContext* context);
 void sig_dsp_DelayTap_generate(void* signal);
@@ -2611,6 +5095,280 @@ void sig_dsp_Allpass_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_Allpass* self);
 
 
+#define sig_dsp_FDNReverb_MAX_LINES 16
+
+// The shortest and longest delay times, in seconds.
+// Delay times are spaced exponentially between them.
+#define sig_dsp_FDNReverb_MIN_DELAY_TIME 0.0297f
+#define sig_dsp_FDNReverb_MAX_DELAY_TIME 0.0971f
+
+// The maximum depth, in samples, of each delay line's modulation.
+#define sig_dsp_FDNReverb_MAX_MODULATION_DEPTH 32.0f
+
+enum sig_dsp_FDNReverb_Matrix {
+    /**
+     * A normalized Hadamard matrix, which is
+     * calculated with a fast Walsh-Hadamard transform.
+     */
+    sig_dsp_FDNReverb_Matrix_HADAMARD,
+
+    /**
+     * A Householder reflection, which mixes each line
+     * with the average of all lines.
+     */
+    sig_dsp_FDNReverb_Matrix_HOUSEHOLDER
+};
+
+struct sig_dsp_FDNReverb_Parameters {
+    enum sig_dsp_FDNReverb_Matrix matrix;
+
+    // The depth of each delay line's modulation, in samples,
+    // up to sig_dsp_FDNReverb_MAX_MODULATION_DEPTH.
+    float modulationDepth;
+
+    // The rate of modulation, in Hz.
+    float modulationRate;
+};
+
+struct sig_dsp_FDNReverb_Inputs {
+    float_array_ptr source;
+    float_array_ptr decayTime;
+    float_array_ptr damping;
+};
+
+struct sig_dsp_FDNReverb_Outputs {
+    float_array_ptr left;
+    float_array_ptr right;
+};
+
+void sig_dsp_FDNReverb_Outputs_newAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_FDNReverb_Outputs* outputs);
+
+void sig_dsp_FDNReverb_Outputs_destroyAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_dsp_FDNReverb_Outputs* outputs);
+
+/**
+ * @brief A feedback delay network reverb with 4, 8 or 16 delay lines.
+ *
+ * Each delay line has its own damping filter and a slowly modulated
+ * read position, and the lines are mixed together by a
+ * Hadamard or Householder feedback matrix. All processing
+ * for every line takes place within this Signal, and all delay memory
+ * is stored in one contiguous allocation.
+ *
+ * The decay time and damping are read once per block.
+ *
+ * Inputs:
+ *  - source: the signal to reverberate
+ *  - decayTime: the time, in seconds, taken for the reverb
+ *    to decay by 60 dB
+ *  - damping: the amount of high frequency damping, between 0.0 and 1.0
+ *
+ * Outputs:
+ *  - left: the left channel of the reverberated signal
+ *  - right: the right channel of the reverberated signal
+ */
+struct sig_dsp_FDNReverb {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_FDNReverb_Inputs inputs;
+    struct sig_dsp_FDNReverb_Parameters parameters;
+    struct sig_dsp_FDNReverb_Outputs outputs;
+
+    size_t numLines;
+
+    // The memory for all delay lines.
+    float_array_ptr delayMemory;
+    size_t lineOffsets[sig_dsp_FDNReverb_MAX_LINES];
+    size_t lineLengths[sig_dsp_FDNReverb_MAX_LINES];
+    size_t writeIndices[sig_dsp_FDNReverb_MAX_LINES];
+
+    // The unmodulated delay of each line, in samples.
+    float delays[sig_dsp_FDNReverb_MAX_LINES];
+
+    float feedbackGains[sig_dsp_FDNReverb_MAX_LINES];
+    float dampingStates[sig_dsp_FDNReverb_MAX_LINES];
+    float modulatorCos[sig_dsp_FDNReverb_MAX_LINES];
+    float modulatorSin[sig_dsp_FDNReverb_MAX_LINES];
+    float previousDecayTime;
+    float previousModulationRate;
+    float modulationCosIncrement;
+    float modulationSinIncrement;
+};
+
+/**
+ * @brief Allocates a new FDNReverb.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numLines the number of delay lines, which will be rounded
+ * to the nearest of 4, 8 or 16
+ * @return struct sig_dsp_FDNReverb* the new FDNReverb
+ */
+struct sig_dsp_FDNReverb* sig_dsp_FDNReverb_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numLines);
+
+/**
+ * @brief Initializes an FDNReverb and clears its delay memory.
+ *
+ * @param self the FDNReverb
+ * @param context the signal context
+ */
+void sig_dsp_FDNReverb_init(struct sig_dsp_FDNReverb* self,
+    struct sig_SignalContext* context);
+void sig_dsp_FDNReverb_generate(void* signal);
+void sig_dsp_FDNReverb_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_FDNReverb* self);
+
+
+#define sig_dsp_CombBank_MAX_LINES 8
+
+struct sig_dsp_CombBank_Parameters {
+    // The delay time of each line, in seconds.
+    float delayTimes[sig_dsp_CombBank_MAX_LINES];
+
+    // The feedback gain of each line.
+    float feedbackGains[sig_dsp_CombBank_MAX_LINES];
+
+    // The one-pole low-pass coefficient in each line's
+    // feedback path (see sig_dsp_Comb). 0.0 disables damping.
+    float lpfCoefficients[sig_dsp_CombBank_MAX_LINES];
+
+    // The gain applied to the sum of all lines.
+    float outputGain;
+};
+
+struct sig_dsp_CombBank_Inputs {
+    float_array_ptr source;
+    float_array_ptr delayTimeScale;
+    float_array_ptr feedbackScale;
+};
+
+/**
+ * @brief A bank of up to sig_dsp_CombBank_MAX_LINES parallel
+ * low-pass-filtered comb filters that share the same input,
+ * equivalent to several sig_dsp_Combs whose outputs are summed.
+ *
+ * All lines are processed together in each sample,
+ * and their delay memory is stored in one contiguous allocation.
+ *
+ * The delay time and feedback scales are read once per block.
+ *
+ * Inputs:
+ *  - source: the signal to filter
+ *  - delayTimeScale: a multiplier for each line's delay time
+ *  - feedbackScale: a multiplier for each line's feedback gain
+ *
+ * Outputs:
+ *  - main: the sum of all lines, multiplied by the output gain
+ */
+struct sig_dsp_CombBank {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_CombBank_Inputs inputs;
+    struct sig_dsp_CombBank_Parameters parameters;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+
+    size_t numLines;
+
+    // The memory for all delay lines, each of which is lineLength long.
+    float_array_ptr delayMemory;
+    size_t lineLength;
+    size_t writeIdx;
+
+    float previousSamples[sig_dsp_CombBank_MAX_LINES];
+    size_t numQuietSamples[sig_dsp_CombBank_MAX_LINES];
+};
+
+/**
+ * @brief Allocates a new CombBank.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numLines the number of comb filters,
+ * up to sig_dsp_CombBank_MAX_LINES
+ * @param maxDelayTime the longest (scaled) delay time, in seconds
+ * @return struct sig_dsp_CombBank* the new CombBank
+ */
+struct sig_dsp_CombBank* sig_dsp_CombBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numLines, float maxDelayTime);
+void sig_dsp_CombBank_init(struct sig_dsp_CombBank* self,
+    struct sig_SignalContext* context);
+void sig_dsp_CombBank_generate(void* signal);
+void sig_dsp_CombBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_CombBank* self);
+
+
+#define sig_dsp_AllpassChain_MAX_STAGES 8
+
+struct sig_dsp_AllpassChain_Parameters {
+    // The delay time of each stage, in seconds.
+    float delayTimes[sig_dsp_AllpassChain_MAX_STAGES];
+
+    // The allpass coefficient of each stage.
+    float gains[sig_dsp_AllpassChain_MAX_STAGES];
+};
+
+struct sig_dsp_AllpassChain_Inputs {
+    float_array_ptr source;
+    float_array_ptr delayTimeScale;
+};
+
+/**
+ * @brief A series of up to sig_dsp_AllpassChain_MAX_STAGES
+ * allpass filters, equivalent to a chain of sig_dsp_Allpasses.
+ *
+ * Because each stage depends on the output of the previous one,
+ * the stages are processed one after another, a block at a time.
+ * Their delay memory is stored in one contiguous allocation.
+ *
+ * The delay time scale is read once per block.
+ *
+ * Inputs:
+ *  - source: the signal to filter
+ *  - delayTimeScale: a multiplier for each stage's delay time
+ *
+ * Outputs:
+ *  - main: the output of the last stage
+ */
+struct sig_dsp_AllpassChain {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_AllpassChain_Inputs inputs;
+    struct sig_dsp_AllpassChain_Parameters parameters;
+    struct sig_dsp_Signal_SingleMonoOutput outputs;
+
+    size_t numStages;
+
+    // The memory for all stages, each of which is lineLength long.
+    float_array_ptr delayMemory;
+    size_t lineLength;
+    size_t writeIdx;
+
+    size_t numQuietSamples[sig_dsp_AllpassChain_MAX_STAGES];
+};
+
+/**
+ * @brief Allocates a new AllpassChain.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numStages the number of allpass filters,
+ * up to sig_dsp_AllpassChain_MAX_STAGES
+ * @param maxDelayTime the longest (scaled) delay time, in seconds
+ * @return struct sig_dsp_AllpassChain* the new AllpassChain
+ */
+struct sig_dsp_AllpassChain* sig_dsp_AllpassChain_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numStages, float maxDelayTime);
+void sig_dsp_AllpassChain_init(struct sig_dsp_AllpassChain* self,
+    struct sig_SignalContext* context);
+void sig_dsp_AllpassChain_generate(void* signal);
+void sig_dsp_AllpassChain_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_AllpassChain* self);
+
 
 struct sig_dsp_Chorus_Inputs {
     float_array_ptr source;
@@ -2627,19 +5385,43 @@ struct sig_dsp_Chorus_Outputs {
     float_array_ptr modulator;
 };
 
+/**
+ * @brief A chorus built on a mono delay line.
+ *
+ * Multichannel Choruses read one modulated tap per channel,
+ * each with its own LFO, and write planar main and modulator outputs.
+ * The LFOs' phases are spread evenly across a cycle,
+ * so a stereo Chorus modulates its channels in opposite directions.
+ * All inputs are mono, and are shared by every channel.
+ */
 struct sig_dsp_Chorus {
     struct sig_dsp_Signal signal;
     struct sig_dsp_Chorus_Inputs inputs;
     struct sig_dsp_Chorus_Outputs outputs;
 
     struct sig_DelayLine* delayLine;
-    struct sig_osc_FastLFSine modulator;
+    size_t numChannels;
+    struct sig_osc_FastLFSine modulators[sig_MAX_CHANNELS];
     float previousFixedOutput;
-    float previousModulatedOutput;
+    float previousModulatedOutputs[sig_MAX_CHANNELS];
 };
 
 struct sig_dsp_Chorus* sig_dsp_Chorus_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context);
+
+/**
+ * @brief Allocates a new Chorus that reads numChannels modulated taps
+ * from its delay line.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numChannels the number of taps,
+ * between 1 and sig_MAX_CHANNELS
+ * @return struct sig_dsp_Chorus* the new Chorus
+ */
+struct sig_dsp_Chorus* sig_dsp_Chorus_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels);
 void sig_dsp_Chorus_init(struct sig_dsp_Chorus* self,
     struct sig_SignalContext* context);
 void sig_dsp_Chorus_generate(void* signal);
@@ -2669,6 +5451,325 @@ void sig_dsp_LinearXFade_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_LinearXFade* self);
 
 
+#define sig_dsp_Mixer_MAX_INPUTS 16
+
+struct sig_dsp_Mixer_Parameters {
+    // The gain of each input. Inputs whose gain is 0.0 are skipped.
+    float gains[sig_dsp_Mixer_MAX_INPUTS];
+
+    // The stereo position of each input, from -1.0 (left)
+    // to 1.0 (right). Only used by stereo Mixers.
+    float pans[sig_dsp_Mixer_MAX_INPUTS];
+
+    // The gain applied to the whole mix.
+    float masterGain;
+};
+
+struct sig_dsp_Mixer_Inputs {
+    float_array_ptr sources[sig_dsp_Mixer_MAX_INPUTS];
+};
+
+struct sig_dsp_Mixer_Outputs {
+    /**
+     * @brief The mix of all inputs (mono Mixers only;
+     * silent for stereo Mixers).
+     */
+    float_array_ptr main;
+
+    /**
+     * @brief The left channel of the mix (stereo Mixers only;
+     * silent for mono Mixers).
+     */
+    float_array_ptr left;
+
+    /**
+     * @brief The right channel of the mix (stereo Mixers only;
+     * silent for mono Mixers).
+     */
+    float_array_ptr right;
+};
+
+/**
+ * @brief Sums up to sig_dsp_Mixer_MAX_INPUTS inputs, each with its own
+ * gain, into a single output block. Stereo Mixers also pan each input
+ * using an equal-power pan law.
+ *
+ * A Mixer replaces a chain of sig_dsp_Add Signals (and the
+ * intermediate blocks between them). Each input is scaled and
+ * accumulated into the output in a single loop, and inputs whose gain
+ * is zero are skipped entirely.
+ *
+ * Inputs:
+ *  - sources: the signals to mix
+ *
+ * Outputs:
+ *  - main: the mix (mono Mixers only; silent for stereo Mixers)
+ *  - left: the left channel of the mix (stereo Mixers only;
+ *    silent for mono Mixers)
+ *  - right: the right channel of the mix (stereo Mixers only;
+ *    silent for mono Mixers)
+ */
+struct sig_dsp_Mixer {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Mixer_Inputs inputs;
+    struct sig_dsp_Mixer_Parameters parameters;
+    struct sig_dsp_Mixer_Outputs outputs;
+
+    size_t numInputs;
+    bool isStereo;
+
+    // The equal-power pan gains for each input,
+    // which are recalculated whenever its pan changes.
+    float previousPans[sig_dsp_Mixer_MAX_INPUTS];
+    float leftPanGains[sig_dsp_Mixer_MAX_INPUTS];
+    float rightPanGains[sig_dsp_Mixer_MAX_INPUTS];
+};
+
+/**
+ * @brief Allocates a new mono Mixer.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numInputs the number of inputs, up to sig_dsp_Mixer_MAX_INPUTS
+ * @return struct sig_dsp_Mixer* the new Mixer
+ */
+struct sig_dsp_Mixer* sig_dsp_Mixer_new(struct sig_Allocator* allocator,
+    struct sig_SignalContext* context, size_t numInputs);
+
+/**
+ * @brief Allocates a new stereo Mixer, which pans each input
+ * into its left and right outputs.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numInputs the number of inputs, up to sig_dsp_Mixer_MAX_INPUTS
+ * @return struct sig_dsp_Mixer* the new Mixer
+ */
+struct sig_dsp_Mixer* sig_dsp_Mixer_newStereo(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numInputs);
+void sig_dsp_Mixer_init(struct sig_dsp_Mixer* self,
+    struct sig_SignalContext* context);
+void sig_dsp_Mixer_generate(void* signal);
+void sig_dsp_Mixer_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Mixer* self);
+
+
+#define sig_dsp_ModMatrix_MAX_SOURCES 8
+#define sig_dsp_ModMatrix_MAX_DESTINATIONS 16
+
+struct sig_dsp_ModMatrix_Parameters {
+    // A constant value added to each destination.
+    float offsets[sig_dsp_ModMatrix_MAX_DESTINATIONS];
+};
+
+struct sig_dsp_ModMatrix_Inputs {
+    float_array_ptr sources[sig_dsp_ModMatrix_MAX_SOURCES];
+};
+
+struct sig_dsp_ModMatrix_Outputs {
+    float_array_ptr destinations[sig_dsp_ModMatrix_MAX_DESTINATIONS];
+};
+
+/**
+ * @brief A modulation matrix, which routes up to
+ * sig_dsp_ModMatrix_MAX_SOURCES source signals to up to
+ * sig_dsp_ModMatrix_MAX_DESTINATIONS destinations.
+ * Each destination is the sum of its offset and every source
+ * multiplied by the depth of its route to that destination.
+ *
+ * Only routes with a non-zero depth are rendered; the list of routes
+ * to each destination is rebuilt whenever the depths change,
+ * so sparse matrices cost no more than the routes they contain.
+ *
+ * Depths are set with sig_dsp_ModMatrix_setDepth() or
+ * sig_dsp_ModMatrix_setDepths(), which write to a pending matrix.
+ * Pending changes are applied at the start of the next block,
+ * and are guarded by a sequence counter so that a block never uses
+ * a partially-written matrix (e.g. when the audio callback interrupts
+ * a control thread part way through a change, or runs on another
+ * core). Changes made by a single sig_dsp_ModMatrix_setDepths() call
+ * are applied together. Depths may be set from one thread other than
+ * the audio thread at a time.
+ *
+ * Inputs:
+ *  - sources: the modulation sources
+ *
+ * Outputs:
+ *  - destinations: one block for each destination
+ *    (unused destinations are NULL)
+ */
+struct sig_dsp_ModMatrix {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_ModMatrix_Inputs inputs;
+    struct sig_dsp_ModMatrix_Parameters parameters;
+    struct sig_dsp_ModMatrix_Outputs outputs;
+
+    size_t numSources;
+    size_t numDestinations;
+
+    // The depths that are currently being rendered.
+    float depths[sig_dsp_ModMatrix_MAX_SOURCES]
+        [sig_dsp_ModMatrix_MAX_DESTINATIONS];
+
+    // The depths that will be applied at the start of the next block.
+    // pendingVersion is odd while they are being written; it is
+    // published with release ordering, and read with acquire ordering
+    // (as a seqlock), like the indices of a sig_RingBuffer.
+    sig_AtomicFloat pendingDepths[sig_dsp_ModMatrix_MAX_SOURCES]
+        [sig_dsp_ModMatrix_MAX_DESTINATIONS];
+    sig_AtomicUInt32 pendingVersion;
+    uint32_t appliedVersion;
+
+    // The sources and depths of each destination's non-zero routes.
+    size_t numRoutes[sig_dsp_ModMatrix_MAX_DESTINATIONS];
+    size_t routeSources[sig_dsp_ModMatrix_MAX_DESTINATIONS]
+        [sig_dsp_ModMatrix_MAX_SOURCES];
+    float routeDepths[sig_dsp_ModMatrix_MAX_DESTINATIONS]
+        [sig_dsp_ModMatrix_MAX_SOURCES];
+};
+
+/**
+ * @brief Allocates a new ModMatrix, in which every depth is 0.0.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param numSources the number of sources,
+ * up to sig_dsp_ModMatrix_MAX_SOURCES
+ * @param numDestinations the number of destinations,
+ * up to sig_dsp_ModMatrix_MAX_DESTINATIONS
+ * @return struct sig_dsp_ModMatrix* the new ModMatrix
+ */
+struct sig_dsp_ModMatrix* sig_dsp_ModMatrix_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numSources, size_t numDestinations);
+void sig_dsp_ModMatrix_init(struct sig_dsp_ModMatrix* self,
+    struct sig_SignalContext* context);
+
+/**
+ * @brief Sets the depth of the route from a source to a destination,
+ * which will take effect at the start of the next block.
+ * Out of range sources and destinations are ignored.
+ *
+ * @param self the ModMatrix
+ * @param source the index of the source
+ * @param destination the index of the destination
+ * @param depth the depth of the route
+ */
+void sig_dsp_ModMatrix_setDepth(struct sig_dsp_ModMatrix* self,
+    size_t source, size_t destination, float depth);
+
+/**
+ * @brief Sets every depth in the matrix, which will all take effect
+ * together at the start of the next block.
+ *
+ * @param self the ModMatrix
+ * @param depths numSources * numDestinations depths, with the depths
+ * of each source's routes to every destination stored contiguously
+ */
+void sig_dsp_ModMatrix_setDepths(struct sig_dsp_ModMatrix* self,
+    const float* depths);
+void sig_dsp_ModMatrix_generate(void* signal);
+void sig_dsp_ModMatrix_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_ModMatrix* self);
+
+
+enum sig_dsp_Telemetry_Mode {
+    // The largest absolute value of the source.
+    sig_dsp_Telemetry_Mode_PEAK,
+
+    // The root mean square of the source.
+    sig_dsp_Telemetry_Mode_RMS,
+
+    // The last sample of the source.
+    sig_dsp_Telemetry_Mode_LAST
+};
+
+struct sig_dsp_Telemetry_Parameters {
+    /**
+     * @brief How each report summarizes the source.
+     */
+    enum sig_dsp_Telemetry_Mode mode;
+
+    /**
+     * @brief The number of blocks summarized by each report.
+     */
+    float blocksPerReport;
+};
+
+struct sig_dsp_Telemetry_Inputs {
+    float_array_ptr source;
+};
+
+struct sig_dsp_Telemetry_Outputs {
+    /**
+     * @brief A queue of float reports, which should be drained
+     * by a single thread outside of the audio callback.
+     */
+    struct sig_RingBuffer* main;
+};
+
+/**
+ * @brief A sink that summarizes its source for user interfaces,
+ * such as meters and scopes, without them reading from the blocks
+ * of a running graph.
+ *
+ * Every blocksPerReport blocks, the peak, RMS or last value of the
+ * source is pushed into a lock-free queue. The UI thread drains
+ * the queue whenever it redraws, and so always reads complete values
+ * from memory that the audio thread isn't writing to. Reports that
+ * don't fit because the queue hasn't been drained are dropped.
+ *
+ * Inputs:
+ *  - source: the signal to summarize
+ *
+ * Outputs:
+ *  - main: a RingBuffer of float reports
+ */
+struct sig_dsp_Telemetry {
+    struct sig_dsp_Signal signal;
+    struct sig_dsp_Telemetry_Inputs inputs;
+    struct sig_dsp_Telemetry_Parameters parameters;
+    struct sig_dsp_Telemetry_Outputs outputs;
+
+    size_t numBlocks;
+    float peak;
+    float sumOfSquares;
+    float last;
+};
+
+/**
+ * @brief Allocates a new Telemetry Signal.
+ *
+ * @param allocator the allocator to use
+ * @param context the signal context
+ * @param capacity the minimum number of reports the queue can hold
+ * before they are dropped
+ * @return struct sig_dsp_Telemetry* the new Telemetry Signal
+ */
+struct sig_dsp_Telemetry* sig_dsp_Telemetry_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t capacity);
+void sig_dsp_Telemetry_init(struct sig_dsp_Telemetry* self,
+    struct sig_SignalContext* context);
+void sig_dsp_Telemetry_generate(void* signal);
+
+/**
+ * @brief Drains all pending reports, keeping only the most recent.
+ * This is intended for meters and readouts, and should only be
+ * called from the thread that consumes the reports.
+ *
+ * @param self the Telemetry Signal
+ * @param value the location to store the most recent report in;
+ * this is left unchanged if there were no pending reports
+ * @return true if there were any pending reports
+ */
+bool sig_dsp_Telemetry_readLatest(struct sig_dsp_Telemetry* self,
+    float* value);
+void sig_dsp_Telemetry_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Telemetry* self);
+
+
 
 // TODO: Don't hardcode these.
 #define sig_dsp_Calibrator_NUM_STAGES 6
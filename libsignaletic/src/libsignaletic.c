@@ -1,9 +1,16 @@
-#include <math.h>   // For powf, fmodf, sinf, roundf, fabsf, rand
-#include <stdlib.h> // For RAND_MAX
+#include <math.h>   // For powf, fmodf, sinf, roundf, fabsf
+#include <stdlib.h> // For labs
+#include <string.h> // For memcpy
 #include <tlsf.h>   // Includes assert.h, limits.h, stddef.h
                     // stdio.h, stdlib.h, string.h (for errors etc.)
 #include <libsignaletic.h>
 
+#if (defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)) && !defined(__EMSCRIPTEN__)
+#include <xmmintrin.h> // For _mm_getcsr, _mm_setcsr
+#define sig_HAS_SSE_CSR 1
+#endif
+
 inline float sig_fminf(float a, float b) {
     float r;
 #ifdef __arm__
@@ -42,16 +49,111 @@ inline float sig_flooredfmodf(float numer, float denom) {
     return remain;
 }
 
-// TODO: Replace this with an object that implements
-// the quick and dirty LCR method from Numerical Recipes:
-//     unsigned long jran = seed,
-//                   ia = 4096,
-//                   ic = 150889,
-//                   im = 714025;
-//     jran=(jran*ia+ic) % im;
-//     float ran=(float) jran / (float) im;
+static inline uint32_t sig_Random_splitMix32(uint32_t* x) {
+    uint32_t z = (*x += 0x9E3779B9u);
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    return z ^ (z >> 16);
+}
+
+static inline uint32_t sig_Random_rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+// Converts the upper 24 bits of a random integer
+// to a float in the range [0.0, 1.0).
+static inline float sig_Random_toFloat(uint32_t x) {
+    return (float) (x >> 8) * (1.0f / 16777216.0f);
+}
+
+void sig_Random_init(struct sig_Random* self, uint32_t seed) {
+    // The seed is expanded using SplitMix32 so that
+    // similar seeds produce uncorrelated sequences.
+    uint32_t x = seed;
+    for (size_t i = 0; i < 4; i++) {
+        self->state[i] = sig_Random_splitMix32(&x);
+    }
+
+    // xoshiro's state must never be entirely zero.
+    if ((self->state[0] | self->state[1] |
+        self->state[2] | self->state[3]) == 0) {
+        self->state[0] = 1;
+    }
+}
+
+inline uint32_t sig_Random_nextUInt32(struct sig_Random* self) {
+    uint32_t* s = self->state;
+    uint32_t result = s[0] + s[3];
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = sig_Random_rotl(s[3], 11);
+
+    return result;
+}
+
+inline float sig_Random_nextf(struct sig_Random* self) {
+    return sig_Random_toFloat(sig_Random_nextUInt32(self));
+}
+
+inline float sig_Random_nextBipolarf(struct sig_Random* self) {
+    return sig_Random_nextf(self) * 2.0f - 1.0f;
+}
+
+void sig_Random_fill(struct sig_Random* self, float_array_ptr array,
+    size_t length) {
+    // The state is copied into locals so that it can be kept
+    // in registers for the duration of the loop.
+    uint32_t s0 = self->state[0];
+    uint32_t s1 = self->state[1];
+    uint32_t s2 = self->state[2];
+    uint32_t s3 = self->state[3];
+
+    for (size_t i = 0; i < length; i++) {
+        uint32_t result = s0 + s3;
+        uint32_t t = s1 << 9;
+
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = sig_Random_rotl(s3, 11);
+
+        FLOAT_ARRAY(array)[i] = sig_Random_toFloat(result);
+    }
+
+    self->state[0] = s0;
+    self->state[1] = s1;
+    self->state[2] = s2;
+    self->state[3] = s3;
+}
+
+void sig_Random_fillBipolar(struct sig_Random* self, float_array_ptr array,
+    size_t length) {
+    sig_Random_fill(self, array, length);
+
+    for (size_t i = 0; i < length; i++) {
+        FLOAT_ARRAY(array)[i] = FLOAT_ARRAY(array)[i] * 2.0f - 1.0f;
+    }
+}
+
+// The shared generator's initial state is equivalent to
+// sig_Random_init(&sig_sharedRandom, sig_DEFAULT_RANDOM_SEED).
+static struct sig_Random sig_sharedRandom = {
+    .state = {0x96A0F96Bu, 0x12BC8390u, 0x971E9964u, 0x79ADC7E7u}
+};
+
 float sig_randf(void) {
-    return (float) ((double) rand() / ((double) RAND_MAX + 1));
+    return sig_Random_nextf(&sig_sharedRandom);
+}
+
+void sig_randSeed(uint32_t seed) {
+    sig_Random_init(&sig_sharedRandom, seed);
 }
 
 inline float sig_fastTanhf(float x) {
@@ -68,6 +170,61 @@ inline float sig_fastTanhf(float x) {
     return x * (27.0f + x2) / (27.0f + 9.0f * x2);
 }
 
+inline float sig_denormals_flush(float value) {
+    return fabsf(value) < sig_DENORMAL_THRESHOLD ? 0.0f : value;
+}
+
+bool sig_denormals_shouldFlushLine(size_t* numQuietSamples,
+    float blockPeak, size_t blockSize, size_t readDistance) {
+    if (blockPeak >= sig_DENORMAL_THRESHOLD) {
+        *numQuietSamples = 0;
+        return false;
+    }
+
+    // Only flush once, when the quiet samples first
+    // cover everything that can be read.
+    bool wasFlushed = *numQuietSamples >= readDistance;
+    *numQuietSamples += blockSize;
+
+    return !wasFlushed && *numQuietSamples >= readDistance;
+}
+
+uint32_t sig_denormals_enableFlushToZero(void) {
+#if defined(sig_HAS_SSE_CSR)
+    // Flush-to-zero (bit 15) and denormals-are-zero (bit 6).
+    uint32_t csr = _mm_getcsr();
+    _mm_setcsr(csr | 0x8040);
+    return csr;
+#elif defined(__aarch64__) && defined(__GNUC__)
+    // FPCR flush-to-zero (bit 24).
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | (1ULL << 24)));
+    return (uint32_t) fpcr;
+#elif defined(__arm__) && defined(__ARM_FP) && defined(__GNUC__)
+    // FPSCR flush-to-zero (bit 24).
+    uint32_t fpscr;
+    __asm__ __volatile__("vmrs %0, fpscr" : "=r"(fpscr));
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(fpscr | (1U << 24)));
+    return fpscr;
+#else
+    return 0;
+#endif
+}
+
+void sig_denormals_restore(uint32_t previousState) {
+#if defined(sig_HAS_SSE_CSR)
+    _mm_setcsr(previousState);
+#elif defined(__aarch64__) && defined(__GNUC__)
+    uint64_t fpcr = previousState;
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#elif defined(__arm__) && defined(__ARM_FP) && defined(__GNUC__)
+    __asm__ __volatile__("vmsr fpscr, %0" : : "r"(previousState));
+#else
+    (void) previousState;
+#endif
+}
+
 // TODO: Unit tests.
 inline float sig_linearMap(float value,
     float fromMin, float fromMax, float toMin, float toMax) {
@@ -380,6 +537,32 @@ inline void sig_osc_Oscillator_accumulatePhase(float* phaseAccumulator,
     *phaseAccumulator = sig_osc_Oscillator_wrapPhase(phase);
 }
 
+inline float sig_osc_polyBLEP(float phase, float phaseIncrement) {
+    if (phase < phaseIncrement) {
+        // Just after the step.
+        float x = 1.0f - phase / phaseIncrement;
+        return -0.5f * x * x;
+    } else if (phase > 1.0f - phaseIncrement) {
+        // Just before the step.
+        float x = (phase - 1.0f) / phaseIncrement + 1.0f;
+        return 0.5f * x * x;
+    }
+
+    return 0.0f;
+}
+
+inline float sig_osc_polyBLAMP(float phase, float phaseIncrement) {
+    if (phase < phaseIncrement) {
+        float x = 1.0f - phase / phaseIncrement;
+        return x * x * x * (1.0f / 6.0f);
+    } else if (phase > 1.0f - phaseIncrement) {
+        float x = (phase - 1.0f) / phaseIncrement + 1.0f;
+        return x * x * x * (1.0f / 6.0f);
+    }
+
+    return 0.0f;
+}
+
 void sig_osc_Wavetable_init(struct sig_osc_Wavetable* self,
     struct sig_Buffer* wavetable) {
     self->phaseAccumulator = 0.0f;
@@ -404,6 +587,11 @@ void sig_osc_WavetableBank_init(struct sig_osc_WavetableBank* self,
     struct sig_WavetableBank* wavetables) {
     self->phaseAccumulator = 0.0f;
     self->wavetables = wavetables;
+    // NaN never equals the next phase increment,
+    // so the mipmap level is selected on the first sample.
+    self->previousPhaseIncrement = NAN;
+    self->mipmapLevel = 0;
+    self->mipmapFade = 0.0f;
 }
 
 inline float sig_osc_WavetableBank_generate(struct sig_osc_WavetableBank* self,
@@ -416,8 +604,15 @@ inline float sig_osc_WavetableBank_generate(struct sig_osc_WavetableBank* self,
         *eocOut = sig_osc_Oscillator_eoc(modulatedPhase);
         modulatedPhase = sig_flooredfmodf(modulatedPhase, 1.0f);
         float scaledTableIdx = tableIndex * lastWaveTableIdx;
-        float sample = sig_WavetableBank_readLinearAtPhase(
-            self->wavetables, scaledTableIdx, modulatedPhase);
+        float phaseIncrement = frequency / sampleRate;
+        if (phaseIncrement != self->previousPhaseIncrement) {
+            sig_WavetableBank_selectMipmapLevel(self->wavetables,
+                phaseIncrement, &self->mipmapLevel, &self->mipmapFade);
+            self->previousPhaseIncrement = phaseIncrement;
+        }
+        float sample = sig_WavetableBank_readMipmapLevelAtPhase(
+            self->wavetables, self->mipmapLevel, self->mipmapFade,
+            scaledTableIdx, modulatedPhase);
         sig_osc_Oscillator_accumulatePhase(&self->phaseAccumulator,
             frequency, sampleRate);
 
@@ -643,26 +838,54 @@ void sig_AudioSettings_destroy(struct sig_Allocator* allocator,
 
 
 
-struct sig_SignalContext* sig_SignalContext_new(
-    struct sig_Allocator* allocator, struct sig_AudioSettings* audioSettings) {
-    struct sig_SignalContext* self = sig_MALLOC(allocator,
-        struct sig_SignalContext);
-
-    self->audioSettings = audioSettings;
-
+// Allocates the context's default buffers and signals,
+// which depend on its audio settings.
+static void sig_SignalContext_newDefaults(struct sig_Allocator* allocator,
+    struct sig_SignalContext* self) {
     struct sig_Buffer* emptyBuffer = sig_Buffer_new(allocator, 0);
     self->emptyBuffer = emptyBuffer;
 
     struct sig_DelayLine* oneSampleDelayLine = sig_DelayLine_new(allocator, 1);
     self->oneSampleDelayLine = oneSampleDelayLine;
 
-    struct sig_dsp_ConstantValue* silence = sig_dsp_ConstantValue_new(
-        allocator, self, 0.0f);
+    // Silence and unity provide the maximum number of channels,
+    // so that they can be connected to multichannel inputs.
+    struct sig_dsp_ConstantValue* silence =
+        sig_dsp_ConstantValue_newMultichannel(allocator, self,
+            sig_MAX_CHANNELS, 0.0f);
     self->silence = silence;
 
-    struct sig_dsp_ConstantValue* unity = sig_dsp_ConstantValue_new(
-        allocator, self, 1.0f);
+    struct sig_dsp_ConstantValue* unity =
+        sig_dsp_ConstantValue_newMultichannel(allocator, self,
+            sig_MAX_CHANNELS, 1.0f);
     self->unity = unity;
+}
+
+struct sig_SignalContext* sig_SignalContext_new(
+    struct sig_Allocator* allocator, struct sig_AudioSettings* audioSettings) {
+    struct sig_SignalContext* self = sig_MALLOC(allocator,
+        struct sig_SignalContext);
+
+    self->audioSettings = audioSettings;
+    self->parent = NULL;
+    sig_Random_init(&self->random, sig_DEFAULT_RANDOM_SEED);
+    sig_SignalContext_newDefaults(allocator, self);
+    self->tables = sig_LookupTableCache_new(allocator);
+
+    return self;
+}
+
+struct sig_SignalContext* sig_SignalContext_newChild(
+    struct sig_Allocator* allocator, struct sig_SignalContext* parent,
+    struct sig_AudioSettings* audioSettings) {
+    struct sig_SignalContext* self = sig_MALLOC(allocator,
+        struct sig_SignalContext);
+
+    self->audioSettings = audioSettings;
+    self->parent = parent;
+    sig_Random_init(&self->random, sig_Random_nextUInt32(&parent->random));
+    sig_SignalContext_newDefaults(allocator, self);
+    self->tables = parent->tables;
 
     return self;
 }
@@ -673,6 +896,12 @@ void sig_SignalContext_destroy(struct sig_Allocator* allocator,
     sig_DelayLine_destroy(allocator, self->oneSampleDelayLine);
     sig_dsp_ConstantValue_destroy(allocator, self->silence);
     sig_dsp_ConstantValue_destroy(allocator, self->unity);
+
+    // Child contexts share their parent's tables.
+    if (self->parent == NULL) {
+        sig_LookupTableCache_destroy(allocator, self->tables);
+    }
+
     allocator->impl->free(allocator, self);
 }
 
@@ -721,6 +950,403 @@ void sig_AudioBlock_destroy(struct sig_Allocator* allocator,
     allocator->impl->free(allocator, self);
 }
 
+static inline size_t sig_clampNumChannels(size_t numChannels) {
+    return numChannels < 1 ? 1 :
+        numChannels > sig_MAX_CHANNELS ? sig_MAX_CHANNELS : numChannels;
+}
+
+float_array_ptr sig_AudioBlock_newMultichannel(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    size_t numChannels) {
+    size_t length = audioSettings->blockSize *
+        sig_clampNumChannels(numChannels);
+    float_array_ptr block = sig_samples_new(allocator, length);
+    sig_fillWithSilence(block, length);
+
+    return block;
+}
+
+float_array_ptr sig_AudioBlock_channel(
+    struct sig_AudioSettings* audioSettings, float_array_ptr block,
+    size_t channel) {
+    return (float_array_ptr) (FLOAT_ARRAY(block) +
+        channel * audioSettings->blockSize);
+}
+
+struct sig_EventBlock* sig_EventBlock_new(struct sig_Allocator* allocator,
+    size_t capacity) {
+    struct sig_EventBlock* self = sig_MALLOC(allocator,
+        struct sig_EventBlock);
+    self->capacity = capacity;
+    self->length = 0;
+    self->events = (struct sig_Event*) allocator->impl->malloc(allocator,
+        sizeof(struct sig_Event) * capacity);
+
+    return self;
+}
+
+void sig_EventBlock_clear(struct sig_EventBlock* self) {
+    self->length = 0;
+}
+
+bool sig_EventBlock_push(struct sig_EventBlock* self, uint32_t offset,
+    float value) {
+    if (self->length >= self->capacity ||
+        (self->length > 0 &&
+        offset < self->events[self->length - 1].offset)) {
+        return false;
+    }
+
+    self->events[self->length].offset = offset;
+    self->events[self->length].value = value;
+    self->length++;
+
+    return true;
+}
+
+void sig_EventBlock_readBlock(struct sig_EventBlock* self,
+    float_array_ptr source, size_t blockSize, float* previousValue) {
+    float previous = *previousValue;
+
+    sig_EventBlock_clear(self);
+    for (size_t i = 0; i < blockSize; i++) {
+        float value = FLOAT_ARRAY(source)[i];
+        if (value != previous) {
+            sig_EventBlock_push(self, (uint32_t) i, value);
+            previous = value;
+        }
+    }
+
+    *previousValue = previous;
+}
+
+void sig_EventBlock_writeBlock(struct sig_EventBlock* self,
+    float_array_ptr output, size_t blockSize, float* currentValue) {
+    float value = *currentValue;
+    size_t start = 0;
+
+    for (size_t i = 0; i < self->length; i++) {
+        size_t offset = self->events[i].offset;
+        if (offset >= blockSize) {
+            break;
+        }
+
+        sig_fillWithValue(FLOAT_ARRAY(output) + start, offset - start,
+            value);
+        value = self->events[i].value;
+        start = offset;
+    }
+
+    sig_fillWithValue(FLOAT_ARRAY(output) + start, blockSize - start,
+        value);
+    *currentValue = value;
+}
+
+void sig_EventBlock_destroy(struct sig_Allocator* allocator,
+    struct sig_EventBlock* self) {
+    allocator->impl->free(allocator, self->events);
+    allocator->impl->free(allocator, self);
+}
+
+
+uint8_t sig_midi_Message_type(struct sig_midi_Message* message) {
+    return message->status < sig_midi_Status_SYSEX_START ?
+        message->status & 0xF0 : message->status;
+}
+
+uint8_t sig_midi_Message_channel(struct sig_midi_Message* message) {
+    return message->status < sig_midi_Status_SYSEX_START ?
+        (message->status & 0x0F) + 1 : 0;
+}
+
+static inline uint8_t sig_midi_numDataBytes(uint8_t status) {
+    uint8_t type = status & 0xF0;
+
+    if (type == sig_midi_Status_PROGRAM_CHANGE ||
+        type == sig_midi_Status_CHANNEL_PRESSURE ||
+        status == 0xF1 || status == 0xF3) {
+        // Program change, channel pressure,
+        // MTC quarter frame, and song select.
+        return 1;
+    } else if (status >= sig_midi_Status_SYSEX_START && status != 0xF2) {
+        // Tune request and the undefined system common messages.
+        // Song position (0xF2) is the only one with two data bytes.
+        return 0;
+    }
+
+    return 2;
+}
+
+void sig_midi_Parser_init(struct sig_midi_Parser* self) {
+    self->status = 0;
+    self->data[0] = 0;
+    self->data[1] = 0;
+    self->numData = 0;
+    self->isInSysEx = false;
+}
+
+bool sig_midi_Parser_parse(struct sig_midi_Parser* self, uint8_t byte,
+    struct sig_midi_Message* message) {
+    if (byte >= sig_midi_Status_TIMING_CLOCK) {
+        // Real-time messages can occur anywhere,
+        // even in the middle of other messages,
+        // and don't affect running status.
+        message->status = byte;
+        message->data[0] = 0;
+        message->data[1] = 0;
+        return true;
+    }
+
+    if (byte & 0x80) {
+        // A status byte, which ends any system exclusive message.
+        // System common messages cancel running status.
+        self->isInSysEx = byte == sig_midi_Status_SYSEX_START;
+        self->status = byte < sig_midi_Status_SYSEX_START ? byte : 0;
+        self->numData = 0;
+
+        if (byte > sig_midi_Status_SYSEX_START &&
+            byte != sig_midi_Status_SYSEX_END) {
+            if (sig_midi_numDataBytes(byte) == 0) {
+                message->status = byte;
+                message->data[0] = 0;
+                message->data[1] = 0;
+                return true;
+            }
+
+            self->status = byte;
+        }
+
+        return false;
+    }
+
+    if (self->isInSysEx || self->status == 0) {
+        // System exclusive data, or data without a status.
+        return false;
+    }
+
+    self->data[self->numData++] = byte;
+    if (self->numData < sig_midi_numDataBytes(self->status)) {
+        return false;
+    }
+
+    message->status = self->status;
+    message->data[0] = self->data[0];
+    message->data[1] = self->numData > 1 ? self->data[1] : 0;
+    self->numData = 0;
+
+    if (self->status >= sig_midi_Status_SYSEX_START) {
+        self->status = 0;
+    }
+
+    return true;
+}
+
+struct sig_midi_EventQueue* sig_midi_EventQueue_new(
+    struct sig_Allocator* allocator, size_t capacity) {
+    struct sig_midi_EventQueue* self = sig_MALLOC(allocator,
+        struct sig_midi_EventQueue);
+    self->capacity = capacity;
+    self->events = (struct sig_midi_Event*) allocator->impl->malloc(
+        allocator, sizeof(struct sig_midi_Event) * capacity);
+    sig_midi_EventQueue_init(self);
+
+    return self;
+}
+
+void sig_midi_EventQueue_init(struct sig_midi_EventQueue* self) {
+    self->length = 0;
+    self->numDropped = 0;
+    sig_midi_Parser_init(&self->parser);
+}
+
+void sig_midi_EventQueue_clear(struct sig_midi_EventQueue* self) {
+    self->length = 0;
+}
+
+bool sig_midi_EventQueue_push(struct sig_midi_EventQueue* self,
+    uint32_t offset, struct sig_midi_Message message) {
+    if (self->length >= self->capacity) {
+        self->numDropped++;
+        return false;
+    }
+
+    if (self->length > 0 && offset < self->events[self->length - 1].offset) {
+        // Keep events in the order they were received.
+        offset = self->events[self->length - 1].offset;
+    }
+
+    self->events[self->length].offset = offset;
+    self->events[self->length].message = message;
+    self->length++;
+
+    return true;
+}
+
+size_t sig_midi_EventQueue_writeBytes(struct sig_midi_EventQueue* self,
+    const uint8_t* bytes, size_t numBytes, uint32_t offset) {
+    struct sig_midi_Message message;
+    size_t numAdded = 0;
+
+    for (size_t i = 0; i < numBytes; i++) {
+        if (sig_midi_Parser_parse(&self->parser, bytes[i], &message) &&
+            sig_midi_EventQueue_push(self, offset, message)) {
+            numAdded++;
+        }
+    }
+
+    return numAdded;
+}
+
+void sig_midi_EventQueue_destroy(struct sig_Allocator* allocator,
+    struct sig_midi_EventQueue* self) {
+    allocator->impl->free(allocator, self->events);
+    allocator->impl->free(allocator, self);
+}
+
+_Static_assert(sizeof(sig_AtomicSize) == sizeof(size_t),
+    "RingBuffer indices must have the same size in C and C++.");
+
+static inline size_t sig_RingBuffer_roundCapacity(size_t capacity) {
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+
+    return rounded;
+}
+
+struct sig_RingBuffer* sig_RingBuffer_new(struct sig_Allocator* allocator,
+    size_t capacity, size_t itemSize) {
+    struct sig_RingBuffer* self = sig_MALLOC(allocator,
+        struct sig_RingBuffer);
+    self->capacity = sig_RingBuffer_roundCapacity(capacity);
+    self->itemSize = itemSize;
+    self->items = (uint8_t*) allocator->impl->malloc(allocator,
+        self->capacity * itemSize);
+    sig_RingBuffer_init(self);
+
+    return self;
+}
+
+void sig_RingBuffer_init(struct sig_RingBuffer* self) {
+    atomic_init(&self->writeIdx, 0);
+    atomic_init(&self->readIdx, 0);
+    self->cachedReadIdx = 0;
+    self->cachedWriteIdx = 0;
+}
+
+size_t sig_RingBuffer_readable(struct sig_RingBuffer* self) {
+    size_t readIdx = atomic_load_explicit(&self->readIdx,
+        memory_order_relaxed);
+    self->cachedWriteIdx = atomic_load_explicit(&self->writeIdx,
+        memory_order_acquire);
+
+    return self->cachedWriteIdx - readIdx;
+}
+
+size_t sig_RingBuffer_writeable(struct sig_RingBuffer* self) {
+    size_t writeIdx = atomic_load_explicit(&self->writeIdx,
+        memory_order_relaxed);
+    self->cachedReadIdx = atomic_load_explicit(&self->readIdx,
+        memory_order_acquire);
+
+    return self->capacity - (writeIdx - self->cachedReadIdx);
+}
+
+size_t sig_RingBuffer_pushSpan(struct sig_RingBuffer* self,
+    const void* items, size_t numItems) {
+    size_t writeIdx = atomic_load_explicit(&self->writeIdx,
+        memory_order_relaxed);
+    size_t writeable = self->capacity - (writeIdx - self->cachedReadIdx);
+
+    // Only touch the consumer's cache line when the cached index
+    // says there isn't enough room.
+    if (writeable < numItems) {
+        writeable = sig_RingBuffer_writeable(self);
+    }
+
+    size_t numToWrite = numItems < writeable ? numItems : writeable;
+    if (numToWrite == 0) {
+        return 0;
+    }
+
+    size_t start = writeIdx & (self->capacity - 1);
+    size_t firstRun = self->capacity - start;
+    if (firstRun > numToWrite) {
+        firstRun = numToWrite;
+    }
+
+    const uint8_t* source = (const uint8_t*) items;
+    memcpy(self->items + start * self->itemSize, source,
+        firstRun * self->itemSize);
+    memcpy(self->items, source + firstRun * self->itemSize,
+        (numToWrite - firstRun) * self->itemSize);
+
+    atomic_store_explicit(&self->writeIdx, writeIdx + numToWrite,
+        memory_order_release);
+
+    return numToWrite;
+}
+
+size_t sig_RingBuffer_popSpan(struct sig_RingBuffer* self,
+    void* items, size_t maxItems) {
+    size_t readIdx = atomic_load_explicit(&self->readIdx,
+        memory_order_relaxed);
+    size_t readable = self->cachedWriteIdx - readIdx;
+
+    if (readable < maxItems) {
+        readable = sig_RingBuffer_readable(self);
+    }
+
+    size_t numToRead = maxItems < readable ? maxItems : readable;
+    if (numToRead == 0) {
+        return 0;
+    }
+
+    size_t start = readIdx & (self->capacity - 1);
+    size_t firstRun = self->capacity - start;
+    if (firstRun > numToRead) {
+        firstRun = numToRead;
+    }
+
+    uint8_t* destination = (uint8_t*) items;
+    memcpy(destination, self->items + start * self->itemSize,
+        firstRun * self->itemSize);
+    memcpy(destination + firstRun * self->itemSize, self->items,
+        (numToRead - firstRun) * self->itemSize);
+
+    atomic_store_explicit(&self->readIdx, readIdx + numToRead,
+        memory_order_release);
+
+    return numToRead;
+}
+
+bool sig_RingBuffer_push(struct sig_RingBuffer* self, const void* item) {
+    return sig_RingBuffer_pushSpan(self, item, 1) == 1;
+}
+
+bool sig_RingBuffer_pop(struct sig_RingBuffer* self, void* item) {
+    return sig_RingBuffer_popSpan(self, item, 1) == 1;
+}
+
+size_t sig_RingBuffer_flush(struct sig_RingBuffer* self) {
+    size_t readIdx = atomic_load_explicit(&self->readIdx,
+        memory_order_relaxed);
+    size_t writeIdx = atomic_load_explicit(&self->writeIdx,
+        memory_order_acquire);
+    self->cachedWriteIdx = writeIdx;
+    atomic_store_explicit(&self->readIdx, writeIdx, memory_order_release);
+
+    return writeIdx - readIdx;
+}
+
+void sig_RingBuffer_destroy(struct sig_Allocator* allocator,
+    struct sig_RingBuffer* self) {
+    allocator->impl->free(allocator, self->items);
+    allocator->impl->free(allocator, self);
+}
+
 struct sig_Buffer* sig_Buffer_new(struct sig_Allocator* allocator,
     size_t length) {
     struct sig_Buffer* self = (struct sig_Buffer*)
@@ -812,12 +1438,25 @@ void sig_BufferView_destroy(struct sig_Allocator* allocator,
     allocator->impl->free(allocator, self);
 }
 
+struct sig_Buffer* sig_BufferView_newWithSamples(
+    struct sig_Allocator* allocator, const float* samples, size_t length) {
+    struct sig_Buffer* self = sig_MALLOC(allocator, struct sig_Buffer);
+    // The samples are treated as read only, even though
+    // sig_Buffer itself doesn't enforce this.
+    self->samples = (float_array_ptr) samples;
+    self->length = length;
+
+    return self;
+}
+
 
 struct sig_WavetableBank* sig_WavetableBank_new(struct sig_Allocator* allocator,
     size_t numTables, size_t tableLength) {
     struct sig_WavetableBank* self = sig_MALLOC(allocator,
         struct sig_WavetableBank);
     self->length = numTables;
+    self->numLevels = 1;
+    self->mipmaps = NULL;
 
     self->waves = (struct sig_Buffer**) allocator->impl->malloc(
         allocator, sizeof(struct sig_Buffer*) * numTables);
@@ -829,27 +1468,199 @@ struct sig_WavetableBank* sig_WavetableBank_new(struct sig_Allocator* allocator,
     return self;
 }
 
-inline float sig_WavetableBank_readLinearAtPhase(struct sig_WavetableBank* self,
-    float tableIdx, float phase) {
-        int32_t tableIdxIntegral = (int32_t) tableIdx;
-        float tableIdxFractional = tableIdx - (float) tableIdxIntegral;
-        size_t aTableIndex = tableIdxIntegral % self->length;
-        struct sig_Buffer* aTable = self->waves[aTableIndex];
-        size_t bTableIndex = (tableIdxIntegral + 1) % self->length;
-        struct sig_Buffer* bTable = self->waves[bTableIndex];
+static inline float sig_WavetableBank_readWaves(struct sig_Buffer** waves,
+    size_t numWaves, float tableIdx, float phase) {
+    int32_t tableIdxIntegral = (int32_t) tableIdx;
+    float tableIdxFractional = tableIdx - (float) tableIdxIntegral;
+    size_t aTableIndex = tableIdxIntegral % numWaves;
+    struct sig_Buffer* aTable = waves[aTableIndex];
+    size_t bTableIndex = (tableIdxIntegral + 1) % numWaves;
+    struct sig_Buffer* bTable = waves[bTableIndex];
 
-        float a = sig_Buffer_readLinearAtPhase(aTable, phase);
-        float b = sig_Buffer_readLinearAtPhase(bTable, phase);
-        float sample = a + (b - a) * tableIdxFractional;
+    float a = sig_Buffer_readLinearAtPhase(aTable, phase);
+    float b = sig_Buffer_readLinearAtPhase(bTable, phase);
+    float sample = a + (b - a) * tableIdxFractional;
 
-        return sample;
+    return sample;
 }
 
-void sig_WavetableBank_destroy(struct sig_Allocator* allocator,
+inline float sig_WavetableBank_readLinearAtPhase(struct sig_WavetableBank* self,
+    float tableIdx, float phase) {
+    return sig_WavetableBank_readWaves(self->waves, self->length, tableIdx,
+        phase);
+}
+
+void sig_WavetableBank_generateMipmaps(struct sig_Allocator* allocator,
     struct sig_WavetableBank* self) {
-    for (size_t i = 0; i < self->length; i++) {
-        sig_Buffer_destroy(allocator, self->waves[i]);
-        self->waves[i] = NULL;
+    size_t tableLength = self->waves[0]->length;
+    for (size_t i = 1; i < self->length; i++) {
+        if (self->waves[i]->length != tableLength) {
+            return;
+        }
+    }
+
+    if (self->mipmaps != NULL) {
+        return;
+    }
+
+    struct sig_FFT* fft = sig_FFT_new(allocator, tableLength);
+    if (fft == NULL) {
+        return;
+    }
+
+    // Keep halving the number of harmonics until only one is left.
+    size_t numHarmonics = tableLength / 2;
+    size_t numLevels = 1;
+    while ((numHarmonics >> numLevels) > 0) {
+        numLevels++;
+    }
+
+    self->numLevels = numLevels;
+    self->mipmaps = (struct sig_Buffer**) allocator->impl->malloc(
+        allocator, sizeof(struct sig_Buffer*) * numLevels * self->length);
+
+    // Since linear interpolation attenuates and images harmonics
+    // that are close to a table's Nyquist frequency, each level's
+    // table is twice as long as it needs to be to hold its harmonics.
+    size_t minLength = tableLength < sig_WavetableBank_MIN_MIPMAP_LENGTH ?
+        tableLength : sig_WavetableBank_MIN_MIPMAP_LENGTH;
+    struct sig_FFT** levelFFTs = (struct sig_FFT**)
+        allocator->impl->malloc(allocator,
+            sizeof(struct sig_FFT*) * numLevels);
+    for (size_t level = 1; level < numLevels; level++) {
+        size_t levelLength = tableLength >> (level - 1);
+        levelFFTs[level] = sig_FFT_new(allocator,
+            levelLength < minLength ? minLength : levelLength);
+    }
+
+    float_array_ptr spectrum = sig_samples_new(allocator, tableLength);
+    for (size_t i = 0; i < self->length; i++) {
+        float* wave = FLOAT_ARRAY(self->waves[i]->samples);
+        float* bins = FLOAT_ARRAY(spectrum);
+        for (size_t j = 0; j < tableLength; j++) {
+            bins[j] = wave[j];
+        }
+        sig_FFT_forward(fft, spectrum);
+
+        self->mipmaps[i] = self->waves[i];
+
+        for (size_t level = 1; level < numLevels; level++) {
+            struct sig_FFT* levelFFT = levelFFTs[level];
+            size_t levelLength = levelFFT->length;
+            size_t levelHarmonics = numHarmonics >> level;
+            struct sig_Buffer* mipmap = sig_Buffer_new(allocator,
+                levelLength);
+            float* levelBins = FLOAT_ARRAY(mipmap->samples);
+
+            // Copy the retained harmonics into the smaller spectrum,
+            // scaling them to account for the shorter inverse transform.
+            float scale = (float) levelLength / (float) tableLength;
+            levelBins[0] = bins[0] * scale;
+            levelBins[1] = 0.0f;
+            for (size_t k = 1; k < levelLength / 2; k++) {
+                bool isRetained = k <= levelHarmonics;
+                levelBins[k * 2] = isRetained ? bins[k * 2] * scale : 0.0f;
+                levelBins[k * 2 + 1] = isRetained ?
+                    bins[k * 2 + 1] * scale : 0.0f;
+            }
+
+            sig_FFT_inverse(levelFFT, mipmap->samples);
+            self->mipmaps[level * self->length + i] = mipmap;
+        }
+    }
+
+    for (size_t level = 1; level < numLevels; level++) {
+        sig_FFT_destroy(allocator, levelFFTs[level]);
+    }
+    allocator->impl->free(allocator, levelFFTs);
+    allocator->impl->free(allocator, spectrum);
+    sig_FFT_destroy(allocator, fft);
+}
+
+inline void sig_WavetableBank_selectMipmapLevel(
+    struct sig_WavetableBank* self, float phaseIncrement,
+    size_t* levelOut, float* fadeOut) {
+    *levelOut = 0;
+    *fadeOut = 0.0f;
+
+    if (self->mipmaps == NULL) {
+        return;
+    }
+
+    // The first level's highest harmonic reaches the Nyquist frequency
+    // when the phase increment is 1 / tableLength. Each level
+    // after it can be played an octave higher.
+    float octave = log2f(fabsf(phaseIncrement) *
+        (float) self->waves[0]->length);
+    size_t lastLevel = self->numLevels - 1;
+
+    // Negated so that silent (-inf) and NaN increments
+    // read from the first level.
+    if (!(octave <= -1.0f)) {
+        float flooredOctave = floorf(octave);
+        size_t level = (size_t) (flooredOctave + 1.0f);
+        float fade = (octave - flooredOctave -
+            (1.0f - sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES)) /
+            sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES;
+        fade = sig_clamp(fade, 0.0f, 1.0f);
+
+        if (level >= lastLevel) {
+            level = lastLevel;
+            fade = 0.0f;
+        }
+
+        *levelOut = level;
+        *fadeOut = fade;
+    }
+}
+
+inline float sig_WavetableBank_readMipmapLevelAtPhase(
+    struct sig_WavetableBank* self, size_t level, float fade,
+    float tableIdx, float phase) {
+    if (self->mipmaps == NULL) {
+        return sig_WavetableBank_readLinearAtPhase(self, tableIdx, phase);
+    }
+
+    struct sig_Buffer** levelWaves = self->mipmaps + level * self->length;
+    float sample = sig_WavetableBank_readWaves(levelWaves, self->length,
+        tableIdx, phase);
+
+    if (fade > 0.0f) {
+        float next = sig_WavetableBank_readWaves(levelWaves + self->length,
+            self->length, tableIdx, phase);
+        sample += (next - sample) * fade;
+    }
+
+    return sample;
+}
+
+inline float sig_WavetableBank_readBandlimitedAtPhase(
+    struct sig_WavetableBank* self, float tableIdx, float phase,
+    float phaseIncrement) {
+    size_t level;
+    float fade;
+    sig_WavetableBank_selectMipmapLevel(self, phaseIncrement, &level, &fade);
+
+    return sig_WavetableBank_readMipmapLevelAtPhase(self, level, fade,
+        tableIdx, phase);
+}
+
+void sig_WavetableBank_destroy(struct sig_Allocator* allocator,
+    struct sig_WavetableBank* self) {
+    if (self->mipmaps != NULL) {
+        // The first level is shared with the waves.
+        for (size_t i = self->length; i < self->numLevels * self->length;
+            i++) {
+            sig_Buffer_destroy(allocator, self->mipmaps[i]);
+        }
+
+        allocator->impl->free(allocator, self->mipmaps);
+        self->mipmaps = NULL;
+    }
+
+    for (size_t i = 0; i < self->length; i++) {
+        sig_Buffer_destroy(allocator, self->waves[i]);
+        self->waves[i] = NULL;
     }
 
     allocator->impl->free(allocator, self->waves);
@@ -858,6 +1669,218 @@ void sig_WavetableBank_destroy(struct sig_Allocator* allocator,
     self = NULL;
 }
 
+struct sig_WavetableBank* sig_WavetableBankView_new(
+    struct sig_Allocator* allocator, const float* samples,
+    size_t numTables, size_t tableLength) {
+    struct sig_WavetableBank* self = sig_MALLOC(allocator,
+        struct sig_WavetableBank);
+    self->length = numTables;
+    self->numLevels = 1;
+    self->mipmaps = NULL;
+
+    self->waves = (struct sig_Buffer**) allocator->impl->malloc(
+        allocator, sizeof(struct sig_Buffer*) * numTables);
+
+    for (size_t i = 0; i < numTables; i++) {
+        self->waves[i] = sig_BufferView_newWithSamples(allocator,
+            samples + (i * tableLength), tableLength);
+    }
+
+    return self;
+}
+
+struct sig_WavetableBank* sig_WavetableBankView_newMipmapped(
+    struct sig_Allocator* allocator, const float* samples,
+    size_t numLevels, size_t tableLength) {
+    struct sig_WavetableBank* self = sig_WavetableBankView_new(allocator,
+        samples, 1, tableLength);
+    self->numLevels = numLevels;
+
+    self->mipmaps = (struct sig_Buffer**) allocator->impl->malloc(
+        allocator, sizeof(struct sig_Buffer*) * numLevels);
+    self->mipmaps[0] = self->waves[0];
+
+    for (size_t level = 1; level < numLevels; level++) {
+        self->mipmaps[level] = sig_BufferView_newWithSamples(allocator,
+            samples + (level * tableLength), tableLength);
+    }
+
+    return self;
+}
+
+void sig_WavetableBankView_destroy(struct sig_Allocator* allocator,
+    struct sig_WavetableBank* self) {
+    if (self->mipmaps != NULL) {
+        for (size_t i = self->length; i < self->numLevels * self->length;
+            i++) {
+            sig_BufferView_destroy(allocator, self->mipmaps[i]);
+        }
+
+        allocator->impl->free(allocator, self->mipmaps);
+        self->mipmaps = NULL;
+    }
+
+    for (size_t i = 0; i < self->length; i++) {
+        sig_BufferView_destroy(allocator, self->waves[i]);
+    }
+
+    allocator->impl->free(allocator, self->waves);
+    self->waves = NULL;
+    allocator->impl->free(allocator, self);
+}
+
+float sig_table_sine(float x) {
+    return sinf(x * sig_TWOPI);
+}
+
+float sig_table_tanh(float x) {
+    return tanhf((2.0f * x - 1.0f) * sig_TABLE_TANH_RANGE);
+}
+
+float sig_table_exp2(float x) {
+    return powf(2.0f, x);
+}
+
+float sig_table_hann(float x) {
+    return 0.5f - 0.5f * cosf(x * sig_TWOPI);
+}
+
+struct sig_LookupTableCache* sig_LookupTableCache_new(
+    struct sig_Allocator* allocator) {
+    struct sig_LookupTableCache* self = sig_MALLOC(allocator,
+        struct sig_LookupTableCache);
+    sig_LookupTableCache_init(self);
+
+    return self;
+}
+
+void sig_LookupTableCache_init(struct sig_LookupTableCache* self) {
+    self->tables = NULL;
+}
+
+struct sig_LookupTable* sig_LookupTableCache_find(
+    struct sig_LookupTableCache* self, sig_table_generator generator,
+    size_t length, size_t numGuardPoints) {
+    for (struct sig_LookupTable* entry = self->tables; entry != NULL;
+        entry = entry->next) {
+        if (entry->generator == generator &&
+            entry->table.length == length &&
+            entry->numGuardPoints == numGuardPoints) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static struct sig_LookupTable* sig_LookupTableCache_addEntry(
+    struct sig_LookupTableCache* self, struct sig_Allocator* allocator,
+    sig_table_generator generator, size_t length, size_t numGuardPoints) {
+    struct sig_LookupTable* entry = sig_MALLOC(allocator,
+        struct sig_LookupTable);
+    entry->generator = generator;
+    entry->numGuardPoints = numGuardPoints;
+    entry->refCount = 0;
+    entry->isPrecomputed = false;
+    entry->table.length = length;
+    entry->table.samples = NULL;
+    entry->next = self->tables;
+    self->tables = entry;
+
+    return entry;
+}
+
+static void sig_LookupTable_freeSamples(struct sig_Allocator* allocator,
+    struct sig_LookupTable* entry) {
+    if (!entry->isPrecomputed && entry->table.samples != NULL) {
+        allocator->impl->free(allocator, entry->table.samples);
+    }
+
+    entry->table.samples = NULL;
+}
+
+struct sig_Buffer* sig_LookupTableCache_acquire(
+    struct sig_LookupTableCache* self, struct sig_Allocator* allocator,
+    sig_table_generator generator, size_t length, size_t numGuardPoints) {
+    struct sig_LookupTable* entry = sig_LookupTableCache_find(self,
+        generator, length, numGuardPoints);
+
+    if (entry == NULL) {
+        entry = sig_LookupTableCache_addEntry(self, allocator,
+            generator, length, numGuardPoints);
+    }
+
+    if (entry->table.samples == NULL) {
+        size_t numPoints = length + numGuardPoints;
+        float* samples = (float*) sig_samples_new(allocator, numPoints);
+        float step = 1.0f / (float) length;
+        for (size_t i = 0; i < numPoints; i++) {
+            samples[i] = generator((float) i * step);
+        }
+        entry->table.samples = samples;
+    }
+
+    entry->refCount++;
+
+    return &entry->table;
+}
+
+void sig_LookupTableCache_provide(struct sig_LookupTableCache* self,
+    struct sig_Allocator* allocator, sig_table_generator generator,
+    size_t length, size_t numGuardPoints, float_array_ptr samples) {
+    struct sig_LookupTable* entry = sig_LookupTableCache_find(self,
+        generator, length, numGuardPoints);
+
+    if (entry == NULL) {
+        entry = sig_LookupTableCache_addEntry(self, allocator,
+            generator, length, numGuardPoints);
+    } else if (entry->refCount > 0) {
+        // Signals are already reading from this table.
+        return;
+    }
+
+    sig_LookupTable_freeSamples(allocator, entry);
+    entry->isPrecomputed = true;
+    entry->table.samples = samples;
+}
+
+void sig_LookupTableCache_release(struct sig_LookupTableCache* self,
+    struct sig_Allocator* allocator, struct sig_Buffer* table) {
+    for (struct sig_LookupTable* entry = self->tables; entry != NULL;
+        entry = entry->next) {
+        if (&entry->table != table) {
+            continue;
+        }
+
+        if (entry->refCount > 0) {
+            entry->refCount--;
+        }
+
+        // The entry itself is retained,
+        // so that the table can be rebuilt if it's requested again.
+        // Precomputed tables are kept, since they can't be rebuilt.
+        if (entry->refCount == 0 && !entry->isPrecomputed) {
+            sig_LookupTable_freeSamples(allocator, entry);
+        }
+
+        return;
+    }
+}
+
+void sig_LookupTableCache_destroy(struct sig_Allocator* allocator,
+    struct sig_LookupTableCache* self) {
+    struct sig_LookupTable* entry = self->tables;
+    while (entry != NULL) {
+        struct sig_LookupTable* next = entry->next;
+        sig_LookupTable_freeSamples(allocator, entry);
+        allocator->impl->free(allocator, entry);
+        entry = next;
+    }
+
+    self->tables = NULL;
+    allocator->impl->free(allocator, self);
+}
+
 struct sig_DelayLine* sig_DelayLine_new(struct sig_Allocator* allocator,
     size_t maxDelayLength) {
     struct sig_DelayLine* self = sig_MALLOC(allocator, struct sig_DelayLine);
@@ -885,23 +1908,40 @@ struct sig_DelayLine* sig_DelayLine_newWithTransferredBuffer(
 }
 
 void sig_DelayLine_init(struct sig_DelayLine* self) {
+    // The buffer isn't zeroed here, since it may be very large.
+    // Samples that haven't been written yet are read as silence instead.
     self->writeIdx = 0;
-    sig_Buffer_fillWithSilence(self->buffer); // Zero the delay line.
+    self->numWritten = 0;
+    self->numQuietSamples = 0;
+}
+
+inline float sig_DelayLine_sampleAt(struct sig_DelayLine* self, size_t idx) {
+    // Writes proceed backwards from index 0, so until the
+    // delay line has been filled once, the unwritten samples
+    // are those in the range [1, writeIdx] (or all of them,
+    // if nothing has been written yet).
+    if (self->numWritten < self->buffer->length &&
+        (self->numWritten == 0 || (idx != 0 && idx <= self->writeIdx))) {
+        return 0.0f;
+    }
+
+    return FLOAT_ARRAY(self->buffer->samples)[idx];
 }
 
 inline float sig_DelayLine_readAt(struct sig_DelayLine* self, size_t readPos) {
     size_t idx = (self->writeIdx + readPos) % self->buffer->length;
-    return FLOAT_ARRAY(self->buffer->samples)[idx];
+    return sig_DelayLine_sampleAt(self, idx);
 }
 
 inline float sig_DelayLine_linearReadAt(struct sig_DelayLine* self,
     float readPos) {
     size_t maxDelayLength = self->buffer->length;
-    float* delayLineSamples = self->buffer->samples;
     int32_t integ = (int32_t) readPos;
     float frac = readPos - (float) integ;
-    float a = delayLineSamples[(self->writeIdx + integ) % maxDelayLength];
-    float b = delayLineSamples[(self->writeIdx + integ + 1) % maxDelayLength];
+    float a = sig_DelayLine_sampleAt(self,
+        (self->writeIdx + integ) % maxDelayLength);
+    float b = sig_DelayLine_sampleAt(self,
+        (self->writeIdx + integ + 1) % maxDelayLength);
 
     return a + (b - a) * frac;
 }
@@ -909,15 +1949,14 @@ inline float sig_DelayLine_linearReadAt(struct sig_DelayLine* self,
 inline float sig_DelayLine_cubicReadAt(struct sig_DelayLine* self,
     float readPos) {
     size_t maxDelayLength = self->buffer->length;
-    float* delayLineSamples = self->buffer->samples;
 
     int32_t integ = (int32_t) readPos;
     float frac = readPos - (float) integ;
     int32_t t = (int32_t) (self->writeIdx + integ + maxDelayLength);
-    float xm1 = delayLineSamples[(t - 1) % maxDelayLength];
-    float x0 = delayLineSamples[t % maxDelayLength];
-    float x1 = delayLineSamples[(t + 1) % maxDelayLength];
-    float x2 = delayLineSamples[(t + 2) % maxDelayLength];
+    float xm1 = sig_DelayLine_sampleAt(self, (t - 1) % maxDelayLength);
+    float x0 = sig_DelayLine_sampleAt(self, t % maxDelayLength);
+    float x1 = sig_DelayLine_sampleAt(self, (t + 1) % maxDelayLength);
+    float x2 = sig_DelayLine_sampleAt(self, (t + 2) % maxDelayLength);
     float c = (x1 - xm1) * 0.5f;
     float v = x0 - x1;
     float w = c + v;
@@ -930,12 +1969,13 @@ inline float sig_DelayLine_cubicReadAt(struct sig_DelayLine* self,
 inline float sig_DelayLine_allpassReadAt(struct sig_DelayLine* self,
     float readPos, float previousSample) {
     size_t maxDelayLength = self->buffer->length;
-    float* delayLineSamples = self->buffer->samples;
     int32_t integ = (int32_t) readPos;
     float frac = readPos - (float) integ;
     float invFrac = 1.0f - frac;
-    float a = delayLineSamples[(self->writeIdx + integ) % maxDelayLength];
-    float b = delayLineSamples[(self->writeIdx + integ + 1) % maxDelayLength];
+    float a = sig_DelayLine_sampleAt(self,
+        (self->writeIdx + integ) % maxDelayLength);
+    float b = sig_DelayLine_sampleAt(self,
+        (self->writeIdx + integ + 1) % maxDelayLength);
 
     return b + invFrac * a - invFrac * previousSample;
 }
@@ -1038,6 +2078,10 @@ inline void sig_DelayLine_write(struct sig_DelayLine* self, float sample) {
     size_t maxDelayLength = self->buffer->length;
     FLOAT_ARRAY(self->buffer->samples)[self->writeIdx] = sample;
     self->writeIdx = (self->writeIdx - 1 + maxDelayLength) % maxDelayLength;
+
+    if (self->numWritten < maxDelayLength) {
+        self->numWritten++;
+    }
 }
 
 inline float sig_DelayLine_calcFeedbackGain(float delayTime, float decayTime) {
@@ -1050,6 +2094,18 @@ inline float sig_DelayLine_calcFeedbackGain(float delayTime, float decayTime) {
     return expf(sig_LOG0_001 * delayTime / decayTime);
 }
 
+void sig_DelayLine_flushDenormals(struct sig_DelayLine* self,
+    float blockPeak, size_t blockSize, float maxReadPos) {
+    // Linear and cubic reads also touch the samples
+    // on either side of the read position.
+    size_t readDistance = (size_t) maxReadPos + 2;
+
+    if (sig_denormals_shouldFlushLine(&self->numQuietSamples, blockPeak,
+        blockSize, readDistance)) {
+        sig_fillWithSilence(self->buffer->samples, self->buffer->length);
+    }
+}
+
 inline float sig_DelayLine_feedback(float sample, float read, float g) {
     return sample + (g * read);
 }
@@ -1079,7 +2135,7 @@ inline float sig_DelayLine_cubicComb(struct sig_DelayLine* self, float sample,
 
 #define sig_DelayLine_allpass_IMPL(self, sample, readPos, g, readFn) \
     float read = readFn(self, readPos); \
-    float toWrite = sample + (g * read); \
+    float toWrite = sig_DelayLine_feedback(sample, read, g); \
     sig_DelayLine_write(self, toWrite); \
     return read - (g * toWrite) \
 
@@ -1106,6 +2162,401 @@ void sig_DelayLine_destroy(struct sig_Allocator* allocator,
     allocator->impl->free(allocator, self);
 }
 
+
+// The zeroth-order modified Bessel function of the first kind,
+// used to calculate Kaiser windows.
+static float sig_besselI0(float x) {
+    float sum = 1.0f;
+    float term = 1.0f;
+    float halfX = x * 0.5f;
+
+    for (int k = 1; k < 32; k++) {
+        float factor = halfX / (float) k;
+        term *= factor * factor;
+        sum += term;
+        if (term < sum * 1.0e-9f) {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+struct sig_filter_Halfband* sig_filter_Halfband_new(
+    struct sig_Allocator* allocator, size_t halfLength) {
+    struct sig_filter_Halfband* self = sig_MALLOC(allocator,
+        struct sig_filter_Halfband);
+    size_t numTaps = halfLength * 2;
+
+    self->halfLength = halfLength;
+    self->coefficients = sig_samples_new(allocator, numTaps);
+    self->history = sig_samples_new(allocator, numTaps * 2);
+    self->delayHistory = sig_samples_new(allocator, numTaps * 2);
+
+    // Calculate the non-zero, non-centre taps of a Kaiser-windowed
+    // sinc with a cutoff at a quarter of the (higher) sample rate.
+    // Tap j lies at an odd offset of 2j - (2 * halfLength - 1)
+    // from the centre of the full filter.
+    float beta = 7.857f; // ~80 dB stopband attenuation.
+    float halfWidth = (float) (numTaps - 1);
+    float windowNorm = 1.0f / sig_besselI0(beta);
+    float sum = 0.0f;
+    for (size_t j = 0; j < numTaps; j++) {
+        float offset = (float) (2 * j) - halfWidth;
+        float x = offset / halfWidth;
+        float window = sig_besselI0(beta * sqrtf(1.0f - x * x)) *
+            windowNorm;
+        float sinc = sinf(sig_PI * 0.5f * offset) / (sig_PI * offset);
+        FLOAT_ARRAY(self->coefficients)[j] = sinc * window;
+        sum += FLOAT_ARRAY(self->coefficients)[j];
+    }
+
+    // Normalize the taps so that the filter has unity gain at DC
+    // (the centre tap contributes the other half).
+    for (size_t j = 0; j < numTaps; j++) {
+        FLOAT_ARRAY(self->coefficients)[j] *= 0.5f / sum;
+    }
+
+    sig_filter_Halfband_init(self);
+
+    return self;
+}
+
+void sig_filter_Halfband_init(struct sig_filter_Halfband* self) {
+    size_t historyLength = self->halfLength * 4;
+    sig_fillWithSilence(self->history, historyLength);
+    sig_fillWithSilence(self->delayHistory, historyLength);
+    self->writeIdx = 0;
+}
+
+// Writes a sample to a double-buffered history,
+// whose most recent numTaps samples can then be read
+// contiguously, in reverse order, starting from the returned pointer.
+static inline float* sig_filter_Halfband_write(float_array_ptr history,
+    size_t writeIdx, size_t numTaps, float sample) {
+    float* samples = FLOAT_ARRAY(history);
+    samples[writeIdx] = sample;
+    samples[writeIdx + numTaps] = sample;
+
+    return samples + writeIdx;
+}
+
+static inline float sig_filter_Halfband_convolve(
+    struct sig_filter_Halfband* self, float* reversedHistory,
+    size_t numTaps) {
+    // The history is stored newest-last, so it is read backwards
+    // from the most recent sample.
+    float* coefficients = FLOAT_ARRAY(self->coefficients);
+    float sum = 0.0f;
+    for (size_t j = 0; j < numTaps; j++) {
+        sum += coefficients[j] * reversedHistory[numTaps - j];
+    }
+
+    return sum;
+}
+
+void sig_filter_Halfband_upsample(struct sig_filter_Halfband* self,
+    float_array_ptr input, float_array_ptr output, size_t inputLength) {
+    size_t numTaps = self->halfLength * 2;
+    size_t writeIdx = self->writeIdx;
+
+    for (size_t i = 0; i < inputLength; i++) {
+        float* history = sig_filter_Halfband_write(self->history,
+            writeIdx, numTaps, FLOAT_ARRAY(input)[i]);
+
+        // The even phase is the polyphase branch (doubled,
+        // to compensate for the zeros that are stuffed between samples),
+        // and the odd phase is the input delayed by halfLength - 1 samples.
+        FLOAT_ARRAY(output)[i * 2] = 2.0f *
+            sig_filter_Halfband_convolve(self, history, numTaps);
+        FLOAT_ARRAY(output)[i * 2 + 1] =
+            history[numTaps - self->halfLength + 1];
+
+        writeIdx = writeIdx + 1 >= numTaps ? 0 : writeIdx + 1;
+    }
+
+    self->writeIdx = writeIdx;
+}
+
+void sig_filter_Halfband_downsample(struct sig_filter_Halfband* self,
+    float_array_ptr input, float_array_ptr output, size_t outputLength) {
+    size_t numTaps = self->halfLength * 2;
+    size_t writeIdx = self->writeIdx;
+
+    for (size_t i = 0; i < outputLength; i++) {
+        float* history = sig_filter_Halfband_write(self->history,
+            writeIdx, numTaps, FLOAT_ARRAY(input)[i * 2]);
+        float* delayed = sig_filter_Halfband_write(self->delayHistory,
+            writeIdx, numTaps, FLOAT_ARRAY(input)[i * 2 + 1]);
+
+        // The even samples pass through the polyphase branch, while
+        // the odd samples are delayed by halfLength samples
+        // and scaled by the centre tap (0.5).
+        FLOAT_ARRAY(output)[i] =
+            sig_filter_Halfband_convolve(self, history, numTaps) +
+            0.5f * delayed[numTaps - self->halfLength];
+
+        writeIdx = writeIdx + 1 >= numTaps ? 0 : writeIdx + 1;
+    }
+
+    self->writeIdx = writeIdx;
+}
+
+size_t sig_filter_Halfband_latency(struct sig_filter_Halfband* self) {
+    return self->halfLength * 2 - 1;
+}
+
+void sig_filter_Halfband_destroy(struct sig_Allocator* allocator,
+    struct sig_filter_Halfband* self) {
+    allocator->impl->free(allocator, self->coefficients);
+    allocator->impl->free(allocator, self->history);
+    allocator->impl->free(allocator, self->delayHistory);
+    allocator->impl->free(allocator, self);
+}
+
+struct sig_FFT* sig_FFT_new(struct sig_Allocator* allocator, size_t length) {
+    if (length < sig_FFT_MIN_LENGTH || length > sig_FFT_MAX_LENGTH ||
+        (length & (length - 1)) != 0) {
+        return NULL;
+    }
+
+    struct sig_FFT* self = sig_MALLOC(allocator, struct sig_FFT);
+    size_t complexLength = length / 2;
+    size_t numBits = 0;
+    while (((size_t) 1 << numBits) < complexLength) {
+        numBits++;
+    }
+
+    self->length = length;
+
+    // Radix-4 butterflies need twiddles of up to 3/4 of a turn.
+    size_t numTwiddles = (complexLength * 3) / 4;
+    self->twiddles = sig_samples_new(allocator, numTwiddles * 2);
+    for (size_t i = 0; i < numTwiddles; i++) {
+        double angle = 2.0 * 3.14159265358979323846 * (double) i /
+            (double) complexLength;
+        FLOAT_ARRAY(self->twiddles)[i * 2] = (float) cos(angle);
+        FLOAT_ARRAY(self->twiddles)[i * 2 + 1] = (float) sin(angle);
+    }
+
+    size_t numRealTwiddles = complexLength / 2 + 1;
+    self->realTwiddles = sig_samples_new(allocator, numRealTwiddles * 2);
+    for (size_t i = 0; i < numRealTwiddles; i++) {
+        double angle = 2.0 * 3.14159265358979323846 * (double) i /
+            (double) length;
+        FLOAT_ARRAY(self->realTwiddles)[i * 2] = (float) cos(angle);
+        FLOAT_ARRAY(self->realTwiddles)[i * 2 + 1] = (float) sin(angle);
+    }
+
+    self->bitReversal = (uint16_t*) allocator->impl->malloc(allocator,
+        sizeof(uint16_t) * complexLength);
+    for (size_t i = 0; i < complexLength; i++) {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < numBits; bit++) {
+            reversed |= ((i >> bit) & 1) << (numBits - 1 - bit);
+        }
+        self->bitReversal[i] = (uint16_t) reversed;
+    }
+
+    return self;
+}
+
+// Computes an unscaled complex FFT of length / 2 interleaved values,
+// in place. The sign of the exponent is -1 for the forward transform
+// and 1 for the inverse transform.
+static void sig_FFT_transformComplex(struct sig_FFT* self, float* data,
+    float sign) {
+    size_t complexLength = self->length / 2;
+    float* twiddles = FLOAT_ARRAY(self->twiddles);
+
+    for (size_t i = 0; i < complexLength; i++) {
+        size_t j = self->bitReversal[i];
+        if (i < j) {
+            float re = data[i * 2];
+            float im = data[i * 2 + 1];
+            data[i * 2] = data[j * 2];
+            data[i * 2 + 1] = data[j * 2 + 1];
+            data[j * 2] = re;
+            data[j * 2 + 1] = im;
+        }
+    }
+
+    size_t subLength = 1;
+
+    // Lengths that aren't a power of four start with
+    // a single, twiddle-free radix-2 stage.
+    if ((complexLength & 0x55555555) == 0) {
+        for (size_t i = 0; i < complexLength * 2; i += 4) {
+            float re = data[i + 2];
+            float im = data[i + 3];
+            data[i + 2] = data[i] - re;
+            data[i + 3] = data[i + 1] - im;
+            data[i] += re;
+            data[i + 1] += im;
+        }
+        subLength = 2;
+    }
+
+    // Each radix-4 stage combines four bit-reversed sub-transforms,
+    // which are laid out in the order x[4n], x[4n+2], x[4n+1], x[4n+3].
+    while (subLength < complexLength) {
+        size_t stageLength = subLength * 4;
+        size_t stride = complexLength / stageLength;
+
+        for (size_t k = 0; k < subLength; k++) {
+            float w1r = twiddles[k * stride * 2];
+            float w1i = sign * twiddles[k * stride * 2 + 1];
+            float w2r = twiddles[k * stride * 4];
+            float w2i = sign * twiddles[k * stride * 4 + 1];
+            float w3r = twiddles[k * stride * 6];
+            float w3i = sign * twiddles[k * stride * 6 + 1];
+
+            for (size_t group = k; group < complexLength;
+                group += stageLength) {
+                float* p0 = data + group * 2;
+                float* p1 = p0 + subLength * 2;
+                float* p2 = p1 + subLength * 2;
+                float* p3 = p2 + subLength * 2;
+
+                float ar = p0[0];
+                float ai = p0[1];
+                float br = w2r * p1[0] - w2i * p1[1];
+                float bi = w2r * p1[1] + w2i * p1[0];
+                float cr = w1r * p2[0] - w1i * p2[1];
+                float ci = w1r * p2[1] + w1i * p2[0];
+                float dr = w3r * p3[0] - w3i * p3[1];
+                float di = w3r * p3[1] + w3i * p3[0];
+
+                float sumABr = ar + br;
+                float sumABi = ai + bi;
+                float diffABr = ar - br;
+                float diffABi = ai - bi;
+                float sumCDr = cr + dr;
+                float sumCDi = ci + di;
+
+                // Rotate c - d by a quarter turn in the
+                // direction of the transform.
+                float rotCDr = -sign * (ci - di);
+                float rotCDi = sign * (cr - dr);
+
+                p0[0] = sumABr + sumCDr;
+                p0[1] = sumABi + sumCDi;
+                p1[0] = diffABr + rotCDr;
+                p1[1] = diffABi + rotCDi;
+                p2[0] = sumABr - sumCDr;
+                p2[1] = sumABi - sumCDi;
+                p3[0] = diffABr - rotCDr;
+                p3[1] = diffABi - rotCDi;
+            }
+        }
+
+        subLength = stageLength;
+    }
+}
+
+void sig_FFT_forward(struct sig_FFT* self, float_array_ptr samples) {
+    float* data = FLOAT_ARRAY(samples);
+    float* twiddles = FLOAT_ARRAY(self->realTwiddles);
+    size_t halfLength = self->length / 2;
+
+    // Treat the even and odd samples as the real and imaginary parts
+    // of a half-length complex signal, and then separate
+    // the spectra of the two interleaved real signals.
+    sig_FFT_transformComplex(self, data, -1.0f);
+
+    float dcRe = data[0];
+    float dcIm = data[1];
+    data[0] = dcRe + dcIm;
+    data[1] = dcRe - dcIm;
+
+    for (size_t k = 1; k <= halfLength / 2; k++) {
+        size_t mirror = halfLength - k;
+        float ar = data[k * 2];
+        float ai = data[k * 2 + 1];
+        float br = data[mirror * 2];
+        float bi = data[mirror * 2 + 1];
+
+        float evenRe = 0.5f * (ar + br);
+        float evenIm = 0.5f * (ai - bi);
+        float oddRe = 0.5f * (ai + bi);
+        float oddIm = -0.5f * (ar - br);
+
+        float wr = twiddles[k * 2];
+        float wi = -twiddles[k * 2 + 1];
+        float rotRe = wr * oddRe - wi * oddIm;
+        float rotIm = wr * oddIm + wi * oddRe;
+
+        data[k * 2] = evenRe + rotRe;
+        data[k * 2 + 1] = evenIm + rotIm;
+        data[mirror * 2] = evenRe - rotRe;
+        data[mirror * 2 + 1] = rotIm - evenIm;
+    }
+}
+
+void sig_FFT_inverse(struct sig_FFT* self, float_array_ptr samples) {
+    float* data = FLOAT_ARRAY(samples);
+    float* twiddles = FLOAT_ARRAY(self->realTwiddles);
+    size_t halfLength = self->length / 2;
+
+    // Each pair of bins is scaled by 1 / length, which combines
+    // the halving of the even/odd spectra with the
+    // 1 / (length / 2) normalization of the complex inverse.
+    float scale = 1.0f / (float) self->length;
+
+    float dc = data[0];
+    float nyquist = data[1];
+    data[0] = (dc + nyquist) * scale;
+    data[1] = (dc - nyquist) * scale;
+
+    for (size_t k = 1; k <= halfLength / 2; k++) {
+        size_t mirror = halfLength - k;
+        float ar = data[k * 2];
+        float ai = data[k * 2 + 1];
+        float br = data[mirror * 2];
+        float bi = data[mirror * 2 + 1];
+
+        float evenRe = (ar + br) * scale;
+        float evenIm = (ai - bi) * scale;
+        float diffRe = (ar - br) * scale;
+        float diffIm = (ai + bi) * scale;
+
+        float wr = twiddles[k * 2];
+        float wi = twiddles[k * 2 + 1];
+        float oddRe = wr * diffRe - wi * diffIm;
+        float oddIm = wr * diffIm + wi * diffRe;
+
+        data[k * 2] = evenRe - oddIm;
+        data[k * 2 + 1] = evenIm + oddRe;
+        data[mirror * 2] = evenRe + oddIm;
+        data[mirror * 2 + 1] = oddRe - evenIm;
+    }
+
+    sig_FFT_transformComplex(self, data, 1.0f);
+}
+
+void sig_FFT_multiplyAccumulate(struct sig_FFT* self, float_array_ptr a,
+    float_array_ptr b, float_array_ptr accumulator) {
+    float* x = FLOAT_ARRAY(a);
+    float* y = FLOAT_ARRAY(b);
+    float* acc = FLOAT_ARRAY(accumulator);
+
+    // The DC and Nyquist bins are both real.
+    acc[0] += x[0] * y[0];
+    acc[1] += x[1] * y[1];
+
+    for (size_t i = 2; i < self->length; i += 2) {
+        acc[i] += x[i] * y[i] - x[i + 1] * y[i + 1];
+        acc[i + 1] += x[i] * y[i + 1] + x[i + 1] * y[i];
+    }
+}
+
+void sig_FFT_destroy(struct sig_Allocator* allocator, struct sig_FFT* self) {
+    allocator->impl->free(allocator, self->twiddles);
+    allocator->impl->free(allocator, self->realTwiddles);
+    allocator->impl->free(allocator, self->bitReversal);
+    allocator->impl->free(allocator, self);
+}
+
 inline float sig_linearXFade(float left, float right, float mix) {
     float clipped = sig_clamp(mix, -1.0f, 1.0f);
     // At -1.0f, left gain should be 1.0 and right gain should be 0.0;
@@ -1153,6 +2604,20 @@ void sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(
     sig_AudioBlock_destroy(allocator, outputs->main);
 }
 
+inline enum sig_dsp_InputChange sig_dsp_detectInputChange(
+    float_array_ptr input, size_t blockSize, float previousValue) {
+    float first = FLOAT_ARRAY(input)[0];
+
+    for (size_t i = 1; i < blockSize; i++) {
+        if (FLOAT_ARRAY(input)[i] != first) {
+            return sig_dsp_InputChange_MODULATED;
+        }
+    }
+
+    return first == previousValue ?
+        sig_dsp_InputChange_NONE : sig_dsp_InputChange_STEP;
+}
+
 
 inline void sig_dsp_evaluateSignals(struct sig_List* signalList) {
     for (size_t i = 0; i < signalList->length; i++) {
@@ -1175,6 +2640,7 @@ void sig_dsp_SignalListEvaluator_init(
     struct sig_dsp_SignalListEvaluator* self, struct sig_List* signalList) {
     self->evaluate = sig_dsp_SignalListEvaluator_evaluate;
     self->signalList = signalList;
+    self->flushDenormals = true;
 }
 
 void sig_dsp_SignalListEvaluator_evaluate(
@@ -1182,7 +2648,14 @@ void sig_dsp_SignalListEvaluator_evaluate(
     struct sig_dsp_SignalListEvaluator* self =
         (struct sig_dsp_SignalListEvaluator*) evaluator;
 
-    sig_dsp_evaluateSignals(self->signalList);
+    if (!self->flushDenormals) {
+        sig_dsp_evaluateSignals(self->signalList);
+        return;
+    }
+
+    uint32_t previousFPState = sig_denormals_enableFlushToZero();
+    sig_dsp_evaluateSignals(self->signalList);
+    sig_denormals_restore(previousFPState);
 }
 
 void sig_dsp_SignalListEvaluator_destroy(struct sig_Allocator* allocator,
@@ -1236,10 +2709,18 @@ void sig_dsp_Value_generate(void* signal) {
 struct sig_dsp_ConstantValue* sig_dsp_ConstantValue_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context,
     float value) {
+    return sig_dsp_ConstantValue_newMultichannel(allocator, context, 1,
+        value);
+}
+
+struct sig_dsp_ConstantValue* sig_dsp_ConstantValue_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels, float value) {
     struct sig_dsp_ConstantValue* self = sig_MALLOC(allocator,
         struct sig_dsp_ConstantValue);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+    self->numChannels = sig_clampNumChannels(numChannels);
+    self->outputs.main = sig_AudioBlock_newMultichannel(allocator,
+        context->audioSettings, self->numChannels);
     sig_dsp_ConstantValue_init(self, context, value);
 
     return self;
@@ -1248,8 +2729,8 @@ struct sig_dsp_ConstantValue* sig_dsp_ConstantValue_new(
 void sig_dsp_ConstantValue_init(struct sig_dsp_ConstantValue* self,
     struct sig_SignalContext* context, float value) {
     sig_dsp_Signal_init(self, context, *sig_dsp_Signal_noOp);
-    sig_fillWithValue(self->outputs.main, context->audioSettings->blockSize,
-        value);
+    sig_fillWithValue(self->outputs.main,
+        context->audioSettings->blockSize * self->numChannels, value);
 };
 
 void sig_dsp_ConstantValue_destroy(struct sig_Allocator* allocator,
@@ -1340,10 +2821,17 @@ void sig_dsp_Clamp_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_ScaleOffset* sig_dsp_ScaleOffset_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_ScaleOffset_newMultichannel(allocator, context, 1);
+}
+
+struct sig_dsp_ScaleOffset* sig_dsp_ScaleOffset_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
     struct sig_dsp_ScaleOffset* self = sig_MALLOC(allocator,
         struct sig_dsp_ScaleOffset);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+    self->numChannels = sig_clampNumChannels(numChannels);
+    self->outputs.main = sig_AudioBlock_newMultichannel(allocator,
+        context->audioSettings, self->numChannels);
     sig_dsp_ScaleOffset_init(self, context);
 
     return self;
@@ -1367,7 +2855,12 @@ void sig_dsp_ScaleOffset_generate(void* signal) {
 
     float scale = self->parameters.scale;
     float offset = self->parameters.offset;
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+
+    // Planar channels are contiguous, so all of them
+    // can be processed in a single pass.
+    size_t numSamples = self->signal.audioSettings->blockSize *
+        self->numChannels;
+    for (size_t i = 0; i < numSamples; i++) {
         float source = FLOAT_ARRAY(self->inputs.source)[i];
         FLOAT_ARRAY(self->outputs.main)[i] = source * scale + offset;
     }
@@ -1418,11 +2911,18 @@ void sig_dsp_Sine_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_BinaryOp* sig_dsp_BinaryOp_new(struct sig_Allocator* allocator,
     struct sig_SignalContext* context, sig_dsp_generateFn generate) {
+    return sig_dsp_BinaryOp_newMultichannel(allocator, context, 1, generate);
+}
+
+struct sig_dsp_BinaryOp* sig_dsp_BinaryOp_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels, sig_dsp_generateFn generate) {
     struct sig_dsp_BinaryOp* self = sig_MALLOC(allocator,
         struct sig_dsp_BinaryOp);
+    self->numChannels = sig_clampNumChannels(numChannels);
     sig_dsp_BinaryOp_init(self, context, generate);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+    self->outputs.main = sig_AudioBlock_newMultichannel(allocator,
+        context->audioSettings, self->numChannels);
 
     return self;
 }
@@ -1431,10 +2931,24 @@ void sig_dsp_BinaryOp_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context, sig_dsp_generateFn generate) {
     sig_dsp_Signal_init(self, context, generate);
 
+    self->numLeftChannels = 1;
+    self->numRightChannels = 1;
+
     sig_CONNECT_TO_SILENCE(self, left, context);
     sig_CONNECT_TO_SILENCE(self, right, context);
 }
 
+// Returns the samples of an input for the specified output channel.
+// Inputs with fewer channels than the output are repeated across it,
+// so a mono input is shared by every channel.
+static inline float* sig_dsp_BinaryOp_inputChannel(float_array_ptr input,
+    size_t numInputChannels, size_t channel, size_t blockSize) {
+    size_t inputChannel = numInputChannels > 1 ?
+        channel % numInputChannels : 0;
+
+    return FLOAT_ARRAY(input) + inputChannel * blockSize;
+}
+
 void sig_dsp_BinaryOp_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_BinaryOp* self) {
     sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
@@ -1447,6 +2961,13 @@ struct sig_dsp_BinaryOp* sig_dsp_Add_new(
     return sig_dsp_BinaryOp_new(allocator, context, *sig_dsp_Add_generate);
 }
 
+struct sig_dsp_BinaryOp* sig_dsp_Add_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
+    return sig_dsp_BinaryOp_newMultichannel(allocator, context, numChannels,
+        *sig_dsp_Add_generate);
+}
+
 void sig_dsp_Add_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context) {
     sig_dsp_BinaryOp_init(self, context, *sig_dsp_Add_generate);
@@ -1455,13 +2976,18 @@ void sig_dsp_Add_init(struct sig_dsp_BinaryOp* self,
 // TODO: Unit tests.
 void sig_dsp_Add_generate(void* signal) {
     struct sig_dsp_BinaryOp* self = (struct sig_dsp_BinaryOp*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float left = FLOAT_ARRAY(self->inputs.left)[i];
-        float right = FLOAT_ARRAY(self->inputs.right)[i];
-        float val = left + right;
+    for (size_t c = 0; c < self->numChannels; c++) {
+        float* left = sig_dsp_BinaryOp_inputChannel(self->inputs.left,
+            self->numLeftChannels, c, blockSize);
+        float* right = sig_dsp_BinaryOp_inputChannel(self->inputs.right,
+            self->numRightChannels, c, blockSize);
+        float* output = FLOAT_ARRAY(self->outputs.main) + c * blockSize;
 
-        FLOAT_ARRAY(self->outputs.main)[i] = val;
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = left[i] + right[i];
+        }
     }
 }
 
@@ -1477,6 +3003,13 @@ struct sig_dsp_BinaryOp* sig_dsp_Sub_new(
     return sig_dsp_BinaryOp_new(allocator, context, *sig_dsp_Sub_generate);
 }
 
+struct sig_dsp_BinaryOp* sig_dsp_Sub_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
+    return sig_dsp_BinaryOp_newMultichannel(allocator, context, numChannels,
+        *sig_dsp_Sub_generate);
+}
+
 void sig_dsp_Sub_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context) {
     sig_dsp_BinaryOp_init(self, context, *sig_dsp_Sub_generate);
@@ -1485,13 +3018,18 @@ void sig_dsp_Sub_init(struct sig_dsp_BinaryOp* self,
 // TODO: Unit tests.
 void sig_dsp_Sub_generate(void* signal) {
     struct sig_dsp_BinaryOp* self = (struct sig_dsp_BinaryOp*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float left = FLOAT_ARRAY(self->inputs.left)[i];
-        float right = FLOAT_ARRAY(self->inputs.right)[i];
-        float val = left - right;
+    for (size_t c = 0; c < self->numChannels; c++) {
+        float* left = sig_dsp_BinaryOp_inputChannel(self->inputs.left,
+            self->numLeftChannels, c, blockSize);
+        float* right = sig_dsp_BinaryOp_inputChannel(self->inputs.right,
+            self->numRightChannels, c, blockSize);
+        float* output = FLOAT_ARRAY(self->outputs.main) + c * blockSize;
 
-        FLOAT_ARRAY(self->outputs.main)[i] = val;
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = left[i] - right[i];
+        }
     }
 }
 
@@ -1507,6 +3045,13 @@ struct sig_dsp_BinaryOp* sig_dsp_Mul_new(struct sig_Allocator* allocator,
     return sig_dsp_BinaryOp_new(allocator, context, *sig_dsp_Mul_generate);
 }
 
+struct sig_dsp_BinaryOp* sig_dsp_Mul_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
+    return sig_dsp_BinaryOp_newMultichannel(allocator, context, numChannels,
+        *sig_dsp_Mul_generate);
+}
+
 void sig_dsp_Mul_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context) {
     sig_dsp_BinaryOp_init(self, context, *sig_dsp_Mul_generate);
@@ -1519,12 +3064,18 @@ void sig_dsp_Mul_destroy(struct sig_Allocator* allocator,
 
 void sig_dsp_Mul_generate(void* signal) {
     struct sig_dsp_BinaryOp* self = (struct sig_dsp_BinaryOp*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float left = FLOAT_ARRAY(self->inputs.left)[i];
-        float right = FLOAT_ARRAY(self->inputs.right)[i];
-        float val = left * right;
-        FLOAT_ARRAY(self->outputs.main)[i] = val;
+    for (size_t c = 0; c < self->numChannels; c++) {
+        float* left = sig_dsp_BinaryOp_inputChannel(self->inputs.left,
+            self->numLeftChannels, c, blockSize);
+        float* right = sig_dsp_BinaryOp_inputChannel(self->inputs.right,
+            self->numRightChannels, c, blockSize);
+        float* output = FLOAT_ARRAY(self->outputs.main) + c * blockSize;
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = left[i] * right[i];
+        }
     }
 }
 
@@ -1534,6 +3085,13 @@ struct sig_dsp_BinaryOp* sig_dsp_Div_new(
     return sig_dsp_BinaryOp_new(allocator, context, *sig_dsp_Div_generate);
 }
 
+struct sig_dsp_BinaryOp* sig_dsp_Div_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
+    return sig_dsp_BinaryOp_newMultichannel(allocator, context, numChannels,
+        *sig_dsp_Div_generate);
+}
+
 void sig_dsp_Div_init(struct sig_dsp_BinaryOp* self,
     struct sig_SignalContext* context) {
     sig_dsp_BinaryOp_init(self, context, *sig_dsp_Div_generate);
@@ -1541,12 +3099,18 @@ void sig_dsp_Div_init(struct sig_dsp_BinaryOp* self,
 
 void sig_dsp_Div_generate(void* signal) {
     struct sig_dsp_BinaryOp* self = (struct sig_dsp_BinaryOp*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float left = FLOAT_ARRAY(self->inputs.left)[i];
-        float right = FLOAT_ARRAY(self->inputs.right)[i];
-        float val = left / right;
-        FLOAT_ARRAY(self->outputs.main)[i] = val;
+    for (size_t c = 0; c < self->numChannels; c++) {
+        float* left = sig_dsp_BinaryOp_inputChannel(self->inputs.left,
+            self->numLeftChannels, c, blockSize);
+        float* right = sig_dsp_BinaryOp_inputChannel(self->inputs.right,
+            self->numRightChannels, c, blockSize);
+        float* output = FLOAT_ARRAY(self->outputs.main) + c * blockSize;
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = left[i] / right[i];
+        }
     }
 }
 
@@ -1660,6 +3224,83 @@ void sig_dsp_Accumulate_destroy(struct sig_Allocator* allocator,
 }
 
 
+struct sig_dsp_BlockToEvents* sig_dsp_BlockToEvents_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_BlockToEvents* self = sig_MALLOC(allocator,
+        struct sig_dsp_BlockToEvents);
+    sig_dsp_BlockToEvents_init(self, context);
+    self->outputs.main = sig_EventBlock_new(allocator,
+        context->audioSettings->blockSize);
+
+    return self;
+}
+
+void sig_dsp_BlockToEvents_init(struct sig_dsp_BlockToEvents* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_BlockToEvents_generate);
+
+    self->previousValue = 0.0f;
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+}
+
+void sig_dsp_BlockToEvents_generate(void* signal) {
+    struct sig_dsp_BlockToEvents* self =
+        (struct sig_dsp_BlockToEvents*) signal;
+
+    sig_EventBlock_readBlock(self->outputs.main, self->inputs.source,
+        self->signal.audioSettings->blockSize, &self->previousValue);
+}
+
+void sig_dsp_BlockToEvents_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BlockToEvents* self) {
+    sig_EventBlock_destroy(allocator, self->outputs.main);
+    sig_dsp_Signal_destroy(allocator, (void*) self);
+}
+
+
+struct sig_dsp_EventsToBlock* sig_dsp_EventsToBlock_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_EventsToBlock* self = sig_MALLOC(allocator,
+        struct sig_dsp_EventsToBlock);
+    sig_dsp_EventsToBlock_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_EventsToBlock_init(struct sig_dsp_EventsToBlock* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_EventsToBlock_generate);
+
+    self->currentValue = 0.0f;
+    self->inputs.source = NULL;
+}
+
+void sig_dsp_EventsToBlock_generate(void* signal) {
+    struct sig_dsp_EventsToBlock* self =
+        (struct sig_dsp_EventsToBlock*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+
+    if (self->inputs.source == NULL) {
+        sig_fillWithValue(self->outputs.main, blockSize,
+            self->currentValue);
+        return;
+    }
+
+    sig_EventBlock_writeBlock(self->inputs.source, self->outputs.main,
+        blockSize, &self->currentValue);
+}
+
+void sig_dsp_EventsToBlock_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_EventsToBlock* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, (void*) self);
+}
+
+
 struct sig_dsp_GatedTimer* sig_dsp_GatedTimer_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
     struct sig_dsp_GatedTimer* self = sig_MALLOC(allocator,
@@ -1677,51 +3318,108 @@ void sig_dsp_GatedTimer_init(struct sig_dsp_GatedTimer* self,
     self->timer = 0;
     self->hasFired = false;
     self->prevGate = 0.0f;
+    self->currentGate = 0.0f;
 
     sig_CONNECT_TO_SILENCE(self, gate, context);
     sig_CONNECT_TO_SILENCE(self, duration, context);
     sig_CONNECT_TO_SILENCE(self, loop, context);
+    self->inputs.gateEvents = NULL;
 }
 
-// TODO: Unit tests
-void sig_dsp_GatedTimer_generate(void* signal) {
-    struct sig_dsp_GatedTimer* self =
-        (struct sig_dsp_GatedTimer*) signal;
+static inline float sig_dsp_GatedTimer_tick(struct sig_dsp_GatedTimer* self,
+    float gate, size_t i) {
+    // TODO: MSVC compiler warning loss of precision.
+    unsigned long durationSamps = (unsigned long)
+        (FLOAT_ARRAY(self->inputs.duration)[i] *
+        self->signal.audioSettings->sampleRate);
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        // TODO: MSVC compiler warning loss of precision.
-        unsigned long durationSamps = (unsigned long)
-            (FLOAT_ARRAY(self->inputs.duration)[i] *
-            self->signal.audioSettings->sampleRate);
-        float gate = FLOAT_ARRAY(self->inputs.gate)[i];
+    if (gate > 0.0f) {
+        // Gate is open.
+        if (!self->hasFired ||
+            FLOAT_ARRAY(self->inputs.loop)[i] > 0.0f) {
+            self->timer++;
+        }
 
-        if (gate > 0.0f) {
-            // Gate is open.
-            if (!self->hasFired ||
-                FLOAT_ARRAY(self->inputs.loop)[i] > 0.0f) {
-                self->timer++;
-            }
+        if (self->timer >= durationSamps) {
+            // We reached the duration time.
+            // Reset the timer counter and note
+            // that we've already fired while
+            // this gate was open.
+            self->timer = 0;
+            self->hasFired = true;
+
+            return 1.0f;
+        }
+    } else if (gate <= 0.0f && self->prevGate > 0.0f) {
+        // Gate just closed. Reset all timer state.
+        self->timer = 0;
+        self->hasFired = false;
+    }
 
-            if (self->timer >= durationSamps) {
-                // We reached the duration time.
-                FLOAT_ARRAY(self->outputs.main)[i] = 1.0f;
+    self->prevGate = gate;
 
-                // Reset the timer counter and note
-                // that we've already fired while
-                // this gate was open.
-                self->timer = 0;
-                self->hasFired = true;
+    return 0.0f;
+}
 
-                continue;
-            }
-        } else if (gate <= 0.0f && self->prevGate > 0.0f) {
-            // Gate just closed. Reset all timer state.
-            self->timer = 0;
-            self->hasFired = false;
+// Renders the samples between two gate events,
+// during which the gate doesn't change.
+static inline void sig_dsp_GatedTimer_renderRun(
+    struct sig_dsp_GatedTimer* self, float gate,
+    size_t start, size_t end) {
+    size_t i = start;
+
+    // Once the gate has been closed for a sample,
+    // the timer is idle until it opens again.
+    for (; i < end && (gate > 0.0f || self->prevGate > 0.0f); i++) {
+        FLOAT_ARRAY(self->outputs.main)[i] =
+            sig_dsp_GatedTimer_tick(self, gate, i);
+    }
+
+    if (i < end) {
+        sig_fillWithSilence(FLOAT_ARRAY(self->outputs.main) + i, end - i);
+    }
+}
+
+static void sig_dsp_GatedTimer_generateFromEvents(
+    struct sig_dsp_GatedTimer* self) {
+    struct sig_EventBlock* events = self->inputs.gateEvents;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float gate = self->currentGate;
+    size_t start = 0;
+
+    for (size_t e = 0; e < events->length &&
+        events->events[e].offset < blockSize; e++) {
+        size_t offset = events->events[e].offset;
+        if (offset > start) {
+            sig_dsp_GatedTimer_renderRun(self, gate, start, offset);
         }
 
-        FLOAT_ARRAY(self->outputs.main)[i] = 0.0f;
-        self->prevGate = gate;
+        gate = events->events[e].value;
+        FLOAT_ARRAY(self->outputs.main)[offset] =
+            sig_dsp_GatedTimer_tick(self, gate, offset);
+        start = offset + 1;
+    }
+
+    if (start < blockSize) {
+        sig_dsp_GatedTimer_renderRun(self, gate, start, blockSize);
+    }
+
+    self->currentGate = gate;
+}
+
+// TODO: Unit tests
+void sig_dsp_GatedTimer_generate(void* signal) {
+    struct sig_dsp_GatedTimer* self =
+        (struct sig_dsp_GatedTimer*) signal;
+
+    if (self->inputs.gateEvents != NULL) {
+        sig_dsp_GatedTimer_generateFromEvents(self);
+        return;
+    }
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        FLOAT_ARRAY(self->outputs.main)[i] = sig_dsp_GatedTimer_tick(self,
+            FLOAT_ARRAY(self->inputs.gate)[i], i);
     }
 }
 
@@ -1757,57 +3455,112 @@ void sig_dsp_TimedTriggerCounter_init(
     sig_CONNECT_TO_SILENCE(self, source, context);
     sig_CONNECT_TO_SILENCE(self, duration, context);
     sig_CONNECT_TO_SILENCE(self, count, context);
+    self->inputs.sourceEvents = NULL;
 }
 
-void sig_dsp_TimedTriggerCounter_generate(void* signal) {
-    struct sig_dsp_TimedTriggerCounter* self =
-        (struct sig_dsp_TimedTriggerCounter*) signal;
+static inline float sig_dsp_TimedTriggerCounter_tick(
+    struct sig_dsp_TimedTriggerCounter* self, float source, size_t i) {
+    float outputSample = 0.0f;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float source = FLOAT_ARRAY(self->inputs.source)[i];
-        float outputSample = 0.0f;
-
-        if (source > 0.0f && self->previousSource == 0.0f) {
-            // Received the rising edge of a trigger.
-            if (!self->isTimerActive) {
-                // It's the first trigger,
-                // so start the timer.
-                self->isTimerActive = true;
-            }
+    if (source > 0.0f && self->previousSource == 0.0f) {
+        // Received the rising edge of a trigger.
+        if (!self->isTimerActive) {
+            // It's the first trigger,
+            // so start the timer.
+            self->isTimerActive = true;
+        }
+    }
+
+    if (self->isTimerActive) {
+        // The timer is running.
+        if (source <= 0.0f && self->previousSource > 0.0f) {
+            // Received the falling edge of a trigger,
+            // so count it.
+            self->numTriggers++;
         }
 
-        if (self->isTimerActive) {
-            // The timer is running.
-            if (source <= 0.0f && self->previousSource > 0.0f) {
-                // Received the falling edge of a trigger,
-                // so count it.
-                self->numTriggers++;
+        self->timer++;
+
+        // Truncate the duration to the nearest sample.
+        long durSamps = (long) (FLOAT_ARRAY(
+            self->inputs.duration)[i] *
+            self->signal.audioSettings->sampleRate);
+
+        if (self->timer >= durSamps) {
+            // Time's up.
+            // Fire a trigger if we've the right number of
+            // incoming triggers, otherwise just reset.
+            if (self->numTriggers ==
+                (int) FLOAT_ARRAY(self->inputs.count)[i]) {
+                outputSample = 1.0f;
             }
 
-            self->timer++;
+            self->isTimerActive = false;
+            self->numTriggers = 0;
+            self->timer = 0;
+        }
+    }
 
-            // Truncate the duration to the nearest sample.
-            long durSamps = (long) (FLOAT_ARRAY(
-                self->inputs.duration)[i] *
-                self->signal.audioSettings->sampleRate);
+    self->previousSource = source;
 
-            if (self->timer >= durSamps) {
-                // Time's up.
-                // Fire a trigger if we've the right number of
-                // incoming triggers, otherwise just reset.
-                if (self->numTriggers ==
-                    (int) FLOAT_ARRAY(self->inputs.count)[i]) {
-                    outputSample = 1.0f;
-                }
+    return outputSample;
+}
 
-                self->isTimerActive = false;
-                self->numTriggers = 0;
-                self->timer = 0;
-            }
+// Renders the samples between two trigger events.
+// The source doesn't change between events, so there are
+// no edges to count; only a running timer needs to tick.
+static inline void sig_dsp_TimedTriggerCounter_renderRun(
+    struct sig_dsp_TimedTriggerCounter* self, size_t start, size_t end) {
+    size_t i = start;
+
+    for (; i < end && self->isTimerActive; i++) {
+        FLOAT_ARRAY(self->outputs.main)[i] =
+            sig_dsp_TimedTriggerCounter_tick(self,
+                self->previousSource, i);
+    }
+
+    if (i < end) {
+        sig_fillWithSilence(FLOAT_ARRAY(self->outputs.main) + i, end - i);
+    }
+}
+
+static void sig_dsp_TimedTriggerCounter_generateFromEvents(
+    struct sig_dsp_TimedTriggerCounter* self) {
+    struct sig_EventBlock* events = self->inputs.sourceEvents;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t start = 0;
+
+    for (size_t e = 0; e < events->length &&
+        events->events[e].offset < blockSize; e++) {
+        size_t offset = events->events[e].offset;
+        if (offset > start) {
+            sig_dsp_TimedTriggerCounter_renderRun(self, start, offset);
         }
 
-        self->previousSource = source;
-        FLOAT_ARRAY(self->outputs.main)[i] = outputSample;
+        FLOAT_ARRAY(self->outputs.main)[offset] =
+            sig_dsp_TimedTriggerCounter_tick(self,
+                events->events[e].value, offset);
+        start = offset + 1;
+    }
+
+    if (start < blockSize) {
+        sig_dsp_TimedTriggerCounter_renderRun(self, start, blockSize);
+    }
+}
+
+void sig_dsp_TimedTriggerCounter_generate(void* signal) {
+    struct sig_dsp_TimedTriggerCounter* self =
+        (struct sig_dsp_TimedTriggerCounter*) signal;
+
+    if (self->inputs.sourceEvents != NULL) {
+        sig_dsp_TimedTriggerCounter_generateFromEvents(self);
+        return;
+    }
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        FLOAT_ARRAY(self->outputs.main)[i] =
+            sig_dsp_TimedTriggerCounter_tick(self,
+                FLOAT_ARRAY(self->inputs.source)[i], i);
     }
 }
 
@@ -1840,6 +3593,34 @@ void sig_dsp_ToggleGate_init(struct sig_dsp_ToggleGate* self,
     self->prevTrig = 0.0f;
 
     sig_CONNECT_TO_SILENCE(self, trigger, context);
+    self->inputs.triggerEvents = NULL;
+}
+
+static void sig_dsp_ToggleGate_generateFromEvents(
+    struct sig_dsp_ToggleGate* self) {
+    struct sig_EventBlock* events = self->inputs.triggerEvents;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t start = 0;
+
+    for (size_t e = 0; e < events->length &&
+        events->events[e].offset < blockSize; e++) {
+        size_t offset = events->events[e].offset;
+        float trigger = events->events[e].value;
+
+        sig_fillWithValue(FLOAT_ARRAY(self->outputs.main) + start,
+            offset - start, (float) self->isGateOpen);
+
+        if (trigger > 0.0f && self->prevTrig <= 0.0f) {
+            // Received a trigger, toggle the gate.
+            self->isGateOpen = !self->isGateOpen;
+        }
+
+        self->prevTrig = trigger;
+        start = offset;
+    }
+
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.main) + start,
+        blockSize - start, (float) self->isGateOpen);
 }
 
 // TODO: Unit tests
@@ -1847,6 +3628,11 @@ void sig_dsp_ToggleGate_generate(void* signal) {
     struct sig_dsp_ToggleGate* self =
         (struct sig_dsp_ToggleGate*) signal;
 
+    if (self->inputs.triggerEvents != NULL) {
+        sig_dsp_ToggleGate_generateFromEvents(self);
+        return;
+    }
+
     for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
         float trigger = FLOAT_ARRAY(self->inputs.trigger)[i];
         if (trigger > 0.0f && self->prevTrig <= 0.0f) {
@@ -2009,34 +3795,247 @@ void sig_dsp_FastLFSineOscillator_destroy(struct sig_Allocator* allocator,
 }
 
 
-void sig_dsp_LFTriangle_init(struct sig_dsp_Oscillator* self,
-    struct sig_SignalContext* context) {
-    sig_dsp_Oscillator_init(self, context, *sig_dsp_LFTriangle_generate);
-};
+struct sig_dsp_SineBank* sig_dsp_SineBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numPartials) {
+    struct sig_dsp_SineBank* self = sig_MALLOC(allocator,
+        struct sig_dsp_SineBank);
+
+    if (numPartials < 1) {
+        numPartials = 1;
+    } else if (numPartials > sig_dsp_SineBank_MAX_PARTIALS) {
+        numPartials = sig_dsp_SineBank_MAX_PARTIALS;
+    }
 
-struct sig_dsp_Oscillator* sig_dsp_LFTriangle_new(
-    struct sig_Allocator* allocator,
+    self->numPartials = numPartials;
+    self->paddedNumPartials = ((numPartials + sig_dsp_SineBank_LANES - 1) /
+        sig_dsp_SineBank_LANES) * sig_dsp_SineBank_LANES;
+
+    self->ratios = sig_samples_new(allocator, numPartials);
+    self->amplitudes = sig_samples_new(allocator, numPartials);
+    self->phases = sig_samples_new(allocator, numPartials);
+    for (size_t k = 0; k < numPartials; k++) {
+        FLOAT_ARRAY(self->ratios)[k] = (float) (k + 1);
+        FLOAT_ARRAY(self->amplitudes)[k] = k == 0 ? 1.0f : 0.0f;
+        FLOAT_ARRAY(self->phases)[k] = 0.0f;
+    }
+
+    size_t padded = self->paddedNumPartials;
+    self->increments = sig_samples_new(allocator, padded);
+    self->cosIncrements = sig_samples_new(allocator, padded);
+    self->sinIncrements = sig_samples_new(allocator, padded);
+    self->cosZ = sig_samples_new(allocator, padded);
+    self->sinZ = sig_samples_new(allocator, padded);
+    self->currentAmplitudes = sig_samples_new(allocator, padded);
+    self->amplitudeSteps = sig_samples_new(allocator, padded);
+    self->mix = sig_samples_new(allocator,
+        context->audioSettings->blockSize * sig_dsp_SineBank_LANES);
+
+    sig_dsp_SineBank_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_SineBank_init(struct sig_dsp_SineBank* self,
     struct sig_SignalContext* context) {
-    return sig_dsp_Oscillator_new(allocator, context,
-        *sig_dsp_LFTriangle_generate);
+    sig_dsp_Signal_init(self, context, *sig_dsp_SineBank_generate);
+
+    sig_CONNECT_TO_SILENCE(self, freq, context);
+    sig_CONNECT_TO_UNITY(self, mul, context);
+    sig_CONNECT_TO_SILENCE(self, add, context);
+
+    // Padding partials never sound, and are left
+    // as stationary phasors.
+    for (size_t k = 0; k < self->paddedNumPartials; k++) {
+        FLOAT_ARRAY(self->increments)[k] = 0.0f;
+        FLOAT_ARRAY(self->cosIncrements)[k] = 1.0f;
+        FLOAT_ARRAY(self->sinIncrements)[k] = 0.0f;
+        FLOAT_ARRAY(self->cosZ)[k] = 1.0f;
+        FLOAT_ARRAY(self->sinZ)[k] = 0.0f;
+        FLOAT_ARRAY(self->currentAmplitudes)[k] = 0.0f;
+        FLOAT_ARRAY(self->amplitudeSteps)[k] = 0.0f;
+    }
+
+    sig_dsp_SineBank_resetPhases(self);
 }
 
-void sig_dsp_LFTriangle_generate(void* signal) {
-    struct sig_dsp_Oscillator* self = (struct sig_dsp_Oscillator*) signal;
+void sig_dsp_SineBank_resetPhases(struct sig_dsp_SineBank* self) {
+    for (size_t k = 0; k < self->numPartials; k++) {
+        float angle = FLOAT_ARRAY(self->phases)[k] * sig_TWOPI;
+        FLOAT_ARRAY(self->cosZ)[k] = cosf(angle);
+        FLOAT_ARRAY(self->sinZ)[k] = sinf(angle);
+    }
+}
+
+static inline float sig_dsp_SineBank_targetAmplitude(
+    struct sig_dsp_SineBank* self, size_t k, float increment) {
+    // Partials at or above the Nyquist frequency are culled.
+    return fabsf(increment) < 0.5f ? FLOAT_ARRAY(self->amplitudes)[k] : 0.0f;
+}
+
+void sig_dsp_SineBank_generate(void* signal) {
+    struct sig_dsp_SineBank* self = (struct sig_dsp_SineBank*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
     float sampleRate = self->signal.audioSettings->sampleRate;
-    float* frequency = FLOAT_ARRAY(self->inputs.freq);
-    float* phaseOffset = FLOAT_ARRAY(self->inputs.phaseOffset);
+    float freq = FLOAT_ARRAY(self->inputs.freq)[0];
     float* mul = FLOAT_ARRAY(self->inputs.mul);
     float* add = FLOAT_ARRAY(self->inputs.add);
-    float* mainOutput = FLOAT_ARRAY(self->outputs.main);
-    float* eocOutput = FLOAT_ARRAY(self->outputs.eoc);
+    float* output = FLOAT_ARRAY(self->outputs.main);
+    float* ratios = FLOAT_ARRAY(self->ratios);
+    float* increments = FLOAT_ARRAY(self->increments);
+    float* cosIncrements = FLOAT_ARRAY(self->cosIncrements);
+    float* sinIncrements = FLOAT_ARRAY(self->sinIncrements);
+    float* cosZ = FLOAT_ARRAY(self->cosZ);
+    float* sinZ = FLOAT_ARRAY(self->sinZ);
+    float* currentAmplitudes = FLOAT_ARRAY(self->currentAmplitudes);
+    float* amplitudeSteps = FLOAT_ARRAY(self->amplitudeSteps);
+    float* mix = FLOAT_ARRAY(self->mix);
+    float blockScale = 1.0f / (float) blockSize;
+    size_t numActive = 0;
+
+    // Update each partial's rotation and amplitude ramp,
+    // and find the highest partial that needs to be rendered.
+    for (size_t k = 0; k < self->numPartials; k++) {
+        float increment = freq * ratios[k] / sampleRate;
+        float target = sig_dsp_SineBank_targetAmplitude(self, k,
+            increment);
+
+        // A culled partial keeps its previous rotation
+        // while it fades out.
+        if (target != 0.0f && increment != increments[k]) {
+            float angle = increment * sig_TWOPI;
+            increments[k] = increment;
+            cosIncrements[k] = cosf(angle);
+            sinIncrements[k] = sinf(angle);
+        }
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float modulatedPhase = self->state.phaseAccumulator +
-            phaseOffset[i];
-        float eoc = sig_osc_Oscillator_eoc(modulatedPhase);
-        modulatedPhase = sig_osc_Oscillator_wrapPhase(modulatedPhase) *
-            sig_TWOPI;
+        amplitudeSteps[k] = (target - currentAmplitudes[k]) * blockScale;
+
+        if (target != 0.0f || currentAmplitudes[k] != 0.0f) {
+            numActive = k + 1;
+        }
+    }
+
+    numActive = ((numActive + sig_dsp_SineBank_LANES - 1) /
+        sig_dsp_SineBank_LANES) * sig_dsp_SineBank_LANES;
+
+    for (size_t i = 0; i < blockSize * sig_dsp_SineBank_LANES; i++) {
+        mix[i] = 0.0f;
+    }
+
+    // Each group of partials is rendered for the whole block
+    // while its state is held in registers.
+    for (size_t k = 0; k < numActive; k += sig_dsp_SineBank_LANES) {
+        float c[sig_dsp_SineBank_LANES];
+        float s[sig_dsp_SineBank_LANES];
+        float cosInc[sig_dsp_SineBank_LANES];
+        float sinInc[sig_dsp_SineBank_LANES];
+        float amp[sig_dsp_SineBank_LANES];
+        float ampStep[sig_dsp_SineBank_LANES];
+
+        for (size_t l = 0; l < sig_dsp_SineBank_LANES; l++) {
+            c[l] = cosZ[k + l];
+            s[l] = sinZ[k + l];
+            cosInc[l] = cosIncrements[k + l];
+            sinInc[l] = sinIncrements[k + l];
+            amp[l] = currentAmplitudes[k + l];
+            ampStep[l] = amplitudeSteps[k + l];
+        }
+
+        for (size_t i = 0; i < blockSize; i++) {
+            float* lanes = mix + i * sig_dsp_SineBank_LANES;
+            for (size_t l = 0; l < sig_dsp_SineBank_LANES; l++) {
+                float nextC = c[l] * cosInc[l] - s[l] * sinInc[l];
+                lanes[l] += amp[l] * s[l];
+                amp[l] += ampStep[l];
+                s[l] = c[l] * sinInc[l] + s[l] * cosInc[l];
+                c[l] = nextC;
+            }
+        }
+
+        for (size_t l = 0; l < sig_dsp_SineBank_LANES; l++) {
+            cosZ[k + l] = c[l];
+            sinZ[k + l] = s[l];
+        }
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float* lanes = mix + i * sig_dsp_SineBank_LANES;
+        float sample = 0.0f;
+        for (size_t l = 0; l < sig_dsp_SineBank_LANES; l++) {
+            sample += lanes[l];
+        }
+
+        output[i] = sample * mul[i] + add[i];
+    }
+
+    // Renormalize each phasor to counteract the gradual growth or
+    // decay of its magnitude due to rounding error, and snap the
+    // amplitudes to their targets.
+    for (size_t k = 0; k < numActive; k++) {
+        float c = cosZ[k];
+        float s = sinZ[k];
+        float gain = 1.5f - 0.5f * (c * c + s * s);
+        cosZ[k] = c * gain;
+        sinZ[k] = s * gain;
+    }
+
+    for (size_t k = 0; k < self->numPartials; k++) {
+        float increment = freq * ratios[k] / sampleRate;
+        currentAmplitudes[k] = sig_dsp_SineBank_targetAmplitude(self, k,
+            increment);
+    }
+}
+
+void sig_dsp_SineBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_SineBank* self) {
+    allocator->impl->free(allocator, self->ratios);
+    allocator->impl->free(allocator, self->amplitudes);
+    allocator->impl->free(allocator, self->phases);
+    allocator->impl->free(allocator, self->increments);
+    allocator->impl->free(allocator, self->cosIncrements);
+    allocator->impl->free(allocator, self->sinIncrements);
+    allocator->impl->free(allocator, self->cosZ);
+    allocator->impl->free(allocator, self->sinZ);
+    allocator->impl->free(allocator, self->currentAmplitudes);
+    allocator->impl->free(allocator, self->amplitudeSteps);
+    allocator->impl->free(allocator, self->mix);
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, (void*) self);
+}
+
+
+void sig_dsp_LFTriangle_init(struct sig_dsp_Oscillator* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Oscillator_init(self, context, *sig_dsp_LFTriangle_generate);
+};
+
+struct sig_dsp_Oscillator* sig_dsp_LFTriangle_new(
+    struct sig_Allocator* allocator,
+    struct sig_SignalContext* context) {
+    return sig_dsp_Oscillator_new(allocator, context,
+        *sig_dsp_LFTriangle_generate);
+}
+
+void sig_dsp_LFTriangle_generate(void* signal) {
+    struct sig_dsp_Oscillator* self = (struct sig_dsp_Oscillator*) signal;
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    float* frequency = FLOAT_ARRAY(self->inputs.freq);
+    float* phaseOffset = FLOAT_ARRAY(self->inputs.phaseOffset);
+    float* mul = FLOAT_ARRAY(self->inputs.mul);
+    float* add = FLOAT_ARRAY(self->inputs.add);
+    float* mainOutput = FLOAT_ARRAY(self->outputs.main);
+    float* eocOutput = FLOAT_ARRAY(self->outputs.eoc);
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        float modulatedPhase = self->state.phaseAccumulator +
+            phaseOffset[i];
+        float eoc = sig_osc_Oscillator_eoc(modulatedPhase);
+        modulatedPhase = sig_osc_Oscillator_wrapPhase(modulatedPhase) *
+            sig_TWOPI;
 
         float sample = -1.0f + (2.0f * (modulatedPhase * sig_RECIP_TWOPI));
         sample = 2.0f * (fabsf(sample) - 0.5f); // Rectify and scale/offset
@@ -2055,6 +4054,279 @@ void sig_dsp_LFTriangle_destroy(struct sig_Allocator* allocator,
 }
 
 
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPOscillator_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    sig_dsp_generateFn generate) {
+    struct sig_dsp_BLEPOscillator* self = sig_MALLOC(allocator,
+        struct sig_dsp_BLEPOscillator);
+    self->phases = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    self->syncPhases = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    sig_dsp_BLEPOscillator_init(self, context, generate);
+    sig_dsp_Oscillator_Outputs_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_BLEPOscillator_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context, sig_dsp_generateFn generate) {
+    sig_dsp_Signal_init(self, context, generate);
+
+    sig_CONNECT_TO_SILENCE(self, freq, context);
+    sig_CONNECT_TO_SILENCE(self, phaseOffset, context);
+    sig_CONNECT_TO_UNITY(self, mul, context);
+    sig_CONNECT_TO_SILENCE(self, add, context);
+    sig_CONNECT_TO_SILENCE(self, pwm, context);
+    sig_CONNECT_TO_SILENCE(self, sync, context);
+
+    sig_osc_Oscillator_init(&self->state);
+    self->previousSync = 0.0f;
+}
+
+// Accumulates the phase for each sample in the block,
+// resetting it whenever a sync trigger is received.
+static inline void sig_dsp_BLEPOscillator_accumulatePhases(
+    struct sig_dsp_BLEPOscillator* self) {
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    float* frequency = FLOAT_ARRAY(self->inputs.freq);
+    float* phaseOffset = FLOAT_ARRAY(self->inputs.phaseOffset);
+    float* sync = FLOAT_ARRAY(self->inputs.sync);
+    float* eocOutput = FLOAT_ARRAY(self->outputs.eoc);
+    float* phases = FLOAT_ARRAY(self->phases);
+    float* syncPhases = FLOAT_ARRAY(self->syncPhases);
+    float previousSync = self->previousSync;
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        float syncPhase = -1.0f;
+        if (sync[i] > 0.0f && previousSync <= 0.0f) {
+            syncPhase = sig_osc_Oscillator_wrapPhase(
+                self->state.phaseAccumulator + phaseOffset[i]);
+            self->state.phaseAccumulator = 0.0f;
+        }
+        previousSync = sync[i];
+
+        float modulatedPhase = self->state.phaseAccumulator +
+            phaseOffset[i];
+        eocOutput[i] = sig_osc_Oscillator_eoc(modulatedPhase);
+        phases[i] = sig_osc_Oscillator_wrapPhase(modulatedPhase);
+        syncPhases[i] = syncPhase;
+
+        sig_osc_Oscillator_accumulatePhase(&self->state.phaseAccumulator,
+            frequency[i], sampleRate);
+    }
+
+    self->previousSync = previousSync;
+}
+
+static inline void sig_dsp_BLEPOscillator_scale(
+    struct sig_dsp_BLEPOscillator* self) {
+    float* mul = FLOAT_ARRAY(self->inputs.mul);
+    float* add = FLOAT_ARRAY(self->inputs.add);
+    float* mainOutput = FLOAT_ARRAY(self->outputs.main);
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        mainOutput[i] = mainOutput[i] * mul[i] + add[i];
+    }
+}
+
+void sig_dsp_BLEPOscillator_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self) {
+    sig_AudioBlock_destroy(allocator, self->phases);
+    sig_AudioBlock_destroy(allocator, self->syncPhases);
+    sig_dsp_Oscillator_Outputs_destroyAudioBlocks(allocator, &self->outputs);
+    sig_dsp_Signal_destroy(allocator, (void*) self);
+}
+
+
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPSaw_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_BLEPOscillator_new(allocator, context,
+        *sig_dsp_BLEPSaw_generate);
+}
+
+void sig_dsp_BLEPSaw_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_BLEPOscillator_init(self, context, *sig_dsp_BLEPSaw_generate);
+}
+
+void sig_dsp_BLEPSaw_generate(void* signal) {
+    struct sig_dsp_BLEPOscillator* self =
+        (struct sig_dsp_BLEPOscillator*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float recipSampleRate = 1.0f / self->signal.audioSettings->sampleRate;
+    float* frequency = FLOAT_ARRAY(self->inputs.freq);
+    float* phases = FLOAT_ARRAY(self->phases);
+    float* syncPhases = FLOAT_ARRAY(self->syncPhases);
+    float* mainOutput = FLOAT_ARRAY(self->outputs.main);
+
+    sig_dsp_BLEPOscillator_accumulatePhases(self);
+
+    for (size_t i = 0; i < blockSize; i++) {
+        mainOutput[i] = 2.0f * phases[i] - 1.0f;
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float phase = phases[i];
+        float dt = fabsf(frequency[i]) * recipSampleRate;
+
+        if (syncPhases[i] >= 0.0f) {
+            // The jump caused by the reset lies at the start
+            // of this sample, so it is corrected by
+            // half of its height.
+            float jump = mainOutput[i] - (2.0f * syncPhases[i] - 1.0f);
+            mainOutput[i] -= 0.5f * jump;
+        } else if (phase < dt || phase > 1.0f - dt) {
+            // The saw falls by 2.0 at the end of each cycle.
+            mainOutput[i] -= 2.0f * sig_osc_polyBLEP(phase, dt);
+        }
+    }
+
+    sig_dsp_BLEPOscillator_scale(self);
+}
+
+void sig_dsp_BLEPSaw_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self) {
+    sig_dsp_BLEPOscillator_destroy(allocator, self);
+}
+
+
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPSquare_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_BLEPOscillator_new(allocator, context,
+        *sig_dsp_BLEPSquare_generate);
+}
+
+void sig_dsp_BLEPSquare_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_BLEPOscillator_init(self, context, *sig_dsp_BLEPSquare_generate);
+}
+
+static inline float sig_dsp_BLEPSquare_pulseWidth(float pwm) {
+    return 0.5f + 0.5f * sig_clamp(pwm, -0.98f, 0.98f);
+}
+
+void sig_dsp_BLEPSquare_generate(void* signal) {
+    struct sig_dsp_BLEPOscillator* self =
+        (struct sig_dsp_BLEPOscillator*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float recipSampleRate = 1.0f / self->signal.audioSettings->sampleRate;
+    float* frequency = FLOAT_ARRAY(self->inputs.freq);
+    float* pwm = FLOAT_ARRAY(self->inputs.pwm);
+    float* phases = FLOAT_ARRAY(self->phases);
+    float* syncPhases = FLOAT_ARRAY(self->syncPhases);
+    float* mainOutput = FLOAT_ARRAY(self->outputs.main);
+
+    sig_dsp_BLEPOscillator_accumulatePhases(self);
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float width = sig_dsp_BLEPSquare_pulseWidth(pwm[i]);
+        mainOutput[i] = phases[i] < width ? 1.0f : -1.0f;
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float phase = phases[i];
+        float dt = fabsf(frequency[i]) * recipSampleRate;
+        float width = sig_dsp_BLEPSquare_pulseWidth(pwm[i]);
+        float fallPhase = phase - width;
+        fallPhase = fallPhase < 0.0f ? fallPhase + 1.0f : fallPhase;
+
+        if (syncPhases[i] >= 0.0f) {
+            float previous = syncPhases[i] < width ? 1.0f : -1.0f;
+            mainOutput[i] -= 0.5f * (mainOutput[i] - previous);
+            continue;
+        }
+
+        // The pulse rises by 2.0 at the start of each cycle,
+        // and falls by 2.0 at the end of its width.
+        if (phase < dt || phase > 1.0f - dt) {
+            mainOutput[i] += 2.0f * sig_osc_polyBLEP(phase, dt);
+        }
+
+        if (fallPhase < dt || fallPhase > 1.0f - dt) {
+            mainOutput[i] -= 2.0f * sig_osc_polyBLEP(fallPhase, dt);
+        }
+    }
+
+    sig_dsp_BLEPOscillator_scale(self);
+}
+
+void sig_dsp_BLEPSquare_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self) {
+    sig_dsp_BLEPOscillator_destroy(allocator, self);
+}
+
+
+struct sig_dsp_BLEPOscillator* sig_dsp_BLEPTriangle_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_BLEPOscillator_new(allocator, context,
+        *sig_dsp_BLEPTriangle_generate);
+}
+
+void sig_dsp_BLEPTriangle_init(struct sig_dsp_BLEPOscillator* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_BLEPOscillator_init(self, context,
+        *sig_dsp_BLEPTriangle_generate);
+}
+
+static inline float sig_dsp_BLEPTriangle_naive(float phase) {
+    return 2.0f * fabsf(2.0f * phase - 1.0f) - 1.0f;
+}
+
+void sig_dsp_BLEPTriangle_generate(void* signal) {
+    struct sig_dsp_BLEPOscillator* self =
+        (struct sig_dsp_BLEPOscillator*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float recipSampleRate = 1.0f / self->signal.audioSettings->sampleRate;
+    float* frequency = FLOAT_ARRAY(self->inputs.freq);
+    float* phases = FLOAT_ARRAY(self->phases);
+    float* syncPhases = FLOAT_ARRAY(self->syncPhases);
+    float* mainOutput = FLOAT_ARRAY(self->outputs.main);
+
+    sig_dsp_BLEPOscillator_accumulatePhases(self);
+
+    for (size_t i = 0; i < blockSize; i++) {
+        mainOutput[i] = sig_dsp_BLEPTriangle_naive(phases[i]);
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float phase = phases[i];
+        float dt = fabsf(frequency[i]) * recipSampleRate;
+
+        // The triangle falls at 4.0 per cycle during its first half,
+        // and rises at 4.0 per cycle during its second half.
+        float slopeChange = 8.0f * dt;
+
+        if (syncPhases[i] >= 0.0f) {
+            float syncPhase = syncPhases[i];
+            float jump = mainOutput[i] - sig_dsp_BLEPTriangle_naive(syncPhase);
+            float slope = phase < 0.5f ? -4.0f * dt : 4.0f * dt;
+            float previousSlope = syncPhase < 0.5f ? -4.0f * dt : 4.0f * dt;
+            mainOutput[i] += -0.5f * jump +
+                (slope - previousSlope) * (1.0f / 6.0f);
+            continue;
+        }
+
+        if (phase < dt || phase > 1.0f - dt) {
+            mainOutput[i] -= slopeChange * sig_osc_polyBLAMP(phase, dt);
+        }
+
+        float midPhase = phase < 0.5f ? phase + 0.5f : phase - 0.5f;
+        if (midPhase < dt || midPhase > 1.0f - dt) {
+            mainOutput[i] += slopeChange * sig_osc_polyBLAMP(midPhase, dt);
+        }
+    }
+
+    sig_dsp_BLEPOscillator_scale(self);
+}
+
+void sig_dsp_BLEPTriangle_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BLEPOscillator* self) {
+    sig_dsp_BLEPOscillator_destroy(allocator, self);
+}
+
+
 void sig_dsp_WavetableOscillator_init(struct sig_dsp_WavetableOscillator* self,
     struct sig_SignalContext* context) {
     sig_dsp_Signal_init(self, context, *sig_dsp_WavetableOscillator_generate);
@@ -2138,7 +4410,11 @@ struct sig_dsp_WavetableBankOscillator* sig_dsp_WavetableBankOscillator_new(
 inline void sig_dsp_WavetableBankOscillator_generate(void* signal) {
     struct sig_dsp_WavetableBankOscillator* self =
         (struct sig_dsp_WavetableBankOscillator*) signal;
-    self->state.wavetables = self->wavetables;
+    if (self->state.wavetables != self->wavetables) {
+        // The new bank may have different mipmap levels.
+        self->state.wavetables = self->wavetables;
+        self->state.previousPhaseIncrement = NAN;
+    }
     float sampleRate = self->signal.audioSettings->sampleRate;
     float* frequency = FLOAT_ARRAY(self->inputs.freq);
     float* phaseOffset = FLOAT_ARRAY(self->inputs.phaseOffset);
@@ -2206,7 +4482,7 @@ void sig_dsp_Smooth_generate(void* signal) {
                 FLOAT_ARRAY(self->inputs.source)[i], previousSample, a1);
     }
 
-    self->previousSample = previousSample;
+    self->previousSample = sig_denormals_flush(previousSample);
 }
 
 void sig_dsp_Smooth_destroy(struct sig_Allocator* allocator,
@@ -2256,6 +4532,11 @@ void sig_dsp_DCBlock_generate(void* signal) {
 
         FLOAT_ARRAY(self->outputs.main)[i] = outputSample;
     }
+
+    self->state.previousInput = sig_denormals_flush(
+        self->state.previousInput);
+    self->state.previousOutput = sig_denormals_flush(
+        self->state.previousOutput);
 }
 
 void sig_dsp_DCBlock_destroy(struct sig_Allocator* allocator,
@@ -2275,7 +4556,10 @@ void sig_dsp_OnePole_init(struct sig_dsp_OnePole* self,
     self->b0 = 1.0f;
     self->previousFrequency = 0.0f;
     self->previousMode = sig_dsp_OnePole_Mode_NOT_SPECIFIED;
-    self->previousSample = 0.0f;
+
+    for (size_t c = 0; c < sig_MAX_CHANNELS; c++) {
+        self->previousSamples[c] = 0.0f;
+    }
 
     sig_CONNECT_TO_SILENCE(self, source, context);
     sig_CONNECT_TO_SILENCE(self, frequency, context);
@@ -2283,11 +4567,18 @@ void sig_dsp_OnePole_init(struct sig_dsp_OnePole* self,
 
 struct sig_dsp_OnePole* sig_dsp_OnePole_new(struct sig_Allocator* allocator,
     struct sig_SignalContext* context) {
+    return sig_dsp_OnePole_newMultichannel(allocator, context, 1);
+}
+
+struct sig_dsp_OnePole* sig_dsp_OnePole_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
     struct sig_dsp_OnePole* self = sig_MALLOC(allocator,
         struct sig_dsp_OnePole);
+    self->numChannels = sig_clampNumChannels(numChannels);
     sig_dsp_OnePole_init(self, context);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+    self->outputs.main = sig_AudioBlock_newMultichannel(allocator,
+        context->audioSettings, self->numChannels);
 
     return self;
 }
@@ -2311,22 +4602,51 @@ inline void sig_dsp_OnePole_recalculateCoefficients(
 
 void sig_dsp_OnePole_generate(void* signal) {
     struct sig_dsp_OnePole* self = (struct sig_dsp_OnePole*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float_array_ptr frequency = self->inputs.frequency;
+    enum sig_dsp_InputChange change = sig_dsp_detectInputChange(frequency,
+        blockSize, self->previousFrequency);
+
+    if (change == sig_dsp_InputChange_STEP ||
+        self->previousMode != self->parameters.mode) {
+        sig_dsp_OnePole_recalculateCoefficients(self,
+            FLOAT_ARRAY(frequency)[0]);
+    }
 
-    float previousSample = self->previousSample;
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float frequency = FLOAT_ARRAY(self->inputs.frequency)[i];
-        if (self->previousFrequency != frequency ||
-            self->previousMode != self->parameters.mode) {
-            sig_dsp_OnePole_recalculateCoefficients(self, frequency);
-        }
+    float b0 = self->b0;
+    float a1 = self->a1;
+    float b0Increment = 0.0f;
+    float a1Increment = 0.0f;
+
+    if (change == sig_dsp_InputChange_MODULATED) {
+        // Interpolate from the current coefficients to those
+        // for the frequency at the end of the block.
+        sig_dsp_OnePole_recalculateCoefficients(self,
+            FLOAT_ARRAY(frequency)[blockSize - 1]);
+        b0Increment = (self->b0 - b0) / (float) blockSize;
+        a1Increment = (self->a1 - a1) / (float) blockSize;
+    }
 
-        float sample = sig_filter_onepole(FLOAT_ARRAY(self->inputs.source)[i],
-            previousSample, self->b0, self->a1);
-        FLOAT_ARRAY(self->outputs.main)[i] = sample;
-        previousSample = sample;
+    // Each channel is filtered in turn, with the same coefficients.
+    for (size_t c = 0; c < self->numChannels; c++) {
+        float* source = FLOAT_ARRAY(self->inputs.source) + c * blockSize;
+        float* output = FLOAT_ARRAY(self->outputs.main) + c * blockSize;
+        float channelB0 = b0;
+        float channelA1 = a1;
+        float previousSample = self->previousSamples[c];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            channelB0 += b0Increment;
+            channelA1 += a1Increment;
+
+            float sample = sig_filter_onepole(source[i], previousSample,
+                channelB0, channelA1);
+            output[i] = sample;
+            previousSample = sample;
+        }
 
+        self->previousSamples[c] = sig_denormals_flush(previousSample);
     }
-    self->previousSample = previousSample;
 }
 
 void sig_dsp_OnePole_destroy(struct sig_Allocator* allocator,
@@ -2428,7 +4748,10 @@ void sig_dsp_Dust_init(struct sig_dsp_Dust* self,
     self->parameters = parameters;
     self->sampleDuration = 1.0 / context->audioSettings->sampleRate;
     self->previousDensity = 0.0;
-    self->threshold = 0.0;
+    self->logNoImpulseProbability = 0.0f;
+    self->samplesUntilImpulse = sig_dsp_Dust_NEVER;
+    sig_Random_init(&self->random,
+        sig_Random_nextUInt32(&context->random));
 
     sig_CONNECT_TO_SILENCE(self, density, context);
 }
@@ -2444,26 +4767,73 @@ struct sig_dsp_Dust* sig_dsp_Dust_new(struct sig_Allocator* allocator,
     return self;
 }
 
+// Draws the number of silent samples that precede the next impulse.
+// Since each sample contains an impulse with a probability of
+// density * sampleDuration, the interval is geometrically distributed;
+// it is sampled by inverting the distribution's CDF.
+static inline size_t sig_dsp_Dust_nextInterval(struct sig_dsp_Dust* self) {
+    if (self->previousDensity <= 0.0f) {
+        return sig_dsp_Dust_NEVER;
+    }
+
+    if (self->logNoImpulseProbability >= 0.0f) {
+        // The density is so low that an impulse is practically impossible.
+        return sig_dsp_Dust_NEVER;
+    }
+
+    // 1 - U lies within (0, 1], which avoids taking the log of zero.
+    float interval = logf(1.0f - sig_Random_nextf(&self->random)) /
+        self->logNoImpulseProbability;
+
+    return interval >= (float) (sig_dsp_Dust_NEVER - 1) ?
+        sig_dsp_Dust_NEVER - 1 : (size_t) interval;
+}
+
 void sig_dsp_Dust_generate(void* signal) {
     struct sig_dsp_Dust* self = (struct sig_dsp_Dust*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float_array_ptr density = self->inputs.density;
 
     float scaleDiv = self->parameters.bipolar > 0.0f ? 2.0f : 1.0f;
     float scaleSub = self->parameters.bipolar > 0.0f ? 1.0f : 0.0f;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float density = FLOAT_ARRAY(self->inputs.density)[i];
+    sig_fillWithSilence(self->outputs.main, blockSize);
+
+    size_t i = 0;
+    while (i < blockSize) {
+        float currentDensity = FLOAT_ARRAY(density)[i];
+
+        if (currentDensity != self->previousDensity) {
+            // The time until the next impulse is memoryless,
+            // so it can be redrawn whenever the density changes.
+            float probability = currentDensity * self->sampleDuration;
+            self->previousDensity = currentDensity;
+            self->logNoImpulseProbability = probability >= 1.0f ?
+                -INFINITY : log1pf(-probability);
+            self->samplesUntilImpulse = sig_dsp_Dust_nextInterval(self);
+        }
+
+        // Find the run of samples that share the same density.
+        size_t runEnd = i + 1;
+        while (runEnd < blockSize &&
+            FLOAT_ARRAY(density)[runEnd] == currentDensity) {
+            runEnd++;
+        }
+
+        // Write each impulse that is scheduled within the run.
+        while (self->samplesUntilImpulse < runEnd - i) {
+            i += self->samplesUntilImpulse;
+            FLOAT_ARRAY(self->outputs.main)[i] =
+                sig_Random_nextf(&self->random) * scaleDiv - scaleSub;
+            i++;
+            self->samplesUntilImpulse = sig_dsp_Dust_nextInterval(self);
+        }
 
-        if (density != self->previousDensity) {
-            self->previousDensity = density;
-            self->threshold = density * self->sampleDuration;
-            self->scale = self->threshold > 0.0f ?
-                scaleDiv / self->threshold : 0.0f;
+        if (self->samplesUntilImpulse != sig_dsp_Dust_NEVER) {
+            self->samplesUntilImpulse -= runEnd - i;
         }
 
-        float rand = sig_randf();
-        float val = rand < self->threshold ?
-            rand * self->scale - scaleSub : 0.0f;
-        FLOAT_ARRAY(self->outputs.main)[i] = val;
+        i = runEnd;
     }
 }
 
@@ -2475,87 +4845,271 @@ void sig_dsp_Dust_destroy(struct sig_Allocator* allocator,
 }
 
 
-void sig_dsp_TimedGate_init(struct sig_dsp_TimedGate* self,
+void sig_dsp_WhiteNoise_init(struct sig_dsp_WhiteNoise* self,
     struct sig_SignalContext* context) {
-    sig_dsp_Signal_init(self, context, *sig_dsp_TimedGate_generate);
-
-    struct sig_dsp_TimedGate_Parameters parameters = {
-        .resetOnTrigger = 0.0,
-        .bipolar = 0.0
-    };
-
-    self->parameters = parameters;
-    self->previousTrigger = 0.0f;
-    self->previousDuration = 0.0f;
-    self->gateValue = 0.0f;
-    self->durationSamps = 0;
-    self->samplesRemaining = 0;
-
-    sig_CONNECT_TO_SILENCE(self, trigger, context);
-    sig_CONNECT_TO_SILENCE(self, duration, context);
+    sig_dsp_Signal_init(self, context, *sig_dsp_WhiteNoise_generate);
+    sig_Random_init(&self->random,
+        sig_Random_nextUInt32(&context->random));
 }
 
-struct sig_dsp_TimedGate* sig_dsp_TimedGate_new(
+struct sig_dsp_WhiteNoise* sig_dsp_WhiteNoise_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
-    struct sig_dsp_TimedGate* self = sig_MALLOC(allocator,
-        struct sig_dsp_TimedGate);
-    sig_dsp_TimedGate_init(self, context);
+    struct sig_dsp_WhiteNoise* self = sig_MALLOC(allocator,
+        struct sig_dsp_WhiteNoise);
+    sig_dsp_WhiteNoise_init(self, context);
     sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
         context->audioSettings, &self->outputs);
 
     return self;
 }
 
-static inline void sig_dsp_TimedGate_outputHigh(struct sig_dsp_TimedGate* self,
-    size_t index) {
-    FLOAT_ARRAY(self->outputs.main)[index] = self->gateValue;
-    self->samplesRemaining--;
-}
+void sig_dsp_WhiteNoise_generate(void* signal) {
+    struct sig_dsp_WhiteNoise* self = (struct sig_dsp_WhiteNoise*) signal;
 
-static inline void sig_dsp_TimedGate_outputLow(struct sig_dsp_TimedGate* self,
-    size_t index) {
-    FLOAT_ARRAY(self->outputs.main)[index] = 0.0f;
+    sig_Random_fillBipolar(&self->random, self->outputs.main,
+        self->signal.audioSettings->blockSize);
 }
 
-void sig_dsp_TimedGate_generate(void* signal) {
-    struct sig_dsp_TimedGate* self = (struct sig_dsp_TimedGate*)
-        signal;
+void sig_dsp_WhiteNoise_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_WhiteNoise* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float currentTrigger = FLOAT_ARRAY(self->inputs.trigger)[i];
-        float duration = FLOAT_ARRAY(self->inputs.duration)[i];
 
-        if ((currentTrigger > 0.0f && self->previousTrigger <= 0.0f) ||
-            (self->parameters.bipolar > 0.0 && currentTrigger < 0.0f && self->previousTrigger >= 0.0f)) {
-            // A new trigger was received.
-            self->gateValue = currentTrigger;
+void sig_dsp_PinkNoise_init(struct sig_dsp_PinkNoise* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_PinkNoise_generate);
+    sig_Random_init(&self->random,
+        sig_Random_nextUInt32(&context->random));
 
-            if (duration != self->previousDuration) {
-                // The duration input has changed.
-                self->durationSamps = lroundf(duration *
-                    self->signal.audioSettings->sampleRate);
-                self->previousDuration = duration;
-            }
+    for (size_t i = 0; i < sig_dsp_PinkNoise_NUM_POLES; i++) {
+        self->poles[i] = 0.0f;
+    }
+}
 
-            if (self->parameters.resetOnTrigger > 0.0f &&
-                self->samplesRemaining > 0) {
-                // Gate is open and needs to be reset.
-                // Close the gate for one sample,
-                // and don't count down the duration
-                // until next time.
-                sig_dsp_TimedGate_outputLow(self, i);
-                self->samplesRemaining = self->durationSamps;
-            } else {
-                self->samplesRemaining = self->durationSamps;
-                sig_dsp_TimedGate_outputHigh(self, i);
-            }
-        } else if (self->samplesRemaining > 0) {
-            sig_dsp_TimedGate_outputHigh(self, i);
-        } else {
+struct sig_dsp_PinkNoise* sig_dsp_PinkNoise_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_PinkNoise* self = sig_MALLOC(allocator,
+        struct sig_dsp_PinkNoise);
+    sig_dsp_PinkNoise_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_PinkNoise_generate(void* signal) {
+    struct sig_dsp_PinkNoise* self = (struct sig_dsp_PinkNoise*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float* b = self->poles;
+
+    // The block is first filled with white noise,
+    // which is then filtered in place.
+    sig_Random_fillBipolar(&self->random, self->outputs.main, blockSize);
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float white = FLOAT_ARRAY(self->outputs.main)[i];
+
+        b[0] = 0.99886f * b[0] + white * 0.0555179f;
+        b[1] = 0.99332f * b[1] + white * 0.0750759f;
+        b[2] = 0.96900f * b[2] + white * 0.1538520f;
+        b[3] = 0.86650f * b[3] + white * 0.3104856f;
+        b[4] = 0.55000f * b[4] + white * 0.5329522f;
+        b[5] = -0.7616f * b[5] - white * 0.0168980f;
+        float pink = b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] +
+            white * 0.5362f;
+        b[6] = white * 0.115926f;
+
+        // Scale the output so that it roughly fits within -1..1.
+        FLOAT_ARRAY(self->outputs.main)[i] = pink * 0.11f;
+    }
+}
+
+void sig_dsp_PinkNoise_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_PinkNoise* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+void sig_dsp_BrownNoise_init(struct sig_dsp_BrownNoise* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_BrownNoise_generate);
+    sig_Random_init(&self->random,
+        sig_Random_nextUInt32(&context->random));
+    self->previousSample = 0.0f;
+}
+
+struct sig_dsp_BrownNoise* sig_dsp_BrownNoise_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_BrownNoise* self = sig_MALLOC(allocator,
+        struct sig_dsp_BrownNoise);
+    sig_dsp_BrownNoise_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_BrownNoise_generate(void* signal) {
+    struct sig_dsp_BrownNoise* self = (struct sig_dsp_BrownNoise*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float previousSample = self->previousSample;
+
+    sig_Random_fillBipolar(&self->random, self->outputs.main, blockSize);
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float white = FLOAT_ARRAY(self->outputs.main)[i];
+        previousSample = (previousSample + 0.02f * white) / 1.02f;
+
+        // Scale the output so that it roughly fits within -1..1.
+        FLOAT_ARRAY(self->outputs.main)[i] = previousSample * 3.5f;
+    }
+
+    self->previousSample = previousSample;
+}
+
+void sig_dsp_BrownNoise_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_BrownNoise* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+void sig_dsp_TimedGate_init(struct sig_dsp_TimedGate* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_TimedGate_generate);
+
+    struct sig_dsp_TimedGate_Parameters parameters = {
+        .resetOnTrigger = 0.0,
+        .bipolar = 0.0
+    };
+
+    self->parameters = parameters;
+    self->previousTrigger = 0.0f;
+    self->previousDuration = 0.0f;
+    self->gateValue = 0.0f;
+    self->durationSamps = 0;
+    self->samplesRemaining = 0;
+
+    sig_CONNECT_TO_SILENCE(self, trigger, context);
+    sig_CONNECT_TO_SILENCE(self, duration, context);
+    self->inputs.triggerEvents = NULL;
+}
+
+struct sig_dsp_TimedGate* sig_dsp_TimedGate_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_TimedGate* self = sig_MALLOC(allocator,
+        struct sig_dsp_TimedGate);
+    sig_dsp_TimedGate_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+static inline void sig_dsp_TimedGate_outputHigh(struct sig_dsp_TimedGate* self,
+    size_t index) {
+    FLOAT_ARRAY(self->outputs.main)[index] = self->gateValue;
+    self->samplesRemaining--;
+}
+
+static inline void sig_dsp_TimedGate_outputLow(struct sig_dsp_TimedGate* self,
+    size_t index) {
+    FLOAT_ARRAY(self->outputs.main)[index] = 0.0f;
+}
+
+static inline void sig_dsp_TimedGate_tick(struct sig_dsp_TimedGate* self,
+    float currentTrigger, size_t i) {
+    if ((currentTrigger > 0.0f && self->previousTrigger <= 0.0f) ||
+        (self->parameters.bipolar > 0.0 && currentTrigger < 0.0f && self->previousTrigger >= 0.0f)) {
+        // A new trigger was received.
+        float duration = FLOAT_ARRAY(self->inputs.duration)[i];
+        self->gateValue = currentTrigger;
+
+        if (duration != self->previousDuration) {
+            // The duration input has changed.
+            self->durationSamps = lroundf(duration *
+                self->signal.audioSettings->sampleRate);
+            self->previousDuration = duration;
+        }
+
+        if (self->parameters.resetOnTrigger > 0.0f &&
+            self->samplesRemaining > 0) {
+            // Gate is open and needs to be reset.
+            // Close the gate for one sample,
+            // and don't count down the duration
+            // until next time.
             sig_dsp_TimedGate_outputLow(self, i);
+            self->samplesRemaining = self->durationSamps;
+        } else {
+            self->samplesRemaining = self->durationSamps;
+            sig_dsp_TimedGate_outputHigh(self, i);
+        }
+    } else if (self->samplesRemaining > 0) {
+        sig_dsp_TimedGate_outputHigh(self, i);
+    } else {
+        sig_dsp_TimedGate_outputLow(self, i);
+    }
+
+    self->previousTrigger = currentTrigger;
+}
+
+// Renders the samples between two trigger events,
+// during which the gate can only count down.
+static inline void sig_dsp_TimedGate_renderRun(
+    struct sig_dsp_TimedGate* self, size_t start, size_t end) {
+    size_t numHigh = 0;
+    if (self->samplesRemaining > 0) {
+        numHigh = (size_t) self->samplesRemaining < end - start ?
+            (size_t) self->samplesRemaining : end - start;
+    }
+
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.main) + start, numHigh,
+        self->gateValue);
+    sig_fillWithSilence(FLOAT_ARRAY(self->outputs.main) + start + numHigh,
+        end - start - numHigh);
+    self->samplesRemaining -= (long) numHigh;
+}
+
+static void sig_dsp_TimedGate_generateFromEvents(
+    struct sig_dsp_TimedGate* self) {
+    struct sig_EventBlock* events = self->inputs.triggerEvents;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t start = 0;
+
+    for (size_t e = 0; e < events->length &&
+        events->events[e].offset < blockSize; e++) {
+        size_t offset = events->events[e].offset;
+        if (offset > start) {
+            sig_dsp_TimedGate_renderRun(self, start, offset);
         }
 
-        self->previousTrigger = currentTrigger;
+        sig_dsp_TimedGate_tick(self, events->events[e].value, offset);
+        start = offset + 1;
+    }
+
+    if (start < blockSize) {
+        sig_dsp_TimedGate_renderRun(self, start, blockSize);
+    }
+}
+
+void sig_dsp_TimedGate_generate(void* signal) {
+    struct sig_dsp_TimedGate* self = (struct sig_dsp_TimedGate*)
+        signal;
+
+    if (self->inputs.triggerEvents != NULL) {
+        sig_dsp_TimedGate_generateFromEvents(self);
+        return;
+    }
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        sig_dsp_TimedGate_tick(self, FLOAT_ARRAY(self->inputs.trigger)[i],
+            i);
     }
 }
 
@@ -2622,7 +5176,8 @@ void sig_dsp_DustGate_destroy(struct sig_Allocator* allocator,
     sig_dsp_TimedGate_destroy(allocator, self->gate);
 
     sig_dsp_Mul_destroy(allocator, self->densityDurationMultiplier);
-    sig_AudioBlock_destroy(allocator, self->reciprocalDensity->inputs.left);
+    // reciprocalDensity's left input is the context's unity signal,
+    // so it isn't ours to free.
     sig_dsp_Div_destroy(allocator, self->reciprocalDensity);
 
     sig_dsp_Dust_destroy(allocator, self->dust);
@@ -2650,9 +5205,12 @@ void sig_dsp_ClockSource_init(
     self->samplesSinceLastTap = 0;
     self->isLatching = false;
     self->latchedTapSamplesRemaining = 0;
+    self->currentPulseValue = 0.0f;
 
     sig_CONNECT_TO_SILENCE(self, pulse, context);
     sig_CONNECT_TO_SILENCE(self, tap, context);
+    self->inputs.pulseEvents = NULL;
+    self->inputs.tapEvents = NULL;
 }
 
 struct sig_dsp_ClockSource* sig_dsp_ClockSource_new(
@@ -2718,45 +5276,126 @@ static inline void handleTap(struct sig_dsp_ClockSource* self) {
     self->samplesSinceLastTap = 0;
 }
 
-void sig_dsp_ClockSource_generate(void* signal) {
-    struct sig_dsp_ClockSource* self = (struct sig_dsp_ClockSource*) signal;
-    float_array_ptr pulse = self->inputs.pulse;
-    float_array_ptr tap = self->inputs.tap;
+static inline float sig_dsp_ClockSource_tick(
+    struct sig_dsp_ClockSource* self, float pulseValue, float tapValue) {
     float threshold = self->parameters.threshold;
+    float sample = 0.0f;
+
+    if (pulseValue >= threshold) {
+        self->isLatching = false;
+        self->tapCount = 0;
+        sample = 1.0f;
+    } else if (pulseValue < threshold) {
+        if (self->tapCount > 0) {
+            self->samplesSinceLastTap++;
+        }
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float pulseValue = FLOAT_ARRAY(pulse)[i];
-        float tapValue = FLOAT_ARRAY(tap)[i];
+        if (tapValue >= threshold && self->previousTapValue < threshold) {
+            handleTap(self);
+        }
 
-        float sample = 0.0f;
-        if (pulseValue >= threshold) {
-            self->isLatching = false;
-            self->tapCount = 0;
-            sample = 1.0f;
-        } else if (pulseValue < threshold) {
-            if (self->tapCount > 0) {
-                self->samplesSinceLastTap++;
+        if (self->isLatching) {
+            if (self->latchedTapSamplesRemaining <= self->numHighSamples) {
+                sample = 1.0f;
             }
 
-            if (tapValue >= threshold && self->previousTapValue < threshold) {
-                handleTap(self);
+            self->latchedTapSamplesRemaining--;
+            if (self->latchedTapSamplesRemaining <= 0) {
+                self->latchedTapSamplesRemaining =
+                    self->tempoDurationSamples;
             }
+        }
+    }
 
-            if (self->isLatching) {
-                if (self->latchedTapSamplesRemaining <= self->numHighSamples) {
-                    sample = 1.0f;
-                }
+    self->previousTapValue = tapValue;
 
-                self->latchedTapSamplesRemaining--;
-                if (self->latchedTapSamplesRemaining <= 0) {
-                    self->latchedTapSamplesRemaining =
-                        self->tempoDurationSamples;
-                }
-            }
+    return sample;
+}
+
+// Renders the samples between two events, during which
+// neither the pulse nor the tap input changes.
+static inline void sig_dsp_ClockSource_renderRun(
+    struct sig_dsp_ClockSource* self, size_t start, size_t end) {
+    float_array_ptr output = FLOAT_ARRAY(self->outputs.main) + start;
+    size_t numSamples = end - start;
+
+    if (self->currentPulseValue >= self->parameters.threshold) {
+        self->isLatching = false;
+        self->tapCount = 0;
+        sig_fillWithValue(output, numSamples, 1.0f);
+    } else if (self->isLatching) {
+        // A tapped tempo has to be counted out sample by sample.
+        for (size_t i = 0; i < numSamples; i++) {
+            FLOAT_ARRAY(output)[i] = sig_dsp_ClockSource_tick(self,
+                self->currentPulseValue, self->previousTapValue);
+        }
+    } else {
+        if (self->tapCount > 0) {
+            self->samplesSinceLastTap += (uint32_t) numSamples;
         }
 
-        FLOAT_ARRAY(self->outputs.main)[i] = sample;
-        self->previousTapValue = tapValue;
+        sig_fillWithSilence(output, numSamples);
+    }
+}
+
+static void sig_dsp_ClockSource_generateFromEvents(
+    struct sig_dsp_ClockSource* self) {
+    struct sig_EventBlock* pulses = self->inputs.pulseEvents;
+    struct sig_EventBlock* taps = self->inputs.tapEvents;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t p = 0;
+    size_t t = 0;
+    size_t start = 0;
+
+    while (start < blockSize) {
+        size_t pulseOffset = p < pulses->length ?
+            pulses->events[p].offset : blockSize;
+        size_t tapOffset = t < taps->length ?
+            taps->events[t].offset : blockSize;
+        size_t offset = pulseOffset < tapOffset ? pulseOffset : tapOffset;
+        if (offset >= blockSize) {
+            break;
+        }
+
+        if (offset > start) {
+            sig_dsp_ClockSource_renderRun(self, start, offset);
+        }
+
+        // Apply every event that occurs at this sample
+        // before ticking it.
+        float tapValue = self->previousTapValue;
+        while (p < pulses->length && pulses->events[p].offset == offset) {
+            self->currentPulseValue = pulses->events[p].value;
+            p++;
+        }
+        while (t < taps->length && taps->events[t].offset == offset) {
+            tapValue = taps->events[t].value;
+            t++;
+        }
+
+        FLOAT_ARRAY(self->outputs.main)[offset] = sig_dsp_ClockSource_tick(
+            self, self->currentPulseValue, tapValue);
+        start = offset + 1;
+    }
+
+    if (start < blockSize) {
+        sig_dsp_ClockSource_renderRun(self, start, blockSize);
+    }
+}
+
+void sig_dsp_ClockSource_generate(void* signal) {
+    struct sig_dsp_ClockSource* self = (struct sig_dsp_ClockSource*) signal;
+    float_array_ptr pulse = self->inputs.pulse;
+    float_array_ptr tap = self->inputs.tap;
+
+    if (self->inputs.pulseEvents != NULL && self->inputs.tapEvents != NULL) {
+        sig_dsp_ClockSource_generateFromEvents(self);
+        return;
+    }
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        FLOAT_ARRAY(self->outputs.main)[i] = sig_dsp_ClockSource_tick(self,
+            FLOAT_ARRAY(pulse)[i], FLOAT_ARRAY(tap)[i]);
     }
 }
 
@@ -2804,6 +5443,7 @@ void sig_dsp_ClockDetector_init(struct sig_dsp_ClockDetector* self,
     self->pulseDurSamples = 0;
 
     sig_CONNECT_TO_SILENCE(self, source, context);
+    self->inputs.sourceEvents = NULL;
 }
 
 struct sig_dsp_ClockDetector* sig_dsp_ClockDetector_new(
@@ -2825,11 +5465,90 @@ static inline float sig_dsp_ClockDetector_calcClockFreq(
     return freq;
 }
 
+// Renders the samples between two clock events. The source doesn't
+// change between events, so no pulses can be detected; only a value
+// that is rising towards the threshold needs to be tracked.
+static inline void sig_dsp_ClockDetector_renderRun(
+    struct sig_dsp_ClockDetector* self, size_t start, size_t end) {
+    float value = self->previousTrigger;
+
+    self->samplesSinceLastPulse += (uint32_t) (end - start);
+    if (value > 0.0f && value < self->parameters.threshold) {
+        self->isRisingEdge = true;
+    }
+
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.main) + start,
+        end - start, self->clockFreq);
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.bpm) + start,
+        end - start, self->clockFreq * 60.0f);
+}
+
+static inline void sig_dsp_ClockDetector_tick(
+    struct sig_dsp_ClockDetector* self, float sourceSamp, size_t i) {
+    self->samplesSinceLastPulse++;
+
+    if (sourceSamp > 0.0f &&
+        self->previousTrigger < self->parameters.threshold) {
+        // Start of rising edge.
+        self->isRisingEdge = true;
+    } else if (sourceSamp < self->previousTrigger) {
+        // Failed to reach the threshold before
+        // the signal fell again.
+        self->isRisingEdge = false;
+    }
+
+    if (self->isRisingEdge && sourceSamp >= self->parameters.threshold) {
+        // Signal is rising and threshold has been reached,
+        // so this is a pulse.
+        self->numPulsesDetected++;
+        if (self->numPulsesDetected > 1) {
+            self->clockFreq = sig_dsp_ClockDetector_calcClockFreq(
+                self->signal.audioSettings->sampleRate,
+                self->samplesSinceLastPulse, self->clockFreq);
+            self->numPulsesDetected = 1;
+        }
+        self->pulseDurSamples = self->samplesSinceLastPulse;
+        self->samplesSinceLastPulse = 0;
+        self->isRisingEdge = false;
+    }
+
+    FLOAT_ARRAY(self->outputs.main)[i] = self->clockFreq;
+    FLOAT_ARRAY(self->outputs.bpm)[i] = self->clockFreq * 60.0f;
+    self->previousTrigger = sourceSamp;
+}
+
+static void sig_dsp_ClockDetector_generateFromEvents(
+    struct sig_dsp_ClockDetector* self) {
+    struct sig_EventBlock* events = self->inputs.sourceEvents;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t start = 0;
+
+    for (size_t e = 0; e < events->length &&
+        events->events[e].offset < blockSize; e++) {
+        size_t offset = events->events[e].offset;
+        if (offset > start) {
+            sig_dsp_ClockDetector_renderRun(self, start, offset);
+        }
+
+        sig_dsp_ClockDetector_tick(self, events->events[e].value, offset);
+        start = offset + 1;
+    }
+
+    if (start < blockSize) {
+        sig_dsp_ClockDetector_renderRun(self, start, blockSize);
+    }
+}
+
 void sig_dsp_ClockDetector_generate(void* signal) {
     struct sig_dsp_ClockDetector* self =
         (struct sig_dsp_ClockDetector*) signal;
     float_array_ptr source = self->inputs.source;
 
+    if (self->inputs.sourceEvents != NULL) {
+        sig_dsp_ClockDetector_generateFromEvents(self);
+        return;
+    }
+
     float previousTrigger = self->previousTrigger;
     float clockFreq = self->clockFreq;
     bool isRisingEdge = self->isRisingEdge;
@@ -2891,67 +5610,401 @@ void sig_dsp_ClockDetector_destroy(struct sig_Allocator* allocator,
 
 
 
-struct sig_dsp_LinearToFreq* sig_dsp_LinearToFreq_new(
-    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
-    struct sig_dsp_LinearToFreq* self = sig_MALLOC(allocator,
-        struct sig_dsp_LinearToFreq);
-    sig_dsp_LinearToFreq_init(self, context);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
-
-    return self;
+static inline bool sig_dsp_Midi_isOnChannel(
+    struct sig_midi_Message* message, float channel) {
+    return channel < 1.0f ||
+        sig_midi_Message_channel(message) == (uint8_t) channel;
 }
 
-void sig_dsp_LinearToFreq_init(struct sig_dsp_LinearToFreq* self,
-    struct sig_SignalContext* context) {
-    sig_dsp_Signal_init(self, context, *sig_dsp_LinearToFreq_generate);
-    self->parameters.middleFreq = sig_FREQ_C4;
-    sig_CONNECT_TO_SILENCE(self, source, context);
+// Returns the sample at which an event takes effect,
+// moving late events to the end of the block.
+static inline size_t sig_dsp_Midi_eventOffset(struct sig_midi_Event* event,
+    size_t blockSize) {
+    return event->offset < blockSize ? event->offset : blockSize - 1;
 }
 
-void sig_dsp_LinearToFreq_generate(void* signal) {
-    struct sig_dsp_LinearToFreq* self = (struct sig_dsp_LinearToFreq*) signal;
-    float_array_ptr source = self->inputs.source;
-    float_array_ptr output = self->outputs.main;
-    float middleFreq = self->parameters.middleFreq;
-
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float inputSample = FLOAT_ARRAY(source)[i];
-        FLOAT_ARRAY(output)[i] = sig_linearToFreq(inputSample, middleFreq);
-    }
+void sig_dsp_MidiNote_Outputs_newAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_MidiNote_Outputs* outputs) {
+    outputs->note = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->velocity = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->gate = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->trigger = sig_AudioBlock_newSilent(allocator, audioSettings);
 }
 
-void sig_dsp_LinearToFreq_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_LinearToFreq* self) {
-    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
-        &self->outputs);
-    sig_dsp_Signal_destroy(allocator, self);
+void sig_dsp_MidiNote_Outputs_destroyAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_dsp_MidiNote_Outputs* outputs) {
+    sig_AudioBlock_destroy(allocator, outputs->note);
+    sig_AudioBlock_destroy(allocator, outputs->velocity);
+    sig_AudioBlock_destroy(allocator, outputs->gate);
+    sig_AudioBlock_destroy(allocator, outputs->trigger);
 }
 
-
-struct sig_dsp_Branch* sig_dsp_Branch_new(
+struct sig_dsp_MidiNote* sig_dsp_MidiNote_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
-    struct sig_dsp_Branch* self = sig_MALLOC(allocator, struct sig_dsp_Branch);
-    sig_dsp_Branch_init(self, context);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+    struct sig_dsp_MidiNote* self = sig_MALLOC(allocator,
+        struct sig_dsp_MidiNote);
+    sig_dsp_MidiNote_init(self, context);
+    sig_dsp_MidiNote_Outputs_newAudioBlocks(allocator,
         context->audioSettings, &self->outputs);
 
     return self;
 }
 
-void sig_dsp_Branch_init(struct sig_dsp_Branch* self,
+void sig_dsp_MidiNote_init(struct sig_dsp_MidiNote* self,
     struct sig_SignalContext* context) {
-    sig_dsp_Signal_init(self, context, *sig_dsp_Branch_generate);
-    sig_CONNECT_TO_SILENCE(self, off, context);
-    sig_CONNECT_TO_SILENCE(self, on, context);
-    sig_CONNECT_TO_SILENCE(self, condition, context);
-}
+    sig_dsp_Signal_init(self, context, *sig_dsp_MidiNote_generate);
 
-void sig_dsp_Branch_generate(void* signal) {
-    struct sig_dsp_Branch* self = (struct sig_dsp_Branch*) signal;
+    struct sig_dsp_MidiNote_Parameters parameters = {
+        .channel = 0.0f
+    };
+    self->parameters = parameters;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float condition = FLOAT_ARRAY(self->inputs.condition)[i];
+    self->numHeldNotes = 0;
+    self->note = 0.0f;
+    self->velocity = 0.0f;
+    self->inputs.source = NULL;
+}
+
+static inline void sig_dsp_MidiNote_removeHeldNote(
+    struct sig_dsp_MidiNote* self, uint8_t note) {
+    size_t j = 0;
+    for (size_t i = 0; i < self->numHeldNotes; i++) {
+        if (self->heldNotes[i] != note) {
+            self->heldNotes[j++] = self->heldNotes[i];
+        }
+    }
+
+    self->numHeldNotes = j;
+}
+
+static inline void sig_dsp_MidiNote_noteOn(struct sig_dsp_MidiNote* self,
+    uint8_t note, uint8_t velocity) {
+    sig_dsp_MidiNote_removeHeldNote(self, note);
+
+    if (self->numHeldNotes == sig_dsp_MidiNote_MAX_HELD_NOTES) {
+        // Forget the oldest held note.
+        for (size_t i = 1; i < self->numHeldNotes; i++) {
+            self->heldNotes[i - 1] = self->heldNotes[i];
+        }
+        self->numHeldNotes--;
+    }
+
+    self->heldNotes[self->numHeldNotes++] = note;
+    self->note = (float) note;
+    self->velocity = (float) velocity / 127.0f;
+}
+
+static inline void sig_dsp_MidiNote_noteOff(struct sig_dsp_MidiNote* self,
+    uint8_t note) {
+    sig_dsp_MidiNote_removeHeldNote(self, note);
+
+    if (self->numHeldNotes > 0) {
+        // Return to the most recent note that is still held.
+        self->note = (float) self->heldNotes[self->numHeldNotes - 1];
+    }
+}
+
+static inline void sig_dsp_MidiNote_renderRun(struct sig_dsp_MidiNote* self,
+    size_t start, size_t end) {
+    size_t numSamples = end - start;
+
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.note) + start, numSamples,
+        self->note);
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.velocity) + start,
+        numSamples, self->velocity);
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.gate) + start, numSamples,
+        self->numHeldNotes > 0 ? 1.0f : 0.0f);
+}
+
+void sig_dsp_MidiNote_generate(void* signal) {
+    struct sig_dsp_MidiNote* self = (struct sig_dsp_MidiNote*) signal;
+    struct sig_midi_EventQueue* source = self->inputs.source;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t start = 0;
+
+    sig_fillWithSilence(self->outputs.trigger, blockSize);
+
+    for (size_t e = 0; source != NULL && e < source->length; e++) {
+        struct sig_midi_Message* message = &source->events[e].message;
+        uint8_t type = sig_midi_Message_type(message);
+        bool isNoteOn = type == sig_midi_Status_NOTE_ON &&
+            message->data[1] > 0;
+        bool isNoteOff = type == sig_midi_Status_NOTE_OFF ||
+            (type == sig_midi_Status_NOTE_ON && message->data[1] == 0);
+        bool isAllNotesOff = type == sig_midi_Status_CONTROL_CHANGE &&
+            message->data[0] == sig_midi_CC_ALL_NOTES_OFF;
+
+        if (!(isNoteOn || isNoteOff || isAllNotesOff) ||
+            !sig_dsp_Midi_isOnChannel(message, self->parameters.channel)) {
+            continue;
+        }
+
+        size_t offset = sig_dsp_Midi_eventOffset(&source->events[e],
+            blockSize);
+        sig_dsp_MidiNote_renderRun(self, start, offset);
+        start = offset;
+
+        if (isNoteOn) {
+            sig_dsp_MidiNote_noteOn(self, message->data[0],
+                message->data[1]);
+            FLOAT_ARRAY(self->outputs.trigger)[offset] = 1.0f;
+        } else if (isNoteOff) {
+            sig_dsp_MidiNote_noteOff(self, message->data[0]);
+        } else {
+            self->numHeldNotes = 0;
+        }
+    }
+
+    sig_dsp_MidiNote_renderRun(self, start, blockSize);
+}
+
+void sig_dsp_MidiNote_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_MidiNote* self) {
+    sig_dsp_MidiNote_Outputs_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+struct sig_dsp_MidiCC* sig_dsp_MidiCC_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_MidiCC* self = sig_MALLOC(allocator,
+        struct sig_dsp_MidiCC);
+    sig_dsp_MidiCC_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_MidiCC_init(struct sig_dsp_MidiCC* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_MidiCC_generate);
+
+    struct sig_dsp_MidiCC_Parameters parameters = {
+        .channel = 0.0f,
+        .controller = 1.0f
+    };
+    self->parameters = parameters;
+
+    self->value = 0.0f;
+    self->inputs.source = NULL;
+}
+
+void sig_dsp_MidiCC_generate(void* signal) {
+    struct sig_dsp_MidiCC* self = (struct sig_dsp_MidiCC*) signal;
+    struct sig_midi_EventQueue* source = self->inputs.source;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    uint8_t controller = (uint8_t) self->parameters.controller;
+    size_t start = 0;
+
+    for (size_t e = 0; source != NULL && e < source->length; e++) {
+        struct sig_midi_Message* message = &source->events[e].message;
+        if (sig_midi_Message_type(message) !=
+            sig_midi_Status_CONTROL_CHANGE ||
+            message->data[0] != controller ||
+            !sig_dsp_Midi_isOnChannel(message, self->parameters.channel)) {
+            continue;
+        }
+
+        size_t offset = sig_dsp_Midi_eventOffset(&source->events[e],
+            blockSize);
+        sig_fillWithValue(FLOAT_ARRAY(self->outputs.main) + start,
+            offset - start, self->value);
+        self->value = (float) message->data[1] / 127.0f;
+        start = offset;
+    }
+
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.main) + start,
+        blockSize - start, self->value);
+}
+
+void sig_dsp_MidiCC_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_MidiCC* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+struct sig_dsp_MidiClock* sig_dsp_MidiClock_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_MidiClock* self = sig_MALLOC(allocator,
+        struct sig_dsp_MidiClock);
+    sig_dsp_MidiClock_init(self, context);
+    self->outputs.main = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    self->outputs.running = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    // Each pulse rises and falls, so every other sample
+    // can have an event in the worst case.
+    self->outputs.pulseEvents = sig_EventBlock_new(allocator,
+        context->audioSettings->blockSize);
+
+    return self;
+}
+
+void sig_dsp_MidiClock_init(struct sig_dsp_MidiClock* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_MidiClock_generate);
+
+    struct sig_dsp_MidiClock_Parameters parameters = {
+        .divisor = 1.0f
+    };
+    self->parameters = parameters;
+
+    self->tickCount = 0;
+    self->isRunning = 0.0f;
+    self->isPulseHigh = false;
+    self->inputs.source = NULL;
+}
+
+// Outputs a pulse at the specified sample. lastPulse is the sample
+// of the previous pulse, which is -1 if it was the last sample of
+// the previous block, or less if the pulse has already fallen.
+static inline void sig_dsp_MidiClock_pulse(struct sig_dsp_MidiClock* self,
+    size_t offset, long* lastPulse) {
+    FLOAT_ARRAY(self->outputs.main)[offset] = 1.0f;
+
+    if ((long) offset <= *lastPulse + 1) {
+        // The pulse is still high from the previous sample.
+        *lastPulse = (long) offset;
+        return;
+    }
+
+    if (*lastPulse >= -1) {
+        sig_EventBlock_push(self->outputs.pulseEvents,
+            (uint32_t) (*lastPulse + 1), 0.0f);
+    }
+
+    sig_EventBlock_push(self->outputs.pulseEvents, (uint32_t) offset,
+        1.0f);
+    *lastPulse = (long) offset;
+}
+
+void sig_dsp_MidiClock_generate(void* signal) {
+    struct sig_dsp_MidiClock* self = (struct sig_dsp_MidiClock*) signal;
+    struct sig_midi_EventQueue* source = self->inputs.source;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    uint32_t divisor = self->parameters.divisor < 1.0f ?
+        1 : (uint32_t) self->parameters.divisor;
+    long lastPulse = self->isPulseHigh ? -1 : -2;
+    size_t start = 0;
+
+    sig_fillWithSilence(self->outputs.main, blockSize);
+    sig_EventBlock_clear(self->outputs.pulseEvents);
+
+    for (size_t e = 0; source != NULL && e < source->length; e++) {
+        uint8_t status = source->events[e].message.status;
+        size_t offset = sig_dsp_Midi_eventOffset(&source->events[e],
+            blockSize);
+
+        if (status == sig_midi_Status_TIMING_CLOCK) {
+            if (self->tickCount % divisor == 0) {
+                sig_dsp_MidiClock_pulse(self, offset, &lastPulse);
+            }
+            self->tickCount++;
+        } else if (status == sig_midi_Status_START ||
+            status == sig_midi_Status_CONTINUE ||
+            status == sig_midi_Status_STOP) {
+            sig_fillWithValue(FLOAT_ARRAY(self->outputs.running) + start,
+                offset - start, self->isRunning);
+            start = offset;
+
+            if (status == sig_midi_Status_START) {
+                self->tickCount = 0;
+            }
+
+            self->isRunning = status == sig_midi_Status_STOP ?
+                0.0f : 1.0f;
+        }
+    }
+
+    sig_fillWithValue(FLOAT_ARRAY(self->outputs.running) + start,
+        blockSize - start, self->isRunning);
+
+    // End the last pulse, unless it continues into the next block.
+    self->isPulseHigh = lastPulse == (long) blockSize - 1;
+    if (lastPulse >= -1 && !self->isPulseHigh) {
+        sig_EventBlock_push(self->outputs.pulseEvents,
+            (uint32_t) (lastPulse + 1), 0.0f);
+    }
+}
+
+void sig_dsp_MidiClock_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_MidiClock* self) {
+    sig_EventBlock_destroy(allocator, self->outputs.pulseEvents);
+    sig_AudioBlock_destroy(allocator, self->outputs.running);
+    sig_AudioBlock_destroy(allocator, self->outputs.main);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+
+struct sig_dsp_LinearToFreq* sig_dsp_LinearToFreq_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_LinearToFreq* self = sig_MALLOC(allocator,
+        struct sig_dsp_LinearToFreq);
+    sig_dsp_LinearToFreq_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_LinearToFreq_init(struct sig_dsp_LinearToFreq* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_LinearToFreq_generate);
+    self->parameters.middleFreq = sig_FREQ_C4;
+    sig_CONNECT_TO_SILENCE(self, source, context);
+}
+
+void sig_dsp_LinearToFreq_generate(void* signal) {
+    struct sig_dsp_LinearToFreq* self = (struct sig_dsp_LinearToFreq*) signal;
+    float_array_ptr source = self->inputs.source;
+    float_array_ptr output = self->outputs.main;
+    float middleFreq = self->parameters.middleFreq;
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        float inputSample = FLOAT_ARRAY(source)[i];
+        FLOAT_ARRAY(output)[i] = sig_linearToFreq(inputSample, middleFreq);
+    }
+}
+
+void sig_dsp_LinearToFreq_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_LinearToFreq* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+struct sig_dsp_Branch* sig_dsp_Branch_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_Branch* self = sig_MALLOC(allocator, struct sig_dsp_Branch);
+    sig_dsp_Branch_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_Branch_init(struct sig_dsp_Branch* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_Branch_generate);
+    sig_CONNECT_TO_SILENCE(self, off, context);
+    sig_CONNECT_TO_SILENCE(self, on, context);
+    sig_CONNECT_TO_SILENCE(self, condition, context);
+}
+
+void sig_dsp_Branch_generate(void* signal) {
+    struct sig_dsp_Branch* self = (struct sig_dsp_Branch*) signal;
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        float condition = FLOAT_ARRAY(self->inputs.condition)[i];
         float off = FLOAT_ARRAY(self->inputs.off)[i];
         float on = FLOAT_ARRAY(self->inputs.on)[i];
 
@@ -3150,7 +6203,9 @@ struct sig_dsp_TwoOpFM* sig_dsp_TwoOpFM_new(struct sig_Allocator* allocator,
         struct sig_dsp_TwoOpFM);
     sig_dsp_TwoOpFM_Outputs_newAudioBlocks(allocator,
         context->audioSettings, &self->outputs);
-    self->sineTable = sig_Buffer_new(allocator, 8192);
+    self->tables = context->tables;
+    self->sineTable = sig_LookupTableCache_acquire(self->tables, allocator,
+        sig_table_sine, sig_dsp_FM_SINE_TABLE_LENGTH, 0);
     self->feedbackDelay.buffer = sig_Buffer_new(allocator, 2);
 
     sig_dsp_TwoOpFM_init(self, context);
@@ -3162,11 +6217,12 @@ void sig_dsp_TwoOpFM_init(struct sig_dsp_TwoOpFM* self,
     struct sig_SignalContext* context) {
     sig_dsp_Signal_init(self, context, *sig_dsp_TwoOpFM_generate);
 
-    sig_Buffer_fillWithWaveform(self->sineTable, sig_waveform_sine,
-        self->sineTable->length, 0.0f, 1.0f);
     sig_osc_Wavetable_init(&self->carrierState, self->sineTable);
     sig_osc_Wavetable_init(&self->modulatorState, self->sineTable);
     sig_DelayLine_init(&self->feedbackDelay);
+    // The feedback buffer is read directly (rather than via
+    // sig_DelayLine's read functions), so it needs to be zeroed.
+    sig_Buffer_fillWithSilence(self->feedbackDelay.buffer);
 
     sig_CONNECT_TO_SILENCE(self, frequency, context);
     sig_CONNECT_TO_SILENCE(self, index, context);
@@ -3215,7 +6271,7 @@ void sig_dsp_TwoOpFM_generate(void* signal) {
 void sig_dsp_TwoOpFM_destroy(struct sig_Allocator* allocator,
     struct sig_dsp_TwoOpFM* self) {
     sig_dsp_TwoOpFM_Outputs_destroyAudioBlocks(allocator, &self->outputs);
-    sig_Buffer_destroy(allocator, self->sineTable);
+    sig_LookupTableCache_release(self->tables, allocator, self->sineTable);
     self->sineTable = NULL;
     sig_Buffer_destroy(allocator, self->feedbackDelay.buffer);
     self->feedbackDelay.buffer = NULL;
@@ -3223,6 +6279,219 @@ void sig_dsp_TwoOpFM_destroy(struct sig_Allocator* allocator,
 }
 
 
+struct sig_dsp_FMOperatorBank* sig_dsp_FMOperatorBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numOperators) {
+    struct sig_dsp_FMOperatorBank* self = sig_MALLOC(allocator,
+        struct sig_dsp_FMOperatorBank);
+
+    if (numOperators < sig_dsp_FMOperatorBank_MIN_OPERATORS) {
+        numOperators = sig_dsp_FMOperatorBank_MIN_OPERATORS;
+    } else if (numOperators > sig_dsp_FMOperatorBank_MAX_OPERATORS) {
+        numOperators = sig_dsp_FMOperatorBank_MAX_OPERATORS;
+    }
+
+    self->numOperators = numOperators;
+    self->tables = context->tables;
+    self->sineTable = sig_LookupTableCache_acquire(self->tables, allocator,
+        sig_table_sine, sig_dsp_FM_SINE_TABLE_LENGTH, 0);
+    sig_dsp_FMOperatorBank_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_FMOperatorBank_init(struct sig_dsp_FMOperatorBank* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_FMOperatorBank_generate);
+
+    sig_CONNECT_TO_SILENCE(self, frequency, context);
+    sig_CONNECT_TO_SILENCE(self, index, context);
+
+    for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+        self->parameters.ratios[j] = 1.0f;
+        self->parameters.levels[j] = 1.0f;
+        self->parameters.feedbackGains[j] = 0.0f;
+        self->phaseAccumulators[j] = 0.0f;
+        self->previousOutputs[j] = 0.0f;
+        self->olderOutputs[j] = 0.0f;
+    }
+
+    self->parameters.algorithm = sig_dsp_FMOperatorBank_Algorithm_STACK;
+    self->previousAlgorithm = self->parameters.algorithm;
+    sig_dsp_FMOperatorBank_setAlgorithm(self, self->parameters.algorithm);
+}
+
+void sig_dsp_FMOperatorBank_setAlgorithm(struct sig_dsp_FMOperatorBank* self,
+    enum sig_dsp_FMOperatorBank_Algorithm algorithm) {
+    size_t numOperators = self->numOperators;
+    size_t half = numOperators / 2;
+    size_t numCarriers = 0;
+
+    if (algorithm == sig_dsp_FMOperatorBank_Algorithm_CUSTOM) {
+        return;
+    }
+
+    for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+        self->carriers[j] = 0.0f;
+        for (size_t k = 0; k < sig_dsp_FMOperatorBank_MAX_OPERATORS; k++) {
+            self->modulation[j][k] = 0.0f;
+        }
+    }
+
+    if (algorithm == sig_dsp_FMOperatorBank_Algorithm_STACK) {
+        for (size_t j = 0; j + 1 < numOperators; j++) {
+            self->modulation[j][j + 1] = 1.0f;
+        }
+        self->carriers[0] = 1.0f;
+    } else if (algorithm == sig_dsp_FMOperatorBank_Algorithm_TWO_STACKS) {
+        for (size_t j = 0; j + 1 < numOperators; j++) {
+            if (j + 1 != half) {
+                self->modulation[j][j + 1] = 1.0f;
+            }
+        }
+        self->carriers[0] = 1.0f;
+        self->carriers[half] = 1.0f;
+    } else if (algorithm == sig_dsp_FMOperatorBank_Algorithm_PAIRS) {
+        for (size_t j = 0; j < numOperators; j += 2) {
+            if (j + 1 < numOperators) {
+                self->modulation[j][j + 1] = 1.0f;
+            }
+            self->carriers[j] = 1.0f;
+        }
+    } else if (algorithm == sig_dsp_FMOperatorBank_Algorithm_BRANCH) {
+        for (size_t k = 1; k < numOperators; k++) {
+            self->modulation[0][k] = 1.0f;
+        }
+        self->carriers[0] = 1.0f;
+    } else {
+        for (size_t j = 0; j < numOperators; j++) {
+            self->carriers[j] = 1.0f;
+        }
+    }
+
+    for (size_t j = 0; j < numOperators; j++) {
+        if (self->carriers[j] != 0.0f) {
+            numCarriers++;
+        }
+    }
+
+    for (size_t j = 0; j < numOperators; j++) {
+        self->carriers[j] /= (float) numCarriers;
+    }
+}
+
+// Wraps a phase into the range 0.0 to 1.0 without calling floorf(),
+// which isn't inlined (or vectorized) on many targets.
+static inline float sig_dsp_FMOperatorBank_wrap(float phase) {
+    phase -= (float) ((int32_t) phase);
+    return phase < 0.0f ? phase + 1.0f : phase;
+}
+
+void sig_dsp_FMOperatorBank_generate(void* signal) {
+    struct sig_dsp_FMOperatorBank* self =
+        (struct sig_dsp_FMOperatorBank*) signal;
+    float* frequency = FLOAT_ARRAY(self->inputs.frequency);
+    float* index = FLOAT_ARRAY(self->inputs.index);
+    float* output = FLOAT_ARRAY(self->outputs.main);
+    float sampleDuration = 1.0f / self->signal.audioSettings->sampleRate;
+    size_t numOperators = self->numOperators;
+    float* table = FLOAT_ARRAY(self->sineTable->samples);
+    size_t tableMask = self->sineTable->length - 1;
+    float tableLength = (float) self->sineTable->length;
+
+    if (self->parameters.algorithm != self->previousAlgorithm) {
+        sig_dsp_FMOperatorBank_setAlgorithm(self,
+            self->parameters.algorithm);
+        self->previousAlgorithm = self->parameters.algorithm;
+    }
+
+    // Operator parameters and state are copied into local arrays
+    // so that the compiler can keep them in registers, since
+    // the output could otherwise alias them. All operators are
+    // processed so that the loops have a constant trip count,
+    // but unused ones are silenced.
+    float ratios[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float feedbackGains[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float carrierLevels[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float modulatorLevels[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float phases[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float previous[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float older[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+    float matrix[sig_dsp_FMOperatorBank_MAX_OPERATORS]
+        [sig_dsp_FMOperatorBank_MAX_OPERATORS];
+
+    for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+        float level = j < numOperators ? self->parameters.levels[j] : 0.0f;
+        ratios[j] = self->parameters.ratios[j];
+        feedbackGains[j] = self->parameters.feedbackGains[j] * 0.5f;
+        carrierLevels[j] = self->carriers[j] * level;
+        modulatorLevels[j] = level;
+        phases[j] = self->phaseAccumulators[j];
+        previous[j] = self->previousOutputs[j];
+        older[j] = self->olderOutputs[j];
+        for (size_t k = 0; k < sig_dsp_FMOperatorBank_MAX_OPERATORS; k++) {
+            matrix[k][j] = self->modulation[j][k];
+        }
+    }
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        float increment = frequency[i] * sampleDuration;
+        float modulation[sig_dsp_FMOperatorBank_MAX_OPERATORS];
+        float sample = 0.0f;
+
+        // Each operator's phase is modulated by the feedback from
+        // its own previous samples...
+        for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+            modulation[j] = feedbackGains[j] * (previous[j] + older[j]);
+        }
+
+        // ... and by the previous sample of each of its modulators.
+        for (size_t k = 0; k < sig_dsp_FMOperatorBank_MAX_OPERATORS; k++) {
+            float modulator = previous[k] * modulatorLevels[k] * index[i];
+            for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+                modulation[j] += matrix[k][j] * modulator;
+            }
+        }
+
+        for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+            float phase = sig_dsp_FMOperatorBank_wrap(
+                phases[j] + modulation[j]);
+            float tableIdx = phase * tableLength;
+            size_t idx = (size_t) tableIdx;
+            float frac = tableIdx - (float) idx;
+            idx &= tableMask;
+            float a = table[idx];
+            float opSample = a + frac * (table[(idx + 1) & tableMask] - a);
+
+            older[j] = previous[j];
+            previous[j] = opSample;
+            sample += carrierLevels[j] * opSample;
+            phases[j] = sig_dsp_FMOperatorBank_wrap(
+                phases[j] + increment * ratios[j]);
+        }
+
+        output[i] = sample;
+    }
+
+    for (size_t j = 0; j < sig_dsp_FMOperatorBank_MAX_OPERATORS; j++) {
+        self->phaseAccumulators[j] = phases[j];
+        self->previousOutputs[j] = previous[j];
+        self->olderOutputs[j] = older[j];
+    }
+}
+
+void sig_dsp_FMOperatorBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_FMOperatorBank* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_LookupTableCache_release(self->tables, allocator, self->sineTable);
+    self->sineTable = NULL;
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
 
 void sig_dsp_FourPoleFilter_Outputs_newAudioBlocks(
     struct sig_Allocator* allocator,
@@ -3230,6 +6499,20 @@ void sig_dsp_FourPoleFilter_Outputs_newAudioBlocks(
     struct sig_dsp_FourPoleFilter_Outputs* outputs) {
     outputs->main = sig_AudioBlock_newSilent(allocator, audioSettings);
     outputs->twoPole = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->fourPole = sig_AudioBlock_newSilent(allocator, audioSettings);
+}
+
+void sig_dsp_FourPoleFilter_Outputs_newMultichannelAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    size_t numChannels,
+    struct sig_dsp_FourPoleFilter_Outputs* outputs) {
+    outputs->main = sig_AudioBlock_newMultichannel(allocator, audioSettings,
+        numChannels);
+    outputs->twoPole = sig_AudioBlock_newMultichannel(allocator,
+        audioSettings, numChannels);
+    outputs->fourPole = sig_AudioBlock_newMultichannel(allocator,
+        audioSettings, numChannels);
 }
 
 void sig_dsp_FourPoleFilter_Outputs_destroyAudioBlocks(
@@ -3237,16 +6520,24 @@ void sig_dsp_FourPoleFilter_Outputs_destroyAudioBlocks(
     struct sig_dsp_FourPoleFilter_Outputs* outputs) {
     sig_AudioBlock_destroy(allocator, outputs->main);
     sig_AudioBlock_destroy(allocator, outputs->twoPole);
+    sig_AudioBlock_destroy(allocator, outputs->fourPole);
 }
 
 
 struct sig_dsp_Ladder* sig_dsp_Ladder_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_Ladder_newMultichannel(allocator, context, 1);
+}
+
+struct sig_dsp_Ladder* sig_dsp_Ladder_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
     struct sig_dsp_Ladder* self = sig_MALLOC(allocator,
         struct sig_dsp_Ladder);
+    self->numChannels = sig_clampNumChannels(numChannels);
     sig_dsp_Ladder_init(self, context);
-    sig_dsp_FourPoleFilter_Outputs_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+    sig_dsp_FourPoleFilter_Outputs_newMultichannelAudioBlocks(allocator,
+        context->audioSettings, self->numChannels, &self->outputs);
 
     return self;
 }
@@ -3265,13 +6556,18 @@ void sig_dsp_Ladder_init(
     self->interpolationRecip = 1.0f / self->interpolation;
     self->alpha = 1.0f;
     self->beta[0] = self->beta[1] = self->beta[2] = self->beta[3] = 0.0f;
-    self->z0[0] = self->z0[1] = self->z0[2] = self->z0[3] = 0.0f;
-    self->z1[0] = self->z1[1] = self->z1[2] = self->z1[3] = 0.0f;
     self->k = 1.0f;
     self->fBase = 1000.0f;
     self->qAdjust = 1.0f;
     self->prevFrequency = -1.0f;
-    self->prevInput = 0.0f;
+
+    for (size_t c = 0; c < sig_MAX_CHANNELS; c++) {
+        for (size_t i = 0; i < 4; i++) {
+            self->z0[c][i] = 0.0f;
+            self->z1[c][i] = 0.0f;
+        }
+        self->prevInputs[c] = 0.0f;
+    }
 
     sig_CONNECT_TO_SILENCE(self, source, context);
     sig_CONNECT_TO_SILENCE(self, frequency, context);
@@ -3283,24 +6579,31 @@ void sig_dsp_Ladder_init(
     sig_CONNECT_TO_UNITY(self, pole4Gain, context);
 }
 
-inline void sig_dsp_Ladder_calcCoefficients(
-    struct sig_dsp_Ladder* self, float freq) {
-    float sampleRate = self->signal.audioSettings->sampleRate;
+static inline void sig_dsp_Ladder_coefficients(float freq,
+    float sampleRate, size_t interpolation, float* alpha, float* qAdjust) {
     freq = sig_clamp(freq, 5.0f, sampleRate * 0.425f);
     float wc = freq * (float) (sig_TWOPI /
-        ((float)self->interpolation * sampleRate));
+        ((float) interpolation * sampleRate));
     float wc2 = wc * wc;
-    self->alpha = 0.9892f * wc - 0.4324f *
+    *alpha = 0.9892f * wc - 0.4324f *
         wc2 + 0.1381f * wc * wc2 - 0.0202f * wc2 * wc2;
-    self->qAdjust = 1.006f + 0.0536f * wc - 0.095f * wc2 - 0.05f * wc2 * wc2;
+    *qAdjust = 1.006f + 0.0536f * wc - 0.095f * wc2 - 0.05f * wc2 * wc2;
+}
+
+inline void sig_dsp_Ladder_calcCoefficients(
+    struct sig_dsp_Ladder* self, float freq) {
+    sig_dsp_Ladder_coefficients(freq, self->signal.audioSettings->sampleRate,
+        self->interpolation, &self->alpha, &self->qAdjust);
 }
 
 inline float sig_dsp_Ladder_calcStage(
-    struct sig_dsp_Ladder* self, float s, uint8_t i) {
-    float ft = s * (1.0f/1.3f) + (0.3f/1.3f) * self->z0[i] - self->z1[i];
-    ft = ft * self->alpha + self->z1[i];
-    self->z1[i] = ft;
-    self->z0[i] = s;
+    struct sig_dsp_Ladder* self, size_t channel, float s, uint8_t i) {
+    float* z0 = self->z0[channel];
+    float* z1 = self->z1[channel];
+    float ft = s * (1.0f/1.3f) + (0.3f/1.3f) * z0[i] - z1[i];
+    ft = ft * self->alpha + z1[i];
+    z1[i] = ft;
+    z0[i] = s;
     return ft;
 }
 
@@ -3309,57 +6612,506 @@ void sig_dsp_Ladder_generate(void* signal) {
         (struct sig_dsp_Ladder*) signal;
     float interpolationRecip = self->interpolationRecip;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float input = FLOAT_ARRAY(self->inputs.source)[i];
-        float frequency = FLOAT_ARRAY(self->inputs.frequency)[i];
-        float resonance = FLOAT_ARRAY(self->inputs.resonance)[i];
-        float totals[5] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
-        float interp = 0.0f;
-
-        // Recalculate coefficients if the frequency has changed.
-        if (frequency != self->prevFrequency) {
-            sig_dsp_Ladder_calcCoefficients(self, frequency);
-            self->prevFrequency = frequency;
-        }
-
-        self->k = 4.0f * resonance;
-
-        for (size_t os = 0; os < self->interpolation; os++) {
-            float inInterp = interp * self->prevInput + (1.0f - interp) * input;
-            float u = inInterp - (self->z1[3] - self->parameters.passbandGain *
-                inInterp) * self->k * self->qAdjust;
-            u = sig_fastTanhf(u);
-            totals[0] = u;
-            float stage1 = sig_dsp_Ladder_calcStage(self, u, 0);
-            totals[1] += stage1 * interpolationRecip;
-            float stage2 = sig_dsp_Ladder_calcStage(self, stage1, 1);
-            totals[2] += stage2 * interpolationRecip;
-            float stage3 = sig_dsp_Ladder_calcStage(self, stage2, 2);
-            totals[3] += stage3 * interpolationRecip;
-            float stage4 = sig_dsp_Ladder_calcStage(self, stage3, 3);
-            totals[4] += stage4 * interpolationRecip;
-            interp += interpolationRecip;
-        }
-        self->prevInput = input;
-        FLOAT_ARRAY(self->outputs.main)[i] =
-            (totals[0] * FLOAT_ARRAY(self->inputs.inputGain)[i]) +
-            (totals[1] * FLOAT_ARRAY(self->inputs.pole1Gain)[i]) +
-            (totals[2] * FLOAT_ARRAY(self->inputs.pole2Gain)[i]) +
-            (totals[3] * FLOAT_ARRAY(self->inputs.pole3Gain)[i]) +
-            (totals[4] * FLOAT_ARRAY(self->inputs.pole4Gain)[i]);
-        FLOAT_ARRAY(self->outputs.twoPole)[i] = totals[2];
-        FLOAT_ARRAY(self->outputs.fourPole)[i] = totals[4];
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float_array_ptr frequency = self->inputs.frequency;
+    enum sig_dsp_InputChange change = sig_dsp_detectInputChange(frequency,
+        blockSize, self->prevFrequency);
+
+    if (change == sig_dsp_InputChange_STEP) {
+        sig_dsp_Ladder_calcCoefficients(self, FLOAT_ARRAY(frequency)[0]);
     }
-}
 
-void sig_dsp_Ladder_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_Ladder* self) {
+    float alpha = self->alpha;
+    float qAdjust = self->qAdjust;
+    float alphaIncrement = 0.0f;
+    float qAdjustIncrement = 0.0f;
+
+    if (change == sig_dsp_InputChange_MODULATED) {
+        // Interpolate from the current coefficients to those
+        // for the frequency at the end of the block.
+        sig_dsp_Ladder_calcCoefficients(self,
+            FLOAT_ARRAY(frequency)[blockSize - 1]);
+        alphaIncrement = (self->alpha - alpha) / (float) blockSize;
+        qAdjustIncrement = (self->qAdjust - qAdjust) / (float) blockSize;
+    }
+
+    float targetAlpha = self->alpha;
+    float targetQAdjust = self->qAdjust;
+    self->prevFrequency = FLOAT_ARRAY(frequency)[blockSize - 1];
+
+    // Each channel is filtered in turn, with the same coefficients.
+    for (size_t c = 0; c < self->numChannels; c++) {
+        float* source = FLOAT_ARRAY(self->inputs.source) + c * blockSize;
+        float* main = FLOAT_ARRAY(self->outputs.main) + c * blockSize;
+        float* twoPole = FLOAT_ARRAY(self->outputs.twoPole) + c * blockSize;
+        float* fourPole = FLOAT_ARRAY(self->outputs.fourPole) +
+            c * blockSize;
+        float* z0 = self->z0[c];
+        float* z1 = self->z1[c];
+        float channelAlpha = alpha;
+        float channelQAdjust = qAdjust;
+        float prevInput = self->prevInputs[c];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            float input = source[i];
+            float resonance = FLOAT_ARRAY(self->inputs.resonance)[i];
+            float totals[5] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+            float interp = 0.0f;
+
+            channelAlpha += alphaIncrement;
+            channelQAdjust += qAdjustIncrement;
+            self->alpha = channelAlpha;
+            self->qAdjust = channelQAdjust;
+            self->k = 4.0f * resonance;
+
+            for (size_t os = 0; os < self->interpolation; os++) {
+                float inInterp = interp * prevInput +
+                    (1.0f - interp) * input;
+                float u = inInterp - (z1[3] - self->parameters.passbandGain *
+                    inInterp) * self->k * self->qAdjust;
+                u = sig_fastTanhf(u);
+                totals[0] = u;
+                float stage1 = sig_dsp_Ladder_calcStage(self, c, u, 0);
+                totals[1] += stage1 * interpolationRecip;
+                float stage2 = sig_dsp_Ladder_calcStage(self, c, stage1, 1);
+                totals[2] += stage2 * interpolationRecip;
+                float stage3 = sig_dsp_Ladder_calcStage(self, c, stage2, 2);
+                totals[3] += stage3 * interpolationRecip;
+                float stage4 = sig_dsp_Ladder_calcStage(self, c, stage3, 3);
+                totals[4] += stage4 * interpolationRecip;
+                interp += interpolationRecip;
+            }
+            prevInput = input;
+            main[i] =
+                (totals[0] * FLOAT_ARRAY(self->inputs.inputGain)[i]) +
+                (totals[1] * FLOAT_ARRAY(self->inputs.pole1Gain)[i]) +
+                (totals[2] * FLOAT_ARRAY(self->inputs.pole2Gain)[i]) +
+                (totals[3] * FLOAT_ARRAY(self->inputs.pole3Gain)[i]) +
+                (totals[4] * FLOAT_ARRAY(self->inputs.pole4Gain)[i]);
+            twoPole[i] = totals[2];
+            fourPole[i] = totals[4];
+        }
+
+        for (size_t i = 0; i < 4; i++) {
+            z0[i] = sig_denormals_flush(z0[i]);
+            z1[i] = sig_denormals_flush(z1[i]);
+        }
+        self->prevInputs[c] = sig_denormals_flush(prevInput);
+    }
+
+    self->alpha = targetAlpha;
+    self->qAdjust = targetQAdjust;
+}
+
+void sig_dsp_Ladder_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Ladder* self) {
     sig_dsp_FourPoleFilter_Outputs_destroyAudioBlocks(allocator,
         &self->outputs);
     sig_dsp_Signal_destroy(allocator, self);
 }
 
 
+// Matches the default interpolation of sig_dsp_Ladder.
+static const size_t sig_dsp_VoiceBank_INTERPOLATION = 4;
+
+// The attack approaches a target of 1.2, so its coefficient is chosen
+// to reach 1.0 (i.e. 1/6th of the initial distance) in the attack time.
+static const float sig_dsp_VoiceBank_ATTACK_TARGET = 1.2f;
+static const float sig_dsp_VoiceBank_LOG_ATTACK_RATIO = -1.7917595f;
+
+// The decay and release fall by 60 dB in their specified time.
+static const float sig_dsp_VoiceBank_LOG_DECAY_RATIO = -6.9077553f;
+
+// A released voice becomes idle when it falls below -80 dB.
+static const float sig_dsp_VoiceBank_IDLE_LEVEL = 0.0001f;
+
+struct sig_dsp_VoiceBank* sig_dsp_VoiceBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numVoices) {
+    struct sig_dsp_VoiceBank* self = sig_MALLOC(allocator,
+        struct sig_dsp_VoiceBank);
+    self->numVoices = numVoices < 1 ? 1 :
+        numVoices > sig_dsp_VoiceBank_MAX_VOICES ?
+            sig_dsp_VoiceBank_MAX_VOICES : numVoices;
+    sig_dsp_VoiceBank_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+static inline void sig_dsp_VoiceBank_resetVoice(
+    struct sig_dsp_VoiceBank* self, size_t voice) {
+    self->stages[voice] = sig_dsp_VoiceBank_Stage_IDLE;
+    self->levels[voice] = 0.0f;
+    self->phaseAccumulators[voice] = 0.0f;
+    self->alphas[voice] = 1.0f;
+    self->qAdjusts[voice] = 1.0f;
+    self->previousCutoffs[voice] = -1.0f;
+    self->previousInputs[voice] = 0.0f;
+
+    for (size_t j = 0; j < 4; j++) {
+        self->z0[j][voice] = 0.0f;
+        self->z1[j][voice] = 0.0f;
+    }
+}
+
+void sig_dsp_VoiceBank_init(struct sig_dsp_VoiceBank* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_VoiceBank_generate);
+
+    struct sig_dsp_VoiceBank_Parameters parameters = {
+        .filterEnvelopeAmount = 0.0f,
+        .passbandGain = 0.5f,
+        .outputGain = 1.0f / (float) self->numVoices
+    };
+    self->parameters = parameters;
+
+    sig_CONNECT_TO_UNITY(self, frequencyScale, context);
+    sig_CONNECT_TO_SILENCE(self, cutoff, context);
+    sig_CONNECT_TO_SILENCE(self, resonance, context);
+    sig_CONNECT_TO_SILENCE(self, attack, context);
+    sig_CONNECT_TO_SILENCE(self, decay, context);
+    sig_CONNECT_TO_UNITY(self, sustain, context);
+    sig_CONNECT_TO_SILENCE(self, release, context);
+
+    self->noteCounter = 0;
+    for (size_t v = 0; v < sig_dsp_VoiceBank_MAX_VOICES; v++) {
+        self->notes[v] = -1;
+        self->noteAges[v] = 0;
+        self->frequencies[v] = 0.0f;
+        self->velocities[v] = 0.0f;
+        sig_dsp_VoiceBank_resetVoice(self, v);
+    }
+}
+
+// Returns the voice that is already playing the note,
+// or the lowest-numbered idle voice, or the voice to steal.
+static inline size_t sig_dsp_VoiceBank_findVoice(
+    struct sig_dsp_VoiceBank* self, int32_t note) {
+    for (size_t v = 0; v < self->numVoices; v++) {
+        if (self->stages[v] != sig_dsp_VoiceBank_Stage_IDLE &&
+            self->notes[v] == note) {
+            return v;
+        }
+    }
+
+    for (size_t v = 0; v < self->numVoices; v++) {
+        if (self->stages[v] == sig_dsp_VoiceBank_Stage_IDLE) {
+            return v;
+        }
+    }
+
+    // Ages are measured relative to the note counter,
+    // so that they remain correct when it wraps around.
+    size_t oldest = 0;
+    uint32_t oldestAge = 0;
+    bool oldestIsReleased = false;
+    for (size_t v = 0; v < self->numVoices; v++) {
+        uint32_t age = self->noteCounter - self->noteAges[v];
+        bool isReleased = self->stages[v] == sig_dsp_VoiceBank_Stage_RELEASE;
+        if ((isReleased && !oldestIsReleased) ||
+            (isReleased == oldestIsReleased && age > oldestAge)) {
+            oldest = v;
+            oldestAge = age;
+            oldestIsReleased = isReleased;
+        }
+    }
+
+    return oldest;
+}
+
+size_t sig_dsp_VoiceBank_noteOn(struct sig_dsp_VoiceBank* self,
+    int32_t note, float frequency, float velocity) {
+    size_t voice = sig_dsp_VoiceBank_findVoice(self, note);
+
+    // Retriggered and stolen voices keep their current level
+    // and filter state, so that they don't click.
+    if (self->stages[voice] == sig_dsp_VoiceBank_Stage_IDLE) {
+        sig_dsp_VoiceBank_resetVoice(self, voice);
+    }
+
+    self->notes[voice] = note;
+    self->noteAges[voice] = self->noteCounter++;
+    self->frequencies[voice] = frequency;
+    self->velocities[voice] = velocity;
+    self->stages[voice] = sig_dsp_VoiceBank_Stage_ATTACK;
+
+    return voice;
+}
+
+void sig_dsp_VoiceBank_noteOff(struct sig_dsp_VoiceBank* self,
+    int32_t note) {
+    for (size_t v = 0; v < self->numVoices; v++) {
+        if (self->notes[v] == note &&
+            (self->stages[v] == sig_dsp_VoiceBank_Stage_ATTACK ||
+            self->stages[v] == sig_dsp_VoiceBank_Stage_DECAY)) {
+            self->stages[v] = sig_dsp_VoiceBank_Stage_RELEASE;
+        }
+    }
+}
+
+void sig_dsp_VoiceBank_allNotesOff(struct sig_dsp_VoiceBank* self) {
+    for (size_t v = 0; v < self->numVoices; v++) {
+        if (self->stages[v] != sig_dsp_VoiceBank_Stage_IDLE) {
+            self->stages[v] = sig_dsp_VoiceBank_Stage_RELEASE;
+        }
+    }
+}
+
+size_t sig_dsp_VoiceBank_numActiveVoices(struct sig_dsp_VoiceBank* self) {
+    size_t numActive = 0;
+    for (size_t v = 0; v < self->numVoices; v++) {
+        if (self->stages[v] != sig_dsp_VoiceBank_Stage_IDLE) {
+            numActive++;
+        }
+    }
+
+    return numActive;
+}
+
+static inline float sig_dsp_VoiceBank_envelopeCoefficient(float time,
+    float sampleRate, float logRatio) {
+    return time > 0.0f ? expf(logRatio / (time * sampleRate)) : 0.0f;
+}
+
+// The block-rate values that are shared by every voice.
+struct sig_dsp_VoiceBank_BlockSettings {
+    float frequencyScale;
+    float cutoff;
+    float k;
+    float sustain;
+    float attackCoefficient;
+    float decayCoefficient;
+    float releaseCoefficient;
+};
+
+static inline void sig_dsp_VoiceBank_envelopeStage(
+    enum sig_dsp_VoiceBank_Stage stage,
+    struct sig_dsp_VoiceBank_BlockSettings* settings,
+    float* target, float* coefficient) {
+    if (stage == sig_dsp_VoiceBank_Stage_ATTACK) {
+        *target = sig_dsp_VoiceBank_ATTACK_TARGET;
+        *coefficient = settings->attackCoefficient;
+    } else if (stage == sig_dsp_VoiceBank_Stage_DECAY) {
+        *target = settings->sustain;
+        *coefficient = settings->decayCoefficient;
+    } else if (stage == sig_dsp_VoiceBank_Stage_RELEASE) {
+        *target = 0.0f;
+        *coefficient = settings->releaseCoefficient;
+    } else {
+        *target = 0.0f;
+        *coefficient = 0.0f;
+    }
+}
+
+// Renders and mixes a batch of voices into the output.
+// The state of each voice in the batch is copied into local arrays,
+// which are iterated together for each sample.
+static inline void sig_dsp_VoiceBank_renderBatch(
+    struct sig_dsp_VoiceBank* self, size_t first,
+    struct sig_dsp_VoiceBank_BlockSettings* settings) {
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    float recipSampleRate = 1.0f / sampleRate;
+    float interpolationRecip = 1.0f /
+        (float) sig_dsp_VoiceBank_INTERPOLATION;
+    float passbandGain = self->parameters.passbandGain;
+    float k = settings->k;
+    float* output = FLOAT_ARRAY(self->outputs.main);
+
+    enum sig_dsp_VoiceBank_Stage stages[sig_dsp_VoiceBank_BATCH_SIZE];
+    float frequencies[sig_dsp_VoiceBank_BATCH_SIZE];
+    float phaseIncrements[sig_dsp_VoiceBank_BATCH_SIZE];
+    float phases[sig_dsp_VoiceBank_BATCH_SIZE];
+    float levels[sig_dsp_VoiceBank_BATCH_SIZE];
+    float targets[sig_dsp_VoiceBank_BATCH_SIZE];
+    float coefficients[sig_dsp_VoiceBank_BATCH_SIZE];
+    float gains[sig_dsp_VoiceBank_BATCH_SIZE];
+    float alphas[sig_dsp_VoiceBank_BATCH_SIZE];
+    float alphaIncrements[sig_dsp_VoiceBank_BATCH_SIZE];
+    float qAdjusts[sig_dsp_VoiceBank_BATCH_SIZE];
+    float qAdjustIncrements[sig_dsp_VoiceBank_BATCH_SIZE];
+    float previousInputs[sig_dsp_VoiceBank_BATCH_SIZE];
+    float z0[4][sig_dsp_VoiceBank_BATCH_SIZE];
+    float z1[4][sig_dsp_VoiceBank_BATCH_SIZE];
+
+    for (size_t lane = 0; lane < sig_dsp_VoiceBank_BATCH_SIZE; lane++) {
+        size_t v = first + lane;
+        float frequency = self->frequencies[v] * settings->frequencyScale;
+
+        stages[lane] = self->stages[v];
+        frequencies[lane] = frequency;
+        phaseIncrements[lane] = fabsf(frequency) * recipSampleRate;
+        phases[lane] = self->phaseAccumulators[v];
+        levels[lane] = self->levels[v];
+        gains[lane] = self->velocities[v] * self->parameters.outputGain;
+        sig_dsp_VoiceBank_envelopeStage(stages[lane], settings,
+            &targets[lane], &coefficients[lane]);
+        previousInputs[lane] = self->previousInputs[v];
+
+        for (size_t j = 0; j < 4; j++) {
+            z0[j][lane] = self->z0[j][v];
+            z1[j][lane] = self->z1[j][v];
+        }
+
+        // The filter's cutoff follows the envelope at block rate;
+        // as in sig_dsp_Ladder, changes are interpolated across the block.
+        float cutoff = settings->cutoff * powf(2.0f,
+            self->parameters.filterEnvelopeAmount * levels[lane]);
+        alphas[lane] = self->alphas[v];
+        qAdjusts[lane] = self->qAdjusts[v];
+        alphaIncrements[lane] = 0.0f;
+        qAdjustIncrements[lane] = 0.0f;
+
+        if (cutoff != self->previousCutoffs[v]) {
+            sig_dsp_Ladder_coefficients(cutoff, sampleRate,
+                sig_dsp_VoiceBank_INTERPOLATION,
+                &self->alphas[v], &self->qAdjusts[v]);
+
+            if (self->previousCutoffs[v] < 0.0f) {
+                alphas[lane] = self->alphas[v];
+                qAdjusts[lane] = self->qAdjusts[v];
+            } else {
+                alphaIncrements[lane] = (self->alphas[v] - alphas[lane]) /
+                    (float) blockSize;
+                qAdjustIncrements[lane] = (self->qAdjusts[v] -
+                    qAdjusts[lane]) / (float) blockSize;
+            }
+
+            self->previousCutoffs[v] = cutoff;
+        }
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float mix = 0.0f;
+
+        for (size_t lane = 0; lane < sig_dsp_VoiceBank_BATCH_SIZE;
+            lane++) {
+            // Envelope.
+            float level = targets[lane] +
+                (levels[lane] - targets[lane]) * coefficients[lane];
+
+            if (stages[lane] == sig_dsp_VoiceBank_Stage_ATTACK &&
+                level >= 1.0f) {
+                level = 1.0f;
+                stages[lane] = sig_dsp_VoiceBank_Stage_DECAY;
+                sig_dsp_VoiceBank_envelopeStage(stages[lane], settings,
+                    &targets[lane], &coefficients[lane]);
+            } else if (stages[lane] == sig_dsp_VoiceBank_Stage_RELEASE &&
+                level < sig_dsp_VoiceBank_IDLE_LEVEL) {
+                level = 0.0f;
+                stages[lane] = sig_dsp_VoiceBank_Stage_IDLE;
+                sig_dsp_VoiceBank_envelopeStage(stages[lane], settings,
+                    &targets[lane], &coefficients[lane]);
+            }
+            levels[lane] = level;
+
+            // Band-limited saw (see sig_dsp_BLEPSaw_generate).
+            float phase = sig_osc_Oscillator_wrapPhase(phases[lane]);
+            float dt = phaseIncrements[lane];
+            float saw = 2.0f * phase - 1.0f;
+            if (phase < dt || phase > 1.0f - dt) {
+                saw -= 2.0f * sig_osc_polyBLEP(phase, dt);
+            }
+            sig_osc_Oscillator_accumulatePhase(&phases[lane],
+                frequencies[lane], sampleRate);
+
+            // Ladder filter (see sig_dsp_Ladder_generate).
+            alphas[lane] += alphaIncrements[lane];
+            qAdjusts[lane] += qAdjustIncrements[lane];
+            float alpha = alphas[lane];
+            float kq = k * qAdjusts[lane];
+            float previousInput = previousInputs[lane];
+            float interp = 0.0f;
+            float total = 0.0f;
+
+            for (size_t os = 0; os < sig_dsp_VoiceBank_INTERPOLATION; os++) {
+                float inInterp = interp * previousInput +
+                    (1.0f - interp) * saw;
+                float s = sig_fastTanhf(inInterp -
+                    (z1[3][lane] - passbandGain * inInterp) * kq);
+
+                for (size_t j = 0; j < 4; j++) {
+                    float ft = s * (1.0f/1.3f) + (0.3f/1.3f) * z0[j][lane] -
+                        z1[j][lane];
+                    ft = ft * alpha + z1[j][lane];
+                    z1[j][lane] = ft;
+                    z0[j][lane] = s;
+                    s = ft;
+                }
+
+                total += s * interpolationRecip;
+                interp += interpolationRecip;
+            }
+            previousInputs[lane] = saw;
+
+            mix += total * level * gains[lane];
+        }
+
+        output[i] += mix;
+    }
+
+    for (size_t lane = 0; lane < sig_dsp_VoiceBank_BATCH_SIZE; lane++) {
+        size_t v = first + lane;
+        self->stages[v] = stages[lane];
+        self->phaseAccumulators[v] = phases[lane];
+        self->levels[v] = sig_denormals_flush(levels[lane]);
+        self->previousInputs[v] = sig_denormals_flush(previousInputs[lane]);
+
+        for (size_t j = 0; j < 4; j++) {
+            self->z0[j][v] = sig_denormals_flush(z0[j][lane]);
+            self->z1[j][v] = sig_denormals_flush(z1[j][lane]);
+        }
+    }
+}
+
+void sig_dsp_VoiceBank_generate(void* signal) {
+    struct sig_dsp_VoiceBank* self = (struct sig_dsp_VoiceBank*) signal;
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    struct sig_dsp_VoiceBank_BlockSettings settings = {
+        .frequencyScale = FLOAT_ARRAY(self->inputs.frequencyScale)[0],
+        .cutoff = FLOAT_ARRAY(self->inputs.cutoff)[0],
+        .k = 4.0f * FLOAT_ARRAY(self->inputs.resonance)[0],
+        .sustain = sig_clamp(FLOAT_ARRAY(self->inputs.sustain)[0],
+            0.0f, 1.0f),
+        .attackCoefficient = sig_dsp_VoiceBank_envelopeCoefficient(
+            FLOAT_ARRAY(self->inputs.attack)[0], sampleRate,
+            sig_dsp_VoiceBank_LOG_ATTACK_RATIO),
+        .decayCoefficient = sig_dsp_VoiceBank_envelopeCoefficient(
+            FLOAT_ARRAY(self->inputs.decay)[0], sampleRate,
+            sig_dsp_VoiceBank_LOG_DECAY_RATIO),
+        .releaseCoefficient = sig_dsp_VoiceBank_envelopeCoefficient(
+            FLOAT_ARRAY(self->inputs.release)[0], sampleRate,
+            sig_dsp_VoiceBank_LOG_DECAY_RATIO)
+    };
+
+    sig_fillWithSilence(self->outputs.main,
+        self->signal.audioSettings->blockSize);
+
+    for (size_t first = 0; first < self->numVoices;
+        first += sig_dsp_VoiceBank_BATCH_SIZE) {
+        bool isBatchActive = false;
+        for (size_t lane = 0; lane < sig_dsp_VoiceBank_BATCH_SIZE; lane++) {
+            if (self->stages[first + lane] != sig_dsp_VoiceBank_Stage_IDLE) {
+                isBatchActive = true;
+            }
+        }
+
+        if (isBatchActive) {
+            sig_dsp_VoiceBank_renderBatch(self, first, &settings);
+        }
+    }
+}
+
+void sig_dsp_VoiceBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_VoiceBank* self) {
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
 
 struct sig_dsp_TiltEQ* sig_dsp_TiltEQ_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
@@ -3377,47 +7129,97 @@ void sig_dsp_TiltEQ_init(struct sig_dsp_TiltEQ* self,
     sig_dsp_Signal_init(self, context, *sig_dsp_TiltEQ_generate);
     self->sr3 = 3.0f * self->signal.audioSettings->sampleRate;
     self->lpOut = 0.0f;
+    self->previousFrequency = -1.0f;
+    self->previousGain = 0.0f;
+    sig_dsp_TiltEQ_calcCoefficients(self, 0.0f, 0.0f);
 
     sig_CONNECT_TO_SILENCE(self, source, context);
     sig_CONNECT_TO_SILENCE(self, frequency, context);
     sig_CONNECT_TO_SILENCE(self, gain, context);
 }
 
-void sig_dsp_TiltEQ_generate(void* signal) {
-    struct sig_dsp_TiltEQ* self = (struct sig_dsp_TiltEQ*) signal;
+inline void sig_dsp_TiltEQ_calcCoefficients(struct sig_dsp_TiltEQ* self,
+    float frequency, float gain) {
     float amp = 8.656170f; // 6.0f / log(2)
     float gfactor = 5.0f; // Proportional gain.
-    float sr3 = self->sr3;
-    float lpOut = self->lpOut;
+    float gainDB = gain * 6.0f;
+    float g1, g2;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float source = FLOAT_ARRAY(self->inputs.source)[i];
-        float f0 = FLOAT_ARRAY(self->inputs.frequency)[i];
-        float gain = FLOAT_ARRAY(self->inputs.gain)[i] * 6.0f; // Convert to dB.
-        float g1, g2;
+    if (gainDB > 0.0f) {
+        g1 = -gfactor * gainDB;
+        g2 = gainDB;
+    } else {
+        g1 = -gainDB;
+        g2 = gfactor * gainDB;
+    }
 
-        if (gain > 0.0f) {
-            g1 = -gfactor * gain;
-            g2 = gain;
-        } else {
-            g1 = -gain;
-            g2 = gfactor * gain;
-        }
+    self->lgain = expf(g1 / amp) - 1.0f;
+    self->hgain = expf(g2 / amp) - 1.0f;
 
-        float lgain = exp(g1 / amp) - 1.0f;
-        float hgain = exp(g2 / amp) - 1.0f;
+    float omega = 2.0f * sig_PI * frequency;
+    float n = 1.0f / (self->sr3 + omega);
+    self->a0 = 2.0f * omega * n;
+    self->b1 = (self->sr3 - omega) * n;
+}
 
-        float omega = 2.0f * sig_PI * f0;
-        float n = 1.0 / (sr3 + omega);
-        float a0 = 2.0 * omega * n;
-        float b1 = (sr3 - omega) * n;
+void sig_dsp_TiltEQ_generate(void* signal) {
+    struct sig_dsp_TiltEQ* self = (struct sig_dsp_TiltEQ*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float_array_ptr frequency = self->inputs.frequency;
+    float_array_ptr gain = self->inputs.gain;
+
+    enum sig_dsp_InputChange frequencyChange = sig_dsp_detectInputChange(
+        frequency, blockSize, self->previousFrequency);
+    enum sig_dsp_InputChange gainChange = sig_dsp_detectInputChange(
+        gain, blockSize, self->previousGain);
+    enum sig_dsp_InputChange change = frequencyChange > gainChange ?
+        frequencyChange : gainChange;
+
+    if (change == sig_dsp_InputChange_STEP) {
+        sig_dsp_TiltEQ_calcCoefficients(self, FLOAT_ARRAY(frequency)[0],
+            FLOAT_ARRAY(gain)[0]);
+    }
+
+    float lgain = self->lgain;
+    float hgain = self->hgain;
+    float a0 = self->a0;
+    float b1 = self->b1;
+    float lgainIncrement = 0.0f;
+    float hgainIncrement = 0.0f;
+    float a0Increment = 0.0f;
+    float b1Increment = 0.0f;
+
+    if (change == sig_dsp_InputChange_MODULATED) {
+        // Interpolate from the current coefficients to those
+        // for the frequency and gain at the end of the block.
+        sig_dsp_TiltEQ_calcCoefficients(self,
+            FLOAT_ARRAY(frequency)[blockSize - 1],
+            FLOAT_ARRAY(gain)[blockSize - 1]);
+        float blockSizeRecip = 1.0f / (float) blockSize;
+        lgainIncrement = (self->lgain - lgain) * blockSizeRecip;
+        hgainIncrement = (self->hgain - hgain) * blockSizeRecip;
+        a0Increment = (self->a0 - a0) * blockSizeRecip;
+        b1Increment = (self->b1 - b1) * blockSizeRecip;
+    }
+
+    self->previousFrequency = FLOAT_ARRAY(frequency)[blockSize - 1];
+    self->previousGain = FLOAT_ARRAY(gain)[blockSize - 1];
+
+    float lpOut = self->lpOut;
+    for (size_t i = 0; i < blockSize; i++) {
+        float source = FLOAT_ARRAY(self->inputs.source)[i];
+
+        lgain += lgainIncrement;
+        hgain += hgainIncrement;
+        a0 += a0Increment;
+        b1 += b1Increment;
 
         lpOut = a0 * source + b1 * lpOut;
         FLOAT_ARRAY(self->outputs.main)[i] = source + lgain * lpOut +
             hgain * (source - lpOut);
     }
 
-    self->lpOut = lpOut;
+    self->lpOut = sig_denormals_flush(lpOut);
 }
 
 void sig_dsp_TiltEQ_destroy(struct sig_Allocator* allocator,
@@ -3429,14 +7231,418 @@ void sig_dsp_TiltEQ_destroy(struct sig_Allocator* allocator,
 
 
 
+struct sig_dsp_Oversampler* sig_dsp_Oversampler_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t factor, size_t maxNumSignals) {
+    struct sig_dsp_Oversampler* self = sig_MALLOC(allocator,
+        struct sig_dsp_Oversampler);
+
+    // Unsupported factors are rounded up to the next power of two,
+    // up to the maximum number of stages.
+    self->numStages = 1;
+    while ((1u << self->numStages) < factor &&
+        self->numStages < sig_dsp_Oversampler_MAX_NUM_STAGES) {
+        self->numStages++;
+    }
+    self->factor = 1u << self->numStages;
+
+    self->audioSettings = sig_AudioSettings_new(allocator);
+    self->audioSettings->sampleRate = context->audioSettings->sampleRate *
+        (float) self->factor;
+    self->audioSettings->numChannels = context->audioSettings->numChannels;
+    self->audioSettings->blockSize = context->audioSettings->blockSize *
+        self->factor;
+    self->context = sig_SignalContext_newChild(allocator, context,
+        self->audioSettings);
+    self->signals = sig_List_new(allocator, maxNumSignals);
+
+    for (size_t i = 0; i < self->numStages; i++) {
+        // The first stage, between the base rate and twice the base rate,
+        // needs the sharpest filters.
+        size_t halfLength = i == 0 ? sig_filter_Halfband_SHARP_HALF_LENGTH :
+            sig_filter_Halfband_RELAXED_HALF_LENGTH;
+        self->upsamplers[i] = sig_filter_Halfband_new(allocator, halfLength);
+        self->downsamplers[i] = sig_filter_Halfband_new(allocator,
+            halfLength);
+    }
+
+    self->scratch[0] = sig_AudioBlock_newSilent(allocator,
+        self->audioSettings);
+    self->scratch[1] = sig_AudioBlock_newSilent(allocator,
+        self->audioSettings);
+    self->outputs.main = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    self->outputs.upsampled = sig_AudioBlock_newSilent(allocator,
+        self->audioSettings);
+
+    sig_dsp_Oversampler_init(self, context);
+
+    return self;
+}
+
+void sig_dsp_Oversampler_init(struct sig_dsp_Oversampler* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_Oversampler_generate);
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+    // The child output must be an oversampled block,
+    // so it is connected to the oversampled context's silence.
+    sig_CONNECT_TO_SILENCE(self, childOutput, self->context);
+}
+
+void sig_dsp_Oversampler_generate(void* signal) {
+    struct sig_dsp_Oversampler* self = (struct sig_dsp_Oversampler*) signal;
+    size_t length = self->signal.audioSettings->blockSize;
+    size_t lastStage = self->numStages - 1;
+
+    // Upsample the source one octave at a time, alternating between
+    // the scratch buffers and writing the last stage to the output.
+    float_array_ptr input = self->inputs.source;
+    for (size_t i = 0; i < self->numStages; i++) {
+        float_array_ptr output = i == lastStage ?
+            self->outputs.upsampled : self->scratch[i % 2];
+        sig_filter_Halfband_upsample(self->upsamplers[i], input, output,
+            length);
+        input = output;
+        length *= 2;
+    }
+
+    sig_dsp_evaluateSignals(self->signals);
+
+    // Downsample the child output, starting at the highest rate.
+    input = self->inputs.childOutput;
+    for (size_t i = 0; i < self->numStages; i++) {
+        size_t stage = lastStage - i;
+        float_array_ptr output = stage == 0 ?
+            self->outputs.main : self->scratch[i % 2];
+        length /= 2;
+        sig_filter_Halfband_downsample(self->downsamplers[stage], input,
+            output, length);
+        input = output;
+    }
+}
+
+float sig_dsp_Oversampler_latency(struct sig_dsp_Oversampler* self) {
+    float latency = 0.0f;
+    float rate = 2.0f;
+
+    // Each stage delays the signal once on the way up and once
+    // on the way down, measured in samples at the stage's higher rate.
+    for (size_t i = 0; i < self->numStages; i++) {
+        latency += (float) (sig_filter_Halfband_latency(self->upsamplers[i]) +
+            sig_filter_Halfband_latency(self->downsamplers[i])) / rate;
+        rate *= 2.0f;
+    }
+
+    return latency;
+}
+
+void sig_dsp_Oversampler_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Oversampler* self) {
+    for (size_t i = 0; i < self->numStages; i++) {
+        sig_filter_Halfband_destroy(allocator, self->upsamplers[i]);
+        sig_filter_Halfband_destroy(allocator, self->downsamplers[i]);
+    }
+
+    sig_AudioBlock_destroy(allocator, self->scratch[0]);
+    sig_AudioBlock_destroy(allocator, self->scratch[1]);
+    sig_AudioBlock_destroy(allocator, self->outputs.upsampled);
+    sig_AudioBlock_destroy(allocator, self->outputs.main);
+    sig_List_destroy(allocator, self->signals);
+    sig_SignalContext_destroy(allocator, self->context);
+    sig_AudioSettings_destroy(allocator, self->audioSettings);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+static void sig_dsp_Convolver_Segment_allocate(
+    struct sig_Allocator* allocator, struct sig_dsp_Convolver_Segment* self,
+    size_t partitionSize, size_t maxNumPartitions) {
+    size_t fftLength = partitionSize * 2;
+
+    self->partitionSize = partitionSize;
+    self->maxNumPartitions = maxNumPartitions;
+    self->numPartitions = 0;
+    self->delayLineIdx = 0;
+    self->fft = NULL;
+
+    if (maxNumPartitions == 0) {
+        self->irSpectra = NULL;
+        self->delayLine = NULL;
+        self->input = NULL;
+        self->accumulator = NULL;
+        self->output = NULL;
+        return;
+    }
+
+    self->fft = sig_FFT_new(allocator, fftLength);
+    self->irSpectra = sig_samples_new(allocator,
+        fftLength * maxNumPartitions);
+    self->delayLine = sig_samples_new(allocator,
+        fftLength * maxNumPartitions);
+    self->input = sig_samples_new(allocator, fftLength);
+    self->accumulator = sig_samples_new(allocator, fftLength);
+    self->output = sig_samples_new(allocator, partitionSize);
+
+    sig_fillWithSilence(self->delayLine, fftLength * maxNumPartitions);
+    sig_fillWithSilence(self->input, fftLength);
+    sig_fillWithSilence(self->output, partitionSize);
+}
+
+static void sig_dsp_Convolver_Segment_load(
+    struct sig_dsp_Convolver_Segment* self, float* ir, size_t irLength) {
+    size_t partitionSize = self->partitionSize;
+    size_t fftLength = partitionSize * 2;
+    size_t numPartitions = (irLength + partitionSize - 1) / partitionSize;
+
+    self->numPartitions = numPartitions < self->maxNumPartitions ?
+        numPartitions : self->maxNumPartitions;
+
+    for (size_t p = 0; p < self->numPartitions; p++) {
+        float* spectrum = FLOAT_ARRAY(self->irSpectra) + p * fftLength;
+        size_t offset = p * partitionSize;
+
+        // Each partition is zero-padded to the FFT's length,
+        // so that the circular convolution's wrapped samples
+        // fall in the discarded half of the output.
+        for (size_t i = 0; i < fftLength; i++) {
+            spectrum[i] = i < partitionSize && offset + i < irLength ?
+                ir[offset + i] : 0.0f;
+        }
+
+        sig_FFT_forward(self->fft, spectrum);
+    }
+}
+
+// Convolves the most recent two partitions of input
+// with the impulse response, writing one partition of output.
+static void sig_dsp_Convolver_Segment_process(
+    struct sig_dsp_Convolver_Segment* self) {
+    size_t partitionSize = self->partitionSize;
+    size_t fftLength = partitionSize * 2;
+    float* input = FLOAT_ARRAY(self->input);
+    float* accumulator = FLOAT_ARRAY(self->accumulator);
+    float* delayLine = FLOAT_ARRAY(self->delayLine);
+    float* irSpectra = FLOAT_ARRAY(self->irSpectra);
+    float* current = delayLine + self->delayLineIdx * fftLength;
+
+    for (size_t i = 0; i < fftLength; i++) {
+        current[i] = input[i];
+    }
+    sig_FFT_forward(self->fft, current);
+
+    // Slide the input along by a partition.
+    for (size_t i = 0; i < partitionSize; i++) {
+        input[i] = input[i + partitionSize];
+    }
+
+    // Each partition of the impulse response is multiplied
+    // by the spectrum of the input that is as many partitions old.
+    sig_fillWithSilence(accumulator, fftLength);
+    size_t delayLineIdx = self->delayLineIdx;
+    for (size_t p = 0; p < self->numPartitions; p++) {
+        sig_FFT_multiplyAccumulate(self->fft,
+            delayLine + delayLineIdx * fftLength,
+            irSpectra + p * fftLength, accumulator);
+        delayLineIdx = delayLineIdx == 0 ?
+            self->maxNumPartitions - 1 : delayLineIdx - 1;
+    }
+
+    self->delayLineIdx = self->delayLineIdx + 1 >= self->maxNumPartitions ?
+        0 : self->delayLineIdx + 1;
+
+    // Only the second half of the output is free
+    // of circular wrap-around.
+    sig_FFT_inverse(self->fft, accumulator);
+    float* output = FLOAT_ARRAY(self->output);
+    for (size_t i = 0; i < partitionSize; i++) {
+        output[i] = accumulator[partitionSize + i];
+    }
+}
+
+static void sig_dsp_Convolver_Segment_free(struct sig_Allocator* allocator,
+    struct sig_dsp_Convolver_Segment* self) {
+    if (self->fft == NULL) {
+        return;
+    }
+
+    sig_FFT_destroy(allocator, self->fft);
+    allocator->impl->free(allocator, self->irSpectra);
+    allocator->impl->free(allocator, self->delayLine);
+    allocator->impl->free(allocator, self->input);
+    allocator->impl->free(allocator, self->accumulator);
+    allocator->impl->free(allocator, self->output);
+}
+
+struct sig_dsp_Convolver* sig_dsp_Convolver_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t maxIRLength) {
+    struct sig_dsp_Convolver* self = sig_MALLOC(allocator,
+        struct sig_dsp_Convolver);
+    size_t blockSize = context->audioSettings->blockSize;
+
+    // Use the largest head partitions that evenly divide the block,
+    // so that each block completes a whole number of partitions.
+    size_t headSize = sig_dsp_Convolver_MIN_PARTITION_SIZE;
+    while (headSize * 2 <= sig_dsp_Convolver_MAX_HEAD_PARTITION_SIZE &&
+        blockSize % (headSize * 2) == 0) {
+        headSize *= 2;
+    }
+    size_t tailSize = headSize * sig_dsp_Convolver_TAIL_PARTITION_RATIO;
+
+    // The head must cover the first tail partition's worth of the
+    // impulse response, since the tail's output is calculated
+    // one tail partition after its input arrives.
+    size_t headLength = maxIRLength < tailSize ? maxIRLength : tailSize;
+    size_t tailLength = maxIRLength - headLength;
+
+    self->maxIRLength = maxIRLength;
+    self->latency = blockSize % headSize == 0 ? 0 : headSize;
+    sig_dsp_Convolver_Segment_allocate(allocator, &self->head, headSize,
+        (headLength + headSize - 1) / headSize);
+    sig_dsp_Convolver_Segment_allocate(allocator, &self->tail, tailSize,
+        (tailLength + tailSize - 1) / tailSize);
+
+    sig_dsp_Convolver_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_Convolver_init(struct sig_dsp_Convolver* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_Convolver_generate);
+
+    self->headFill = 0;
+    self->tailFill = 0;
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+}
+
+void sig_dsp_Convolver_loadIR(struct sig_dsp_Convolver* self,
+    struct sig_Buffer* ir) {
+    size_t irLength = ir->length < self->maxIRLength ?
+        ir->length : self->maxIRLength;
+    size_t headLength = self->head.maxNumPartitions *
+        self->head.partitionSize;
+    float* samples = FLOAT_ARRAY(ir->samples);
+
+    if (self->head.fft != NULL) {
+        sig_dsp_Convolver_Segment_load(&self->head, samples,
+            irLength < headLength ? irLength : headLength);
+    }
+
+    if (self->tail.fft != NULL) {
+        sig_dsp_Convolver_Segment_load(&self->tail, samples + headLength,
+            irLength > headLength ? irLength - headLength : 0);
+    }
+}
+
+// Processes a completed head partition of input.
+static void sig_dsp_Convolver_processPartition(
+    struct sig_dsp_Convolver* self) {
+    struct sig_dsp_Convolver_Segment* head = &self->head;
+    struct sig_dsp_Convolver_Segment* tail = &self->tail;
+    size_t headSize = head->partitionSize;
+
+    sig_dsp_Convolver_Segment_process(head);
+
+    if (tail->fft == NULL) {
+        return;
+    }
+
+    // Mix in the part of the tail's output that lines up
+    // with this partition, and then feed the tail with its input.
+    float* headOutput = FLOAT_ARRAY(head->output);
+    float* tailOutput = FLOAT_ARRAY(tail->output) + self->tailFill;
+    float* headInput = FLOAT_ARRAY(head->input);
+    float* tailInput = FLOAT_ARRAY(tail->input) + tail->partitionSize +
+        self->tailFill;
+    for (size_t i = 0; i < headSize; i++) {
+        headOutput[i] += tailOutput[i];
+        tailInput[i] = headInput[i];
+    }
+
+    self->tailFill += headSize;
+    if (self->tailFill >= tail->partitionSize) {
+        sig_dsp_Convolver_Segment_process(tail);
+        self->tailFill = 0;
+    }
+}
+
+void sig_dsp_Convolver_generate(void* signal) {
+    struct sig_dsp_Convolver* self = (struct sig_dsp_Convolver*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t headSize = self->head.partitionSize;
+    float* source = FLOAT_ARRAY(self->inputs.source);
+    float* output = FLOAT_ARRAY(self->outputs.main);
+
+    if (self->head.fft == NULL) {
+        sig_fillWithSilence(self->outputs.main, blockSize);
+        return;
+    }
+
+    float* headInput = FLOAT_ARRAY(self->head.input) + headSize;
+    float* headOutput = FLOAT_ARRAY(self->head.output);
+    size_t i = 0;
+    while (i < blockSize) {
+        size_t remaining = blockSize - i;
+        size_t numSamples = headSize - self->headFill;
+        if (numSamples > remaining) {
+            numSamples = remaining;
+        }
+
+        // When blocks don't line up with partitions, the output
+        // is read from the previous partition before it is replaced.
+        for (size_t j = 0; j < numSamples; j++) {
+            headInput[self->headFill + j] = source[i + j];
+            if (self->latency > 0) {
+                output[i + j] = headOutput[self->headFill + j];
+            }
+        }
+
+        self->headFill += numSamples;
+        if (self->headFill == headSize) {
+            self->headFill = 0;
+            sig_dsp_Convolver_processPartition(self);
+
+            if (self->latency == 0) {
+                for (size_t j = 0; j < numSamples; j++) {
+                    output[i + j] = headOutput[j];
+                }
+            }
+        }
+
+        i += numSamples;
+    }
+}
+
+void sig_dsp_Convolver_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Convolver* self) {
+    sig_dsp_Convolver_Segment_free(allocator, &self->head);
+    sig_dsp_Convolver_Segment_free(allocator, &self->tail);
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+
 struct sig_dsp_Delay* sig_dsp_Delay_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_Delay_newMultichannel(allocator, context, 1);
+}
+
+struct sig_dsp_Delay* sig_dsp_Delay_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
     struct sig_dsp_Delay* self = sig_MALLOC(allocator, struct sig_dsp_Delay);
     // TODO: Improve buffer management throughout Signaletic.
     self->delayLine = context->oneSampleDelayLine;
+    self->numChannels = sig_clampNumChannels(numChannels);
     sig_dsp_Delay_init(self, context);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+    self->outputs.main = sig_AudioBlock_newMultichannel(allocator,
+        context->audioSettings, self->numChannels);
 
     return self;
 }
@@ -3444,6 +7650,7 @@ struct sig_dsp_Delay* sig_dsp_Delay_new(
 void sig_dsp_Delay_init(struct sig_dsp_Delay* self,
     struct sig_SignalContext* context) {
     sig_dsp_Signal_init(self, context, *sig_dsp_Delay_generate);
+    self->numDelayTimeChannels = 1;
 
     sig_CONNECT_TO_SILENCE(self, source, context);
     sig_CONNECT_TO_SILENCE(self, delayTime, context);
@@ -3451,13 +7658,23 @@ void sig_dsp_Delay_init(struct sig_dsp_Delay* self,
 
 inline void sig_dsp_Delay_read(struct sig_dsp_Delay* self, float source,
     size_t i) {
-    float delayTime = FLOAT_ARRAY(self->inputs.delayTime)[i];
-
-    FLOAT_ARRAY(self->outputs.main)[i] = sig_DelayLine_cubicReadAtTime(
-        self->delayLine,
-        source,
-        delayTime,
-        self->signal.audioSettings->sampleRate);
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    size_t numDelayTimeChannels = self->numDelayTimeChannels;
+
+    // Each channel is a separate tap on the same delay line.
+    for (size_t c = 0; c < self->numChannels; c++) {
+        size_t delayTimeChannel = numDelayTimeChannels > 1 ?
+            c % numDelayTimeChannels : 0;
+        float delayTime = FLOAT_ARRAY(self->inputs.delayTime)[
+            delayTimeChannel * blockSize + i];
+
+        FLOAT_ARRAY(self->outputs.main)[c * blockSize + i] =
+            sig_DelayLine_cubicReadAtTime(
+                self->delayLine,
+                source,
+                delayTime,
+                self->signal.audioSettings->sampleRate);
+    }
 }
 
 void sig_dsp_Delay_generate(void* signal) {
@@ -3482,16 +7699,15 @@ void sig_dsp_Delay_destroy(struct sig_Allocator* allocator,
 
 struct sig_dsp_Delay* sig_dsp_DelayTap_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
-    // TODO: Copy-pasted from sig_dsp_Delay but we have a different
-    // initialization function we need to call here. Seems like it's time to
-    // decompose Signals into more function pointers!
-    struct sig_dsp_Delay* self = sig_MALLOC(allocator, struct sig_dsp_Delay);
-    // TODO: Improve buffer management throughout Signaletic.
-    self->delayLine = context->oneSampleDelayLine;
+    return sig_dsp_DelayTap_newMultichannel(allocator, context, 1);
+}
 
-    sig_dsp_Delay_init(self, context);
-    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
-        context->audioSettings, &self->outputs);
+struct sig_dsp_Delay* sig_dsp_DelayTap_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
+    struct sig_dsp_Delay* self = sig_dsp_Delay_newMultichannel(allocator,
+        context, numChannels);
+    sig_dsp_DelayTap_init(self, context);
 
     return self;
 }
@@ -3587,6 +7803,8 @@ void sig_dsp_Comb_init(struct sig_dsp_Comb* self,
 
 void sig_dsp_Comb_generate(void* signal) {
     struct sig_dsp_Comb* self = (struct sig_dsp_Comb*) signal;
+    float peak = 0.0f;
+    float maxReadPos = 0.0f;
 
     for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
         float maxDelayLength = (float) self->delayLine->buffer->length;
@@ -3599,89 +7817,668 @@ void sig_dsp_Comb_generate(void* signal) {
             readPos = maxDelayLength - 1;
         }
 
-        delayTime = sig_fmaxf(delayTime, 0.00001f); // Delay time can't be zero.
-        float read = sig_DelayLine_linearReadAt(self->delayLine, readPos);
-        float outputSample = sig_filter_smooth(read, self->previousSample,
-            lpfCoefficient);
-        float toWrite = sig_DelayLine_feedback(source, outputSample,
-            feedbackGain);
-        sig_DelayLine_write(self->delayLine, toWrite);
-        FLOAT_ARRAY(self->outputs.main)[i] = outputSample;
-        self->previousSample = outputSample;
+        delayTime = sig_fmaxf(delayTime, 0.00001f); // Delay time can't be zero.
+        float read = sig_DelayLine_linearReadAt(self->delayLine, readPos);
+        float outputSample = sig_filter_smooth(read, self->previousSample,
+            lpfCoefficient);
+        float toWrite = sig_DelayLine_feedback(source, outputSample,
+            feedbackGain);
+        sig_DelayLine_write(self->delayLine, toWrite);
+        FLOAT_ARRAY(self->outputs.main)[i] = outputSample;
+        self->previousSample = outputSample;
+        peak = sig_fmaxf(peak, fabsf(toWrite));
+        maxReadPos = sig_fmaxf(maxReadPos, readPos);
+    }
+
+    self->previousSample = sig_denormals_flush(self->previousSample);
+    sig_DelayLine_flushDenormals(self->delayLine, peak,
+        self->signal.audioSettings->blockSize, maxReadPos);
+}
+
+void sig_dsp_Comb_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Comb* self) {
+    // Don't destroy the delay line; it isn't owned.
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+
+// TODO: Resolve duplication with sig_dsp_Delay and Comb
+struct sig_dsp_Allpass* sig_dsp_Allpass_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    struct sig_dsp_Allpass* self = sig_MALLOC(allocator,
+        struct sig_dsp_Allpass);
+     // TODO: Improve buffer management throughout Signaletic.
+    self->delayLine = context->oneSampleDelayLine;
+
+    sig_dsp_Allpass_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_Allpass_init(struct sig_dsp_Allpass* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_Allpass_generate);
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+    sig_CONNECT_TO_SILENCE(self, delayTime, context);
+    sig_CONNECT_TO_SILENCE(self, g, context);
+}
+
+void sig_dsp_Allpass_generate(void* signal) {
+    struct sig_dsp_Allpass* self = (struct sig_dsp_Allpass*) signal;
+    float peak = 0.0f;
+    float maxReadPos = 0.0f;
+
+    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+        float maxDelayLength = (float) self->delayLine->buffer->length;
+        float source = FLOAT_ARRAY(self->inputs.source)[i];
+        float delayTime = FLOAT_ARRAY(self->inputs.delayTime)[i];
+        float g = FLOAT_ARRAY(self->inputs.g)[i];
+        float readPos = (delayTime * self->signal.audioSettings->sampleRate);
+        if (readPos >= maxDelayLength) {
+            readPos = maxDelayLength - 1;
+        }
+
+        if (delayTime <= 0.0f || g <= 0.0f) {
+            FLOAT_ARRAY(self->outputs.main)[i] = source;
+        } else {
+            // This is sig_DelayLine_linearAllpass(), expanded so that
+            // the peak of the written samples can be tracked.
+            float read = sig_DelayLine_linearReadAt(self->delayLine,
+                readPos);
+            float toWrite = sig_DelayLine_feedback(source, read, g);
+            sig_DelayLine_write(self->delayLine, toWrite);
+            FLOAT_ARRAY(self->outputs.main)[i] = read - (g * toWrite);
+            peak = sig_fmaxf(peak, fabsf(toWrite));
+            maxReadPos = sig_fmaxf(maxReadPos, readPos);
+        }
+    }
+
+    sig_DelayLine_flushDenormals(self->delayLine, peak,
+        self->signal.audioSettings->blockSize, maxReadPos);
+}
+
+void sig_dsp_Allpass_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Allpass* self) {
+    // Don't destroy the delay line; it isn't owned.
+    sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
+        &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+void sig_dsp_FDNReverb_Outputs_newAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_AudioSettings* audioSettings,
+    struct sig_dsp_FDNReverb_Outputs* outputs) {
+    outputs->left = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->right = sig_AudioBlock_newSilent(allocator, audioSettings);
+}
+
+void sig_dsp_FDNReverb_Outputs_destroyAudioBlocks(
+    struct sig_Allocator* allocator,
+    struct sig_dsp_FDNReverb_Outputs* outputs) {
+    sig_AudioBlock_destroy(allocator, outputs->left);
+    outputs->left = NULL;
+    sig_AudioBlock_destroy(allocator, outputs->right);
+    outputs->right = NULL;
+}
+
+static bool sig_dsp_FDNReverb_isPrime(size_t n) {
+    if (n < 2) {
+        return false;
+    }
+
+    for (size_t d = 2; d * d <= n; d++) {
+        if (n % d == 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+struct sig_dsp_FDNReverb* sig_dsp_FDNReverb_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numLines) {
+    struct sig_dsp_FDNReverb* self = sig_MALLOC(allocator,
+        struct sig_dsp_FDNReverb);
+    float sampleRate = context->audioSettings->sampleRate;
+    float timeRatio = sig_dsp_FDNReverb_MAX_DELAY_TIME /
+        sig_dsp_FDNReverb_MIN_DELAY_TIME;
+    size_t totalLength = 0;
+    size_t previousDelay = 0;
+
+    // The Hadamard matrix requires a power of two.
+    if (numLines < 6) {
+        numLines = 4;
+    } else if (numLines < 12) {
+        numLines = 8;
+    } else {
+        numLines = sig_dsp_FDNReverb_MAX_LINES;
+    }
+
+    self->numLines = numLines;
+
+    // Delays are spaced exponentially and rounded up to
+    // distinct prime numbers of samples, so that their
+    // echoes rarely coincide.
+    for (size_t j = 0; j < numLines; j++) {
+        float position = (float) j / (float) (numLines - 1);
+        size_t delay = (size_t) (sig_dsp_FDNReverb_MIN_DELAY_TIME *
+            powf(timeRatio, position) * sampleRate);
+        if (delay <= previousDelay) {
+            delay = previousDelay + 1;
+        }
+
+        while (!sig_dsp_FDNReverb_isPrime(delay)) {
+            delay++;
+        }
+
+        self->delays[j] = (float) delay;
+        self->lineOffsets[j] = totalLength;
+        self->lineLengths[j] = delay +
+            (size_t) sig_dsp_FDNReverb_MAX_MODULATION_DEPTH + 2;
+        totalLength += self->lineLengths[j];
+        previousDelay = delay;
+    }
+
+    self->delayMemory = sig_samples_new(allocator, totalLength);
+    sig_dsp_FDNReverb_init(self, context);
+    sig_dsp_FDNReverb_Outputs_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_FDNReverb_init(struct sig_dsp_FDNReverb* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_FDNReverb_generate);
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+    sig_CONNECT_TO_UNITY(self, decayTime, context);
+    sig_CONNECT_TO_SILENCE(self, damping, context);
+
+    self->parameters.matrix = sig_dsp_FDNReverb_Matrix_HADAMARD;
+    self->parameters.modulationDepth = 0.0f;
+    self->parameters.modulationRate = 0.5f;
+
+    size_t numLines = self->numLines;
+    size_t totalLength = self->lineOffsets[numLines - 1] +
+        self->lineLengths[numLines - 1];
+    float* memory = FLOAT_ARRAY(self->delayMemory);
+    for (size_t i = 0; i < totalLength; i++) {
+        memory[i] = 0.0f;
+    }
+
+    for (size_t j = 0; j < numLines; j++) {
+        // Stagger the modulators' phases so that
+        // the lines aren't modulated in unison.
+        float phase = sig_TWOPI * (float) j / (float) numLines;
+        self->writeIndices[j] = 0;
+        self->feedbackGains[j] = 0.0f;
+        self->dampingStates[j] = 0.0f;
+        self->modulatorCos[j] = cosf(phase);
+        self->modulatorSin[j] = sinf(phase);
+    }
+
+    // Ensure that coefficients are calculated on the first block.
+    self->previousDecayTime = -1.0f;
+    self->previousModulationRate = -1.0f;
+    self->modulationCosIncrement = 1.0f;
+    self->modulationSinIncrement = 0.0f;
+}
+
+static inline void sig_dsp_FDNReverb_hadamard(float* x, size_t numLines) {
+    for (size_t h = 1; h < numLines; h *= 2) {
+        for (size_t i = 0; i < numLines; i += h * 2) {
+            for (size_t j = i; j < i + h; j++) {
+                float a = x[j];
+                float b = x[j + h];
+                x[j] = a + b;
+                x[j + h] = a - b;
+            }
+        }
+    }
+
+    float scale = 1.0f / sqrtf((float) numLines);
+    for (size_t j = 0; j < numLines; j++) {
+        x[j] *= scale;
+    }
+}
+
+static inline void sig_dsp_FDNReverb_householder(float* x, size_t numLines) {
+    float sum = 0.0f;
+    for (size_t j = 0; j < numLines; j++) {
+        sum += x[j];
+    }
+
+    float reflection = sum * (2.0f / (float) numLines);
+    for (size_t j = 0; j < numLines; j++) {
+        x[j] -= reflection;
+    }
+}
+
+// Renders a block with a constant number of lines,
+// so that the per-line loops can be unrolled and vectorized.
+static inline void sig_dsp_FDNReverb_render(
+    struct sig_dsp_FDNReverb* self, size_t numLines) {
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    float* source = FLOAT_ARRAY(self->inputs.source);
+    float* left = FLOAT_ARRAY(self->outputs.left);
+    float* right = FLOAT_ARRAY(self->outputs.right);
+    float* memory = FLOAT_ARRAY(self->delayMemory);
+    float decayTime = sig_fmaxf(FLOAT_ARRAY(self->inputs.decayTime)[0],
+        0.001f);
+    float damping = sig_clamp(FLOAT_ARRAY(self->inputs.damping)[0],
+        0.0f, 0.99f);
+    float modulationDepth = sig_clamp(self->parameters.modulationDepth,
+        0.0f, sig_dsp_FDNReverb_MAX_MODULATION_DEPTH);
+    bool isHadamard =
+        self->parameters.matrix == sig_dsp_FDNReverb_Matrix_HADAMARD;
+    float outputScale = 1.0f / sqrtf((float) numLines);
+
+    if (decayTime != self->previousDecayTime) {
+        // Each line's gain is chosen so that the whole network
+        // decays by 60 dB (a factor of 1000) in the decay time.
+        for (size_t j = 0; j < numLines; j++) {
+            self->feedbackGains[j] = powf(0.001f,
+                self->delays[j] / (decayTime * sampleRate));
+        }
+        self->previousDecayTime = decayTime;
+    }
+
+    if (self->parameters.modulationRate != self->previousModulationRate) {
+        float angle = sig_TWOPI * self->parameters.modulationRate /
+            sampleRate;
+        self->modulationCosIncrement = cosf(angle);
+        self->modulationSinIncrement = sinf(angle);
+        self->previousModulationRate = self->parameters.modulationRate;
+    }
+
+    // Line state is copied into local arrays so that the compiler
+    // can vectorize the per-line loops without worrying about
+    // aliasing with the output blocks.
+    float gains[sig_dsp_FDNReverb_MAX_LINES];
+    float dampingStates[sig_dsp_FDNReverb_MAX_LINES];
+    float modCos[sig_dsp_FDNReverb_MAX_LINES];
+    float modSin[sig_dsp_FDNReverb_MAX_LINES];
+    float delays[sig_dsp_FDNReverb_MAX_LINES];
+    size_t offsets[sig_dsp_FDNReverb_MAX_LINES];
+    size_t lengths[sig_dsp_FDNReverb_MAX_LINES];
+    size_t writeIndices[sig_dsp_FDNReverb_MAX_LINES];
+    float cosInc = self->modulationCosIncrement;
+    float sinInc = self->modulationSinIncrement;
+
+    for (size_t j = 0; j < numLines; j++) {
+        gains[j] = self->feedbackGains[j];
+        dampingStates[j] = self->dampingStates[j];
+        modCos[j] = self->modulatorCos[j];
+        modSin[j] = self->modulatorSin[j];
+        delays[j] = self->delays[j];
+        offsets[j] = self->lineOffsets[j];
+        lengths[j] = self->lineLengths[j];
+        writeIndices[j] = self->writeIndices[j];
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float lines[sig_dsp_FDNReverb_MAX_LINES];
+        float leftSample = 0.0f;
+        float rightSample = 0.0f;
+
+        // Read each line at its modulated delay.
+        for (size_t j = 0; j < numLines; j++) {
+            float* line = memory + offsets[j];
+            float readPos = (float) writeIndices[j] -
+                (delays[j] + modulationDepth * modSin[j]);
+            if (readPos < 0.0f) {
+                readPos += (float) lengths[j];
+            }
+
+            size_t idx = (size_t) readPos;
+            float frac = readPos - (float) idx;
+            size_t nextIdx = idx + 1 >= lengths[j] ? 0 : idx + 1;
+            lines[j] = line[idx] + frac * (line[nextIdx] - line[idx]);
+        }
+
+        for (size_t j = 0; j < numLines; j++) {
+            float c = modCos[j];
+            float s = modSin[j];
+            modCos[j] = c * cosInc - s * sinInc;
+            modSin[j] = c * sinInc + s * cosInc;
+
+            dampingStates[j] = lines[j] +
+                damping * (dampingStates[j] - lines[j]);
+            lines[j] = dampingStates[j];
+        }
+
+        // Alternate the polarity of the lines in the right channel
+        // to decorrelate it from the left.
+        for (size_t j = 0; j < numLines; j += 2) {
+            leftSample += lines[j] + lines[j + 1];
+            rightSample += lines[j] - lines[j + 1];
+        }
+
+        for (size_t j = 0; j < numLines; j++) {
+            lines[j] *= gains[j];
+        }
+
+        if (isHadamard) {
+            sig_dsp_FDNReverb_hadamard(lines, numLines);
+        } else {
+            sig_dsp_FDNReverb_householder(lines, numLines);
+        }
+
+        for (size_t j = 0; j < numLines; j++) {
+            float inputSign = (j & 2) ? -outputScale : outputScale;
+            memory[offsets[j] + writeIndices[j]] = lines[j] +
+                source[i] * inputSign;
+            writeIndices[j]++;
+            if (writeIndices[j] >= lengths[j]) {
+                writeIndices[j] = 0;
+            }
+        }
+
+        left[i] = leftSample * outputScale;
+        right[i] = rightSample * outputScale;
+    }
+
+    for (size_t j = 0; j < numLines; j++) {
+        // Renormalize the modulators, which would otherwise
+        // gradually drift in amplitude.
+        float c = modCos[j];
+        float s = modSin[j];
+        float gain = 1.5f - 0.5f * (c * c + s * s);
+        self->modulatorCos[j] = c * gain;
+        self->modulatorSin[j] = s * gain;
+        self->dampingStates[j] = sig_denormals_flush(dampingStates[j]);
+        self->writeIndices[j] = writeIndices[j];
+    }
+}
+
+void sig_dsp_FDNReverb_generate(void* signal) {
+    struct sig_dsp_FDNReverb* self = (struct sig_dsp_FDNReverb*) signal;
+
+    if (self->numLines == 4) {
+        sig_dsp_FDNReverb_render(self, 4);
+    } else if (self->numLines == 8) {
+        sig_dsp_FDNReverb_render(self, 8);
+    } else {
+        sig_dsp_FDNReverb_render(self, sig_dsp_FDNReverb_MAX_LINES);
+    }
+}
+
+void sig_dsp_FDNReverb_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_FDNReverb* self) {
+    allocator->impl->free(allocator, self->delayMemory);
+    sig_dsp_FDNReverb_Outputs_destroyAudioBlocks(allocator, &self->outputs);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+// The default delay times of the CombBank and AllpassChain
+// match those used in the Moorer and 1962a reverb examples.
+static const float sig_dsp_CombBank_DEFAULT_DELAY_TIMES[] = {
+    0.05f, 0.056f, 0.061f, 0.068f, 0.072f, 0.078f, 0.083f, 0.089f
+};
+
+static const float sig_dsp_AllpassChain_DEFAULT_DELAY_TIMES[] = {
+    0.1f, 0.068f, 0.06f, 0.0197f, 0.00585f, 0.0047f, 0.0036f, 0.0017f
+};
+
+// Splits a delay time into a whole number of samples and a fraction,
+// clamped to the range that can be read from a line
+// of the specified length.
+static inline void sig_dsp_splitDelay(float delayTime, float sampleRate,
+    size_t lineLength, size_t* whole, float* frac) {
+    float delay = sig_clamp(delayTime * sampleRate, 1.0f,
+        (float) (lineLength - 2));
+    *whole = (size_t) delay;
+    *frac = delay - (float) *whole;
+}
+
+struct sig_dsp_CombBank* sig_dsp_CombBank_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numLines, float maxDelayTime) {
+    struct sig_dsp_CombBank* self = sig_MALLOC(allocator,
+        struct sig_dsp_CombBank);
+    self->numLines = numLines < 1 ? 1 :
+        numLines > sig_dsp_CombBank_MAX_LINES ?
+            sig_dsp_CombBank_MAX_LINES : numLines;
+    self->lineLength = (size_t) (maxDelayTime *
+        context->audioSettings->sampleRate) + 3;
+    self->delayMemory = sig_samples_new(allocator,
+        self->lineLength * self->numLines);
+    sig_dsp_CombBank_init(self, context);
+    sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
+        context->audioSettings, &self->outputs);
+
+    return self;
+}
+
+void sig_dsp_CombBank_init(struct sig_dsp_CombBank* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_CombBank_generate);
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+    sig_CONNECT_TO_UNITY(self, delayTimeScale, context);
+    sig_CONNECT_TO_UNITY(self, feedbackScale, context);
+
+    for (size_t j = 0; j < sig_dsp_CombBank_MAX_LINES; j++) {
+        self->parameters.delayTimes[j] =
+            sig_dsp_CombBank_DEFAULT_DELAY_TIMES[j];
+        self->parameters.feedbackGains[j] = 0.0f;
+        self->parameters.lpfCoefficients[j] = 0.0f;
+        self->previousSamples[j] = 0.0f;
+        self->numQuietSamples[j] = 0;
+    }
+
+    self->parameters.outputGain = 1.0f / (float) self->numLines;
+    self->writeIdx = 0;
+    sig_fillWithSilence(self->delayMemory,
+        self->lineLength * self->numLines);
+}
+
+void sig_dsp_CombBank_generate(void* signal) {
+    struct sig_dsp_CombBank* self = (struct sig_dsp_CombBank*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    float* source = FLOAT_ARRAY(self->inputs.source);
+    float* output = FLOAT_ARRAY(self->outputs.main);
+    float* memory = FLOAT_ARRAY(self->delayMemory);
+    size_t numLines = self->numLines;
+    size_t lineLength = self->lineLength;
+    float timeScale = FLOAT_ARRAY(self->inputs.delayTimeScale)[0];
+    float feedbackScale = FLOAT_ARRAY(self->inputs.feedbackScale)[0];
+    float outputGain = self->parameters.outputGain;
+
+    // Since every line is written at the same index,
+    // each line's read offset is fixed for the whole block.
+    // Line state is held in local arrays so that the compiler
+    // can keep it in registers.
+    size_t delays[sig_dsp_CombBank_MAX_LINES];
+    float fracs[sig_dsp_CombBank_MAX_LINES];
+    float gains[sig_dsp_CombBank_MAX_LINES];
+    float coefficients[sig_dsp_CombBank_MAX_LINES];
+    float previous[sig_dsp_CombBank_MAX_LINES];
+    float peaks[sig_dsp_CombBank_MAX_LINES];
+    size_t writeIdx = self->writeIdx;
+
+    for (size_t j = 0; j < numLines; j++) {
+        sig_dsp_splitDelay(self->parameters.delayTimes[j] * timeScale,
+            sampleRate, lineLength, &delays[j], &fracs[j]);
+        gains[j] = self->parameters.feedbackGains[j] * feedbackScale;
+        coefficients[j] = self->parameters.lpfCoefficients[j];
+        previous[j] = self->previousSamples[j];
+        peaks[j] = 0.0f;
+    }
+
+    for (size_t i = 0; i < blockSize; i++) {
+        float input = source[i];
+        float sum = 0.0f;
+
+        for (size_t j = 0; j < numLines; j++) {
+            float* line = memory + j * lineLength;
+            size_t readIdx = writeIdx >= delays[j] ?
+                writeIdx - delays[j] : writeIdx + lineLength - delays[j];
+            size_t olderIdx = readIdx == 0 ? lineLength - 1 : readIdx - 1;
+            float read = line[readIdx] + fracs[j] *
+                (line[olderIdx] - line[readIdx]);
+            float filtered = sig_filter_smooth(read, previous[j],
+                coefficients[j]);
+            float toWrite = sig_DelayLine_feedback(input, filtered,
+                gains[j]);
+            line[writeIdx] = toWrite;
+            previous[j] = filtered;
+            peaks[j] = sig_fmaxf(peaks[j], fabsf(toWrite));
+            sum += filtered;
+        }
+
+        output[i] = sum * outputGain;
+        writeIdx = writeIdx + 1 >= lineLength ? 0 : writeIdx + 1;
+    }
+
+    for (size_t j = 0; j < numLines; j++) {
+        self->previousSamples[j] = sig_denormals_flush(previous[j]);
+
+        if (sig_denormals_shouldFlushLine(&self->numQuietSamples[j],
+            peaks[j], blockSize, delays[j] + 2)) {
+            sig_fillWithSilence(memory + j * lineLength, lineLength);
+        }
     }
+
+    self->writeIdx = writeIdx;
 }
 
-void sig_dsp_Comb_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_Comb* self) {
-    // Don't destroy the delay line; it isn't owned.
+void sig_dsp_CombBank_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_CombBank* self) {
+    allocator->impl->free(allocator, self->delayMemory);
     sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
         &self->outputs);
     sig_dsp_Signal_destroy(allocator, self);
 }
 
 
-
-// TODO: Resolve duplication with sig_dsp_Delay and Comb
-struct sig_dsp_Allpass* sig_dsp_Allpass_new(
-    struct sig_Allocator* allocator, struct sig_SignalContext* context) {
-    struct sig_dsp_Allpass* self = sig_MALLOC(allocator,
-        struct sig_dsp_Allpass);
-     // TODO: Improve buffer management throughout Signaletic.
-    self->delayLine = context->oneSampleDelayLine;
-
-    sig_dsp_Allpass_init(self, context);
+struct sig_dsp_AllpassChain* sig_dsp_AllpassChain_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numStages, float maxDelayTime) {
+    struct sig_dsp_AllpassChain* self = sig_MALLOC(allocator,
+        struct sig_dsp_AllpassChain);
+    self->numStages = numStages < 1 ? 1 :
+        numStages > sig_dsp_AllpassChain_MAX_STAGES ?
+            sig_dsp_AllpassChain_MAX_STAGES : numStages;
+    self->lineLength = (size_t) (maxDelayTime *
+        context->audioSettings->sampleRate) + 3;
+    self->delayMemory = sig_samples_new(allocator,
+        self->lineLength * self->numStages);
+    sig_dsp_AllpassChain_init(self, context);
     sig_dsp_Signal_SingleMonoOutput_newAudioBlocks(allocator,
         context->audioSettings, &self->outputs);
 
     return self;
 }
 
-void sig_dsp_Allpass_init(struct sig_dsp_Allpass* self,
+void sig_dsp_AllpassChain_init(struct sig_dsp_AllpassChain* self,
     struct sig_SignalContext* context) {
-    sig_dsp_Signal_init(self, context, *sig_dsp_Allpass_generate);
+    sig_dsp_Signal_init(self, context, *sig_dsp_AllpassChain_generate);
 
     sig_CONNECT_TO_SILENCE(self, source, context);
-    sig_CONNECT_TO_SILENCE(self, delayTime, context);
-    sig_CONNECT_TO_SILENCE(self, g, context);
+    sig_CONNECT_TO_UNITY(self, delayTimeScale, context);
+
+    for (size_t j = 0; j < sig_dsp_AllpassChain_MAX_STAGES; j++) {
+        self->parameters.delayTimes[j] =
+            sig_dsp_AllpassChain_DEFAULT_DELAY_TIMES[j];
+        self->parameters.gains[j] = 0.7f;
+        self->numQuietSamples[j] = 0;
+    }
+
+    self->writeIdx = 0;
+    sig_fillWithSilence(self->delayMemory,
+        self->lineLength * self->numStages);
 }
 
-void sig_dsp_Allpass_generate(void* signal) {
-    struct sig_dsp_Allpass* self = (struct sig_dsp_Allpass*) signal;
+void sig_dsp_AllpassChain_generate(void* signal) {
+    struct sig_dsp_AllpassChain* self = (struct sig_dsp_AllpassChain*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float sampleRate = self->signal.audioSettings->sampleRate;
+    float* output = FLOAT_ARRAY(self->outputs.main);
+    float* memory = FLOAT_ARRAY(self->delayMemory);
+    size_t lineLength = self->lineLength;
+    float timeScale = FLOAT_ARRAY(self->inputs.delayTimeScale)[0];
+    float* input = FLOAT_ARRAY(self->inputs.source);
+
+    // Each stage is processed for the whole block before the next,
+    // reading from the previous stage's output in place.
+    for (size_t s = 0; s < self->numStages; s++) {
+        float delayTime = self->parameters.delayTimes[s] * timeScale;
+        float g = self->parameters.gains[s];
+
+        // Like sig_dsp_Allpass, stages with no delay or gain are bypassed.
+        if (delayTime <= 0.0f || g <= 0.0f) {
+            continue;
+        }
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
-        float maxDelayLength = (float) self->delayLine->buffer->length;
-        float source = FLOAT_ARRAY(self->inputs.source)[i];
-        float delayTime = FLOAT_ARRAY(self->inputs.delayTime)[i];
-        float g = FLOAT_ARRAY(self->inputs.g)[i];
-        float readPos = (delayTime * self->signal.audioSettings->sampleRate);
-        if (readPos >= maxDelayLength) {
-            readPos = maxDelayLength - 1;
+        float* line = memory + s * lineLength;
+        size_t delay;
+        float frac;
+        size_t writeIdx = self->writeIdx;
+        float peak = 0.0f;
+        sig_dsp_splitDelay(delayTime, sampleRate, lineLength, &delay, &frac);
+
+        for (size_t i = 0; i < blockSize; i++) {
+            size_t readIdx = writeIdx >= delay ?
+                writeIdx - delay : writeIdx + lineLength - delay;
+            size_t olderIdx = readIdx == 0 ? lineLength - 1 : readIdx - 1;
+            float read = line[readIdx] + frac *
+                (line[olderIdx] - line[readIdx]);
+            float toWrite = input[i] + g * read;
+            line[writeIdx] = toWrite;
+            output[i] = read - g * toWrite;
+            peak = sig_fmaxf(peak, fabsf(toWrite));
+            writeIdx = writeIdx + 1 >= lineLength ? 0 : writeIdx + 1;
         }
 
-        if (delayTime <= 0.0f || g <= 0.0f) {
-            FLOAT_ARRAY(self->outputs.main)[i] = source;
-        } else {
-            FLOAT_ARRAY(self->outputs.main)[i] = sig_DelayLine_linearAllpass(
-                self->delayLine, source, readPos, g);
+        if (sig_denormals_shouldFlushLine(&self->numQuietSamples[s],
+            peak, blockSize, delay + 2)) {
+            sig_fillWithSilence(line, lineLength);
+        }
+
+        input = output;
+    }
+
+    // If every stage was bypassed, the source passes through unchanged.
+    if (input != output) {
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = input[i];
         }
     }
+
+    self->writeIdx = (self->writeIdx + blockSize) % lineLength;
 }
 
-void sig_dsp_Allpass_destroy(struct sig_Allocator* allocator,
-    struct sig_dsp_Allpass* self) {
-    // Don't destroy the delay line; it isn't owned.
+void sig_dsp_AllpassChain_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_AllpassChain* self) {
+    allocator->impl->free(allocator, self->delayMemory);
     sig_dsp_Signal_SingleMonoOutput_destroyAudioBlocks(allocator,
         &self->outputs);
     sig_dsp_Signal_destroy(allocator, self);
 }
 
-
 void sig_dsp_Chorus_Outputs_newAudioBlocks(
     struct sig_Allocator* allocator,
     struct sig_AudioSettings* audioSettings,
+    size_t numChannels,
     struct sig_dsp_Chorus_Outputs* outputs) {
-    outputs->main = sig_AudioBlock_newSilent(allocator, audioSettings);
-    outputs->modulator = sig_AudioBlock_newSilent(allocator, audioSettings);
+    outputs->main = sig_AudioBlock_newMultichannel(allocator, audioSettings,
+        numChannels);
+    outputs->modulator = sig_AudioBlock_newMultichannel(allocator,
+        audioSettings, numChannels);
 }
 
 void sig_dsp_Chorus_Outputs_destroyAudioBlocks(
@@ -3693,14 +8490,21 @@ void sig_dsp_Chorus_Outputs_destroyAudioBlocks(
 
 struct sig_dsp_Chorus* sig_dsp_Chorus_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+    return sig_dsp_Chorus_newMultichannel(allocator, context, 1);
+}
+
+struct sig_dsp_Chorus* sig_dsp_Chorus_newMultichannel(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numChannels) {
     struct sig_dsp_Chorus* self = sig_MALLOC(allocator,
         struct sig_dsp_Chorus);
      // TODO: Improve buffer management throughout Signaletic.
     self->delayLine = context->oneSampleDelayLine;
+    self->numChannels = sig_clampNumChannels(numChannels);
 
     sig_dsp_Chorus_init(self, context);
     sig_dsp_Chorus_Outputs_newAudioBlocks(allocator, context->audioSettings,
-        &self->outputs);
+        self->numChannels, &self->outputs);
 
     return self;
 }
@@ -3709,11 +8513,20 @@ void sig_dsp_Chorus_init(struct sig_dsp_Chorus* self,
     struct sig_SignalContext* context) {
     sig_dsp_Signal_init(self, context, *sig_dsp_Chorus_generate);
 
-    sig_osc_FastLFSine_init(&self->modulator,
-        self->signal.audioSettings->sampleRate);
+    for (size_t c = 0; c < self->numChannels; c++) {
+        struct sig_osc_FastLFSine* modulator = &self->modulators[c];
+        sig_osc_FastLFSine_init(modulator,
+            self->signal.audioSettings->sampleRate);
+
+        // Spread the LFOs' starting phases evenly across a cycle.
+        float phase = sig_TWOPI * (float) c / (float) self->numChannels;
+        modulator->sinZ = sinf(phase);
+        modulator->cosZ = cosf(phase);
+
+        self->previousModulatedOutputs[c] = 0.0f;
+    }
 
     self->previousFixedOutput = 0.0f;
-    self->previousModulatedOutput = 0.0f;
 
     sig_CONNECT_TO_SILENCE(self, source, context);
     sig_CONNECT_TO_SILENCE(self, delayTime, context);
@@ -3726,8 +8539,10 @@ void sig_dsp_Chorus_init(struct sig_dsp_Chorus* self,
 
 void sig_dsp_Chorus_generate(void* signal) {
     struct sig_dsp_Chorus* self = (struct sig_dsp_Chorus*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float sampleRate = self->signal.audioSettings->sampleRate;
 
-    for (size_t i = 0; i < self->signal.audioSettings->blockSize; i++) {
+    for (size_t i = 0; i < blockSize; i++) {
         float source = FLOAT_ARRAY(self->inputs.source)[i];
         float delayTime = FLOAT_ARRAY(self->inputs.delayTime)[i];
         float speed = FLOAT_ARRAY(self->inputs.speed)[i];
@@ -3736,32 +8551,39 @@ void sig_dsp_Chorus_generate(void* signal) {
         float feedforwardGain = FLOAT_ARRAY(self->inputs.feedforwardGain)[i];
         float blend = FLOAT_ARRAY(self->inputs.blend)[i];
 
-        sig_osc_FastLFSine_setFrequencyFast(&self->modulator, speed);
-        sig_osc_FastLFSine_generate(&self->modulator);
-        FLOAT_ARRAY(self->outputs.modulator)[i] = self->modulator.sinZ;
-
         // TODO: Add one pole low pass filters in both the feedback and
         // feedforward lines to support echo.
 
+        // The fixed tap and the feedback into the delay line
+        // are shared by every channel.
         float fixedRead = sig_DelayLine_allpassReadAtTime(self->delayLine,
-            source, delayTime, self->signal.audioSettings->sampleRate,
-            self->previousFixedOutput);
+            source, delayTime, sampleRate, self->previousFixedOutput);
         self->previousFixedOutput = fixedRead;
         float toWrite = source - (fixedRead * feedbackGain);
         sig_DelayLine_write(self->delayLine, toWrite);
 
-        float modulatedDelayTime = self->modulator.sinZ * width + delayTime;
-        float modulatedRead = sig_DelayLine_allpassReadAtTime(self->delayLine,
-            source, modulatedDelayTime, self->signal.audioSettings->sampleRate,
-            self->previousModulatedOutput);
-        self->previousModulatedOutput = modulatedRead;
-        float feedforwardSample = modulatedRead * feedforwardGain;
-        float output = (toWrite * blend) + feedforwardSample;
-
-        // TODO: What kind of gain staging should we do here?
-        // It seems likely that we can have up to 3x gain depending on
-        // the values of feedbackGain, feedforwardGain, and blend.
-        FLOAT_ARRAY(self->outputs.main)[i] = sig_fastTanhf(output / 3.0f);
+        // Each channel is a separately modulated tap.
+        for (size_t c = 0; c < self->numChannels; c++) {
+            struct sig_osc_FastLFSine* modulator = &self->modulators[c];
+            sig_osc_FastLFSine_setFrequencyFast(modulator, speed);
+            sig_osc_FastLFSine_generate(modulator);
+            FLOAT_ARRAY(self->outputs.modulator)[c * blockSize + i] =
+                modulator->sinZ;
+
+            float modulatedDelayTime = modulator->sinZ * width + delayTime;
+            float modulatedRead = sig_DelayLine_allpassReadAtTime(
+                self->delayLine, source, modulatedDelayTime, sampleRate,
+                self->previousModulatedOutputs[c]);
+            self->previousModulatedOutputs[c] = modulatedRead;
+            float feedforwardSample = modulatedRead * feedforwardGain;
+            float output = (toWrite * blend) + feedforwardSample;
+
+            // TODO: What kind of gain staging should we do here?
+            // It seems likely that we can have up to 3x gain depending on
+            // the values of feedbackGain, feedforwardGain, and blend.
+            FLOAT_ARRAY(self->outputs.main)[c * blockSize + i] =
+                sig_fastTanhf(output / 3.0f);
+        }
     }
 }
 
@@ -3813,6 +8635,480 @@ void sig_dsp_LinearXFade_destroy(struct sig_Allocator* allocator,
 }
 
 
+static inline struct sig_dsp_Mixer* sig_dsp_Mixer_newWithChannels(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numInputs, bool isStereo) {
+    struct sig_dsp_Mixer* self = sig_MALLOC(allocator, struct sig_dsp_Mixer);
+    self->numInputs = numInputs < 1 ? 1 :
+        numInputs > sig_dsp_Mixer_MAX_INPUTS ?
+            sig_dsp_Mixer_MAX_INPUTS : numInputs;
+    self->isStereo = isStereo;
+    sig_dsp_Mixer_init(self, context);
+
+    // Every output is allocated, so that connecting to the outputs
+    // that this Mixer doesn't write to reads silence rather than NULL.
+    self->outputs.main = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    self->outputs.left = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+    self->outputs.right = sig_AudioBlock_newSilent(allocator,
+        context->audioSettings);
+
+    return self;
+}
+
+struct sig_dsp_Mixer* sig_dsp_Mixer_new(struct sig_Allocator* allocator,
+    struct sig_SignalContext* context, size_t numInputs) {
+    return sig_dsp_Mixer_newWithChannels(allocator, context,
+        numInputs, false);
+}
+
+struct sig_dsp_Mixer* sig_dsp_Mixer_newStereo(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numInputs) {
+    return sig_dsp_Mixer_newWithChannels(allocator, context,
+        numInputs, true);
+}
+
+void sig_dsp_Mixer_init(struct sig_dsp_Mixer* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_Mixer_generate);
+
+    for (size_t j = 0; j < sig_dsp_Mixer_MAX_INPUTS; j++) {
+        sig_CONNECT_TO_SILENCE(self, sources[j], context);
+        self->parameters.gains[j] = 1.0f;
+        self->parameters.pans[j] = 0.0f;
+        self->previousPans[j] = 0.0f;
+        self->leftPanGains[j] = self->rightPanGains[j] = cosf(0.25f * sig_PI);
+    }
+
+    self->parameters.masterGain = 1.0f;
+}
+
+// Sets the output to the sum of an offset and each source
+// scaled by its gain. Up to four sources are summed in each pass
+// over the output, and the first pass overwrites it, which avoids
+// storing and then immediately reloading each of its samples
+// for every source.
+static inline void sig_dsp_sumScaled(float* output, float** sources,
+    float* gains, size_t numSources, float offset, size_t blockSize) {
+    size_t numFirst = numSources % 4;
+    if (numFirst == 0 && numSources > 0) {
+        numFirst = 4;
+    }
+
+    if (numFirst == 0) {
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = offset;
+        }
+    } else if (numFirst == 1) {
+        float* a = sources[0];
+        float aGain = gains[0];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = offset + a[i] * aGain;
+        }
+    } else if (numFirst == 2) {
+        float* a = sources[0];
+        float* b = sources[1];
+        float aGain = gains[0];
+        float bGain = gains[1];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = offset + a[i] * aGain + b[i] * bGain;
+        }
+    } else if (numFirst == 3) {
+        float* a = sources[0];
+        float* b = sources[1];
+        float* c = sources[2];
+        float aGain = gains[0];
+        float bGain = gains[1];
+        float cGain = gains[2];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = offset + a[i] * aGain + b[i] * bGain +
+                c[i] * cGain;
+        }
+    } else {
+        float* a = sources[0];
+        float* b = sources[1];
+        float* c = sources[2];
+        float* d = sources[3];
+        float aGain = gains[0];
+        float bGain = gains[1];
+        float cGain = gains[2];
+        float dGain = gains[3];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] = offset + a[i] * aGain + b[i] * bGain +
+                c[i] * cGain + d[i] * dGain;
+        }
+    }
+
+    for (size_t j = numFirst; j < numSources; j += 4) {
+        float* a = sources[j];
+        float* b = sources[j + 1];
+        float* c = sources[j + 2];
+        float* d = sources[j + 3];
+        float aGain = gains[j];
+        float bGain = gains[j + 1];
+        float cGain = gains[j + 2];
+        float dGain = gains[j + 3];
+
+        for (size_t i = 0; i < blockSize; i++) {
+            output[i] += a[i] * aGain + b[i] * bGain +
+                c[i] * cGain + d[i] * dGain;
+        }
+    }
+}
+
+// Scales each input by its gain and accumulates it into the output,
+// skipping inputs whose gain is zero.
+static inline void sig_dsp_Mixer_mix(struct sig_dsp_Mixer* self,
+    float* output, float* gains) {
+    float* sources[sig_dsp_Mixer_MAX_INPUTS];
+    float activeGains[sig_dsp_Mixer_MAX_INPUTS];
+    size_t numActive = 0;
+
+    for (size_t j = 0; j < self->numInputs; j++) {
+        if (gains[j] != 0.0f) {
+            sources[numActive] = FLOAT_ARRAY(self->inputs.sources[j]);
+            activeGains[numActive] = gains[j];
+            numActive++;
+        }
+    }
+
+    sig_dsp_sumScaled(output, sources, activeGains, numActive, 0.0f,
+        self->signal.audioSettings->blockSize);
+}
+
+// Recalculates the equal-power pan gains of any input
+// whose pan has changed since the previous block.
+static inline void sig_dsp_Mixer_updatePanGains(struct sig_dsp_Mixer* self) {
+    for (size_t j = 0; j < self->numInputs; j++) {
+        float pan = self->parameters.pans[j];
+        if (pan == self->previousPans[j]) {
+            continue;
+        }
+
+        if (pan <= -1.0f) {
+            self->leftPanGains[j] = 1.0f;
+            self->rightPanGains[j] = 0.0f;
+        } else if (pan >= 1.0f) {
+            self->leftPanGains[j] = 0.0f;
+            self->rightPanGains[j] = 1.0f;
+        } else {
+            float angle = (pan + 1.0f) * 0.25f * sig_PI;
+            self->leftPanGains[j] = cosf(angle);
+            self->rightPanGains[j] = sinf(angle);
+        }
+
+        self->previousPans[j] = pan;
+    }
+}
+
+void sig_dsp_Mixer_generate(void* signal) {
+    struct sig_dsp_Mixer* self = (struct sig_dsp_Mixer*) signal;
+    float masterGain = self->parameters.masterGain;
+    float gains[sig_dsp_Mixer_MAX_INPUTS];
+
+    if (!self->isStereo) {
+        for (size_t j = 0; j < self->numInputs; j++) {
+            gains[j] = self->parameters.gains[j] * masterGain;
+        }
+
+        sig_dsp_Mixer_mix(self, FLOAT_ARRAY(self->outputs.main), gains);
+        return;
+    }
+
+    sig_dsp_Mixer_updatePanGains(self);
+
+    for (size_t j = 0; j < self->numInputs; j++) {
+        gains[j] = self->parameters.gains[j] * masterGain *
+            self->leftPanGains[j];
+    }
+    sig_dsp_Mixer_mix(self, FLOAT_ARRAY(self->outputs.left), gains);
+
+    for (size_t j = 0; j < self->numInputs; j++) {
+        gains[j] = self->parameters.gains[j] * masterGain *
+            self->rightPanGains[j];
+    }
+    sig_dsp_Mixer_mix(self, FLOAT_ARRAY(self->outputs.right), gains);
+}
+
+void sig_dsp_Mixer_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Mixer* self) {
+    sig_AudioBlock_destroy(allocator, self->outputs.main);
+    sig_AudioBlock_destroy(allocator, self->outputs.left);
+    sig_AudioBlock_destroy(allocator, self->outputs.right);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+struct sig_dsp_ModMatrix* sig_dsp_ModMatrix_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t numSources, size_t numDestinations) {
+    struct sig_dsp_ModMatrix* self = sig_MALLOC(allocator,
+        struct sig_dsp_ModMatrix);
+    self->numSources = numSources < 1 ? 1 :
+        numSources > sig_dsp_ModMatrix_MAX_SOURCES ?
+            sig_dsp_ModMatrix_MAX_SOURCES : numSources;
+    self->numDestinations = numDestinations < 1 ? 1 :
+        numDestinations > sig_dsp_ModMatrix_MAX_DESTINATIONS ?
+            sig_dsp_ModMatrix_MAX_DESTINATIONS : numDestinations;
+    sig_dsp_ModMatrix_init(self, context);
+
+    for (size_t d = 0; d < sig_dsp_ModMatrix_MAX_DESTINATIONS; d++) {
+        self->outputs.destinations[d] = d < self->numDestinations ?
+            sig_AudioBlock_newSilent(allocator, context->audioSettings) :
+            NULL;
+    }
+
+    return self;
+}
+
+void sig_dsp_ModMatrix_init(struct sig_dsp_ModMatrix* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_ModMatrix_generate);
+
+    for (size_t s = 0; s < sig_dsp_ModMatrix_MAX_SOURCES; s++) {
+        sig_CONNECT_TO_SILENCE(self, sources[s], context);
+
+        for (size_t d = 0; d < sig_dsp_ModMatrix_MAX_DESTINATIONS; d++) {
+            self->depths[s][d] = 0.0f;
+            atomic_init(&self->pendingDepths[s][d], 0.0f);
+        }
+    }
+
+    for (size_t d = 0; d < sig_dsp_ModMatrix_MAX_DESTINATIONS; d++) {
+        self->parameters.offsets[d] = 0.0f;
+        self->numRoutes[d] = 0;
+    }
+
+    atomic_init(&self->pendingVersion, 0);
+    self->appliedVersion = 0;
+}
+
+// Marks the pending depths as being written, and returns the version
+// to publish once they have been. The fence keeps the depth stores
+// from being reordered before the odd version is visible.
+static inline uint32_t sig_dsp_ModMatrix_beginWrite(
+    struct sig_dsp_ModMatrix* self) {
+    uint32_t version = atomic_load_explicit(&self->pendingVersion,
+        memory_order_relaxed);
+    atomic_store_explicit(&self->pendingVersion, version + 1,
+        memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    return version + 2;
+}
+
+static inline void sig_dsp_ModMatrix_endWrite(
+    struct sig_dsp_ModMatrix* self, uint32_t version) {
+    atomic_store_explicit(&self->pendingVersion, version,
+        memory_order_release);
+}
+
+void sig_dsp_ModMatrix_setDepth(struct sig_dsp_ModMatrix* self,
+    size_t source, size_t destination, float depth) {
+    if (source >= self->numSources ||
+        destination >= self->numDestinations) {
+        return;
+    }
+
+    uint32_t version = sig_dsp_ModMatrix_beginWrite(self);
+    atomic_store_explicit(&self->pendingDepths[source][destination], depth,
+        memory_order_relaxed);
+    sig_dsp_ModMatrix_endWrite(self, version);
+}
+
+void sig_dsp_ModMatrix_setDepths(struct sig_dsp_ModMatrix* self,
+    const float* depths) {
+    uint32_t version = sig_dsp_ModMatrix_beginWrite(self);
+    for (size_t s = 0; s < self->numSources; s++) {
+        for (size_t d = 0; d < self->numDestinations; d++) {
+            atomic_store_explicit(&self->pendingDepths[s][d],
+                depths[s * self->numDestinations + d],
+                memory_order_relaxed);
+        }
+    }
+    sig_dsp_ModMatrix_endWrite(self, version);
+}
+
+// Copies the pending depths into the matrix if they have changed
+// and aren't being written, and then rebuilds the list of routes.
+static inline void sig_dsp_ModMatrix_applyPendingDepths(
+    struct sig_dsp_ModMatrix* self) {
+    uint32_t version = atomic_load_explicit(&self->pendingVersion,
+        memory_order_acquire);
+    if (version == self->appliedVersion || (version & 1) != 0) {
+        return;
+    }
+
+    float depths[sig_dsp_ModMatrix_MAX_SOURCES]
+        [sig_dsp_ModMatrix_MAX_DESTINATIONS];
+    for (size_t s = 0; s < self->numSources; s++) {
+        for (size_t d = 0; d < self->numDestinations; d++) {
+            depths[s][d] = atomic_load_explicit(&self->pendingDepths[s][d],
+                memory_order_relaxed);
+        }
+    }
+
+    // The fence keeps the depth loads from being reordered
+    // after the version is checked again. If the depths were changed
+    // while they were being copied, try again in the next block.
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&self->pendingVersion,
+        memory_order_relaxed) != version) {
+        return;
+    }
+
+    for (size_t d = 0; d < self->numDestinations; d++) {
+        size_t numRoutes = 0;
+
+        for (size_t s = 0; s < self->numSources; s++) {
+            self->depths[s][d] = depths[s][d];
+
+            if (depths[s][d] != 0.0f) {
+                self->routeSources[d][numRoutes] = s;
+                self->routeDepths[d][numRoutes] = depths[s][d];
+                numRoutes++;
+            }
+        }
+
+        self->numRoutes[d] = numRoutes;
+    }
+
+    self->appliedVersion = version;
+}
+
+void sig_dsp_ModMatrix_generate(void* signal) {
+    struct sig_dsp_ModMatrix* self = (struct sig_dsp_ModMatrix*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float* sources[sig_dsp_ModMatrix_MAX_SOURCES];
+
+    sig_dsp_ModMatrix_applyPendingDepths(self);
+
+    for (size_t d = 0; d < self->numDestinations; d++) {
+        size_t numRoutes = self->numRoutes[d];
+        for (size_t r = 0; r < numRoutes; r++) {
+            sources[r] = FLOAT_ARRAY(
+                self->inputs.sources[self->routeSources[d][r]]);
+        }
+
+        sig_dsp_sumScaled(FLOAT_ARRAY(self->outputs.destinations[d]),
+            sources, self->routeDepths[d], numRoutes,
+            self->parameters.offsets[d], blockSize);
+    }
+}
+
+void sig_dsp_ModMatrix_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_ModMatrix* self) {
+    for (size_t d = 0; d < self->numDestinations; d++) {
+        sig_AudioBlock_destroy(allocator, self->outputs.destinations[d]);
+    }
+
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
+struct sig_dsp_Telemetry* sig_dsp_Telemetry_new(
+    struct sig_Allocator* allocator, struct sig_SignalContext* context,
+    size_t capacity) {
+    struct sig_dsp_Telemetry* self = sig_MALLOC(allocator,
+        struct sig_dsp_Telemetry);
+    sig_dsp_Telemetry_init(self, context);
+    self->outputs.main = sig_RingBuffer_new(allocator, capacity,
+        sizeof(float));
+
+    return self;
+}
+
+static inline void sig_dsp_Telemetry_resetWindow(
+    struct sig_dsp_Telemetry* self) {
+    self->numBlocks = 0;
+    self->peak = 0.0f;
+    self->sumOfSquares = 0.0f;
+}
+
+void sig_dsp_Telemetry_init(struct sig_dsp_Telemetry* self,
+    struct sig_SignalContext* context) {
+    sig_dsp_Signal_init(self, context, *sig_dsp_Telemetry_generate);
+    self->parameters.mode = sig_dsp_Telemetry_Mode_PEAK;
+    self->parameters.blocksPerReport = 1.0f;
+    self->last = 0.0f;
+    sig_dsp_Telemetry_resetWindow(self);
+
+    sig_CONNECT_TO_SILENCE(self, source, context);
+}
+
+void sig_dsp_Telemetry_generate(void* signal) {
+    struct sig_dsp_Telemetry* self = (struct sig_dsp_Telemetry*) signal;
+    size_t blockSize = self->signal.audioSettings->blockSize;
+    float* source = FLOAT_ARRAY(self->inputs.source);
+    enum sig_dsp_Telemetry_Mode mode = self->parameters.mode;
+
+    // Only the statistic that will be reported is accumulated.
+    if (mode == sig_dsp_Telemetry_Mode_PEAK) {
+        float peak = self->peak;
+        for (size_t i = 0; i < blockSize; i++) {
+            float magnitude = fabsf(source[i]);
+            peak = magnitude > peak ? magnitude : peak;
+        }
+        self->peak = peak;
+    } else if (mode == sig_dsp_Telemetry_Mode_RMS) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < blockSize; i++) {
+            sum += source[i] * source[i];
+        }
+        self->sumOfSquares += sum;
+    }
+
+    self->last = source[blockSize - 1];
+    self->numBlocks++;
+
+    size_t blocksPerReport = self->parameters.blocksPerReport < 1.0f ?
+        1 : (size_t) self->parameters.blocksPerReport;
+    if (self->numBlocks < blocksPerReport) {
+        return;
+    }
+
+    float report;
+    if (mode == sig_dsp_Telemetry_Mode_PEAK) {
+        report = self->peak;
+    } else if (mode == sig_dsp_Telemetry_Mode_RMS) {
+        report = sqrtf(self->sumOfSquares /
+            (float) (self->numBlocks * blockSize));
+    } else {
+        report = self->last;
+    }
+
+    sig_RingBuffer_push(self->outputs.main, &report);
+    sig_dsp_Telemetry_resetWindow(self);
+}
+
+bool sig_dsp_Telemetry_readLatest(struct sig_dsp_Telemetry* self,
+    float* value) {
+    float reports[8];
+    bool didRead = false;
+    size_t numRead;
+
+    while ((numRead = sig_RingBuffer_popSpan(self->outputs.main, reports,
+        8)) > 0) {
+        *value = reports[numRead - 1];
+        didRead = true;
+    }
+
+    return didRead;
+}
+
+void sig_dsp_Telemetry_destroy(struct sig_Allocator* allocator,
+    struct sig_dsp_Telemetry* self) {
+    sig_RingBuffer_destroy(allocator, self->outputs.main);
+    sig_dsp_Signal_destroy(allocator, self);
+}
+
+
 
 struct sig_dsp_Calibrator* sig_dsp_Calibrator_new(
     struct sig_Allocator* allocator, struct sig_SignalContext* context) {
@@ -2,7 +2,7 @@
 #include <unity.h>
 #include <tlsf.h>
 #include <libsignaletic.h>
-#include <stdlib.h> // TODO: Remove when a custom RNG is implemented.
+#include <libsignaletic-tables.h>
 #include <buffer-test-utils.h>
 
 #define FLOAT_EPSILON powf(2, -23)
@@ -86,15 +86,55 @@ void test_sig_randf(void) {
         numSamples);
     struct sig_Buffer* fourthRun = sig_Buffer_new(&allocator,
         numSamples);
-    srand(1);
+    sig_randSeed(1);
     sig_Buffer_fill(thirdRun, sig_randomFill);
 
-    srand(1);
+    sig_randSeed(1);
     sig_Buffer_fill(fourthRun, sig_randomFill);
     TEST_ASSERT_EQUAL_FLOAT_ARRAY(thirdRun->samples,
         fourthRun->samples, numSamples);
 }
 
+void test_sig_Random(void) {
+    size_t numSamples = 8192;
+    struct sig_Random first;
+    struct sig_Random second;
+    struct sig_Buffer* firstRun = sig_Buffer_new(&allocator, numSamples);
+    struct sig_Buffer* secondRun = sig_Buffer_new(&allocator, numSamples);
+
+    // Generators with the same seed should produce identical results,
+    // whether values are generated one at a time or in blocks.
+    sig_Random_init(&first, 42);
+    sig_Random_init(&second, 42);
+    sig_Random_fill(&first, firstRun->samples, numSamples);
+    for (size_t i = 0; i < numSamples; i++) {
+        FLOAT_ARRAY(secondRun->samples)[i] = sig_Random_nextf(&second);
+    }
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(firstRun->samples,
+        secondRun->samples, numSamples);
+    testAssertBufferValuesInRange(firstRun->samples, numSamples,
+        0.0f, 1.0f);
+
+    // Generators with different seeds should not.
+    sig_Random_init(&second, 43);
+    sig_Random_fill(&second, secondRun->samples, numSamples);
+    testAssertBuffersNotEqual(firstRun->samples, secondRun->samples,
+        numSamples);
+
+    // Bipolar values should be evenly distributed around zero.
+    sig_Random_fillBipolar(&first, firstRun->samples, numSamples);
+    testAssertBufferValuesInRange(firstRun->samples, numSamples,
+        -1.0f, 1.0f);
+    float sum = 0.0f;
+    for (size_t i = 0; i < numSamples; i++) {
+        sum += FLOAT_ARRAY(firstRun->samples)[i];
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.0f, sum / numSamples);
+
+    sig_Buffer_destroy(&allocator, firstRun);
+    sig_Buffer_destroy(&allocator, secondRun);
+}
+
 void test_sig_midiToFreq(void) {
     // 69 A 440
     float actual = sig_midiToFreq(69.0f);
@@ -295,6 +335,281 @@ void test_sig_AudioBlock_newWithValue(void) {
     sig_AudioSettings_destroy(&localAlloc, customSettings);
 }
 
+void test_sig_AudioBlock_newMultichannel(void) {
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr block = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, 3);
+    testAssertBufferIsSilent(&allocator, block, blockSize * 3);
+
+    // Channels should be stored one after another.
+    for (size_t c = 0; c < 3; c++) {
+        float_array_ptr channel = sig_AudioBlock_channel(audioSettings,
+            block, c);
+        TEST_ASSERT_EQUAL_PTR(FLOAT_ARRAY(block) + c * blockSize,
+            FLOAT_ARRAY(channel));
+    }
+
+    // The context's silence and unity should provide every channel.
+    testAssertBufferIsSilent(&allocator, context->silence->outputs.main,
+        blockSize * sig_MAX_CHANNELS);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f,
+        context->unity->outputs.main, blockSize * sig_MAX_CHANNELS);
+
+    sig_AudioBlock_destroy(&allocator, block);
+}
+
+void test_sig_EventBlock(void) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_EventBlock* events = sig_EventBlock_new(&allocator, 2);
+
+    // Events must be pushed in order, and only up to the capacity.
+    TEST_ASSERT_TRUE(sig_EventBlock_push(events, 4, 1.0f));
+    TEST_ASSERT_FALSE(sig_EventBlock_push(events, 3, 0.0f));
+    TEST_ASSERT_TRUE(sig_EventBlock_push(events, 6, 0.0f));
+    TEST_ASSERT_FALSE(sig_EventBlock_push(events, 10, 1.0f));
+    TEST_ASSERT_EQUAL_size_t(2, events->length);
+
+    // Each event's value should be held until the next one.
+    float_array_ptr block = sig_AudioBlock_new(&allocator, audioSettings);
+    float value = 0.5f;
+    sig_EventBlock_writeBlock(events, block, blockSize, &value);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, FLOAT_ARRAY(block)[3]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, FLOAT_ARRAY(block)[4]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, FLOAT_ARRAY(block)[5]);
+    testAssertBufferIsSilent(&allocator, FLOAT_ARRAY(block) + 6,
+        blockSize - 6);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, value);
+
+    // Reading the rendered block back should produce the same events,
+    // except for the first, which continues the previous block.
+    struct sig_EventBlock* readEvents = sig_EventBlock_new(&allocator,
+        blockSize);
+    float previousValue = 0.5f;
+    sig_EventBlock_readBlock(readEvents, block, blockSize,
+        &previousValue);
+    TEST_ASSERT_EQUAL_size_t(2, readEvents->length);
+    TEST_ASSERT_EQUAL_UINT32(4, readEvents->events[0].offset);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, readEvents->events[0].value);
+    TEST_ASSERT_EQUAL_UINT32(6, readEvents->events[1].offset);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, readEvents->events[1].value);
+
+    // A block that doesn't change shouldn't produce any events.
+    sig_EventBlock_readBlock(readEvents, context->silence->outputs.main,
+        blockSize, &previousValue);
+    TEST_ASSERT_EQUAL_size_t(0, readEvents->length);
+
+    sig_EventBlock_clear(events);
+    TEST_ASSERT_EQUAL_size_t(0, events->length);
+
+    sig_EventBlock_destroy(&allocator, readEvents);
+    sig_EventBlock_destroy(&allocator, events);
+    sig_AudioBlock_destroy(&allocator, block);
+}
+
+void test_sig_dsp_BlockToEvents(void) {
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr source = sig_AudioBlock_newSilent(&allocator,
+        audioSettings);
+    struct sig_dsp_BlockToEvents* toEvents = sig_dsp_BlockToEvents_new(
+        &allocator, context);
+    toEvents->inputs.source = source;
+    struct sig_dsp_EventsToBlock* toBlock = sig_dsp_EventsToBlock_new(
+        &allocator, context);
+    toBlock->inputs.source = toEvents->outputs.main;
+
+    // Converting a signal to events and back should be lossless.
+    float value = 0.0f;
+    for (size_t block = 0; block < 8; block++) {
+        for (size_t i = 0; i < blockSize; i++) {
+            if (sig_randf() < 0.1f) {
+                value = value > 0.0f ? 0.0f : sig_randf();
+            }
+            FLOAT_ARRAY(source)[i] = value;
+        }
+
+        toEvents->signal.generate(toEvents);
+        toBlock->signal.generate(toBlock);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(source, toBlock->outputs.main,
+            blockSize);
+    }
+
+    sig_dsp_EventsToBlock_destroy(&allocator, toBlock);
+    sig_dsp_BlockToEvents_destroy(&allocator, toEvents);
+    sig_AudioBlock_destroy(&allocator, source);
+}
+
+void testAssertMidiMessage(uint8_t status, uint8_t data0, uint8_t data1,
+    struct sig_midi_Message* message) {
+    TEST_ASSERT_EQUAL_HEX8(status, message->status);
+    TEST_ASSERT_EQUAL_UINT8(data0, message->data[0]);
+    TEST_ASSERT_EQUAL_UINT8(data1, message->data[1]);
+}
+
+void test_sig_midi_Parser(void) {
+    struct sig_midi_Parser parser;
+    struct sig_midi_Message message;
+    sig_midi_Parser_init(&parser);
+
+    // A note on, followed by another that uses running status
+    // and has a clock message in the middle of it.
+    uint8_t bytes[] = {0x91, 60, 100, 64, 0xF8, 90};
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, bytes[0], &message));
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, bytes[1], &message));
+    TEST_ASSERT_TRUE(sig_midi_Parser_parse(&parser, bytes[2], &message));
+    testAssertMidiMessage(0x91, 60, 100, &message);
+    TEST_ASSERT_EQUAL_UINT8(sig_midi_Status_NOTE_ON,
+        sig_midi_Message_type(&message));
+    TEST_ASSERT_EQUAL_UINT8(2, sig_midi_Message_channel(&message));
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, bytes[3], &message));
+    TEST_ASSERT_TRUE(sig_midi_Parser_parse(&parser, bytes[4], &message));
+    testAssertMidiMessage(0xF8, 0, 0, &message);
+    TEST_ASSERT_EQUAL_UINT8(0, sig_midi_Message_channel(&message));
+    TEST_ASSERT_TRUE(sig_midi_Parser_parse(&parser, bytes[5], &message));
+    testAssertMidiMessage(0x91, 64, 90, &message);
+
+    // Program changes have a single data byte.
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, 0xC0, &message));
+    TEST_ASSERT_TRUE(sig_midi_Parser_parse(&parser, 5, &message));
+    testAssertMidiMessage(0xC0, 5, 0, &message);
+    TEST_ASSERT_TRUE(sig_midi_Parser_parse(&parser, 6, &message));
+    testAssertMidiMessage(0xC0, 6, 0, &message);
+
+    // System exclusive data should be skipped,
+    // and should cancel running status.
+    uint8_t sysEx[] = {0xF0, 0x7E, 0x01, 0x02, 0xF7, 0x03, 0x04};
+    for (size_t i = 0; i < sizeof(sysEx); i++) {
+        TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, sysEx[i],
+            &message));
+    }
+
+    // So should system common messages.
+    uint8_t songPosition[] = {0xF2, 0x10, 0x20};
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, songPosition[0],
+        &message));
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, songPosition[1],
+        &message));
+    TEST_ASSERT_TRUE(sig_midi_Parser_parse(&parser, songPosition[2],
+        &message));
+    testAssertMidiMessage(0xF2, 0x10, 0x20, &message);
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, 0x30, &message));
+    TEST_ASSERT_FALSE(sig_midi_Parser_parse(&parser, 0x40, &message));
+}
+
+void test_sig_midi_EventQueue(void) {
+    struct sig_midi_EventQueue* queue = sig_midi_EventQueue_new(&allocator,
+        3);
+
+    // A message split across two writes should take effect
+    // at the offset of its last byte.
+    uint8_t noteOn[] = {0x90, 60, 127};
+    TEST_ASSERT_EQUAL_size_t(0, sig_midi_EventQueue_writeBytes(queue,
+        noteOn, 2, 3));
+    TEST_ASSERT_EQUAL_size_t(1, sig_midi_EventQueue_writeBytes(queue,
+        noteOn + 2, 1, 7));
+    TEST_ASSERT_EQUAL_UINT32(7, queue->events[0].offset);
+    testAssertMidiMessage(0x90, 60, 127, &queue->events[0].message);
+
+    // Events that arrive with earlier offsets stay in order.
+    uint8_t clock[] = {0xF8};
+    sig_midi_EventQueue_writeBytes(queue, clock, 1, 2);
+    TEST_ASSERT_EQUAL_UINT32(7, queue->events[1].offset);
+
+    // Events that don't fit are dropped and counted.
+    uint8_t clocks[] = {0xF8, 0xF8};
+    TEST_ASSERT_EQUAL_size_t(1, sig_midi_EventQueue_writeBytes(queue,
+        clocks, 2, 9));
+    TEST_ASSERT_EQUAL_size_t(3, queue->length);
+    TEST_ASSERT_EQUAL_size_t(1, queue->numDropped);
+
+    // Clearing the queue shouldn't reset running status.
+    sig_midi_EventQueue_clear(queue);
+    uint8_t runningStatus[] = {62, 100};
+    TEST_ASSERT_EQUAL_size_t(1, sig_midi_EventQueue_writeBytes(queue,
+        runningStatus, 2, 0));
+    testAssertMidiMessage(0x90, 62, 100, &queue->events[0].message);
+
+    sig_midi_EventQueue_destroy(&allocator, queue);
+}
+
+void test_sig_RingBuffer(void) {
+    struct sig_RingBuffer* ring = sig_RingBuffer_new(&allocator, 5,
+        sizeof(uint32_t));
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(8, ring->capacity,
+        "The capacity should be rounded up to a power of two");
+
+    // An empty buffer should be entirely writeable.
+    TEST_ASSERT_EQUAL_size_t(0, sig_RingBuffer_readable(ring));
+    TEST_ASSERT_EQUAL_size_t(8, sig_RingBuffer_writeable(ring));
+
+    uint32_t values[12] = {0};
+    for (uint32_t i = 0; i < 12; i++) {
+        values[i] = i + 1;
+    }
+
+    // A span that doesn't fit should be partially written,
+    // leaving a full buffer that is distinct from an empty one.
+    TEST_ASSERT_EQUAL_size_t(8, sig_RingBuffer_pushSpan(ring, values, 12));
+    TEST_ASSERT_EQUAL_size_t(8, sig_RingBuffer_readable(ring));
+    TEST_ASSERT_EQUAL_size_t(0, sig_RingBuffer_writeable(ring));
+    TEST_ASSERT_FALSE(sig_RingBuffer_push(ring, &values[8]));
+
+    uint32_t read[12] = {0};
+    TEST_ASSERT_EQUAL_size_t(5, sig_RingBuffer_popSpan(ring, read, 5));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(values, read, 5);
+
+    // Spans should wrap around the end of the buffer.
+    TEST_ASSERT_EQUAL_size_t(4, sig_RingBuffer_pushSpan(ring, values + 8,
+        4));
+    TEST_ASSERT_EQUAL_size_t(7, sig_RingBuffer_popSpan(ring, read, 12));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(values + 5, read, 7);
+    TEST_ASSERT_EQUAL_size_t(0, sig_RingBuffer_readable(ring));
+
+    uint32_t value = 0;
+    TEST_ASSERT_FALSE(sig_RingBuffer_pop(ring, &value));
+    TEST_ASSERT_TRUE(sig_RingBuffer_push(ring, &values[0]));
+    TEST_ASSERT_TRUE(sig_RingBuffer_pop(ring, &value));
+    TEST_ASSERT_EQUAL_UINT32(1, value);
+
+    // Indices should keep working when they overflow.
+    atomic_store(&ring->writeIdx, SIZE_MAX - 2);
+    atomic_store(&ring->readIdx, SIZE_MAX - 2);
+    ring->cachedReadIdx = SIZE_MAX - 2;
+    ring->cachedWriteIdx = SIZE_MAX - 2;
+    TEST_ASSERT_EQUAL_size_t(6, sig_RingBuffer_pushSpan(ring, values, 6));
+    TEST_ASSERT_EQUAL_size_t(6, sig_RingBuffer_readable(ring));
+    TEST_ASSERT_EQUAL_size_t(2, sig_RingBuffer_writeable(ring));
+    TEST_ASSERT_EQUAL_size_t(6, sig_RingBuffer_popSpan(ring, read, 6));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(values, read, 6);
+
+    sig_RingBuffer_pushSpan(ring, values, 3);
+    TEST_ASSERT_EQUAL_size_t(3, sig_RingBuffer_flush(ring));
+    TEST_ASSERT_EQUAL_size_t(0, sig_RingBuffer_readable(ring));
+    TEST_ASSERT_EQUAL_size_t(8, sig_RingBuffer_writeable(ring));
+
+    sig_RingBuffer_destroy(&allocator, ring);
+}
+
+void test_sig_RingBuffer_indicesDontShareCacheLines(void) {
+    // The producer's and consumer's fields must be at least a full
+    // cache line apart from each other and from the shared fields,
+    // since the buffer may be allocated at any alignment.
+    size_t sharedEnd = offsetof(struct sig_RingBuffer, items) +
+        sizeof(uint8_t*);
+    size_t producerStart = offsetof(struct sig_RingBuffer, writeIdx);
+    size_t producerEnd = offsetof(struct sig_RingBuffer, cachedReadIdx) +
+        sizeof(size_t);
+    size_t consumerStart = offsetof(struct sig_RingBuffer, readIdx);
+    size_t consumerEnd = offsetof(struct sig_RingBuffer, cachedWriteIdx) +
+        sizeof(size_t);
+
+    TEST_ASSERT_GREATER_OR_EQUAL_size_t(sig_CACHE_LINE_SIZE,
+        producerStart - sharedEnd);
+    TEST_ASSERT_GREATER_OR_EQUAL_size_t(sig_CACHE_LINE_SIZE,
+        consumerStart - producerEnd);
+    TEST_ASSERT_GREATER_OR_EQUAL_size_t(sig_CACHE_LINE_SIZE,
+        sizeof(struct sig_RingBuffer) - consumerEnd);
+}
+
 void test_sig_Buffer(void) {
     size_t len = 1024;
     struct sig_Buffer* b = sig_Buffer_new(&allocator, len);
@@ -384,228 +699,2022 @@ void test_sig_linearXFade(void) {
         "50 percent to the left.");
 }
 
-void test_sig_dsp_Value(void) {
-    struct sig_dsp_Value* value = sig_dsp_Value_new(&allocator, context);
-    value->parameters.value = 123.45f;
+void test_sig_DelayLine_unwrittenSamplesAreSilent(void) {
+    size_t len = 8;
+    struct sig_Buffer* buffer = sig_Buffer_new(&allocator, len);
+    // Simulate uninitialized memory.
+    sig_Buffer_fillWithValue(buffer, 42.0f);
 
-    // Output should contain the value parameter.
-    value->signal.generate(value);
-    testAssertBufferContainsValueOnly(&allocator,
-        123.45f, value->outputs.main, audioSettings->blockSize);
+    struct sig_DelayLine* delayLine = sig_DelayLine_newWithTransferredBuffer(
+        &allocator, buffer);
 
-    // Output should contain the updated value parameter.
-    value->parameters.value = 1.111f;
-    value->signal.generate(value);
-    testAssertBufferContainsValueOnly(&allocator,
-        1.111f, value->outputs.main, audioSettings->blockSize);
+    // Nothing has been written yet, so all reads should be silent.
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(0.0f,
+            sig_DelayLine_readAt(delayLine, i),
+            "An unwritten delay line should read as silence.");
+    }
 
-    // The lastSample member should have been updated.
-    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(FLOAT_EPSILON,
-        1.111f, value->lastSample,
-        "lastSample should have been updated.");
+    // Write three samples. The three most recent positions should contain
+    // them, and all older positions should still read as silence.
+    sig_DelayLine_write(delayLine, 1.0f);
+    sig_DelayLine_write(delayLine, 2.0f);
+    sig_DelayLine_write(delayLine, 3.0f);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, sig_DelayLine_readAt(delayLine, 1));
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, sig_DelayLine_readAt(delayLine, 2));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, sig_DelayLine_readAt(delayLine, 3));
+    for (size_t i = 4; i <= len; i++) {
+        TEST_ASSERT_EQUAL_FLOAT_MESSAGE(0.0f,
+            sig_DelayLine_readAt(delayLine, i),
+            "Positions older than the first write should read as silence.");
+    }
 
-    // After multiple calls to generate(),
-    // the output should continue to contain the value parameter.
-    value->signal.generate(value);
-    value->signal.generate(value);
-    testAssertBufferContainsValueOnly(&allocator,
-        1.111f, value->outputs.main, audioSettings->blockSize);
+    // Interpolated reads should blend with silence at the boundary.
+    TEST_ASSERT_EQUAL_FLOAT(0.5f,
+        sig_DelayLine_linearReadAt(delayLine, 3.5f));
 
-    sig_dsp_Value_destroy(&allocator, value);
+    // Once the delay line has been filled,
+    // every position should contain written values.
+    for (size_t i = 3; i < len; i++) {
+        sig_DelayLine_write(delayLine, (float) i + 1.0f);
+    }
+    TEST_ASSERT_EQUAL_size_t(len, delayLine->numWritten);
+    for (size_t i = 1; i <= len; i++) {
+        TEST_ASSERT_EQUAL_FLOAT((float) (len - i + 1),
+            sig_DelayLine_readAt(delayLine, i));
+    }
+
+    // Re-initializing the delay line should silence it again.
+    sig_DelayLine_init(delayLine);
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, sig_DelayLine_readAt(delayLine, i));
+    }
+
+    sig_DelayLine_destroy(&allocator, delayLine);
 }
 
-void test_sig_dsp_ConstantValue(void) {
-    struct sig_dsp_ConstantValue* constVal = sig_dsp_ConstantValue_new(
-        &allocator, context, 42.0f);
+void test_sig_LookupTableCache(void) {
+    struct sig_LookupTableCache* cache = sig_LookupTableCache_new(&allocator);
+
+    struct sig_Buffer* sine = sig_LookupTableCache_acquire(cache,
+        &allocator, sig_table_sine, 1024, 1);
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(1024, sine->length,
+        "The table's length should not include the guard points.");
+    TEST_ASSERT_FLOAT_WITHIN(FLOAT_EPSILON, 0.0f,
+        FLOAT_ARRAY(sine->samples)[0]);
+    TEST_ASSERT_FLOAT_WITHIN(FLOAT_EPSILON, 1.0f,
+        FLOAT_ARRAY(sine->samples)[256]);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.000001f, 0.0f,
+        FLOAT_ARRAY(sine->samples)[1024],
+        "The guard point should continue the table's function.");
+
+    // Requesting the same table should return the shared instance.
+    struct sig_Buffer* sameSine = sig_LookupTableCache_acquire(cache,
+        &allocator, sig_table_sine, 1024, 1);
+    TEST_ASSERT_EQUAL_PTR(sine, sameSine);
+    struct sig_LookupTable* entry = sig_LookupTableCache_find(cache,
+        sig_table_sine, 1024, 1);
+    TEST_ASSERT_EQUAL_size_t(2, entry->refCount);
+
+    // Tables with different keys should be distinct.
+    struct sig_Buffer* noGuardSine = sig_LookupTableCache_acquire(cache,
+        &allocator, sig_table_sine, 1024, 0);
+    TEST_ASSERT_NOT_EQUAL(sine, noGuardSine);
+    struct sig_Buffer* tanhTable = sig_LookupTableCache_acquire(cache,
+        &allocator, sig_table_tanh, 1024, 0);
+    TEST_ASSERT_NOT_EQUAL(sine, tanhTable);
+    TEST_ASSERT_FLOAT_WITHIN(0.000001f, 0.0f,
+        FLOAT_ARRAY(tanhTable->samples)[512]);
+
+    // The table should be freed once it has been released by all users.
+    sig_LookupTableCache_release(cache, &allocator, sine);
+    TEST_ASSERT_NOT_NULL(entry->table.samples);
+    sig_LookupTableCache_release(cache, &allocator, sameSine);
+    TEST_ASSERT_EQUAL_size_t(0, entry->refCount);
+    TEST_ASSERT_NULL(entry->table.samples);
+
+    // Precomputed tables should be returned without being copied.
+    float precomputed[5] = {1.0f, 2.0f, 4.0f, 8.0f, 16.0f};
+    sig_LookupTableCache_provide(cache, &allocator, sig_table_exp2, 4, 1,
+        precomputed);
+    struct sig_Buffer* exp2Table = sig_LookupTableCache_acquire(cache,
+        &allocator, sig_table_exp2, 4, 1);
+    TEST_ASSERT_EQUAL_PTR(precomputed, exp2Table->samples);
+    sig_LookupTableCache_release(cache, &allocator, exp2Table);
+    TEST_ASSERT_EQUAL_FLOAT(16.0f, precomputed[4]);
+
+    sig_LookupTableCache_destroy(&allocator, cache);
+}
 
-    // Output should contain the value, even prior to being evaluated.
-    testAssertBufferContainsValueOnly(&allocator, 42.0f,
-        constVal->outputs.main, audioSettings->blockSize);
+size_t numCountedAllocations = 0;
 
-    // The output should not change.
-    constVal->signal.generate(constVal);
-    testAssertBufferContainsValueOnly(&allocator, 42.0f,
-        constVal->outputs.main, audioSettings->blockSize);
+void* countingMalloc(struct sig_Allocator* allocator, size_t size) {
+    numCountedAllocations++;
+    return sig_TLSFAllocator_malloc(allocator, size);
 }
 
-void test_sig_dsp_TimedTriggerCounter(void) {
-    float halfBlockSecs = (audioSettings->blockSize / 2) /
-        audioSettings->sampleRate;
+struct sig_AllocatorImpl countingAllocatorImpl = {
+    .init = sig_TLSFAllocator_init,
+    .malloc = countingMalloc,
+    .free = sig_TLSFAllocator_free
+};
 
-    // A trigger right at the beginning of the input buffer.
-    float* source = sig_AudioBlock_newWithValue(&allocator,
-        audioSettings, 0.0f);
-    source[0] = 1.0;
+void test_sig_LookupTableCache_keepsPrecomputedTables(void) {
+    struct sig_Allocator countingAllocator = {
+        .impl = &countingAllocatorImpl,
+        .heap = allocator.heap
+    };
+    struct sig_LookupTableCache* cache = sig_LookupTableCache_new(
+        &countingAllocator);
+    float precomputed[5] = {0.0f, 1.0f, 0.0f, -1.0f, 0.0f};
+
+    sig_LookupTableCache_provide(cache, &countingAllocator, sig_table_sine,
+        4, 1, precomputed);
+    struct sig_Buffer* table = sig_LookupTableCache_acquire(cache,
+        &countingAllocator, sig_table_sine, 4, 1);
+    sig_LookupTableCache_release(cache, &countingAllocator, table);
+
+    // Acquiring the table again after it has been released
+    // should return the precomputed samples without regenerating them.
+    size_t numAllocations = numCountedAllocations;
+    table = sig_LookupTableCache_acquire(cache, &countingAllocator,
+        sig_table_sine, 4, 1);
+    TEST_ASSERT_EQUAL_PTR(precomputed, table->samples);
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(numAllocations, numCountedAllocations,
+        "No memory should be allocated for a precomputed table.");
+    sig_LookupTableCache_release(cache, &countingAllocator, table);
+
+    sig_LookupTableCache_destroy(&countingAllocator, cache);
+}
 
-    struct sig_dsp_TimedTriggerCounter* counter = sig_dsp_TimedTriggerCounter_new(&allocator, context);
-    counter->inputs.source = source;
-    counter->inputs.duration = sig_AudioBlock_newWithValue(&allocator,
-        audioSettings, halfBlockSecs);
-    counter->inputs.count = sig_AudioBlock_newWithValue(&allocator,
-        audioSettings, 1.0f);
+void test_sig_dsp_TwoOpFM_sharesSineTable(void) {
+    struct sig_dsp_TwoOpFM* first = sig_dsp_TwoOpFM_new(&allocator, context);
+    struct sig_dsp_TwoOpFM* second = sig_dsp_TwoOpFM_new(&allocator, context);
 
-    // The output should contain a single trigger half block size.
-    // (i.e. 24 samples after we received the
-    // rising edge of the input trigger)
-    counter->signal.generate(counter);
-    float* expected = sig_AudioBlock_newWithValue(&allocator,
-        audioSettings, 0.0f);
-    expected[23] = 1.0f;
-    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, counter->outputs.main,
-        audioSettings->blockSize);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(first->sineTable, second->sineTable,
+        "TwoOpFM instances should share the same sine table.");
 
-    // The first trigger can happen later after the
-    // "duration" has elapsed and it will be recognized
-    // because it shouldn't start counting until a trigger is
-    // received.
-    source[0] = 0.0f;
-    source[24] = 1.0f;
-    counter->signal.generate(counter);
-    sig_fillWithSilence(expected, audioSettings->blockSize);
-    expected[47] = 1.0f;
-    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, counter->outputs.main,
-        audioSettings->blockSize);
+    sig_dsp_TwoOpFM_destroy(&allocator, first);
+    sig_dsp_TwoOpFM_destroy(&allocator, second);
+}
 
-    // When the input contains two triggers in the
-    // specified duration, but we're looking for one,
-    // no trigger should be output.
-    sig_fillWithSilence(source, audioSettings->blockSize);
-    source[1] = 1.0f;
-    source[20] = 1.0f;
-    counter->signal.generate(counter);
-    TEST_ASSERT_EQUAL_FLOAT_ARRAY(
-        context->silence->outputs.main,
-        counter->outputs.main,
-        audioSettings->blockSize);
+void test_sig_denormals_flush(void) {
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, sig_denormals_flush(1.0e-39f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, sig_denormals_flush(-1.0e-20f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, sig_denormals_flush(0.0f));
+    TEST_ASSERT_EQUAL_FLOAT(0.001f, sig_denormals_flush(0.001f));
+    TEST_ASSERT_EQUAL_FLOAT(-0.5f, sig_denormals_flush(-0.5f));
+
+    // Enabling and restoring flush-to-zero mode should round trip.
+    uint32_t previousState = sig_denormals_enableFlushToZero();
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, sig_denormals_flush(0.25f));
+    sig_denormals_restore(previousState);
+    TEST_ASSERT_EQUAL_UINT32(previousState, sig_denormals_enableFlushToZero());
+    sig_denormals_restore(previousState);
+}
 
-    // When we're looking for two triggers and we get two triggers,
-    // one trigger should be fired.
-    sig_fillWithValue(counter->inputs.count, audioSettings->blockSize,
-        2.0f);
-    counter->signal.generate(counter);
-    sig_fillWithSilence(expected, audioSettings->blockSize);
-    expected[24] = 1.0f;
-    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, counter->outputs.main,
-        audioSettings->blockSize);
+void test_sig_dsp_OnePole_decaysToSilence(void) {
+    struct sig_dsp_ConstantValue* freq = sig_dsp_ConstantValue_new(
+        &allocator, context, 10.0f);
+    struct sig_dsp_OnePole* onePole = sig_dsp_OnePole_new(&allocator,
+        context);
+    onePole->inputs.frequency = freq->outputs.main;
+    onePole->previousSamples[0] = 1.0f;
 
-    // When we're looking for two triggers and
-    // the second one comes too late,
-    // No triggers should be fired.
-    sig_fillWithSilence(source, audioSettings->blockSize);
-    source[0] = 1.0f;
-    source[25] = 1.0f;
-    counter->signal.generate(counter);
-    TEST_ASSERT_EQUAL_FLOAT_ARRAY(
-        context->silence->outputs.main,
-        counter->outputs.main,
+    // The filter's state should be flushed to exactly zero
+    // rather than decaying indefinitely into denormals.
+    for (size_t i = 0; i < 10000; i++) {
+        onePole->signal.generate(onePole);
+    }
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, onePole->previousSamples[0]);
+    testAssertBufferIsSilent(&allocator, onePole->outputs.main,
         audioSettings->blockSize);
+
+    sig_dsp_OnePole_destroy(&allocator, onePole);
+    sig_dsp_ConstantValue_destroy(&allocator, freq);
 }
 
-void test_sig_dsp_Mul(void) {
-    struct sig_dsp_BinaryOp* gain = sig_dsp_Mul_new(&allocator, context);
-    gain->inputs.left = sig_AudioBlock_newWithValue(&allocator, audioSettings,
-        0.5f);
-    gain->inputs.right = sig_AudioBlock_newWithValue(&allocator, audioSettings,
-        440.0f);
+void test_sig_DelayLine_flushDenormals(void) {
+    struct sig_DelayLine* delayLine = sig_DelayLine_new(&allocator, 16);
+    sig_DelayLine_write(delayLine, 1.0f);
+    for (size_t i = 0; i < 3; i++) {
+        sig_DelayLine_write(delayLine, 1.0e-20f);
+    }
 
-    gain->signal.generate(gain);
-    testAssertBufferContainsValueOnly(&allocator,
-        220.0f, gain->outputs.main, audioSettings->blockSize);
+    // The loud sample is still within reach of the read position,
+    // so the delay line shouldn't be zeroed yet.
+    sig_DelayLine_flushDenormals(delayLine, 1.0e-20f, 3, 4.0f);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, sig_DelayLine_readAt(delayLine, 4));
+    TEST_ASSERT_EQUAL_FLOAT(1.0e-20f, sig_DelayLine_readAt(delayLine, 1));
 
-    sig_fillWithValue(gain->inputs.left, audioSettings->blockSize, 0.0f);
-    gain->signal.generate(gain);
-    testAssertBufferContainsValueOnly(&allocator,
-        0.0f, gain->outputs.main, audioSettings->blockSize);
+    for (size_t i = 0; i < 3; i++) {
+        sig_DelayLine_write(delayLine, 1.0e-20f);
+    }
 
-    sig_fillWithValue(gain->inputs.left, audioSettings->blockSize, 2.0f);
-    gain->signal.generate(gain);
-    testAssertBufferContainsValueOnly(&allocator,
-        880.0f, gain->outputs.main, audioSettings->blockSize);
+    sig_DelayLine_flushDenormals(delayLine, 1.0e-20f, 3, 4.0f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, sig_DelayLine_readAt(delayLine, 1));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, sig_DelayLine_readAt(delayLine, 7));
 
-    sig_fillWithValue(gain->inputs.left, audioSettings->blockSize, -1.0f);
-    gain->signal.generate(gain);
-    testAssertBufferContainsValueOnly(&allocator,
-        -440.0f, gain->outputs.main, audioSettings->blockSize);
+    // A loud block should restart the count.
+    sig_DelayLine_write(delayLine, 0.5f);
+    sig_DelayLine_flushDenormals(delayLine, 0.5f, 1, 4.0f);
+    TEST_ASSERT_EQUAL_size_t(0, delayLine->numQuietSamples);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, sig_DelayLine_readAt(delayLine, 1));
 
-    sig_AudioBlock_destroy(&allocator, gain->inputs.left);
-    sig_AudioBlock_destroy(&allocator, gain->inputs.right);
-    sig_dsp_Mul_destroy(&allocator, gain);
+    sig_DelayLine_destroy(&allocator, delayLine);
 }
 
-void createOscInputs(struct sig_Allocator* allocator,
-    struct sig_dsp_Oscillator* osc,
-    float freq, float phaseOffset, float mul, float add) {
+void test_sig_dsp_Chorus_multichannel(void) {
+    size_t numChannels = 2;
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr source = sig_AudioBlock_newSilent(&allocator,
+        audioSettings);
+    float_array_ptr delayTime = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.005f);
+    float_array_ptr speed = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.5f);
+    float_array_ptr width = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.002f);
+    float_array_ptr feedbackGain = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.3f);
+    float_array_ptr feedforwardGain = sig_AudioBlock_newWithValue(
+        &allocator, audioSettings, 0.7f);
+    float_array_ptr blend = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.7f);
+
+    struct sig_dsp_Chorus* choruses[2];
+    choruses[0] = sig_dsp_Chorus_newMultichannel(&allocator, context,
+        numChannels);
+    // The first channel of a multichannel Chorus should match
+    // a mono Chorus fed the same signal through its own delay line.
+    choruses[1] = sig_dsp_Chorus_new(&allocator, context);
+    for (size_t j = 0; j < 2; j++) {
+        choruses[j]->delayLine = sig_DelayLine_newSeconds(&allocator,
+            audioSettings, 0.01f);
+        choruses[j]->inputs.source = source;
+        choruses[j]->inputs.delayTime = delayTime;
+        choruses[j]->inputs.speed = speed;
+        choruses[j]->inputs.width = width;
+        choruses[j]->inputs.feedbackGain = feedbackGain;
+        choruses[j]->inputs.feedforwardGain = feedforwardGain;
+        choruses[j]->inputs.blend = blend;
+    }
+    struct sig_dsp_Chorus* stereo = choruses[0];
+    struct sig_dsp_Chorus* mono = choruses[1];
+
+    for (size_t block = 0; block < 8; block++) {
+        fillSine(source, blockSize, 440.0f, audioSettings->sampleRate,
+            block * blockSize);
+        stereo->signal.generate(stereo);
+        mono->signal.generate(mono);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(mono->outputs.main,
+            stereo->outputs.main, blockSize);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(mono->outputs.modulator,
+            stereo->outputs.modulator, blockSize);
+    }
 
-    osc->inputs.freq = sig_AudioBlock_newWithValue(allocator,
-        osc->signal.audioSettings, freq);
-    osc->inputs.phaseOffset = sig_AudioBlock_newWithValue(allocator,
-        osc->signal.audioSettings, phaseOffset);
-    osc->inputs.mul = sig_AudioBlock_newWithValue(allocator,
-        osc->signal.audioSettings, mul);
-    osc->inputs.add = sig_AudioBlock_newWithValue(allocator,
-        osc->signal.audioSettings, add);
-}
+    // The second channel's LFO should be half a cycle
+    // out of phase with the first's, so its tap should differ.
+    float_array_ptr leftModulator = sig_AudioBlock_channel(audioSettings,
+        stereo->outputs.modulator, 0);
+    float_array_ptr rightModulator = sig_AudioBlock_channel(audioSettings,
+        stereo->outputs.modulator, 1);
+    testAssertBufferValuesInRange(leftModulator, blockSize, -1.0f, 1.0f);
+    for (size_t i = 0; i < blockSize; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, -FLOAT_ARRAY(leftModulator)[i],
+            FLOAT_ARRAY(rightModulator)[i]);
+    }
+    TEST_ASSERT_FALSE(FLOAT_ARRAY(stereo->outputs.main)[blockSize - 1] ==
+        FLOAT_ARRAY(stereo->outputs.main)[2 * blockSize - 1]);
 
-void destroyOscInputs(struct sig_Allocator* allocator,
-    struct sig_dsp_Oscillator_Inputs* sineInputs) {
-    allocator->impl->free(allocator, sineInputs->freq);
-    allocator->impl->free(allocator, sineInputs->phaseOffset);
-    allocator->impl->free(allocator, sineInputs->mul);
-    allocator->impl->free(allocator, sineInputs->add);
+    for (size_t j = 0; j < 2; j++) {
+        sig_DelayLine_destroy(&allocator, choruses[j]->delayLine);
+        sig_dsp_Chorus_destroy(&allocator, choruses[j]);
+    }
+    sig_AudioBlock_destroy(&allocator, blend);
+    sig_AudioBlock_destroy(&allocator, feedforwardGain);
+    sig_AudioBlock_destroy(&allocator, feedbackGain);
+    sig_AudioBlock_destroy(&allocator, width);
+    sig_AudioBlock_destroy(&allocator, speed);
+    sig_AudioBlock_destroy(&allocator, delayTime);
+    sig_AudioBlock_destroy(&allocator, source);
 }
 
-void test_sig_dsp_SineOscillator(void) {
-    // Generated from this program:
-    /*
-        #include <stddef.h>
-        #include <math.h>
-        #include <stdio.h>
+void test_sig_dsp_detectInputChange(void) {
+    float_array_ptr input = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 440.0f);
 
-        const float PI = 3.14159265358979323846f;
-        const float TWOPI = 2.0f * PI;
+    TEST_ASSERT_EQUAL_INT(sig_dsp_InputChange_NONE,
+        sig_dsp_detectInputChange(input, audioSettings->blockSize, 440.0f));
+    TEST_ASSERT_EQUAL_INT(sig_dsp_InputChange_STEP,
+        sig_dsp_detectInputChange(input, audioSettings->blockSize, 220.0f));
 
-        int main(int argc, char *argv[]) {
-            float sr = 44100.0f;
-            float freq = 440.0f;
-            float phaseStep = freq / sr * TWOPI;
-            float phase = 0.0f;
-            for (size_t i = 0; i < 64; i++) {
-                float sample = sinf(phase);
-                phase = phase + phaseStep;
-                printf("%.8ff, ", sample);
-            }
-        }
-    */
-    float expected[BLOCK_SIZE] = {
-        0.00000000f, 0.06264833f, 0.12505053f, 0.18696144f,
-        0.24813786f, 0.30833939f, 0.36732957f, 0.42487663f,
-        0.48075449f, 0.53474361f, 0.58663195f, 0.63621557f,
-        0.68329972f, 0.72769940f, 0.76924020f, 0.80775887f,
-        0.84310418f, 0.87513721f, 0.90373212f, 0.92877656f,
-        0.95017213f, 0.96783477f, 0.98169512f, 0.99169868f,
-        0.99780619f, 0.99999368f, 0.99825245f, 0.99258947f,
-        0.98302686f, 0.96960229f, 0.95236850f, 0.93139309f,
-        0.90675867f, 0.87856185f, 0.84691346f, 0.81193781f,
-        0.77377236f, 0.73256701f, 0.68848366f, 0.64169550f,
-        0.59238636f, 0.54074991f, 0.48698899f, 0.43131489f,
-        0.37394631f, 0.31510863f, 0.25503296f, 0.19395538f,
-        0.13211580f, 0.06975718f, 0.00712451f, -0.05553614f,
-        -0.11797862f, -0.17995760f, -0.24122958f, -0.30155385f,
-        -0.36069342f, -0.41841593f, -0.47449467f, -0.52870923f,
-        -0.58084673f, -0.63070220f, -0.67807990f, -0.72279370f
-    };
-    struct sig_SignalContext* mono441kContext = sig_SignalContext_new(
-        &allocator, &mono441kAudioSettings);
+    FLOAT_ARRAY(input)[audioSettings->blockSize - 1] = 880.0f;
+    TEST_ASSERT_EQUAL_INT(sig_dsp_InputChange_MODULATED,
+        sig_dsp_detectInputChange(input, audioSettings->blockSize, 440.0f));
 
-    struct sig_dsp_Oscillator* sine = sig_dsp_SineOscillator_new(&allocator,
-        mono441kContext);
-    createOscInputs(&allocator, sine, 440.0f, 0.0f, 1.0f, 0.0f);
+    sig_AudioBlock_destroy(&allocator, input);
+}
 
-    sine->signal.generate(sine);
-    for (size_t i = 0; i < BLOCK_SIZE; i++) {
-        TEST_ASSERT_FLOAT_WITHIN(0.00001,
-            FLOAT_ARRAY(sine->outputs.main)[i],
-            FLOAT_ARRAY(expected)[i]);
+void test_sig_dsp_OnePole_interpolatesModulatedFrequency(void) {
+    struct sig_dsp_OnePole* onePole = sig_dsp_OnePole_new(&allocator,
+        context);
+    onePole->inputs.frequency = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 100.0f);
+    onePole->inputs.source = context->unity->outputs.main;
+    onePole->signal.generate(onePole);
+    float startA1 = onePole->a1;
+    float startB0 = onePole->b0;
+    float previousSample = onePole->previousSamples[0];
+
+    // When the frequency is modulated within a block,
+    // the coefficients should ramp towards those
+    // for the frequency at the end of the block.
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        FLOAT_ARRAY(onePole->inputs.frequency)[i] = 100.0f + i * 100.0f;
+    }
+    onePole->signal.generate(onePole);
+
+    float endFrequency = 100.0f + (audioSettings->blockSize - 1) * 100.0f;
+    float endA1 = sig_filter_onepole_LPF_calculateA1(endFrequency,
+        audioSettings->sampleRate);
+    TEST_ASSERT_EQUAL_FLOAT(endFrequency, onePole->previousFrequency);
+    TEST_ASSERT_EQUAL_FLOAT(endA1, onePole->a1);
+
+    float firstA1 = startA1 + (endA1 - startA1) / audioSettings->blockSize;
+    float firstB0 = startB0 + (sig_filter_onepole_LPF_calculateB0(endA1) -
+        startB0) / audioSettings->blockSize;
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f,
+        sig_filter_onepole(1.0f, previousSample, firstB0, firstA1),
+        FLOAT_ARRAY(onePole->outputs.main)[0]);
+
+    sig_AudioBlock_destroy(&allocator, onePole->inputs.frequency);
+    sig_dsp_OnePole_destroy(&allocator, onePole);
+}
+
+void fillSine(float_array_ptr samples, size_t length, float freq,
+    float sampleRate, size_t startIdx) {
+    for (size_t i = 0; i < length; i++) {
+        FLOAT_ARRAY(samples)[i] = sinf(sig_TWOPI * freq *
+            (float) (startIdx + i) / sampleRate);
+    }
+}
+
+// Fills each channel of a planar block with a different sine wave.
+void fillMultichannelSines(float_array_ptr block, size_t numChannels) {
+    for (size_t c = 0; c < numChannels; c++) {
+        fillSine(sig_AudioBlock_channel(audioSettings, block, c),
+            audioSettings->blockSize, 1000.0f * (float) (c + 1),
+            audioSettings->sampleRate, 0);
+    }
+}
+
+void test_sig_dsp_BinaryOp_multichannel(void) {
+    size_t numChannels = 2;
+    size_t numSamples = audioSettings->blockSize * numChannels;
+    float_array_ptr left = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, numChannels);
+    struct sig_dsp_ConstantValue* right =
+        sig_dsp_ConstantValue_newMultichannel(&allocator, context,
+            numChannels, 0.5f);
+    struct sig_dsp_BinaryOp* mul = sig_dsp_Mul_newMultichannel(&allocator,
+        context, numChannels);
+    struct sig_dsp_BinaryOp* add = sig_dsp_Add_newMultichannel(&allocator,
+        context, numChannels);
+    fillMultichannelSines(left, numChannels);
+
+    mul->inputs.left = left;
+    mul->numLeftChannels = numChannels;
+    mul->inputs.right = right->outputs.main;
+    mul->numRightChannels = numChannels;
+    mul->signal.generate(mul);
+
+    // An unconnected input should read as silence on every channel.
+    add->inputs.left = mul->outputs.main;
+    add->numLeftChannels = numChannels;
+    add->signal.generate(add);
+
+    for (size_t i = 0; i < numSamples; i++) {
+        float expected = FLOAT_ARRAY(left)[i] * 0.5f;
+        TEST_ASSERT_EQUAL_FLOAT(expected, FLOAT_ARRAY(mul->outputs.main)[i]);
+        TEST_ASSERT_EQUAL_FLOAT(expected, FLOAT_ARRAY(add->outputs.main)[i]);
+    }
+
+    sig_dsp_Add_destroy(&allocator, add);
+    sig_dsp_Mul_destroy(&allocator, mul);
+    sig_dsp_ConstantValue_destroy(&allocator, right);
+    sig_AudioBlock_destroy(&allocator, left);
+}
+
+void test_sig_dsp_BinaryOp_multichannelBroadcastsMonoInputs(void) {
+    size_t numChannels = 2;
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr left = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, numChannels);
+    float_array_ptr right = sig_AudioBlock_new(&allocator, audioSettings);
+    struct sig_dsp_BinaryOp* mul = sig_dsp_Mul_newMultichannel(&allocator,
+        context, numChannels);
+    fillMultichannelSines(left, numChannels);
+    fillSine(right, blockSize, 250.0f, audioSettings->sampleRate, 0);
+
+    // A stereo signal multiplied by a mono one should only read
+    // a single channel's worth of samples from the mono input.
+    mul->inputs.left = left;
+    mul->numLeftChannels = numChannels;
+    mul->inputs.right = right;
+    mul->signal.generate(mul);
+
+    for (size_t c = 0; c < numChannels; c++) {
+        float* leftChannel = sig_AudioBlock_channel(audioSettings, left, c);
+        float* outputChannel = sig_AudioBlock_channel(audioSettings,
+            mul->outputs.main, c);
+        for (size_t i = 0; i < blockSize; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(leftChannel[i] * FLOAT_ARRAY(right)[i],
+                outputChannel[i]);
+        }
+    }
+
+    sig_dsp_Mul_destroy(&allocator, mul);
+    sig_AudioBlock_destroy(&allocator, right);
+    sig_AudioBlock_destroy(&allocator, left);
+}
+
+void test_sig_dsp_ScaleOffset_multichannel(void) {
+    size_t numChannels = 4;
+    float_array_ptr source = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, numChannels);
+    struct sig_dsp_ScaleOffset* scaleOffset =
+        sig_dsp_ScaleOffset_newMultichannel(&allocator, context,
+            numChannels);
+    fillMultichannelSines(source, numChannels);
+    scaleOffset->inputs.source = source;
+    scaleOffset->parameters.scale = 2.0f;
+    scaleOffset->parameters.offset = 1.0f;
+    scaleOffset->signal.generate(scaleOffset);
+
+    for (size_t i = 0; i < audioSettings->blockSize * numChannels; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(FLOAT_ARRAY(source)[i] * 2.0f + 1.0f,
+            FLOAT_ARRAY(scaleOffset->outputs.main)[i]);
+    }
+
+    sig_dsp_ScaleOffset_destroy(&allocator, scaleOffset);
+    sig_AudioBlock_destroy(&allocator, source);
+}
+
+void test_sig_dsp_OnePole_multichannel(void) {
+    size_t numChannels = 2;
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr source = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, numChannels);
+    float_array_ptr frequency = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 2000.0f);
+    struct sig_dsp_OnePole* stereo = sig_dsp_OnePole_newMultichannel(
+        &allocator, context, numChannels);
+    stereo->inputs.source = source;
+    stereo->inputs.frequency = frequency;
+
+    // Each channel of a multichannel OnePole should match
+    // a mono OnePole that filters that channel alone.
+    struct sig_dsp_OnePole* monos[2];
+    for (size_t c = 0; c < numChannels; c++) {
+        monos[c] = sig_dsp_OnePole_new(&allocator, context);
+        monos[c]->inputs.source = sig_AudioBlock_channel(audioSettings,
+            source, c);
+        monos[c]->inputs.frequency = frequency;
+    }
+
+    fillMultichannelSines(source, numChannels);
+    for (size_t block = 0; block < 4; block++) {
+        stereo->signal.generate(stereo);
+        for (size_t c = 0; c < numChannels; c++) {
+            monos[c]->signal.generate(monos[c]);
+            TEST_ASSERT_EQUAL_FLOAT_ARRAY(monos[c]->outputs.main,
+                sig_AudioBlock_channel(audioSettings,
+                    stereo->outputs.main, c), blockSize);
+        }
+    }
+
+    for (size_t c = 0; c < numChannels; c++) {
+        sig_dsp_OnePole_destroy(&allocator, monos[c]);
+    }
+    sig_dsp_OnePole_destroy(&allocator, stereo);
+    sig_AudioBlock_destroy(&allocator, frequency);
+    sig_AudioBlock_destroy(&allocator, source);
+}
+
+void test_sig_dsp_Ladder_multichannel(void) {
+    size_t numChannels = 2;
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr source = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, numChannels);
+    struct sig_dsp_Value* frequency = sig_dsp_Value_new(&allocator, context);
+    frequency->parameters.value = 1200.0f;
+    float_array_ptr resonance = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.2f);
+    struct sig_dsp_Ladder* stereo = sig_dsp_Ladder_newMultichannel(
+        &allocator, context, numChannels);
+    stereo->inputs.source = source;
+    stereo->inputs.frequency = frequency->outputs.main;
+    stereo->inputs.resonance = resonance;
+
+    // Each channel of a multichannel Ladder should match
+    // a mono Ladder that filters that channel alone.
+    struct sig_dsp_Ladder* monos[2];
+    for (size_t c = 0; c < numChannels; c++) {
+        monos[c] = sig_dsp_Ladder_new(&allocator, context);
+        monos[c]->inputs.source = sig_AudioBlock_channel(audioSettings,
+            source, c);
+        monos[c]->inputs.frequency = frequency->outputs.main;
+        monos[c]->inputs.resonance = resonance;
+    }
+
+    fillMultichannelSines(source, numChannels);
+    for (size_t block = 0; block < 4; block++) {
+        // Sweep the cutoff so that interpolated coefficients are tested.
+        frequency->parameters.value = 1200.0f + 500.0f * (float) block;
+        frequency->signal.generate(frequency);
+        stereo->signal.generate(stereo);
+        for (size_t c = 0; c < numChannels; c++) {
+            monos[c]->signal.generate(monos[c]);
+            TEST_ASSERT_EQUAL_FLOAT_ARRAY(monos[c]->outputs.main,
+                sig_AudioBlock_channel(audioSettings,
+                    stereo->outputs.main, c), blockSize);
+            TEST_ASSERT_EQUAL_FLOAT_ARRAY(monos[c]->outputs.fourPole,
+                sig_AudioBlock_channel(audioSettings,
+                    stereo->outputs.fourPole, c), blockSize);
+        }
+    }
+
+    for (size_t c = 0; c < numChannels; c++) {
+        sig_dsp_Ladder_destroy(&allocator, monos[c]);
+    }
+    sig_dsp_Ladder_destroy(&allocator, stereo);
+    sig_AudioBlock_destroy(&allocator, resonance);
+    sig_dsp_Value_destroy(&allocator, frequency);
+    sig_AudioBlock_destroy(&allocator, source);
+}
+
+void test_sig_dsp_DelayTap_multichannel(void) {
+    size_t numChannels = 2;
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_DelayLine* delayLine = sig_DelayLine_newSeconds(&allocator,
+        audioSettings, 0.01f);
+    float_array_ptr delayTime = sig_AudioBlock_newMultichannel(&allocator,
+        audioSettings, numChannels);
+    for (size_t i = 0; i < blockSize; i++) {
+        FLOAT_ARRAY(delayTime)[i] = 0.001f;
+        FLOAT_ARRAY(delayTime)[blockSize + i] = 0.0025f;
+    }
+
+    struct sig_dsp_Delay* stereo = sig_dsp_DelayTap_newMultichannel(
+        &allocator, context, numChannels);
+    stereo->delayLine = delayLine;
+    stereo->inputs.delayTime = delayTime;
+    stereo->numDelayTimeChannels = numChannels;
+
+    // Each tap should match a mono DelayTap reading at that tap's time.
+    struct sig_dsp_Delay* monos[2];
+    for (size_t c = 0; c < numChannels; c++) {
+        monos[c] = sig_dsp_DelayTap_new(&allocator, context);
+        monos[c]->delayLine = delayLine;
+        monos[c]->inputs.delayTime = sig_AudioBlock_channel(audioSettings,
+            delayTime, c);
+    }
+
+    for (size_t i = 0; i < delayLine->buffer->length; i++) {
+        sig_DelayLine_write(delayLine, (float) i);
+    }
+    size_t writeIdx = delayLine->writeIdx;
+
+    stereo->signal.generate(stereo);
+    for (size_t c = 0; c < numChannels; c++) {
+        monos[c]->signal.generate(monos[c]);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(monos[c]->outputs.main,
+            sig_AudioBlock_channel(audioSettings, stereo->outputs.main, c),
+            blockSize);
+    }
+
+    // The taps should be different, and shouldn't write to the delay line.
+    TEST_ASSERT_TRUE(FLOAT_ARRAY(stereo->outputs.main)[0] !=
+        FLOAT_ARRAY(stereo->outputs.main)[blockSize]);
+    TEST_ASSERT_EQUAL_size_t(writeIdx, delayLine->writeIdx);
+
+    for (size_t c = 0; c < numChannels; c++) {
+        sig_dsp_DelayTap_destroy(&allocator, monos[c]);
+    }
+    sig_dsp_DelayTap_destroy(&allocator, stereo);
+    sig_AudioBlock_destroy(&allocator, delayTime);
+    sig_DelayLine_destroy(&allocator, delayLine);
+}
+
+// Returns the amplitude of the specified frequency within a signal.
+float measureAmplitude(float_array_ptr samples, size_t length, float freq,
+    float sampleRate) {
+    double re = 0.0;
+    double im = 0.0;
+    for (size_t i = 0; i < length; i++) {
+        double phase = sig_TWOPI * freq * (double) i / sampleRate;
+        re += FLOAT_ARRAY(samples)[i] * cos(phase);
+        im += FLOAT_ARRAY(samples)[i] * sin(phase);
+    }
+
+    return (float) (2.0 * sqrt(re * re + im * im) / length);
+}
+
+void test_sig_filter_Halfband(void) {
+    size_t blockSize = 441;
+    size_t numBlocks = 20;
+    float sampleRate = 44100.0f;
+    float freq = 1000.0f;
+    struct sig_filter_Halfband* up = sig_filter_Halfband_new(&allocator,
+        sig_filter_Halfband_SHARP_HALF_LENGTH);
+    struct sig_filter_Halfband* down = sig_filter_Halfband_new(&allocator,
+        sig_filter_Halfband_SHARP_HALF_LENGTH);
+    struct sig_Buffer* inputBuffer = sig_Buffer_new(&allocator, blockSize);
+    struct sig_Buffer* upsampledBuffer = sig_Buffer_new(&allocator,
+        blockSize * 2);
+    struct sig_Buffer* outputBuffer = sig_Buffer_new(&allocator, blockSize);
+    float_array_ptr input = inputBuffer->samples;
+    float_array_ptr upsampled = upsampledBuffer->samples;
+    float_array_ptr output = outputBuffer->samples;
+    size_t latency = (sig_filter_Halfband_latency(up) +
+        sig_filter_Halfband_latency(down)) / 2;
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        size_t startIdx = block * blockSize;
+        fillSine(input, blockSize, freq, sampleRate, startIdx);
+        sig_filter_Halfband_upsample(up, input, upsampled, blockSize);
+        sig_filter_Halfband_downsample(down, upsampled, output, blockSize);
+    }
+
+    // A round trip through the filters should
+    // reproduce a passband signal, delayed by the filters' latency.
+    size_t startIdx = (numBlocks - 1) * blockSize;
+    fillSine(input, blockSize, freq, sampleRate, startIdx - latency);
+    for (size_t i = 0; i < blockSize; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, FLOAT_ARRAY(input)[i],
+            FLOAT_ARRAY(output)[i]);
+    }
+
+    // When upsampling, the image of the signal
+    // above the original Nyquist frequency should be suppressed.
+    float passbandFreq = 5000.0f;
+    for (size_t block = 0; block < numBlocks; block++) {
+        fillSine(input, blockSize, passbandFreq, sampleRate,
+            block * blockSize);
+        sig_filter_Halfband_upsample(up, input, upsampled, blockSize);
+    }
+
+    float signalAmp = measureAmplitude(upsampled, blockSize * 2,
+        passbandFreq, sampleRate * 2.0f);
+    float imageAmp = measureAmplitude(upsampled, blockSize * 2,
+        sampleRate - passbandFreq, sampleRate * 2.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, signalAmp);
+    TEST_ASSERT_TRUE_MESSAGE(imageAmp < 0.0003f,
+        "The image should be attenuated by more than 70 dB.");
+
+    sig_Buffer_destroy(&allocator, inputBuffer);
+    sig_Buffer_destroy(&allocator, upsampledBuffer);
+    sig_Buffer_destroy(&allocator, outputBuffer);
+    sig_filter_Halfband_destroy(&allocator, up);
+    sig_filter_Halfband_destroy(&allocator, down);
+}
+
+void test_sig_dsp_Oversampler(void) {
+    size_t factor = 4;
+    float freq = 1000.0f;
+    struct sig_dsp_Oversampler* oversampler = sig_dsp_Oversampler_new(
+        &allocator, context, factor, 1);
+    oversampler->inputs.source = sig_AudioBlock_new(&allocator,
+        audioSettings);
+
+    // Child Signals should run at the oversampled rate.
+    TEST_ASSERT_EQUAL_FLOAT(audioSettings->sampleRate * factor,
+        oversampler->context->audioSettings->sampleRate);
+    TEST_ASSERT_EQUAL_size_t(audioSettings->blockSize * factor,
+        oversampler->context->audioSettings->blockSize);
+
+    struct sig_dsp_Tanh* tanh = sig_dsp_Tanh_new(&allocator,
+        oversampler->context);
+    tanh->inputs.source = oversampler->outputs.upsampled;
+    sig_List_append(oversampler->signals, tanh, NULL);
+    oversampler->inputs.childOutput = tanh->outputs.main;
+
+    size_t numBlocks = 200;
+    float_array_ptr expected = sig_AudioBlock_new(&allocator, audioSettings);
+    float latency = sig_dsp_Oversampler_latency(oversampler);
+    double errorSum = 0.0;
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        size_t startIdx = block * audioSettings->blockSize;
+        fillSine(oversampler->inputs.source, audioSettings->blockSize,
+            freq, audioSettings->sampleRate, startIdx);
+        oversampler->signal.generate(oversampler);
+
+        if (block < numBlocks / 2) {
+            continue;
+        }
+
+        // The output should be the tanh of the input,
+        // delayed by the oversampler's latency.
+        for (size_t i = 0; i < audioSettings->blockSize; i++) {
+            float t = ((float) (startIdx + i) - latency) /
+                audioSettings->sampleRate;
+            FLOAT_ARRAY(expected)[i] = tanhf(sinf(sig_TWOPI * freq * t));
+            float error = FLOAT_ARRAY(expected)[i] -
+                FLOAT_ARRAY(oversampler->outputs.main)[i];
+            errorSum += error * error;
+        }
+    }
+
+    float rmsError = (float) sqrt(errorSum /
+        ((numBlocks / 2) * audioSettings->blockSize));
+    TEST_ASSERT_TRUE_MESSAGE(rmsError < 0.001f,
+        "The oversampled output should match the expected waveform.");
+
+    sig_AudioBlock_destroy(&allocator, expected);
+    sig_AudioBlock_destroy(&allocator, oversampler->inputs.source);
+    sig_dsp_Tanh_destroy(&allocator, tanh);
+    sig_dsp_Oversampler_destroy(&allocator, oversampler);
+}
+
+void test_sig_dsp_Oversampler_childContext(void) {
+    struct sig_SignalContext* parent = sig_SignalContext_new(&allocator,
+        audioSettings);
+    struct sig_Random expectedRandom;
+    sig_Random_init(&expectedRandom, sig_DEFAULT_RANDOM_SEED);
+    sig_Random_init(&expectedRandom, sig_Random_nextUInt32(&expectedRandom));
+
+    // A factor of 1 oversamples by 2.
+    struct sig_dsp_Oversampler* oversampler = sig_dsp_Oversampler_new(
+        &allocator, parent, 1, 1);
+    TEST_ASSERT_EQUAL_size_t(2, oversampler->factor);
+
+    // The child context shares the parent's tables,
+    // and is seeded from the parent's random number generator.
+    TEST_ASSERT_EQUAL_PTR(parent, oversampler->context->parent);
+    TEST_ASSERT_EQUAL_PTR(parent->tables, oversampler->context->tables);
+    TEST_ASSERT_EQUAL_UINT32(sig_Random_nextUInt32(&expectedRandom),
+        sig_Random_nextUInt32(&oversampler->context->random));
+
+    // Tables acquired by child Signals are visible to the parent.
+    struct sig_Buffer* table = sig_LookupTableCache_acquire(
+        oversampler->context->tables, &allocator, sig_table_sine, 64, 1);
+    TEST_ASSERT_NOT_NULL(sig_LookupTableCache_find(parent->tables,
+        sig_table_sine, 64, 1));
+
+    // Destroying the child leaves the parent's tables intact.
+    sig_dsp_Oversampler_destroy(&allocator, oversampler);
+    TEST_ASSERT_EQUAL_PTR(table, sig_LookupTableCache_acquire(parent->tables,
+        &allocator, sig_table_sine, 64, 1));
+    sig_LookupTableCache_release(parent->tables, &allocator, table);
+    sig_LookupTableCache_release(parent->tables, &allocator, table);
+
+    sig_SignalContext_destroy(&allocator, parent);
+}
+
+// Compares the FFT to a naive (double precision) DFT of a noise signal.
+void testFFTMatchesDFT(size_t length) {
+    struct sig_FFT* fft = sig_FFT_new(&allocator, length);
+    struct sig_Buffer* buffer = sig_Buffer_new(&allocator, length);
+    struct sig_Buffer* input = sig_Buffer_new(&allocator, length);
+    struct sig_Random random;
+    sig_Random_init(&random, 42);
+    sig_Random_fillBipolar(&random, input->samples, length);
+    for (size_t i = 0; i < length; i++) {
+        FLOAT_ARRAY(buffer->samples)[i] = FLOAT_ARRAY(input->samples)[i];
+    }
+
+    sig_FFT_forward(fft, buffer->samples);
+
+    float tolerance = 0.0001f * (float) length;
+    for (size_t k = 0; k <= length / 2; k++) {
+        double re = 0.0;
+        double im = 0.0;
+        for (size_t n = 0; n < length; n++) {
+            double phase = 2.0 * 3.14159265358979323846 *
+                (double) ((k * n) % length) / (double) length;
+            re += FLOAT_ARRAY(input->samples)[n] * cos(phase);
+            im -= FLOAT_ARRAY(input->samples)[n] * sin(phase);
+        }
+
+        if (k == 0) {
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, re,
+                FLOAT_ARRAY(buffer->samples)[0]);
+        } else if (k == length / 2) {
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, re,
+                FLOAT_ARRAY(buffer->samples)[1]);
+        } else {
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, re,
+                FLOAT_ARRAY(buffer->samples)[k * 2]);
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, im,
+                FLOAT_ARRAY(buffer->samples)[k * 2 + 1]);
+        }
+    }
+
+    sig_FFT_inverse(fft, buffer->samples);
+    for (size_t i = 0; i < length; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, FLOAT_ARRAY(input->samples)[i],
+            FLOAT_ARRAY(buffer->samples)[i]);
+    }
+
+    sig_Buffer_destroy(&allocator, buffer);
+    sig_Buffer_destroy(&allocator, input);
+    sig_FFT_destroy(&allocator, fft);
+}
+
+void test_sig_FFT_new(void) {
+    TEST_ASSERT_NULL(sig_FFT_new(&allocator, 16));
+    TEST_ASSERT_NULL(sig_FFT_new(&allocator, 16384));
+    TEST_ASSERT_NULL(sig_FFT_new(&allocator, 100));
+
+    struct sig_FFT* fft = sig_FFT_new(&allocator, sig_FFT_MIN_LENGTH);
+    TEST_ASSERT_NOT_NULL(fft);
+    TEST_ASSERT_EQUAL_size_t(sig_FFT_MIN_LENGTH, fft->length);
+    sig_FFT_destroy(&allocator, fft);
+}
+
+void test_sig_FFT_matchesDFT(void) {
+    // Both power-of-four and non-power-of-four
+    // complex transform lengths are covered.
+    testFFTMatchesDFT(32);
+    testFFTMatchesDFT(64);
+    testFFTMatchesDFT(512);
+    testFFTMatchesDFT(2048);
+}
+
+void test_sig_FFT_roundTrip(void) {
+    size_t length = sig_FFT_MAX_LENGTH;
+    struct sig_FFT* fft = sig_FFT_new(&allocator, length);
+    struct sig_Buffer* buffer = sig_Buffer_new(&allocator, length);
+    fillSine(buffer->samples, length, 1000.0f, 48000.0f, 0);
+
+    sig_FFT_forward(fft, buffer->samples);
+    sig_FFT_inverse(fft, buffer->samples);
+
+    struct sig_Buffer* expected = sig_Buffer_new(&allocator, length);
+    fillSine(expected->samples, length, 1000.0f, 48000.0f, 0);
+    for (size_t i = 0; i < length; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, FLOAT_ARRAY(expected->samples)[i],
+            FLOAT_ARRAY(buffer->samples)[i]);
+    }
+
+    sig_Buffer_destroy(&allocator, buffer);
+    sig_Buffer_destroy(&allocator, expected);
+    sig_FFT_destroy(&allocator, fft);
+}
+
+// Runs noise through a Convolver and compares its output
+// to a direct convolution with the impulse response.
+void testConvolverMatchesDirectConvolution(size_t blockSize,
+    size_t irLength, size_t numBlocks, size_t expectedLatency) {
+    struct sig_AudioSettings settings = mono441kAudioSettings;
+    settings.blockSize = blockSize;
+    struct sig_SignalContext* convolverContext = sig_SignalContext_new(
+        &allocator, &settings);
+    size_t totalLength = blockSize * numBlocks;
+    struct sig_Buffer* ir = sig_Buffer_new(&allocator, irLength);
+    struct sig_Buffer* input = sig_Buffer_new(&allocator, totalLength);
+    struct sig_Buffer* output = sig_Buffer_new(&allocator, totalLength);
+    struct sig_Random random;
+    sig_Random_init(&random, 7);
+    sig_Random_fillBipolar(&random, input->samples, totalLength);
+
+    // A decaying noise impulse response.
+    sig_Random_fillBipolar(&random, ir->samples, irLength);
+    for (size_t i = 0; i < irLength; i++) {
+        FLOAT_ARRAY(ir->samples)[i] *= expf(-4.0f * (float) i /
+            (float) irLength);
+    }
+
+    struct sig_dsp_Convolver* convolver = sig_dsp_Convolver_new(&allocator,
+        convolverContext, irLength);
+    convolver->inputs.source = sig_AudioBlock_new(&allocator, &settings);
+    sig_dsp_Convolver_loadIR(convolver, ir);
+    TEST_ASSERT_EQUAL_size_t(expectedLatency, convolver->latency);
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(convolver->inputs.source)[i] =
+                FLOAT_ARRAY(input->samples)[block * blockSize + i];
+        }
+
+        convolver->signal.generate(convolver);
+
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(output->samples)[block * blockSize + i] =
+                FLOAT_ARRAY(convolver->outputs.main)[i];
+        }
+    }
+
+    for (size_t n = 0; n < totalLength; n++) {
+        double expected = 0.0;
+        if (n >= expectedLatency) {
+            size_t delayed = n - expectedLatency;
+            for (size_t k = 0; k < irLength && k <= delayed; k++) {
+                expected += FLOAT_ARRAY(ir->samples)[k] *
+                    FLOAT_ARRAY(input->samples)[delayed - k];
+            }
+        }
+
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, (float) expected,
+            FLOAT_ARRAY(output->samples)[n]);
+    }
+
+    sig_AudioBlock_destroy(&allocator, convolver->inputs.source);
+    sig_dsp_Convolver_destroy(&allocator, convolver);
+    sig_Buffer_destroy(&allocator, ir);
+    sig_Buffer_destroy(&allocator, input);
+    sig_Buffer_destroy(&allocator, output);
+    sig_SignalContext_destroy(&allocator, convolverContext);
+}
+
+void test_sig_dsp_Convolver_shortIR(void) {
+    // An impulse response that fits within the head partitions.
+    testConvolverMatchesDirectConvolution(48, 37, 20, 0);
+}
+
+void test_sig_dsp_Convolver_longIR(void) {
+    // With 64 sample blocks, the head partitions contain 64 samples
+    // and the tail partitions 512, so this impulse response spans
+    // the head and several tail partitions.
+    testConvolverMatchesDirectConvolution(64, 3000, 100, 0);
+}
+
+void test_sig_dsp_Convolver_unalignedBlockSize(void) {
+    // Blocks that aren't a multiple of the minimum partition size
+    // are delayed by one partition.
+    testConvolverMatchesDirectConvolution(20, 500, 60,
+        sig_dsp_Convolver_MIN_PARTITION_SIZE);
+}
+
+void test_sig_dsp_Convolver_identity(void) {
+    struct sig_Buffer* ir = sig_Buffer_new(&allocator, 1);
+    FLOAT_ARRAY(ir->samples)[0] = 1.0f;
+    struct sig_dsp_Convolver* convolver = sig_dsp_Convolver_new(&allocator,
+        context, 1024);
+    convolver->inputs.source = sig_AudioBlock_new(&allocator,
+        audioSettings);
+
+    // Before an impulse response has been loaded, the output is silent.
+    fillSine(convolver->inputs.source, audioSettings->blockSize, 440.0f,
+        audioSettings->sampleRate, 0);
+    convolver->signal.generate(convolver);
+    testAssertBufferIsSilent(&allocator, convolver->outputs.main,
+        audioSettings->blockSize);
+
+    sig_dsp_Convolver_loadIR(convolver, ir);
+    convolver->signal.generate(convolver);
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f,
+            FLOAT_ARRAY(convolver->inputs.source)[i],
+            FLOAT_ARRAY(convolver->outputs.main)[i]);
+    }
+
+    sig_AudioBlock_destroy(&allocator, convolver->inputs.source);
+    sig_dsp_Convolver_destroy(&allocator, convolver);
+    sig_Buffer_destroy(&allocator, ir);
+}
+
+void test_sig_tables_precomputed(void) {
+    // The precomputed tables should match the runtime generators.
+    for (size_t i = 0; i < sig_tables_SINE_LENGTH +
+        sig_tables_SINE_NUM_GUARD_POINTS; i++) {
+        float x = (float) i / (float) sig_tables_SINE_LENGTH;
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, sig_table_sine(x),
+            sig_tables_sine[i]);
+    }
+
+    for (size_t i = 0; i <= sig_tables_TANH_LENGTH; i++) {
+        float x = (float) i / (float) sig_tables_TANH_LENGTH;
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, sig_table_tanh(x),
+            sig_tables_tanh[i]);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 1.0f, sig_tables_exp2[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 2.0f,
+        sig_tables_exp2[sig_tables_EXP2_LENGTH]);
+
+    // Registered tables should be returned from the cache without copying.
+    struct sig_LookupTableCache* cache = sig_LookupTableCache_new(&allocator);
+    sig_tables_provide(cache, &allocator);
+    struct sig_Buffer* sine = sig_LookupTableCache_acquire(cache, &allocator,
+        sig_table_sine, sig_tables_SINE_LENGTH,
+        sig_tables_SINE_NUM_GUARD_POINTS);
+    TEST_ASSERT_EQUAL_PTR(sig_tables_sine, sine->samples);
+    sig_LookupTableCache_release(cache, &allocator, sine);
+    sig_LookupTableCache_destroy(&allocator, cache);
+}
+
+void test_sig_tables_readByFMSignals(void) {
+    struct sig_SignalContext* fmContext = sig_SignalContext_new(&allocator,
+        audioSettings);
+    sig_tables_provide(fmContext->tables, &allocator);
+
+    struct sig_dsp_TwoOpFM* fm = sig_dsp_TwoOpFM_new(&allocator,
+        fmContext);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(sig_tables_sine, fm->sineTable->samples,
+        "TwoOpFM should read the precomputed sine table.");
+
+    struct sig_dsp_FMOperatorBank* bank = sig_dsp_FMOperatorBank_new(
+        &allocator, fmContext, 2);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(sig_tables_sine, bank->sineTable->samples,
+        "FMOperatorBank should read the precomputed sine table.");
+
+    sig_dsp_FMOperatorBank_destroy(&allocator, bank);
+    sig_dsp_TwoOpFM_destroy(&allocator, fm);
+    sig_SignalContext_destroy(&allocator, fmContext);
+}
+
+void test_sig_WavetableBankView(void) {
+    struct sig_WavetableBank* saws = sig_WavetableBankView_new(&allocator,
+        sig_tables_sawMipmaps, sig_tables_MIPMAP_NUM_LEVELS,
+        sig_tables_MIPMAP_LENGTH);
+
+    TEST_ASSERT_EQUAL_size_t(sig_tables_MIPMAP_NUM_LEVELS, saws->length);
+    for (size_t i = 0; i < saws->length; i++) {
+        TEST_ASSERT_EQUAL_size_t(sig_tables_MIPMAP_LENGTH,
+            saws->waves[i]->length);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(
+            sig_tables_sawMipmaps + (i * sig_tables_MIPMAP_LENGTH),
+            saws->waves[i]->samples,
+            "Each wave should reference the precomputed table directly.");
+    }
+
+    // The most band-limited level should be a single (inverted) sine,
+    // with the same phase as the naive saw wave.
+    struct sig_Buffer* topLevel = saws->waves[saws->length - 1];
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, -2.0f / sig_PI,
+        FLOAT_ARRAY(topLevel->samples)[sig_tables_MIPMAP_LENGTH / 4]);
+
+    // The fullest level should closely approximate the naive saw,
+    // away from its discontinuity.
+    struct sig_Buffer* bottomLevel = saws->waves[0];
+    for (size_t i = sig_tables_MIPMAP_LENGTH / 8;
+        i < sig_tables_MIPMAP_LENGTH - (sig_tables_MIPMAP_LENGTH / 8); i++) {
+        float phase = sig_TWOPI * (float) i / sig_tables_MIPMAP_LENGTH;
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, sig_waveform_saw(phase),
+            FLOAT_ARRAY(bottomLevel->samples)[i]);
+    }
+
+    sig_WavetableBankView_destroy(&allocator, saws);
+}
+
+void test_sig_WavetableBankView_newMipmapped(void) {
+    struct sig_WavetableBank* saw = sig_WavetableBankView_newMipmapped(
+        &allocator, sig_tables_sawMipmaps, sig_tables_MIPMAP_NUM_LEVELS,
+        sig_tables_MIPMAP_LENGTH);
+
+    TEST_ASSERT_EQUAL_size_t(1, saw->length);
+    TEST_ASSERT_EQUAL_size_t(sig_tables_MIPMAP_NUM_LEVELS, saw->numLevels);
+    TEST_ASSERT_EQUAL_PTR(saw->waves[0], saw->mipmaps[0]);
+    for (size_t i = 0; i < saw->numLevels; i++) {
+        TEST_ASSERT_EQUAL_PTR(
+            sig_tables_sawMipmaps + (i * sig_tables_MIPMAP_LENGTH),
+            saw->mipmaps[i]->samples);
+    }
+
+    sig_WavetableBankView_destroy(&allocator, saw);
+}
+
+float nonBandlimitedSaw(size_t i, float_array_ptr array) {
+    return sig_waveform_saw(sig_TWOPI * (float) i / 1024.0f);
+}
+
+float nonBandlimitedSquare(size_t i, float_array_ptr array) {
+    return sig_waveform_square(sig_TWOPI * (float) i / 1024.0f);
+}
+
+struct sig_WavetableBank* newNonBandlimitedBank(void) {
+    struct sig_WavetableBank* bank = sig_WavetableBank_new(&allocator, 2,
+        1024);
+    sig_Buffer_fill(bank->waves[0], nonBandlimitedSaw);
+    sig_Buffer_fill(bank->waves[1], nonBandlimitedSquare);
+
+    return bank;
+}
+
+void test_sig_WavetableBank_generateMipmaps(void) {
+    struct sig_WavetableBank* bank = newNonBandlimitedBank();
+    TEST_ASSERT_EQUAL_size_t(1, bank->numLevels);
+    TEST_ASSERT_NULL(bank->mipmaps);
+
+    sig_WavetableBank_generateMipmaps(&allocator, bank);
+    TEST_ASSERT_EQUAL_size_t(10, bank->numLevels);
+
+    for (size_t wave = 0; wave < bank->length; wave++) {
+        struct sig_Buffer* original = bank->waves[wave];
+        TEST_ASSERT_EQUAL_PTR(original, bank->mipmaps[wave]);
+
+        for (size_t level = 1; level < bank->numLevels; level++) {
+            struct sig_Buffer* mipmap =
+                bank->mipmaps[level * bank->length + wave];
+            size_t numHarmonics = 512 >> level;
+            size_t expectedLength = 1024 >> (level - 1);
+            if (expectedLength < sig_WavetableBank_MIN_MIPMAP_LENGTH) {
+                expectedLength = sig_WavetableBank_MIN_MIPMAP_LENGTH;
+            }
+            TEST_ASSERT_EQUAL_size_t(expectedLength, mipmap->length);
+
+            // Each level should retain the original's harmonics
+            // up to its limit, and none above it.
+            float lastHarmonic = (float) numHarmonics;
+            TEST_ASSERT_FLOAT_WITHIN(0.0001f,
+                measureAmplitude(original->samples, original->length,
+                    lastHarmonic, (float) original->length),
+                measureAmplitude(mipmap->samples, mipmap->length,
+                    lastHarmonic, (float) mipmap->length));
+            TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f,
+                measureAmplitude(mipmap->samples, mipmap->length,
+                    lastHarmonic + 1.0f, (float) mipmap->length));
+        }
+    }
+
+    sig_WavetableBank_destroy(&allocator, bank);
+}
+
+void test_sig_WavetableBank_readBandlimitedAtPhase(void) {
+    struct sig_WavetableBank* bank = newNonBandlimitedBank();
+    float phase = 0.3f;
+    float tableIdx = 0.25f;
+
+    // Banks without mipmaps are read directly.
+    TEST_ASSERT_EQUAL_FLOAT(
+        sig_WavetableBank_readLinearAtPhase(bank, tableIdx, phase),
+        sig_WavetableBank_readBandlimitedAtPhase(bank, tableIdx, phase,
+            0.1f));
+
+    sig_WavetableBank_generateMipmaps(&allocator, bank);
+
+    // Low frequencies read from the full bandwidth waves.
+    TEST_ASSERT_EQUAL_FLOAT(
+        sig_WavetableBank_readLinearAtPhase(bank, tableIdx, phase),
+        sig_WavetableBank_readBandlimitedAtPhase(bank, tableIdx, phase,
+            20.0f / 44100.0f));
+
+    // Halfway through the third octave, the third level's harmonics
+    // are all below the Nyquist frequency.
+    struct sig_WavetableBank levelThree = *bank;
+    levelThree.waves = bank->mipmaps + 3 * bank->length;
+    levelThree.mipmaps = NULL;
+    float increment = powf(2.0f, 2.5f) / 1024.0f;
+    TEST_ASSERT_EQUAL_FLOAT(
+        sig_WavetableBank_readLinearAtPhase(&levelThree, tableIdx, phase),
+        sig_WavetableBank_readBandlimitedAtPhase(bank, tableIdx, phase,
+            increment));
+
+    // Towards the end of the octave, the next level is crossfaded in.
+    struct sig_WavetableBank levelFour = levelThree;
+    levelFour.waves = bank->mipmaps + 4 * bank->length;
+    float fade = (0.95f - (1.0f - sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES)) /
+        sig_WavetableBank_MIPMAP_CROSSFADE_OCTAVES;
+    float three = sig_WavetableBank_readLinearAtPhase(&levelThree, tableIdx,
+        phase);
+    float four = sig_WavetableBank_readLinearAtPhase(&levelFour, tableIdx,
+        phase);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, three + (four - three) * fade,
+        sig_WavetableBank_readBandlimitedAtPhase(bank, tableIdx, phase,
+            powf(2.0f, 2.95f) / 1024.0f));
+
+    // Negative frequencies are band-limited in the same way.
+    TEST_ASSERT_EQUAL_FLOAT(
+        sig_WavetableBank_readBandlimitedAtPhase(bank, tableIdx, phase,
+            increment),
+        sig_WavetableBank_readBandlimitedAtPhase(bank, tableIdx, phase,
+            -increment));
+
+    // Levels can be selected once and then read from repeatedly.
+    size_t level;
+    float selectedFade;
+    sig_WavetableBank_selectMipmapLevel(bank, powf(2.0f, 2.95f) / 1024.0f,
+        &level, &selectedFade);
+    TEST_ASSERT_EQUAL_size_t(3, level);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, fade, selectedFade);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, three + (four - three) * fade,
+        sig_WavetableBank_readMipmapLevelAtPhase(bank, level, selectedFade,
+            tableIdx, phase));
+
+    sig_WavetableBank_destroy(&allocator, bank);
+}
+
+// Returns the amplitude of an aliased harmonic
+// of a 5 KHz saw wave played by a WavetableBankOscillator.
+float measureWavetableBankAliasing(struct sig_WavetableBank* bank) {
+    size_t numBlocks = 100;
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_Buffer* output = sig_Buffer_new(&allocator,
+        blockSize * numBlocks);
+    struct sig_dsp_WavetableBankOscillator* osc =
+        sig_dsp_WavetableBankOscillator_new(&allocator, context);
+    osc->wavetables = bank;
+    osc->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 5000.0f);
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        osc->signal.generate(osc);
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(output->samples)[block * blockSize + i] =
+                FLOAT_ARRAY(osc->outputs.main)[i];
+        }
+    }
+
+    // The sixth harmonic (30 KHz) aliases to 18 KHz.
+    float aliasAmp = measureAmplitude(output->samples, output->length,
+        audioSettings->sampleRate - 30000.0f, audioSettings->sampleRate);
+
+    sig_AudioBlock_destroy(&allocator, osc->inputs.freq);
+    sig_dsp_WavetableBankOscillator_destroy(&allocator, osc);
+    sig_Buffer_destroy(&allocator, output);
+
+    return aliasAmp;
+}
+
+void test_sig_dsp_WavetableBankOscillator_mipmapped(void) {
+    struct sig_WavetableBank* bank = newNonBandlimitedBank();
+    float unfilteredAliasAmp = measureWavetableBankAliasing(bank);
+    TEST_ASSERT_TRUE_MESSAGE(unfilteredAliasAmp > 0.01f,
+        "A saw without mipmaps should alias at high frequencies.");
+
+    sig_WavetableBank_generateMipmaps(&allocator, bank);
+    float mipmappedAliasAmp = measureWavetableBankAliasing(bank);
+    TEST_ASSERT_TRUE_MESSAGE(mipmappedAliasAmp < 0.001f,
+        "A saw with mipmaps shouldn't alias.");
+
+    sig_WavetableBank_destroy(&allocator, bank);
+}
+
+void test_sig_dsp_Value(void) {
+    struct sig_dsp_Value* value = sig_dsp_Value_new(&allocator, context);
+    value->parameters.value = 123.45f;
+
+    // Output should contain the value parameter.
+    value->signal.generate(value);
+    testAssertBufferContainsValueOnly(&allocator,
+        123.45f, value->outputs.main, audioSettings->blockSize);
+
+    // Output should contain the updated value parameter.
+    value->parameters.value = 1.111f;
+    value->signal.generate(value);
+    testAssertBufferContainsValueOnly(&allocator,
+        1.111f, value->outputs.main, audioSettings->blockSize);
+
+    // The lastSample member should have been updated.
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(FLOAT_EPSILON,
+        1.111f, value->lastSample,
+        "lastSample should have been updated.");
+
+    // After multiple calls to generate(),
+    // the output should continue to contain the value parameter.
+    value->signal.generate(value);
+    value->signal.generate(value);
+    testAssertBufferContainsValueOnly(&allocator,
+        1.111f, value->outputs.main, audioSettings->blockSize);
+
+    sig_dsp_Value_destroy(&allocator, value);
+}
+
+void test_sig_dsp_ConstantValue(void) {
+    struct sig_dsp_ConstantValue* constVal = sig_dsp_ConstantValue_new(
+        &allocator, context, 42.0f);
+
+    // Output should contain the value, even prior to being evaluated.
+    testAssertBufferContainsValueOnly(&allocator, 42.0f,
+        constVal->outputs.main, audioSettings->blockSize);
+
+    // The output should not change.
+    constVal->signal.generate(constVal);
+    testAssertBufferContainsValueOnly(&allocator, 42.0f,
+        constVal->outputs.main, audioSettings->blockSize);
+}
+
+void test_sig_dsp_TimedTriggerCounter(void) {
+    float halfBlockSecs = (audioSettings->blockSize / 2) /
+        audioSettings->sampleRate;
+
+    // A trigger right at the beginning of the input buffer.
+    float* source = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.0f);
+    source[0] = 1.0;
+
+    struct sig_dsp_TimedTriggerCounter* counter = sig_dsp_TimedTriggerCounter_new(&allocator, context);
+    counter->inputs.source = source;
+    counter->inputs.duration = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, halfBlockSecs);
+    counter->inputs.count = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.0f);
+
+    // The output should contain a single trigger half block size.
+    // (i.e. 24 samples after we received the
+    // rising edge of the input trigger)
+    counter->signal.generate(counter);
+    float* expected = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.0f);
+    expected[23] = 1.0f;
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, counter->outputs.main,
+        audioSettings->blockSize);
+
+    // The first trigger can happen later after the
+    // "duration" has elapsed and it will be recognized
+    // because it shouldn't start counting until a trigger is
+    // received.
+    source[0] = 0.0f;
+    source[24] = 1.0f;
+    counter->signal.generate(counter);
+    sig_fillWithSilence(expected, audioSettings->blockSize);
+    expected[47] = 1.0f;
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, counter->outputs.main,
+        audioSettings->blockSize);
+
+    // When the input contains two triggers in the
+    // specified duration, but we're looking for one,
+    // no trigger should be output.
+    sig_fillWithSilence(source, audioSettings->blockSize);
+    source[1] = 1.0f;
+    source[20] = 1.0f;
+    counter->signal.generate(counter);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(
+        context->silence->outputs.main,
+        counter->outputs.main,
+        audioSettings->blockSize);
+
+    // When we're looking for two triggers and we get two triggers,
+    // one trigger should be fired.
+    sig_fillWithValue(counter->inputs.count, audioSettings->blockSize,
+        2.0f);
+    counter->signal.generate(counter);
+    sig_fillWithSilence(expected, audioSettings->blockSize);
+    expected[24] = 1.0f;
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, counter->outputs.main,
+        audioSettings->blockSize);
+
+    // When we're looking for two triggers and
+    // the second one comes too late,
+    // No triggers should be fired.
+    sig_fillWithSilence(source, audioSettings->blockSize);
+    source[0] = 1.0f;
+    source[25] = 1.0f;
+    counter->signal.generate(counter);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(
+        context->silence->outputs.main,
+        counter->outputs.main,
+        audioSettings->blockSize);
+}
+
+// Fills a block with randomly spaced triggers of random widths,
+// some of which are too small to cross a clock's threshold.
+void fillWithTriggers(float_array_ptr samples, size_t length,
+    float* value) {
+    for (size_t i = 0; i < length; i++) {
+        if (sig_randf() < 0.05f) {
+            *value = *value > 0.0f ? 0.0f :
+                sig_randf() < 0.2f ? 0.02f : sig_randf() + 0.1f;
+        }
+        FLOAT_ARRAY(samples)[i] = *value;
+    }
+}
+
+// Generates both Signals for a number of blocks of triggers,
+// with the first reading them as a dense block and the second
+// as events, and asserts that their outputs are identical.
+void testAssertEventsMatchBlocks(void* blockSignal,
+    float_array_ptr* blockInput, float_array_ptr blockOutput,
+    void* eventSignal, struct sig_EventBlock** eventInput,
+    float_array_ptr eventOutput) {
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr triggers = sig_AudioBlock_new(&allocator,
+        audioSettings);
+    struct sig_dsp_BlockToEvents* toEvents = sig_dsp_BlockToEvents_new(
+        &allocator, context);
+    toEvents->inputs.source = triggers;
+    *blockInput = triggers;
+    *eventInput = toEvents->outputs.main;
+
+    float value = 0.0f;
+    for (size_t block = 0; block < 200; block++) {
+        fillWithTriggers(triggers, blockSize, &value);
+        toEvents->signal.generate(toEvents);
+        ((struct sig_dsp_Signal*) blockSignal)->generate(blockSignal);
+        ((struct sig_dsp_Signal*) eventSignal)->generate(eventSignal);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(blockOutput, eventOutput,
+            blockSize);
+    }
+
+    sig_dsp_BlockToEvents_destroy(&allocator, toEvents);
+    sig_AudioBlock_destroy(&allocator, triggers);
+}
+
+void test_sig_dsp_TimedTriggerCounter_events(void) {
+    struct sig_dsp_TimedTriggerCounter* counters[2];
+    for (size_t i = 0; i < 2; i++) {
+        counters[i] = sig_dsp_TimedTriggerCounter_new(&allocator, context);
+        counters[i]->inputs.duration = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, 0.002f);
+        counters[i]->inputs.count = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, 2.0f);
+    }
+
+    testAssertEventsMatchBlocks(counters[0],
+        &counters[0]->inputs.source, counters[0]->outputs.main,
+        counters[1], &counters[1]->inputs.sourceEvents,
+        counters[1]->outputs.main);
+
+    for (size_t i = 0; i < 2; i++) {
+        sig_AudioBlock_destroy(&allocator, counters[i]->inputs.duration);
+        sig_AudioBlock_destroy(&allocator, counters[i]->inputs.count);
+        sig_dsp_TimedTriggerCounter_destroy(&allocator, counters[i]);
+    }
+}
+
+void test_sig_dsp_GatedTimer_events(void) {
+    struct sig_dsp_GatedTimer* timers[2];
+    for (size_t i = 0; i < 2; i++) {
+        timers[i] = sig_dsp_GatedTimer_new(&allocator, context);
+        timers[i]->inputs.duration = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, 0.0005f);
+        timers[i]->inputs.loop = context->unity->outputs.main;
+    }
+
+    testAssertEventsMatchBlocks(timers[0],
+        &timers[0]->inputs.gate, timers[0]->outputs.main,
+        timers[1], &timers[1]->inputs.gateEvents,
+        timers[1]->outputs.main);
+
+    for (size_t i = 0; i < 2; i++) {
+        sig_AudioBlock_destroy(&allocator, timers[i]->inputs.duration);
+        sig_dsp_GatedTimer_destroy(&allocator, timers[i]);
+    }
+}
+
+void test_sig_dsp_ToggleGate_events(void) {
+    struct sig_dsp_ToggleGate* gates[2];
+    for (size_t i = 0; i < 2; i++) {
+        gates[i] = sig_dsp_ToggleGate_new(&allocator, context);
+    }
+
+    testAssertEventsMatchBlocks(gates[0],
+        &gates[0]->inputs.trigger, gates[0]->outputs.main,
+        gates[1], &gates[1]->inputs.triggerEvents,
+        gates[1]->outputs.main);
+
+    for (size_t i = 0; i < 2; i++) {
+        sig_dsp_ToggleGate_destroy(&allocator, gates[i]);
+    }
+}
+
+void test_sig_dsp_TimedGate_events(void) {
+    struct sig_dsp_TimedGate* gates[2];
+    for (size_t i = 0; i < 2; i++) {
+        gates[i] = sig_dsp_TimedGate_new(&allocator, context);
+        gates[i]->inputs.duration = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, 0.0005f);
+        gates[i]->parameters.resetOnTrigger = 1.0f;
+    }
+
+    testAssertEventsMatchBlocks(gates[0],
+        &gates[0]->inputs.trigger, gates[0]->outputs.main,
+        gates[1], &gates[1]->inputs.triggerEvents,
+        gates[1]->outputs.main);
+
+    for (size_t i = 0; i < 2; i++) {
+        sig_AudioBlock_destroy(&allocator, gates[i]->inputs.duration);
+        sig_dsp_TimedGate_destroy(&allocator, gates[i]);
+    }
+}
+
+void test_sig_dsp_ClockDetector_events(void) {
+    struct sig_dsp_ClockDetector* detectors[2];
+    for (size_t i = 0; i < 2; i++) {
+        detectors[i] = sig_dsp_ClockDetector_new(&allocator, context);
+    }
+
+    testAssertEventsMatchBlocks(detectors[0],
+        &detectors[0]->inputs.source, detectors[0]->outputs.bpm,
+        detectors[1], &detectors[1]->inputs.sourceEvents,
+        detectors[1]->outputs.bpm);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(detectors[0]->outputs.main,
+        detectors[1]->outputs.main, audioSettings->blockSize);
+
+    for (size_t i = 0; i < 2; i++) {
+        sig_dsp_ClockDetector_destroy(&allocator, detectors[i]);
+    }
+}
+
+void test_sig_dsp_ClockSource_events(void) {
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr pulses = sig_AudioBlock_newSilent(&allocator,
+        audioSettings);
+    float_array_ptr taps = sig_AudioBlock_new(&allocator, audioSettings);
+    struct sig_dsp_BlockToEvents* pulseEvents = sig_dsp_BlockToEvents_new(
+        &allocator, context);
+    pulseEvents->inputs.source = pulses;
+    struct sig_dsp_BlockToEvents* tapEvents = sig_dsp_BlockToEvents_new(
+        &allocator, context);
+    tapEvents->inputs.source = taps;
+
+    struct sig_dsp_ClockSource* blockClock = sig_dsp_ClockSource_new(
+        &allocator, context);
+    blockClock->inputs.pulse = pulses;
+    blockClock->inputs.tap = taps;
+    struct sig_dsp_ClockSource* eventClock = sig_dsp_ClockSource_new(
+        &allocator, context);
+    eventClock->inputs.pulseEvents = pulseEvents->outputs.main;
+    eventClock->inputs.tapEvents = tapEvents->outputs.main;
+
+    // Taps alone latch a tempo, which a pulse later overrides.
+    float tapValue = 0.0f;
+    for (size_t block = 0; block < 400; block++) {
+        fillWithTriggers(taps, blockSize, &tapValue);
+        if (block >= 300) {
+            sig_fillWithSilence(pulses, blockSize);
+            FLOAT_ARRAY(pulses)[block % blockSize] = 1.0f;
+        }
+
+        pulseEvents->signal.generate(pulseEvents);
+        tapEvents->signal.generate(tapEvents);
+        blockClock->signal.generate(blockClock);
+        eventClock->signal.generate(eventClock);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(blockClock->outputs.main,
+            eventClock->outputs.main, blockSize);
+    }
+
+    sig_dsp_ClockSource_destroy(&allocator, eventClock);
+    sig_dsp_ClockSource_destroy(&allocator, blockClock);
+    sig_dsp_BlockToEvents_destroy(&allocator, tapEvents);
+    sig_dsp_BlockToEvents_destroy(&allocator, pulseEvents);
+    sig_AudioBlock_destroy(&allocator, taps);
+    sig_AudioBlock_destroy(&allocator, pulses);
+}
+
+void test_sig_dsp_MidiNote(void) {
+    struct sig_midi_EventQueue* queue = sig_midi_EventQueue_new(&allocator,
+        16);
+    struct sig_dsp_MidiNote* note = sig_dsp_MidiNote_new(&allocator,
+        context);
+    note->inputs.source = queue;
+    note->parameters.channel = 1.0f;
+
+    // Play a note, and then a second one on top of it.
+    // A note on another channel should be ignored.
+    uint8_t first[] = {0x90, 60, 127};
+    uint8_t second[] = {0x90, 67, 64};
+    uint8_t otherChannel[] = {0x91, 72, 127};
+    sig_midi_EventQueue_writeBytes(queue, first, 3, 5);
+    sig_midi_EventQueue_writeBytes(queue, otherChannel, 3, 8);
+    sig_midi_EventQueue_writeBytes(queue, second, 3, 10);
+    note->signal.generate(note);
+
+    float* gate = FLOAT_ARRAY(note->outputs.gate);
+    float* noteNum = FLOAT_ARRAY(note->outputs.note);
+    float* trigger = FLOAT_ARRAY(note->outputs.trigger);
+    testAssertBufferIsSilent(&allocator, gate, 5);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f, gate + 5,
+        audioSettings->blockSize - 5);
+    testAssertBufferContainsValueOnly(&allocator, 60.0f, noteNum + 5, 5);
+    testAssertBufferContainsValueOnly(&allocator, 67.0f, noteNum + 10,
+        audioSettings->blockSize - 10);
+    TEST_ASSERT_EQUAL_FLOAT(64.0f / 127.0f,
+        FLOAT_ARRAY(note->outputs.velocity)[10]);
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(i == 5 || i == 10 ? 1.0f : 0.0f,
+            trigger[i]);
+    }
+
+    // Releasing the second note should return to the first
+    // without retriggering, and releasing that (with a note on
+    // with zero velocity) should close the gate.
+    // Offsets beyond the block should take effect at its end.
+    sig_midi_EventQueue_clear(queue);
+    uint8_t releaseSecond[] = {0x80, 67, 0};
+    uint8_t releaseFirst[] = {0x90, 60, 0};
+    sig_midi_EventQueue_writeBytes(queue, releaseSecond, 3, 2);
+    sig_midi_EventQueue_writeBytes(queue, releaseFirst, 3, 1000);
+    note->signal.generate(note);
+
+    size_t last = audioSettings->blockSize - 1;
+    testAssertBufferContainsValueOnly(&allocator, 67.0f, noteNum, 2);
+    testAssertBufferContainsValueOnly(&allocator, 60.0f, noteNum + 2,
+        last - 2);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f, gate, last);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, gate[last]);
+    testAssertBufferIsSilent(&allocator, trigger, audioSettings->blockSize);
+
+    // With no events, the outputs should hold their values.
+    sig_midi_EventQueue_clear(queue);
+    note->signal.generate(note);
+    testAssertBufferIsSilent(&allocator, gate, audioSettings->blockSize);
+    testAssertBufferContainsValueOnly(&allocator, 60.0f, noteNum,
+        audioSettings->blockSize);
+
+    sig_dsp_MidiNote_destroy(&allocator, note);
+    sig_midi_EventQueue_destroy(&allocator, queue);
+}
+
+void test_sig_dsp_MidiCC(void) {
+    struct sig_midi_EventQueue* queue = sig_midi_EventQueue_new(&allocator,
+        16);
+    struct sig_dsp_MidiCC* cc = sig_dsp_MidiCC_new(&allocator, context);
+    cc->inputs.source = queue;
+    cc->parameters.controller = 74.0f;
+
+    // Only changes to the selected controller should be output,
+    // each at the sample at which it occurs.
+    uint8_t bytes[] = {0xB3, 74, 127, 1, 64, 74, 0};
+    sig_midi_EventQueue_writeBytes(queue, bytes, 3, 12);
+    sig_midi_EventQueue_writeBytes(queue, bytes + 3, 2, 20);
+    sig_midi_EventQueue_writeBytes(queue, bytes + 5, 2, 30);
+    cc->signal.generate(cc);
+
+    float* output = FLOAT_ARRAY(cc->outputs.main);
+    testAssertBufferIsSilent(&allocator, output, 12);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f, output + 12, 18);
+    testAssertBufferIsSilent(&allocator, output + 30,
+        audioSettings->blockSize - 30);
+
+    sig_dsp_MidiCC_destroy(&allocator, cc);
+    sig_midi_EventQueue_destroy(&allocator, queue);
+}
+
+void test_sig_dsp_MidiClock(void) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_midi_EventQueue* queue = sig_midi_EventQueue_new(&allocator,
+        16);
+    struct sig_dsp_MidiClock* clock = sig_dsp_MidiClock_new(&allocator,
+        context);
+    clock->inputs.source = queue;
+    clock->parameters.divisor = 2.0f;
+    struct sig_dsp_EventsToBlock* pulses = sig_dsp_EventsToBlock_new(
+        &allocator, context);
+    pulses->inputs.source = clock->outputs.pulseEvents;
+
+    // Start, followed by clocks at every 10th sample,
+    // and one on the final sample of the block.
+    // Every second clock should output a pulse.
+    uint8_t start[] = {0xFA};
+    uint8_t tick[] = {0xF8};
+    sig_midi_EventQueue_writeBytes(queue, start, 1, 3);
+    for (size_t i = 0; i < 4; i++) {
+        sig_midi_EventQueue_writeBytes(queue, tick, 1, 7 + i * 10);
+    }
+    sig_midi_EventQueue_writeBytes(queue, tick, 1, blockSize - 1);
+    clock->signal.generate(clock);
+    pulses->signal.generate(pulses);
+
+    float* output = FLOAT_ARRAY(clock->outputs.main);
+    for (size_t i = 0; i < blockSize; i++) {
+        float expected = i == 7 || i == 27 || i == blockSize - 1 ?
+            1.0f : 0.0f;
+        TEST_ASSERT_EQUAL_FLOAT(expected, output[i]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(output, pulses->outputs.main, blockSize);
+    testAssertBufferIsSilent(&allocator, clock->outputs.running, 3);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f,
+        FLOAT_ARRAY(clock->outputs.running) + 3, blockSize - 3);
+
+    // The last pulse should end at the start of the next block,
+    // and stopping should only affect the running output.
+    sig_midi_EventQueue_clear(queue);
+    uint8_t stop[] = {0xFC};
+    sig_midi_EventQueue_writeBytes(queue, stop, 1, 10);
+    clock->signal.generate(clock);
+    pulses->signal.generate(pulses);
+    testAssertBufferIsSilent(&allocator, clock->outputs.main, blockSize);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(clock->outputs.main,
+        pulses->outputs.main, blockSize);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f,
+        clock->outputs.running, 10);
+    testAssertBufferIsSilent(&allocator,
+        FLOAT_ARRAY(clock->outputs.running) + 10, blockSize - 10);
+
+    sig_dsp_EventsToBlock_destroy(&allocator, pulses);
+    sig_dsp_MidiClock_destroy(&allocator, clock);
+    sig_midi_EventQueue_destroy(&allocator, queue);
+}
+
+void test_sig_dsp_Mul(void) {
+    struct sig_dsp_BinaryOp* gain = sig_dsp_Mul_new(&allocator, context);
+    gain->inputs.left = sig_AudioBlock_newWithValue(&allocator, audioSettings,
+        0.5f);
+    gain->inputs.right = sig_AudioBlock_newWithValue(&allocator, audioSettings,
+        440.0f);
+
+    gain->signal.generate(gain);
+    testAssertBufferContainsValueOnly(&allocator,
+        220.0f, gain->outputs.main, audioSettings->blockSize);
+
+    sig_fillWithValue(gain->inputs.left, audioSettings->blockSize, 0.0f);
+    gain->signal.generate(gain);
+    testAssertBufferContainsValueOnly(&allocator,
+        0.0f, gain->outputs.main, audioSettings->blockSize);
+
+    sig_fillWithValue(gain->inputs.left, audioSettings->blockSize, 2.0f);
+    gain->signal.generate(gain);
+    testAssertBufferContainsValueOnly(&allocator,
+        880.0f, gain->outputs.main, audioSettings->blockSize);
+
+    sig_fillWithValue(gain->inputs.left, audioSettings->blockSize, -1.0f);
+    gain->signal.generate(gain);
+    testAssertBufferContainsValueOnly(&allocator,
+        -440.0f, gain->outputs.main, audioSettings->blockSize);
+
+    sig_AudioBlock_destroy(&allocator, gain->inputs.left);
+    sig_AudioBlock_destroy(&allocator, gain->inputs.right);
+    sig_dsp_Mul_destroy(&allocator, gain);
+}
+
+void test_sig_dsp_Mixer(void) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_dsp_Mixer* mixer = sig_dsp_Mixer_new(&allocator, context, 3);
+
+    // Unconnected inputs are silent.
+    mixer->signal.generate(mixer);
+    testAssertBufferIsSilent(&allocator, mixer->outputs.main, blockSize);
+
+    mixer->inputs.sources[0] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.0f);
+    mixer->inputs.sources[1] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 2.0f);
+    mixer->inputs.sources[2] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 4.0f);
+    mixer->parameters.gains[1] = 0.5f;
+    mixer->parameters.gains[2] = -0.25f;
+    mixer->parameters.masterGain = 2.0f;
+
+    mixer->signal.generate(mixer);
+    testAssertBufferContainsValueOnly(&allocator, 2.0f,
+        mixer->outputs.main, blockSize);
+
+    // The stereo outputs are allocated, but remain silent.
+    testAssertBufferIsSilent(&allocator, mixer->outputs.left, blockSize);
+    testAssertBufferIsSilent(&allocator, mixer->outputs.right, blockSize);
+
+    // Inputs whose gain is zero are skipped,
+    // so that they don't contribute at all, even if they're not finite.
+    sig_fillWithValue(mixer->inputs.sources[1], blockSize, NAN);
+    mixer->parameters.gains[1] = 0.0f;
+    mixer->signal.generate(mixer);
+    testAssertBufferContainsValueOnly(&allocator, 0.0f,
+        mixer->outputs.main, blockSize);
+
+    // The output is silent when every input's gain is zero.
+    mixer->parameters.gains[0] = 0.0f;
+    mixer->parameters.gains[2] = 0.0f;
+    mixer->signal.generate(mixer);
+    testAssertBufferIsSilent(&allocator, mixer->outputs.main, blockSize);
+
+    for (size_t j = 0; j < 3; j++) {
+        sig_AudioBlock_destroy(&allocator, mixer->inputs.sources[j]);
+    }
+    sig_dsp_Mixer_destroy(&allocator, mixer);
+}
+
+void test_sig_dsp_Mixer_stereo(void) {
+    size_t blockSize = audioSettings->blockSize;
+    float centre = sqrtf(0.5f);
+    struct sig_dsp_Mixer* mixer = sig_dsp_Mixer_newStereo(&allocator,
+        context, 2);
+
+    mixer->inputs.sources[0] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.0f);
+    mixer->inputs.sources[1] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 2.0f);
+
+    // Inputs are centred by default, using an equal-power pan law.
+    mixer->signal.generate(mixer);
+    for (size_t i = 0; i < blockSize; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, 3.0f * centre,
+            FLOAT_ARRAY(mixer->outputs.left)[i]);
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, 3.0f * centre,
+            FLOAT_ARRAY(mixer->outputs.right)[i]);
+    }
+
+    // The mono output is allocated, but remains silent.
+    testAssertBufferIsSilent(&allocator, mixer->outputs.main, blockSize);
+
+    mixer->parameters.pans[0] = -1.0f;
+    mixer->parameters.pans[1] = 1.0f;
+    mixer->parameters.masterGain = 0.5f;
+    mixer->signal.generate(mixer);
+    testAssertBufferContainsValueOnly(&allocator, 0.5f,
+        mixer->outputs.left, blockSize);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f,
+        mixer->outputs.right, blockSize);
+
+    for (size_t j = 0; j < 2; j++) {
+        sig_AudioBlock_destroy(&allocator, mixer->inputs.sources[j]);
+    }
+    sig_dsp_Mixer_destroy(&allocator, mixer);
+}
+
+void test_sig_dsp_ModMatrix(void) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_dsp_ModMatrix* matrix = sig_dsp_ModMatrix_new(&allocator,
+        context, 2, 3);
+    TEST_ASSERT_NULL(matrix->outputs.destinations[3]);
+
+    matrix->inputs.sources[0] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.0f);
+    matrix->inputs.sources[1] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 2.0f);
+    matrix->parameters.offsets[2] = 0.5f;
+
+    // Without any routes, each destination is its offset.
+    matrix->signal.generate(matrix);
+    testAssertBufferIsSilent(&allocator, matrix->outputs.destinations[0],
+        blockSize);
+    testAssertBufferContainsValueOnly(&allocator, 0.5f,
+        matrix->outputs.destinations[2], blockSize);
+
+    sig_dsp_ModMatrix_setDepth(matrix, 0, 0, 0.5f);
+    sig_dsp_ModMatrix_setDepth(matrix, 1, 0, 0.25f);
+    sig_dsp_ModMatrix_setDepth(matrix, 1, 2, -1.0f);
+
+    // Out of range routes are ignored.
+    sig_dsp_ModMatrix_setDepth(matrix, 2, 0, 1.0f);
+    sig_dsp_ModMatrix_setDepth(matrix, 0, 3, 1.0f);
+
+    matrix->signal.generate(matrix);
+    TEST_ASSERT_EQUAL_size_t(2, matrix->numRoutes[0]);
+    TEST_ASSERT_EQUAL_size_t(0, matrix->numRoutes[1]);
+    TEST_ASSERT_EQUAL_size_t(1, matrix->numRoutes[2]);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f,
+        matrix->outputs.destinations[0], blockSize);
+    testAssertBufferIsSilent(&allocator, matrix->outputs.destinations[1],
+        blockSize);
+    testAssertBufferContainsValueOnly(&allocator, -1.5f,
+        matrix->outputs.destinations[2], blockSize);
+
+    float depths[] = {
+        0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 2.0f
+    };
+    sig_dsp_ModMatrix_setDepths(matrix, depths);
+    matrix->signal.generate(matrix);
+    testAssertBufferIsSilent(&allocator, matrix->outputs.destinations[0],
+        blockSize);
+    testAssertBufferContainsValueOnly(&allocator, 1.0f,
+        matrix->outputs.destinations[1], blockSize);
+    testAssertBufferContainsValueOnly(&allocator, 4.5f,
+        matrix->outputs.destinations[2], blockSize);
+
+    for (size_t s = 0; s < 2; s++) {
+        sig_AudioBlock_destroy(&allocator, matrix->inputs.sources[s]);
+    }
+    sig_dsp_ModMatrix_destroy(&allocator, matrix);
+}
+
+void test_sig_dsp_ModMatrix_defersPartialChanges(void) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_dsp_ModMatrix* matrix = sig_dsp_ModMatrix_new(&allocator,
+        context, 1, 1);
+    matrix->inputs.sources[0] = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.0f);
+
+    sig_dsp_ModMatrix_setDepth(matrix, 0, 0, 0.5f);
+
+    // Simulate a block that starts part way through a change.
+    atomic_fetch_add(&matrix->pendingVersion, 1);
+    atomic_store(&matrix->pendingDepths[0][0], 0.75f);
+    matrix->signal.generate(matrix);
+    testAssertBufferIsSilent(&allocator, matrix->outputs.destinations[0],
+        blockSize);
+
+    // The change is applied once it has been completed.
+    atomic_fetch_add(&matrix->pendingVersion, 1);
+    matrix->signal.generate(matrix);
+    testAssertBufferContainsValueOnly(&allocator, 0.75f,
+        matrix->outputs.destinations[0], blockSize);
+
+    sig_AudioBlock_destroy(&allocator, matrix->inputs.sources[0]);
+    sig_dsp_ModMatrix_destroy(&allocator, matrix);
+}
+
+void test_sig_dsp_Telemetry(void) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_dsp_Telemetry* telemetry = sig_dsp_Telemetry_new(&allocator,
+        context, 2);
+    float_array_ptr source = sig_AudioBlock_newSilent(&allocator,
+        audioSettings);
+    telemetry->inputs.source = source;
+    telemetry->parameters.blocksPerReport = 2.0f;
+
+    // A square wave of +/- 0.5 with a single peak of -0.75.
+    for (size_t i = 0; i < blockSize; i++) {
+        FLOAT_ARRAY(source)[i] = i % 2 == 0 ? 0.5f : -0.5f;
+    }
+    FLOAT_ARRAY(source)[3] = -0.75f;
+
+    // Nothing should be reported until the window is complete.
+    float report = -1.0f;
+    telemetry->signal.generate(telemetry);
+    TEST_ASSERT_FALSE(sig_dsp_Telemetry_readLatest(telemetry, &report));
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, report);
+
+    telemetry->signal.generate(telemetry);
+    TEST_ASSERT_TRUE(sig_dsp_Telemetry_readLatest(telemetry, &report));
+    TEST_ASSERT_EQUAL_FLOAT(0.75f, report);
+
+    FLOAT_ARRAY(source)[3] = -0.5f;
+    telemetry->parameters.mode = sig_dsp_Telemetry_Mode_RMS;
+    telemetry->signal.generate(telemetry);
+    telemetry->signal.generate(telemetry);
+    TEST_ASSERT_TRUE(sig_dsp_Telemetry_readLatest(telemetry, &report));
+    TEST_ASSERT_FLOAT_WITHIN(0.00001f, 0.5f, report);
+
+    // Reports that don't fit in the queue should be dropped,
+    // and the UI should see the most recent report that did.
+    telemetry->parameters.mode = sig_dsp_Telemetry_Mode_LAST;
+    telemetry->parameters.blocksPerReport = 1.0f;
+    float lastValues[] = {0.1f, 0.2f, 0.3f, 0.4f};
+    for (size_t i = 0; i < 4; i++) {
+        FLOAT_ARRAY(source)[blockSize - 1] = lastValues[i];
+        telemetry->signal.generate(telemetry);
+    }
+    TEST_ASSERT_EQUAL_size_t(2,
+        sig_RingBuffer_readable(telemetry->outputs.main));
+    TEST_ASSERT_TRUE(sig_dsp_Telemetry_readLatest(telemetry, &report));
+    TEST_ASSERT_EQUAL_FLOAT(0.2f, report);
+    TEST_ASSERT_EQUAL_size_t(0,
+        sig_RingBuffer_readable(telemetry->outputs.main));
+
+    sig_AudioBlock_destroy(&allocator, source);
+    sig_dsp_Telemetry_destroy(&allocator, telemetry);
+}
+
+void createOscInputs(struct sig_Allocator* allocator,
+    struct sig_dsp_Oscillator* osc,
+    float freq, float phaseOffset, float mul, float add) {
+
+    osc->inputs.freq = sig_AudioBlock_newWithValue(allocator,
+        osc->signal.audioSettings, freq);
+    osc->inputs.phaseOffset = sig_AudioBlock_newWithValue(allocator,
+        osc->signal.audioSettings, phaseOffset);
+    osc->inputs.mul = sig_AudioBlock_newWithValue(allocator,
+        osc->signal.audioSettings, mul);
+    osc->inputs.add = sig_AudioBlock_newWithValue(allocator,
+        osc->signal.audioSettings, add);
+}
+
+void destroyOscInputs(struct sig_Allocator* allocator,
+    struct sig_dsp_Oscillator_Inputs* sineInputs) {
+    allocator->impl->free(allocator, sineInputs->freq);
+    allocator->impl->free(allocator, sineInputs->phaseOffset);
+    allocator->impl->free(allocator, sineInputs->mul);
+    allocator->impl->free(allocator, sineInputs->add);
+}
+
+void test_sig_dsp_SineOscillator(void) {
+    // Generated from this program:
+    /*
+        #include <stddef.h>
+        #include <math.h>
+        #include <stdio.h>
+
+        const float PI = 3.14159265358979323846f;
+        const float TWOPI = 2.0f * PI;
+
+        int main(int argc, char *argv[]) {
+            float sr = 44100.0f;
+            float freq = 440.0f;
+            float phaseStep = freq / sr * TWOPI;
+            float phase = 0.0f;
+            for (size_t i = 0; i < 64; i++) {
+                float sample = sinf(phase);
+                phase = phase + phaseStep;
+                printf("%.8ff, ", sample);
+            }
+        }
+    */
+    float expected[BLOCK_SIZE] = {
+        0.00000000f, 0.06264833f, 0.12505053f, 0.18696144f,
+        0.24813786f, 0.30833939f, 0.36732957f, 0.42487663f,
+        0.48075449f, 0.53474361f, 0.58663195f, 0.63621557f,
+        0.68329972f, 0.72769940f, 0.76924020f, 0.80775887f,
+        0.84310418f, 0.87513721f, 0.90373212f, 0.92877656f,
+        0.95017213f, 0.96783477f, 0.98169512f, 0.99169868f,
+        0.99780619f, 0.99999368f, 0.99825245f, 0.99258947f,
+        0.98302686f, 0.96960229f, 0.95236850f, 0.93139309f,
+        0.90675867f, 0.87856185f, 0.84691346f, 0.81193781f,
+        0.77377236f, 0.73256701f, 0.68848366f, 0.64169550f,
+        0.59238636f, 0.54074991f, 0.48698899f, 0.43131489f,
+        0.37394631f, 0.31510863f, 0.25503296f, 0.19395538f,
+        0.13211580f, 0.06975718f, 0.00712451f, -0.05553614f,
+        -0.11797862f, -0.17995760f, -0.24122958f, -0.30155385f,
+        -0.36069342f, -0.41841593f, -0.47449467f, -0.52870923f,
+        -0.58084673f, -0.63070220f, -0.67807990f, -0.72279370f
+    };
+    struct sig_SignalContext* mono441kContext = sig_SignalContext_new(
+        &allocator, &mono441kAudioSettings);
+
+    struct sig_dsp_Oscillator* sine = sig_dsp_SineOscillator_new(&allocator,
+        mono441kContext);
+    createOscInputs(&allocator, sine, 440.0f, 0.0f, 1.0f, 0.0f);
+
+    sine->signal.generate(sine);
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.00001,
+            FLOAT_ARRAY(sine->outputs.main)[i],
+            FLOAT_ARRAY(expected)[i]);
     }
 
     destroyOscInputs(&allocator, &sine->inputs);
@@ -698,6 +2807,951 @@ void test_sig_dsp_SineOscillator_phaseWrapsAt2PI(void) {
     sig_dsp_SineOscillator_destroy(&allocator, sine);
 }
 
+// Renders a number of blocks of an oscillator's main output.
+struct sig_Buffer* renderBLEPOscillator(struct sig_dsp_BLEPOscillator* osc,
+    size_t numBlocks) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_Buffer* output = sig_Buffer_new(&allocator,
+        blockSize * numBlocks);
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        osc->signal.generate(osc);
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(output->samples)[block * blockSize + i] =
+                FLOAT_ARRAY(osc->outputs.main)[i];
+        }
+    }
+
+    return output;
+}
+
+// Renders a naive waveform at the same frequency as
+// renderBLEPOscillator(), and compares the amplitude of
+// an aliased partial to the BLEP oscillator's.
+void testBLEPOscillatorReducesAliasing(struct sig_dsp_BLEPOscillator* osc,
+    sig_waveform_generator naiveWaveform, float freq, float aliasFreq,
+    float maxRatio) {
+    size_t numBlocks = 100;
+    float sampleRate = audioSettings->sampleRate;
+    osc->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+    struct sig_Buffer* output = renderBLEPOscillator(osc, numBlocks);
+    struct sig_Buffer* naive = sig_Buffer_new(&allocator, output->length);
+    for (size_t i = 0; i < naive->length; i++) {
+        double phase = fmod((double) i * freq / sampleRate, 1.0);
+        FLOAT_ARRAY(naive->samples)[i] = naiveWaveform(
+            (float) (phase * 2.0 * 3.14159265358979323846));
+    }
+
+    float naiveAliasAmp = measureAmplitude(naive->samples, naive->length,
+        aliasFreq, sampleRate);
+    float aliasAmp = measureAmplitude(output->samples, output->length,
+        aliasFreq, sampleRate);
+    TEST_ASSERT_TRUE_MESSAGE(aliasAmp < naiveAliasAmp * maxRatio,
+        "The aliased partial should be attenuated.");
+
+    // The fundamental should only be slightly attenuated
+    // by the residual's gentle low pass.
+    float naiveFundamentalAmp = measureAmplitude(naive->samples,
+        naive->length, freq, sampleRate);
+    TEST_ASSERT_FLOAT_WITHIN(naiveFundamentalAmp * 0.05f,
+        naiveFundamentalAmp,
+        measureAmplitude(output->samples, output->length, freq, sampleRate));
+
+    sig_AudioBlock_destroy(&allocator, osc->inputs.freq);
+    sig_Buffer_destroy(&allocator, output);
+    sig_Buffer_destroy(&allocator, naive);
+}
+
+void test_sig_dsp_BLEPSaw(void) {
+    struct sig_dsp_BLEPOscillator* saw = sig_dsp_BLEPSaw_new(&allocator,
+        context);
+    float freq = 100.0f;
+    float dt = freq / audioSettings->sampleRate;
+    saw->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+
+    // Away from its discontinuity, the saw should match the naive one.
+    for (size_t block = 0; block < 20; block++) {
+        saw->signal.generate(saw);
+        for (size_t i = 0; i < audioSettings->blockSize; i++) {
+            float phase = FLOAT_ARRAY(saw->phases)[i];
+            if (phase > dt && phase < 1.0f - dt) {
+                TEST_ASSERT_FLOAT_WITHIN(0.00001f,
+                    sig_waveform_saw(phase * sig_TWOPI),
+                    FLOAT_ARRAY(saw->outputs.main)[i]);
+            }
+        }
+    }
+
+    sig_AudioBlock_destroy(&allocator, saw->inputs.freq);
+
+    // The sixth harmonic of a 5 KHz saw aliases to 18 KHz.
+    testBLEPOscillatorReducesAliasing(saw, sig_waveform_saw, 5000.0f,
+        audioSettings->sampleRate - 30000.0f, 0.3f);
+
+    sig_dsp_BLEPSaw_destroy(&allocator, saw);
+}
+
+void test_sig_dsp_BLEPSquare(void) {
+    struct sig_dsp_BLEPOscillator* square = sig_dsp_BLEPSquare_new(
+        &allocator, context);
+
+    // The seventh harmonic of a 5 KHz square aliases to 13 KHz.
+    testBLEPOscillatorReducesAliasing(square, sig_waveform_square, 5000.0f,
+        audioSettings->sampleRate - 35000.0f, 0.3f);
+
+    // Pulse width modulation should change the duty cycle,
+    // and thus the average value of the wave.
+    square->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 480.0f);
+    square->inputs.pwm = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.5f);
+    struct sig_Buffer* output = renderBLEPOscillator(square, 100);
+    float sum = 0.0f;
+    for (size_t i = 0; i < output->length; i++) {
+        sum += FLOAT_ARRAY(output->samples)[i];
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.5f, sum / (float) output->length);
+
+    sig_Buffer_destroy(&allocator, output);
+    sig_AudioBlock_destroy(&allocator, square->inputs.pwm);
+    sig_AudioBlock_destroy(&allocator, square->inputs.freq);
+    sig_dsp_BLEPSquare_destroy(&allocator, square);
+}
+
+void test_sig_dsp_BLEPTriangle(void) {
+    struct sig_dsp_BLEPOscillator* triangle = sig_dsp_BLEPTriangle_new(
+        &allocator, context);
+
+    // The seventh harmonic of a 5 KHz triangle aliases to 13 KHz.
+    testBLEPOscillatorReducesAliasing(triangle, sig_waveform_triangle,
+        5000.0f, audioSettings->sampleRate - 35000.0f, 0.3f);
+
+    sig_dsp_BLEPTriangle_destroy(&allocator, triangle);
+}
+
+void test_sig_dsp_BLEPSaw_sync(void) {
+    struct sig_dsp_BLEPOscillator* saw = sig_dsp_BLEPSaw_new(&allocator,
+        context);
+    float freq = 220.0f;
+    float dt = freq / audioSettings->sampleRate;
+    size_t syncIdx = 10;
+    saw->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+    saw->inputs.sync = sig_AudioBlock_newSilent(&allocator, audioSettings);
+
+    saw->signal.generate(saw);
+    saw->signal.generate(saw);
+    float phaseBeforeSync = FLOAT_ARRAY(saw->phases)[
+        audioSettings->blockSize - 1] + (float) (syncIdx + 1) * dt;
+
+    FLOAT_ARRAY(saw->inputs.sync)[syncIdx] = 1.0f;
+    saw->signal.generate(saw);
+
+    // The phase should be reset when the sync input is triggered,
+    // and the jump band-limited by splitting the difference
+    // between the old and new values.
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, FLOAT_ARRAY(saw->phases)[syncIdx]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, phaseBeforeSync,
+        FLOAT_ARRAY(saw->syncPhases)[syncIdx]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f,
+        0.5f * (-1.0f + (2.0f * phaseBeforeSync - 1.0f)),
+        FLOAT_ARRAY(saw->outputs.main)[syncIdx]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 2.0f * dt - 1.0f,
+        FLOAT_ARRAY(saw->outputs.main)[syncIdx + 1]);
+
+    // Sync is only triggered by rising edges.
+    FLOAT_ARRAY(saw->inputs.sync)[syncIdx] = 0.0f;
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        FLOAT_ARRAY(saw->inputs.sync)[i] = 1.0f;
+    }
+    saw->signal.generate(saw);
+    saw->signal.generate(saw);
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(-1.0f, FLOAT_ARRAY(saw->syncPhases)[i]);
+    }
+
+    sig_AudioBlock_destroy(&allocator, saw->inputs.sync);
+    sig_AudioBlock_destroy(&allocator, saw->inputs.freq);
+    sig_dsp_BLEPSaw_destroy(&allocator, saw);
+}
+
+// Renders a number of blocks of a SineBank's main output.
+struct sig_Buffer* renderSineBank(struct sig_dsp_SineBank* bank,
+    size_t numBlocks) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_Buffer* output = sig_Buffer_new(&allocator,
+        blockSize * numBlocks);
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        bank->signal.generate(bank);
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(output->samples)[block * blockSize + i] =
+                FLOAT_ARRAY(bank->outputs.main)[i];
+        }
+    }
+
+    return output;
+}
+
+void test_sig_dsp_SineBank(void) {
+    struct sig_dsp_SineBank* bank = sig_dsp_SineBank_new(&allocator,
+        context, 16);
+    float freq = 440.0f;
+    float sampleRate = audioSettings->sampleRate;
+    bank->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+
+    TEST_ASSERT_EQUAL_size_t(16, bank->numPartials);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, FLOAT_ARRAY(bank->ratios)[0]);
+    TEST_ASSERT_EQUAL_FLOAT(16.0f, FLOAT_ARRAY(bank->ratios)[15]);
+
+    // By default, only the fundamental sounds,
+    // producing a sine wave after fading in during the first block.
+    struct sig_Buffer* output = renderSineBank(bank, 10);
+    for (size_t i = audioSettings->blockSize; i < output->length; i++) {
+        float expected = sinf(sig_TWOPI * freq * (float) i / sampleRate);
+        TEST_ASSERT_FLOAT_WITHIN(0.001f, expected,
+            FLOAT_ARRAY(output->samples)[i]);
+    }
+    sig_Buffer_destroy(&allocator, output);
+
+    // Each partial should be rendered at its ratio and amplitude.
+    FLOAT_ARRAY(bank->amplitudes)[0] = 0.5f;
+    FLOAT_ARRAY(bank->amplitudes)[2] = 0.25f;
+    FLOAT_ARRAY(bank->ratios)[2] = 2.5f;
+    FLOAT_ARRAY(bank->amplitudes)[9] = 0.125f;
+    // Let the amplitude ramps settle before measuring.
+    bank->signal.generate(bank);
+    output = renderSineBank(bank, 100);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.5f,
+        measureAmplitude(output->samples, output->length, freq, sampleRate));
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.25f,
+        measureAmplitude(output->samples, output->length, freq * 2.5f,
+            sampleRate));
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.125f,
+        measureAmplitude(output->samples, output->length, freq * 10.0f,
+            sampleRate));
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.0f,
+        measureAmplitude(output->samples, output->length, freq * 2.0f,
+            sampleRate));
+    sig_Buffer_destroy(&allocator, output);
+
+    sig_AudioBlock_destroy(&allocator, bank->inputs.freq);
+    sig_dsp_SineBank_destroy(&allocator, bank);
+}
+
+void test_sig_dsp_SineBank_cullsPartialsAboveNyquist(void) {
+    struct sig_dsp_SineBank* bank = sig_dsp_SineBank_new(&allocator,
+        context, 16);
+    float freq = 10000.0f;
+    float sampleRate = audioSettings->sampleRate;
+    bank->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+
+    // The third partial, at 30 KHz, would alias to 18 KHz.
+    FLOAT_ARRAY(bank->amplitudes)[2] = 1.0f;
+    bank->signal.generate(bank);
+    struct sig_Buffer* output = renderSineBank(bank, 100);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 1.0f,
+        measureAmplitude(output->samples, output->length, freq, sampleRate));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f,
+        measureAmplitude(output->samples, output->length,
+            sampleRate - freq * 3.0f, sampleRate));
+
+    sig_Buffer_destroy(&allocator, output);
+    sig_AudioBlock_destroy(&allocator, bank->inputs.freq);
+    sig_dsp_SineBank_destroy(&allocator, bank);
+}
+
+void test_sig_dsp_SineBank_isStable(void) {
+    struct sig_dsp_SineBank* bank = sig_dsp_SineBank_new(&allocator,
+        context, sig_dsp_SineBank_MAX_PARTIALS + 1);
+    size_t numPartials = sig_dsp_SineBank_MAX_PARTIALS;
+    TEST_ASSERT_EQUAL_size_t(numPartials, bank->numPartials);
+
+    bank->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 55.0f);
+    for (size_t k = 0; k < numPartials; k++) {
+        FLOAT_ARRAY(bank->amplitudes)[k] = 1.0f / (float) numPartials;
+        FLOAT_ARRAY(bank->ratios)[k] = (float) (k + 1) * 1.01f;
+    }
+
+    // After a minute, every partial should still have unit magnitude.
+    size_t numBlocks = (size_t) (60.0f * audioSettings->sampleRate /
+        (float) audioSettings->blockSize);
+    for (size_t block = 0; block < numBlocks; block++) {
+        bank->signal.generate(bank);
+    }
+
+    for (size_t k = 0; k < numPartials; k++) {
+        float c = FLOAT_ARRAY(bank->cosZ)[k];
+        float s = FLOAT_ARRAY(bank->sinZ)[k];
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, sqrtf(c * c + s * s));
+    }
+
+    sig_AudioBlock_destroy(&allocator, bank->inputs.freq);
+    sig_dsp_SineBank_destroy(&allocator, bank);
+}
+
+void test_sig_dsp_FMOperatorBank_algorithms(void) {
+    struct sig_dsp_FMOperatorBank* fm = sig_dsp_FMOperatorBank_new(
+        &allocator, context, 5);
+    TEST_ASSERT_EQUAL_size_t(5, fm->numOperators);
+
+    // The default algorithm is a single stack.
+    for (size_t j = 0; j < 4; j++) {
+        TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[j][j + 1]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fm->modulation[4][0]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->carriers[0]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fm->carriers[1]);
+
+    sig_dsp_FMOperatorBank_setAlgorithm(fm,
+        sig_dsp_FMOperatorBank_Algorithm_TWO_STACKS);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[0][1]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fm->modulation[1][2]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[2][3]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[3][4]);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, fm->carriers[0]);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, fm->carriers[2]);
+
+    sig_dsp_FMOperatorBank_setAlgorithm(fm,
+        sig_dsp_FMOperatorBank_Algorithm_PAIRS);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[0][1]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[2][3]);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fm->modulation[3][4]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f / 3.0f, fm->carriers[4]);
+
+    sig_dsp_FMOperatorBank_setAlgorithm(fm,
+        sig_dsp_FMOperatorBank_Algorithm_BRANCH);
+    for (size_t k = 1; k < 5; k++) {
+        TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->modulation[0][k]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fm->carriers[0]);
+
+    // Changing the algorithm parameter should update the matrix
+    // when the Signal is next generated.
+    fm->parameters.algorithm = sig_dsp_FMOperatorBank_Algorithm_ADDITIVE;
+    fm->signal.generate(fm);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fm->modulation[0][1]);
+    TEST_ASSERT_EQUAL_FLOAT(0.2f, fm->carriers[3]);
+
+    // Custom routings should be left alone.
+    fm->modulation[1][4] = 0.5f;
+    fm->parameters.algorithm = sig_dsp_FMOperatorBank_Algorithm_CUSTOM;
+    fm->signal.generate(fm);
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, fm->modulation[1][4]);
+    TEST_ASSERT_EQUAL_FLOAT(0.2f, fm->carriers[3]);
+
+    sig_dsp_FMOperatorBank_destroy(&allocator, fm);
+
+    fm = sig_dsp_FMOperatorBank_new(&allocator, context, 12);
+    TEST_ASSERT_EQUAL_size_t(sig_dsp_FMOperatorBank_MAX_OPERATORS,
+        fm->numOperators);
+    sig_dsp_FMOperatorBank_destroy(&allocator, fm);
+}
+
+// Renders a number of blocks of an FMOperatorBank's main output.
+struct sig_Buffer* renderFMOperatorBank(struct sig_dsp_FMOperatorBank* fm,
+    size_t numBlocks) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_Buffer* output = sig_Buffer_new(&allocator,
+        blockSize * numBlocks);
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        fm->signal.generate(fm);
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(output->samples)[block * blockSize + i] =
+                FLOAT_ARRAY(fm->outputs.main)[i];
+        }
+    }
+
+    return output;
+}
+
+void test_sig_dsp_FMOperatorBank_sidebands(void) {
+    struct sig_dsp_FMOperatorBank* fm = sig_dsp_FMOperatorBank_new(
+        &allocator, context, 4);
+    float sampleRate = audioSettings->sampleRate;
+    float freq = 1000.0f;
+    fm->inputs.frequency = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+    fm->inputs.index = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 1.0f / sig_TWOPI);
+
+    // Without any modulation, the carrier should be a sine wave.
+    fm->parameters.levels[1] = 0.0f;
+    fm->parameters.levels[2] = 0.0f;
+    fm->parameters.levels[3] = 0.0f;
+    struct sig_Buffer* output = renderFMOperatorBank(fm, 10);
+    for (size_t i = 0; i < output->length; i++) {
+        float expected = sinf(sig_TWOPI * freq * (float) i / sampleRate);
+        TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected,
+            FLOAT_ARRAY(output->samples)[i]);
+    }
+    sig_Buffer_destroy(&allocator, output);
+
+    // A sine modulator with a modulation index of one radian should
+    // produce sidebands with amplitudes given by Bessel functions.
+    fm->parameters.levels[1] = 1.0f;
+    fm->parameters.ratios[1] = 0.25f;
+    output = renderFMOperatorBank(fm, 100);
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.765198f,
+        measureAmplitude(output->samples, output->length, freq, sampleRate));
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.440051f,
+        measureAmplitude(output->samples, output->length, freq + 250.0f,
+            sampleRate));
+    TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.114903f,
+        measureAmplitude(output->samples, output->length, freq + 500.0f,
+            sampleRate));
+    sig_Buffer_destroy(&allocator, output);
+
+    sig_AudioBlock_destroy(&allocator, fm->inputs.index);
+    sig_AudioBlock_destroy(&allocator, fm->inputs.frequency);
+    sig_dsp_FMOperatorBank_destroy(&allocator, fm);
+}
+
+void test_sig_dsp_FMOperatorBank_additiveAndFeedback(void) {
+    struct sig_dsp_FMOperatorBank* fm = sig_dsp_FMOperatorBank_new(
+        &allocator, context, 4);
+    float sampleRate = audioSettings->sampleRate;
+    float freq = 500.0f;
+    fm->inputs.frequency = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, freq);
+    fm->parameters.algorithm = sig_dsp_FMOperatorBank_Algorithm_ADDITIVE;
+    for (size_t j = 0; j < 4; j++) {
+        fm->parameters.ratios[j] = (float) (j + 1);
+    }
+
+    // Each operator should be mixed equally into the output.
+    struct sig_Buffer* output = renderFMOperatorBank(fm, 100);
+    for (size_t j = 0; j < 4; j++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.005f, 0.25f,
+            measureAmplitude(output->samples, output->length,
+                freq * (float) (j + 1), sampleRate));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f,
+        measureAmplitude(output->samples, output->length, freq * 5.0f,
+            sampleRate));
+    sig_Buffer_destroy(&allocator, output);
+
+    // Feedback should add harmonics to an operator.
+    fm->parameters.levels[1] = 0.0f;
+    fm->parameters.levels[2] = 0.0f;
+    fm->parameters.levels[3] = 0.0f;
+    fm->parameters.feedbackGains[3] = 0.2f;
+    output = renderFMOperatorBank(fm, 100);
+    TEST_ASSERT_TRUE(measureAmplitude(output->samples, output->length,
+        freq * 2.0f, sampleRate) < 0.001f);
+    sig_Buffer_destroy(&allocator, output);
+
+    fm->parameters.feedbackGains[0] = 0.2f;
+    output = renderFMOperatorBank(fm, 100);
+    TEST_ASSERT_TRUE(measureAmplitude(output->samples, output->length,
+        freq * 2.0f, sampleRate) > 0.01f);
+    sig_Buffer_destroy(&allocator, output);
+
+    sig_AudioBlock_destroy(&allocator, fm->inputs.frequency);
+    sig_dsp_FMOperatorBank_destroy(&allocator, fm);
+}
+
+void test_sig_dsp_FMOperatorBank_sharesSineTable(void) {
+    struct sig_dsp_TwoOpFM* twoOp = sig_dsp_TwoOpFM_new(&allocator, context);
+    struct sig_dsp_FMOperatorBank* fm = sig_dsp_FMOperatorBank_new(
+        &allocator, context, 6);
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(twoOp->sineTable, fm->sineTable,
+        "FMOperatorBank should share TwoOpFM's sine table.");
+    sig_dsp_FMOperatorBank_destroy(&allocator, fm);
+    sig_dsp_TwoOpFM_destroy(&allocator, twoOp);
+}
+
+void test_sig_dsp_FDNReverb_new(void) {
+    size_t requested[] = {1, 5, 6, 11, 12, 100};
+    size_t expected[] = {4, 4, 8, 8, 16, 16};
+
+    for (size_t n = 0; n < sizeof(requested) / sizeof(requested[0]); n++) {
+        struct sig_dsp_FDNReverb* reverb = sig_dsp_FDNReverb_new(&allocator,
+            context, requested[n]);
+        TEST_ASSERT_EQUAL_size_t(expected[n], reverb->numLines);
+
+        // Delay lines should be distinct, increasing, and
+        // stored back to back in the same allocation.
+        for (size_t j = 1; j < reverb->numLines; j++) {
+            TEST_ASSERT_TRUE(reverb->delays[j] > reverb->delays[j - 1]);
+            TEST_ASSERT_EQUAL_size_t(
+                reverb->lineOffsets[j - 1] + reverb->lineLengths[j - 1],
+                reverb->lineOffsets[j]);
+        }
+
+        TEST_ASSERT_TRUE(reverb->delays[0] >=
+            sig_dsp_FDNReverb_MIN_DELAY_TIME * audioSettings->sampleRate);
+
+        sig_dsp_FDNReverb_destroy(&allocator, reverb);
+    }
+}
+
+// Returns the RMS level of the specified range of samples.
+float measureRMS(float* samples, size_t start, size_t length) {
+    float sum = 0.0f;
+    for (size_t i = start; i < start + length; i++) {
+        sum += samples[i] * samples[i];
+    }
+
+    return sqrtf(sum / (float) length);
+}
+
+// Renders the left channel of an FDNReverb's response to an impulse.
+struct sig_Buffer* renderFDNReverbImpulseResponse(
+    struct sig_dsp_FDNReverb* reverb, size_t numBlocks) {
+    size_t blockSize = audioSettings->blockSize;
+    struct sig_Buffer* output = sig_Buffer_new(&allocator,
+        blockSize * numBlocks);
+    reverb->inputs.source = sig_AudioBlock_newSilent(&allocator,
+        audioSettings);
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        FLOAT_ARRAY(reverb->inputs.source)[0] = block == 0 ? 1.0f : 0.0f;
+        reverb->signal.generate(reverb);
+        for (size_t i = 0; i < blockSize; i++) {
+            FLOAT_ARRAY(output->samples)[block * blockSize + i] =
+                FLOAT_ARRAY(reverb->outputs.left)[i];
+        }
+    }
+
+    sig_AudioBlock_destroy(&allocator, reverb->inputs.source);
+
+    return output;
+}
+
+void testFDNReverbDecay(size_t numLines,
+    enum sig_dsp_FDNReverb_Matrix matrix) {
+    float decayTime = 1.0f;
+    size_t sampleRate = (size_t) audioSettings->sampleRate;
+    size_t numBlocks = 2 * sampleRate / audioSettings->blockSize;
+    size_t windowLength = sampleRate / 10;
+    struct sig_dsp_FDNReverb* reverb = sig_dsp_FDNReverb_new(&allocator,
+        context, numLines);
+    reverb->parameters.matrix = matrix;
+    reverb->inputs.decayTime = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, decayTime);
+
+    struct sig_Buffer* output = renderFDNReverbImpulseResponse(reverb,
+        numBlocks);
+    float* samples = FLOAT_ARRAY(output->samples);
+
+    // Nothing should be heard before the shortest delay.
+    float firstEcho = reverb->delays[0];
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, measureRMS(samples, 0,
+        (size_t) firstEcho - 1));
+
+    // The response should decay by 30 dB in half the decay time.
+    float early = measureRMS(samples, sampleRate / 5, windowLength);
+    float late = measureRMS(samples, sampleRate / 5 + sampleRate / 2,
+        windowLength);
+    float decay = 20.0f * log10f(late / early);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, -30.0f, decay);
+
+    sig_Buffer_destroy(&allocator, output);
+    sig_AudioBlock_destroy(&allocator, reverb->inputs.decayTime);
+    sig_dsp_FDNReverb_destroy(&allocator, reverb);
+}
+
+void test_sig_dsp_FDNReverb_decay(void) {
+    testFDNReverbDecay(4, sig_dsp_FDNReverb_Matrix_HADAMARD);
+    testFDNReverbDecay(8, sig_dsp_FDNReverb_Matrix_HADAMARD);
+    testFDNReverbDecay(16, sig_dsp_FDNReverb_Matrix_HADAMARD);
+    testFDNReverbDecay(4, sig_dsp_FDNReverb_Matrix_HOUSEHOLDER);
+    testFDNReverbDecay(8, sig_dsp_FDNReverb_Matrix_HOUSEHOLDER);
+    testFDNReverbDecay(16, sig_dsp_FDNReverb_Matrix_HOUSEHOLDER);
+}
+
+// Sums the squared first difference of a signal,
+// which is a rough measure of its high frequency energy.
+float measureHighFrequencyEnergy(struct sig_Buffer* buffer) {
+    float* samples = FLOAT_ARRAY(buffer->samples);
+    float sum = 0.0f;
+    for (size_t i = 1; i < buffer->length; i++) {
+        float diff = samples[i] - samples[i - 1];
+        sum += diff * diff;
+    }
+
+    return sum;
+}
+
+void test_sig_dsp_FDNReverb_dampingAndModulation(void) {
+    size_t numBlocks = (size_t) audioSettings->sampleRate /
+        audioSettings->blockSize;
+    struct sig_dsp_FDNReverb* reverb = sig_dsp_FDNReverb_new(&allocator,
+        context, 8);
+    float_array_ptr decayTime = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 2.0f);
+    float_array_ptr damping = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.7f);
+
+    reverb->inputs.decayTime = decayTime;
+    struct sig_Buffer* undamped = renderFDNReverbImpulseResponse(reverb,
+        numBlocks);
+
+    sig_dsp_FDNReverb_init(reverb, context);
+    reverb->inputs.decayTime = decayTime;
+    reverb->inputs.damping = damping;
+    struct sig_Buffer* damped = renderFDNReverbImpulseResponse(reverb,
+        numBlocks);
+
+    TEST_ASSERT_TRUE_MESSAGE(measureHighFrequencyEnergy(damped) <
+        measureHighFrequencyEnergy(undamped) * 0.1f,
+        "Damping should attenuate high frequencies.");
+
+    // Modulation should change the response
+    // without making the network unstable.
+    sig_dsp_FDNReverb_init(reverb, context);
+    reverb->inputs.decayTime = decayTime;
+    reverb->parameters.modulationDepth = 8.0f;
+    reverb->parameters.modulationRate = 1.0f;
+    struct sig_Buffer* modulated = renderFDNReverbImpulseResponse(reverb,
+        numBlocks * 4);
+    float* samples = FLOAT_ARRAY(modulated->samples);
+    bool isDifferent = false;
+    for (size_t i = 0; i < modulated->length; i++) {
+        TEST_ASSERT_TRUE(fabsf(samples[i]) < 1.0f);
+        if (i < undamped->length && fabsf(samples[i] -
+            FLOAT_ARRAY(undamped->samples)[i]) > 0.001f) {
+            isDifferent = true;
+        }
+    }
+    TEST_ASSERT_TRUE(isDifferent);
+
+    // After three decay times (180 dB in theory),
+    // the tail should be far quieter than the start.
+    size_t windowLength = numBlocks * audioSettings->blockSize / 10;
+    TEST_ASSERT_TRUE(measureRMS(samples, modulated->length - windowLength,
+        windowLength) < measureRMS(samples, windowLength, windowLength) *
+        0.001f);
+
+    sig_Buffer_destroy(&allocator, modulated);
+    sig_Buffer_destroy(&allocator, damped);
+    sig_Buffer_destroy(&allocator, undamped);
+    sig_AudioBlock_destroy(&allocator, damping);
+    sig_AudioBlock_destroy(&allocator, decayTime);
+    sig_dsp_FDNReverb_destroy(&allocator, reverb);
+}
+
+void fillWithNoise(float_array_ptr samples, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        FLOAT_ARRAY(samples)[i] = sig_randf() * 2.0f - 1.0f;
+    }
+}
+
+void test_sig_dsp_CombBank_matchesCombs(void) {
+    size_t numLines = 3;
+    size_t numBlocks = 200;
+    size_t blockSize = audioSettings->blockSize;
+    float delayTimes[] = {0.0105f, 0.0137f, 0.0161f};
+    float feedbackGains[] = {0.8f, 0.75f, 0.7f};
+    float lpfCoefficients[] = {0.0f, 0.3f, 0.5f};
+    float_array_ptr source = sig_AudioBlock_new(&allocator, audioSettings);
+
+    struct sig_dsp_CombBank* bank = sig_dsp_CombBank_new(&allocator,
+        context, numLines, 0.02f);
+    bank->inputs.source = source;
+    bank->parameters.outputGain = 1.0f;
+
+    struct sig_dsp_Comb* combs[3];
+    for (size_t j = 0; j < numLines; j++) {
+        bank->parameters.delayTimes[j] = delayTimes[j];
+        bank->parameters.feedbackGains[j] = feedbackGains[j];
+        bank->parameters.lpfCoefficients[j] = lpfCoefficients[j];
+
+        combs[j] = sig_dsp_Comb_new(&allocator, context);
+        combs[j]->delayLine = sig_DelayLine_newSeconds(&allocator,
+            audioSettings, 0.02f);
+        combs[j]->inputs.source = source;
+        combs[j]->inputs.delayTime = sig_AudioBlock_newWithValue(&allocator,
+            audioSettings, delayTimes[j]);
+        combs[j]->inputs.feedbackGain = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, feedbackGains[j]);
+        combs[j]->inputs.lpfCoefficient = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, lpfCoefficients[j]);
+    }
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        // Feed noise for a little while, and then let the combs ring.
+        if (block < 20) {
+            fillWithNoise(source, blockSize);
+        } else {
+            sig_fillWithSilence(source, blockSize);
+        }
+
+        bank->signal.generate(bank);
+        for (size_t j = 0; j < numLines; j++) {
+            combs[j]->signal.generate(combs[j]);
+        }
+
+        for (size_t i = 0; i < blockSize; i++) {
+            float expected = 0.0f;
+            for (size_t j = 0; j < numLines; j++) {
+                expected += FLOAT_ARRAY(combs[j]->outputs.main)[i];
+            }
+
+            TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected,
+                FLOAT_ARRAY(bank->outputs.main)[i]);
+        }
+    }
+
+    for (size_t j = 0; j < numLines; j++) {
+        sig_AudioBlock_destroy(&allocator, combs[j]->inputs.delayTime);
+        sig_AudioBlock_destroy(&allocator, combs[j]->inputs.feedbackGain);
+        sig_AudioBlock_destroy(&allocator, combs[j]->inputs.lpfCoefficient);
+        sig_DelayLine_destroy(&allocator, combs[j]->delayLine);
+        sig_dsp_Comb_destroy(&allocator, combs[j]);
+    }
+    sig_dsp_CombBank_destroy(&allocator, bank);
+    sig_AudioBlock_destroy(&allocator, source);
+}
+
+void test_sig_dsp_CombBank_scalesDelayTimeAndFeedback(void) {
+    struct sig_dsp_CombBank* bank = sig_dsp_CombBank_new(&allocator,
+        context, 1, 0.01f);
+    float_array_ptr source = sig_AudioBlock_newSilent(&allocator,
+        audioSettings);
+    bank->inputs.source = source;
+    bank->inputs.delayTimeScale = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.5f);
+    bank->inputs.feedbackScale = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.5f);
+    bank->parameters.delayTimes[0] = 20.0f / audioSettings->sampleRate;
+    bank->parameters.feedbackGains[0] = 1.0f;
+
+    // An impulse should echo every ten samples,
+    // halving in amplitude with each echo.
+    FLOAT_ARRAY(source)[0] = 1.0f;
+    bank->signal.generate(bank);
+    float* output = FLOAT_ARRAY(bank->outputs.main);
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        float expected = i > 0 && i % 10 == 0 ?
+            powf(0.5f, (float) (i / 10 - 1)) : 0.0f;
+        TEST_ASSERT_FLOAT_WITHIN(0.00001f, expected, output[i]);
+    }
+
+    sig_AudioBlock_destroy(&allocator, bank->inputs.feedbackScale);
+    sig_AudioBlock_destroy(&allocator, bank->inputs.delayTimeScale);
+    sig_AudioBlock_destroy(&allocator, source);
+    sig_dsp_CombBank_destroy(&allocator, bank);
+}
+
+void test_sig_dsp_AllpassChain_matchesAllpasses(void) {
+    size_t numStages = 3;
+    size_t numBlocks = 100;
+    size_t blockSize = audioSettings->blockSize;
+    float delayTimes[] = {0.0047f, 0.0036f, 0.00123f};
+    float gains[] = {0.7f, 0.0f, 0.6f};
+    float_array_ptr source = sig_AudioBlock_new(&allocator, audioSettings);
+
+    struct sig_dsp_AllpassChain* chain = sig_dsp_AllpassChain_new(
+        &allocator, context, numStages, 0.005f);
+    chain->inputs.source = source;
+
+    struct sig_dsp_Allpass* allpasses[3];
+    float_array_ptr previousOutput = source;
+    for (size_t j = 0; j < numStages; j++) {
+        chain->parameters.delayTimes[j] = delayTimes[j];
+        chain->parameters.gains[j] = gains[j];
+
+        allpasses[j] = sig_dsp_Allpass_new(&allocator, context);
+        allpasses[j]->delayLine = sig_DelayLine_newSeconds(&allocator,
+            audioSettings, 0.005f);
+        allpasses[j]->inputs.source = previousOutput;
+        allpasses[j]->inputs.delayTime = sig_AudioBlock_newWithValue(
+            &allocator, audioSettings, delayTimes[j]);
+        allpasses[j]->inputs.g = sig_AudioBlock_newWithValue(&allocator,
+            audioSettings, gains[j]);
+        previousOutput = allpasses[j]->outputs.main;
+    }
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        fillWithNoise(source, blockSize);
+        chain->signal.generate(chain);
+        for (size_t j = 0; j < numStages; j++) {
+            allpasses[j]->signal.generate(allpasses[j]);
+        }
+
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(previousOutput, chain->outputs.main,
+            blockSize);
+    }
+
+    for (size_t j = 0; j < numStages; j++) {
+        sig_AudioBlock_destroy(&allocator, allpasses[j]->inputs.delayTime);
+        sig_AudioBlock_destroy(&allocator, allpasses[j]->inputs.g);
+        sig_DelayLine_destroy(&allocator, allpasses[j]->delayLine);
+        sig_dsp_Allpass_destroy(&allocator, allpasses[j]);
+    }
+    sig_dsp_AllpassChain_destroy(&allocator, chain);
+    sig_AudioBlock_destroy(&allocator, source);
+}
+
+void test_sig_dsp_AllpassChain_bypass(void) {
+    struct sig_dsp_AllpassChain* chain = sig_dsp_AllpassChain_new(
+        &allocator, context, 2, 0.01f);
+    float_array_ptr source = sig_AudioBlock_new(&allocator, audioSettings);
+    chain->inputs.source = source;
+    chain->parameters.gains[0] = 0.0f;
+    chain->parameters.delayTimes[1] = 0.0f;
+
+    fillWithNoise(source, audioSettings->blockSize);
+    chain->signal.generate(chain);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(source, chain->outputs.main,
+        audioSettings->blockSize);
+
+    sig_AudioBlock_destroy(&allocator, source);
+    sig_dsp_AllpassChain_destroy(&allocator, chain);
+}
+
+void test_sig_dsp_VoiceBank_matchesVoiceGraph(void) {
+    size_t numBlocks = 100;
+    size_t blockSize = audioSettings->blockSize;
+    float_array_ptr cutoff = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 2000.0f);
+    float_array_ptr resonance = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 0.5f);
+
+    struct sig_dsp_VoiceBank* bank = sig_dsp_VoiceBank_new(&allocator,
+        context, 4);
+    bank->inputs.cutoff = cutoff;
+    bank->inputs.resonance = resonance;
+    bank->parameters.outputGain = 1.0f;
+
+    struct sig_dsp_BLEPOscillator* saw = sig_dsp_BLEPSaw_new(&allocator,
+        context);
+    saw->inputs.freq = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 220.0f);
+    struct sig_dsp_Ladder* ladder = sig_dsp_Ladder_new(&allocator, context);
+    ladder->inputs.source = saw->outputs.main;
+    ladder->inputs.frequency = cutoff;
+    ladder->inputs.resonance = resonance;
+
+    // With an instantaneous attack and full sustain,
+    // the voice should match a graph of a BLEPSaw and a Ladder.
+    TEST_ASSERT_EQUAL_size_t(0,
+        sig_dsp_VoiceBank_noteOn(bank, 57, 220.0f, 1.0f));
+    TEST_ASSERT_EQUAL_size_t(1, sig_dsp_VoiceBank_numActiveVoices(bank));
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        bank->signal.generate(bank);
+        saw->signal.generate(saw);
+        ladder->signal.generate(ladder);
+
+        for (size_t i = 0; i < blockSize; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(0.00001f,
+                FLOAT_ARRAY(ladder->outputs.main)[i],
+                FLOAT_ARRAY(bank->outputs.main)[i]);
+        }
+    }
+
+    sig_AudioBlock_destroy(&allocator, saw->inputs.freq);
+    sig_dsp_Ladder_destroy(&allocator, ladder);
+    sig_dsp_BLEPSaw_destroy(&allocator, saw);
+    sig_dsp_VoiceBank_destroy(&allocator, bank);
+    sig_AudioBlock_destroy(&allocator, resonance);
+    sig_AudioBlock_destroy(&allocator, cutoff);
+}
+
+void test_sig_dsp_VoiceBank_allocatesAndStealsVoices(void) {
+    struct sig_dsp_VoiceBank* bank = sig_dsp_VoiceBank_new(&allocator,
+        context, 4);
+
+    for (int32_t note = 60; note < 64; note++) {
+        TEST_ASSERT_EQUAL_size_t(note - 60,
+            sig_dsp_VoiceBank_noteOn(bank, note, 440.0f, 1.0f));
+    }
+    TEST_ASSERT_EQUAL_size_t(4, sig_dsp_VoiceBank_numActiveVoices(bank));
+
+    // A note that is already playing retriggers its own voice.
+    TEST_ASSERT_EQUAL_size_t(0,
+        sig_dsp_VoiceBank_noteOn(bank, 60, 440.0f, 1.0f));
+
+    // Released voices are stolen before held ones.
+    sig_dsp_VoiceBank_noteOff(bank, 62);
+    TEST_ASSERT_EQUAL_INT(sig_dsp_VoiceBank_Stage_RELEASE, bank->stages[2]);
+    TEST_ASSERT_EQUAL_size_t(2,
+        sig_dsp_VoiceBank_noteOn(bank, 64, 440.0f, 1.0f));
+
+    // Otherwise, the oldest voice is stolen.
+    TEST_ASSERT_EQUAL_size_t(1,
+        sig_dsp_VoiceBank_noteOn(bank, 65, 440.0f, 1.0f));
+    TEST_ASSERT_EQUAL_size_t(3,
+        sig_dsp_VoiceBank_noteOn(bank, 66, 440.0f, 1.0f));
+    TEST_ASSERT_EQUAL_INT32(66, bank->notes[3]);
+    TEST_ASSERT_EQUAL_size_t(4, sig_dsp_VoiceBank_numActiveVoices(bank));
+
+    sig_dsp_VoiceBank_destroy(&allocator, bank);
+}
+
+void test_sig_dsp_VoiceBank_envelope(void) {
+    size_t blockSize = audioSettings->blockSize;
+    float sampleRate = audioSettings->sampleRate;
+    float attack = 0.01f;
+    float decay = 0.05f;
+    float release = 0.02f;
+    float sustain = 0.5f;
+    struct sig_dsp_VoiceBank* bank = sig_dsp_VoiceBank_new(&allocator,
+        context, 8);
+    bank->inputs.cutoff = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, 5000.0f);
+    bank->inputs.attack = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, attack);
+    bank->inputs.decay = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, decay);
+    bank->inputs.sustain = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, sustain);
+    bank->inputs.release = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, release);
+
+    // Without any notes, every voice is idle and the output is silent.
+    bank->signal.generate(bank);
+    testAssertBufferIsSilent(&allocator, bank->outputs.main, blockSize);
+
+    size_t voice = sig_dsp_VoiceBank_noteOn(bank, 48, 110.0f, 1.0f);
+    // Stop just short of the end of the attack.
+    size_t attackBlocks = (size_t) (attack * sampleRate / blockSize) - 1;
+    for (size_t block = 0; block < attackBlocks; block++) {
+        bank->signal.generate(bank);
+    }
+    TEST_ASSERT_EQUAL_INT(sig_dsp_VoiceBank_Stage_ATTACK,
+        bank->stages[voice]);
+    TEST_ASSERT_TRUE(bank->levels[voice] > 0.9f);
+    testAssertBufferNotSilent(&allocator, bank->outputs.main, blockSize);
+
+    // The decay should fall by 60 dB towards the sustain level.
+    size_t decayBlocks = (size_t) (decay * sampleRate / blockSize) + 2;
+    for (size_t block = 0; block < decayBlocks; block++) {
+        bank->signal.generate(bank);
+    }
+    TEST_ASSERT_EQUAL_INT(sig_dsp_VoiceBank_Stage_DECAY,
+        bank->stages[voice]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0005f, sustain, bank->levels[voice]);
+
+    // The voice should become idle after it is released.
+    sig_dsp_VoiceBank_noteOff(bank, 48);
+    size_t releaseBlocks = (size_t) (2.0f * release * sampleRate /
+        blockSize);
+    for (size_t block = 0; block < releaseBlocks; block++) {
+        bank->signal.generate(bank);
+    }
+    TEST_ASSERT_EQUAL_INT(sig_dsp_VoiceBank_Stage_IDLE, bank->stages[voice]);
+    TEST_ASSERT_EQUAL_size_t(0, sig_dsp_VoiceBank_numActiveVoices(bank));
+    bank->signal.generate(bank);
+    testAssertBufferIsSilent(&allocator, bank->outputs.main, blockSize);
+
+    sig_AudioBlock_destroy(&allocator, bank->inputs.cutoff);
+    sig_AudioBlock_destroy(&allocator, bank->inputs.attack);
+    sig_AudioBlock_destroy(&allocator, bank->inputs.decay);
+    sig_AudioBlock_destroy(&allocator, bank->inputs.sustain);
+    sig_AudioBlock_destroy(&allocator, bank->inputs.release);
+    sig_dsp_VoiceBank_destroy(&allocator, bank);
+}
+
 void testDust(struct sig_dsp_Dust* dust,
     float min, float max, int16_t expectedNumDustPerBlock) {
     dust->signal.generate(dust);
@@ -733,6 +3787,163 @@ void test_sig_dsp_Dust(void) {
     sig_dsp_Dust_destroy(&allocator, dust);
 }
 
+void test_sig_dsp_Dust_sparse(void) {
+    // At very low densities, most blocks should be silent,
+    // but impulses should still occur at the expected rate.
+    int32_t expectedNumDustPerTenBlocks = 15;
+    size_t numBlocks = 15000;
+    float density = (audioSettings->sampleRate /
+        audioSettings->blockSize) * expectedNumDustPerTenBlocks / 10.0f;
+
+    struct sig_dsp_Dust* dust = sig_dsp_Dust_new(&allocator, context);
+    dust->inputs.density = sig_AudioBlock_newWithValue(&allocator,
+        audioSettings, density);
+
+    size_t numNonZero = countNonZeroSamplesGenerated(&dust->signal,
+        dust->outputs.main, numBlocks);
+    float expected = (float) (numBlocks / 10 * expectedNumDustPerTenBlocks);
+    TEST_ASSERT_FLOAT_WITHIN(expected * 0.05f, expected, (float) numNonZero);
+
+    allocator.impl->free(&allocator, dust->inputs.density);
+    sig_dsp_Dust_destroy(&allocator, dust);
+}
+
+void test_sig_dsp_Dust_modulatedDensity(void) {
+    // When the density changes on every sample, the average
+    // number of impulses should match the average density.
+    int32_t expectedNumDustPerBlock = 5;
+    float averageDensity = (audioSettings->sampleRate /
+        audioSettings->blockSize) * expectedNumDustPerBlock;
+
+    struct sig_dsp_Dust* dust = sig_dsp_Dust_new(&allocator, context);
+    dust->inputs.density = sig_AudioBlock_new(&allocator, audioSettings);
+    for (size_t i = 0; i < audioSettings->blockSize; i++) {
+        FLOAT_ARRAY(dust->inputs.density)[i] = i % 2 == 0 ?
+            averageDensity * 0.5f : averageDensity * 1.5f;
+    }
+
+    testDust(dust, 0.0f, 1.0f, expectedNumDustPerBlock);
+
+    allocator.impl->free(&allocator, dust->inputs.density);
+    sig_dsp_Dust_destroy(&allocator, dust);
+}
+
+void test_sig_dsp_DustGate(void) {
+    int32_t expectedNumDustPerBlock = 2;
+    float density = (audioSettings->sampleRate /
+        audioSettings->blockSize) * expectedNumDustPerBlock;
+
+    struct sig_dsp_DustGate* dustGate = sig_dsp_DustGate_new(&allocator,
+        context);
+    struct sig_dsp_ConstantValue* densityValue = sig_dsp_ConstantValue_new(
+        &allocator, context, density);
+    struct sig_dsp_ConstantValue* durationPercentage =
+        sig_dsp_ConstantValue_new(&allocator, context, 0.5f);
+    dustGate->inputs.density = densityValue->outputs.main;
+    dustGate->inputs.durationPercentage = durationPercentage->outputs.main;
+
+    // The gate's duration is half the average interval between impulses,
+    // so it should be open roughly 1 - e^-0.5 (about 40%) of the time.
+    size_t numBlocks = 500;
+    size_t numNonZero = countNonZeroSamplesGenerated(&dustGate->signal,
+        dustGate->outputs.main, numBlocks);
+    float openRatio = (float) numNonZero /
+        (float) (numBlocks * audioSettings->blockSize);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 0.4f, openRatio);
+
+    sig_dsp_DustGate_destroy(&allocator, dustGate);
+    sig_dsp_ConstantValue_destroy(&allocator, densityValue);
+    sig_dsp_ConstantValue_destroy(&allocator, durationPercentage);
+}
+
+void test_sig_dsp_Dust_isSeededFromContext(void) {
+    struct sig_dsp_ConstantValue* density = sig_dsp_ConstantValue_new(
+        &allocator, context, 10000.0f);
+
+    sig_Random_init(&context->random, 7);
+    struct sig_dsp_Dust* first = sig_dsp_Dust_new(&allocator, context);
+    first->inputs.density = density->outputs.main;
+    sig_Random_init(&context->random, 7);
+    struct sig_dsp_Dust* second = sig_dsp_Dust_new(&allocator, context);
+    second->inputs.density = density->outputs.main;
+
+    // Instances seeded identically should produce identical output.
+    first->signal.generate(first);
+    second->signal.generate(second);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first->outputs.main,
+        second->outputs.main, audioSettings->blockSize);
+
+    // Instances created one after the other should not.
+    struct sig_dsp_Dust* third = sig_dsp_Dust_new(&allocator, context);
+    third->inputs.density = density->outputs.main;
+    third->signal.generate(third);
+    testAssertBuffersNotEqual(first->outputs.main, third->outputs.main,
+        audioSettings->blockSize);
+
+    sig_dsp_Dust_destroy(&allocator, first);
+    sig_dsp_Dust_destroy(&allocator, second);
+    sig_dsp_Dust_destroy(&allocator, third);
+    sig_dsp_ConstantValue_destroy(&allocator, density);
+}
+
+/**
+ * Returns the lag-one autocorrelation of a signal,
+ * which approaches zero for white noise and increases
+ * as the signal's energy shifts towards lower frequencies.
+ */
+float generateNoiseAutocorrelation(struct sig_dsp_Signal* signal,
+    float_array_ptr output, size_t numBlocks, float min, float max) {
+    float previous = 0.0f;
+    double energy = 0.0;
+    double correlation = 0.0;
+
+    for (size_t block = 0; block < numBlocks; block++) {
+        signal->generate(signal);
+        testAssertBufferValuesInRange(output, audioSettings->blockSize,
+            min, max);
+
+        for (size_t i = 0; i < audioSettings->blockSize; i++) {
+            float sample = FLOAT_ARRAY(output)[i];
+            energy += sample * sample;
+            correlation += sample * previous;
+            previous = sample;
+        }
+    }
+
+    return (float) (correlation / energy);
+}
+
+void test_sig_dsp_WhiteNoise(void) {
+    struct sig_dsp_WhiteNoise* noise = sig_dsp_WhiteNoise_new(&allocator,
+        context);
+    float autocorrelation = generateNoiseAutocorrelation(&noise->signal,
+        noise->outputs.main, 1000, -1.0f, 1.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 0.0f, autocorrelation);
+
+    sig_dsp_WhiteNoise_destroy(&allocator, noise);
+}
+
+void test_sig_dsp_PinkNoise(void) {
+    struct sig_dsp_PinkNoise* noise = sig_dsp_PinkNoise_new(&allocator,
+        context);
+    float autocorrelation = generateNoiseAutocorrelation(&noise->signal,
+        noise->outputs.main, 1000, -1.0f, 1.0f);
+    TEST_ASSERT_TRUE(autocorrelation > 0.3f);
+    TEST_ASSERT_TRUE(autocorrelation < 0.95f);
+
+    sig_dsp_PinkNoise_destroy(&allocator, noise);
+}
+
+void test_sig_dsp_BrownNoise(void) {
+    struct sig_dsp_BrownNoise* noise = sig_dsp_BrownNoise_new(&allocator,
+        context);
+    float autocorrelation = generateNoiseAutocorrelation(&noise->signal,
+        noise->outputs.main, 1000, -1.5f, 1.5f);
+    TEST_ASSERT_TRUE(autocorrelation > 0.95f);
+
+    sig_dsp_BrownNoise_destroy(&allocator, noise);
+}
+
 
 struct sig_test_BufferPlayer* WaveformPlayer_new(
     sig_waveform_generator waveform,
@@ -752,6 +3963,53 @@ void WaveformPlayer_destroy(struct sig_test_BufferPlayer* player) {
     sig_test_BufferPlayer_destroy(&allocator, player);
 }
 
+void test_sig_dsp_TiltEQ_constantInputs(void) {
+    // With constant inputs, the cached coefficients should
+    // produce the same output as calculating them every sample.
+    float f0 = 800.0f;
+    float gain = 0.5f;
+    struct sig_dsp_ConstantValue* freq = sig_dsp_ConstantValue_new(
+        &allocator, context, f0);
+    struct sig_dsp_ConstantValue* gainValue = sig_dsp_ConstantValue_new(
+        &allocator, context, gain);
+    struct sig_test_BufferPlayer* player = WaveformPlayer_new(
+        sig_waveform_square, audioSettings->sampleRate, 220.0f, 1.0f);
+    struct sig_dsp_TiltEQ* tilt = sig_dsp_TiltEQ_new(&allocator, context);
+    tilt->inputs.source = player->outputs.main;
+    tilt->inputs.frequency = freq->outputs.main;
+    tilt->inputs.gain = gainValue->outputs.main;
+
+    float amp = 6.0f / logf(2.0f);
+    float g1 = -5.0f * gain * 6.0f;
+    float g2 = gain * 6.0f;
+    float lgain = expf(g1 / amp) - 1.0f;
+    float hgain = expf(g2 / amp) - 1.0f;
+    float sr3 = 3.0f * audioSettings->sampleRate;
+    float omega = 2.0f * sig_PI * f0;
+    float a0 = 2.0f * omega / (sr3 + omega);
+    float b1 = (sr3 - omega) / (sr3 + omega);
+    float lpOut = 0.0f;
+
+    for (size_t block = 0; block < 10; block++) {
+        player->signal.generate(player);
+        tilt->signal.generate(tilt);
+
+        for (size_t i = 0; i < audioSettings->blockSize; i++) {
+            float source = FLOAT_ARRAY(player->outputs.main)[i];
+            lpOut = a0 * source + b1 * lpOut;
+            float expected = source + lgain * lpOut +
+                hgain * (source - lpOut);
+            TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected,
+                FLOAT_ARRAY(tilt->outputs.main)[i]);
+        }
+    }
+
+    sig_dsp_TiltEQ_destroy(&allocator, tilt);
+    WaveformPlayer_destroy(player);
+    sig_dsp_ConstantValue_destroy(&allocator, freq);
+    sig_dsp_ConstantValue_destroy(&allocator, gainValue);
+}
+
 void testClockDetector(struct sig_test_BufferPlayer* clockPlayer,
     float duration, float expectedFreq) {
     struct sig_dsp_ClockDetector* det = sig_dsp_ClockDetector_new(
@@ -1315,6 +4573,7 @@ int main(void) {
     RUN_TEST(test_sig_bipolarToUint12);
     RUN_TEST(test_sig_bipolarToInvUint12);
     RUN_TEST(test_sig_randf);
+    RUN_TEST(test_sig_Random);
     RUN_TEST(test_sig_midiToFreq);
     RUN_TEST(test_sig_freqToMidi);
     RUN_TEST(test_sig_sig_linearToFreq);
@@ -1324,18 +4583,79 @@ int main(void) {
     RUN_TEST(test_sig_AudioSettings_new);
     RUN_TEST(test_sig_samplesToSeconds);
     RUN_TEST(test_sig_AudioBlock_newWithValue);
+    RUN_TEST(test_sig_AudioBlock_newMultichannel);
+    RUN_TEST(test_sig_EventBlock);
+    RUN_TEST(test_sig_dsp_BlockToEvents);
+    RUN_TEST(test_sig_midi_Parser);
+    RUN_TEST(test_sig_midi_EventQueue);
+    RUN_TEST(test_sig_RingBuffer);
+    RUN_TEST(test_sig_RingBuffer_indicesDontShareCacheLines);
     RUN_TEST(test_sig_Buffer);
     RUN_TEST(test_sig_BufferView);
     RUN_TEST(test_sig_linearXFade);
+    RUN_TEST(test_sig_denormals_flush);
+    RUN_TEST(test_sig_DelayLine_unwrittenSamplesAreSilent);
+    RUN_TEST(test_sig_LookupTableCache);
+    RUN_TEST(test_sig_LookupTableCache_keepsPrecomputedTables);
+    RUN_TEST(test_sig_tables_precomputed);
+    RUN_TEST(test_sig_tables_readByFMSignals);
+    RUN_TEST(test_sig_WavetableBankView);
+    RUN_TEST(test_sig_WavetableBankView_newMipmapped);
+    RUN_TEST(test_sig_WavetableBank_generateMipmaps);
+    RUN_TEST(test_sig_WavetableBank_readBandlimitedAtPhase);
+    RUN_TEST(test_sig_dsp_WavetableBankOscillator_mipmapped);
     RUN_TEST(test_sig_dsp_Value);
     RUN_TEST(test_sig_dsp_ConstantValue);
     RUN_TEST(test_sig_dsp_TimedTriggerCounter);
+    RUN_TEST(test_sig_dsp_TimedTriggerCounter_events);
+    RUN_TEST(test_sig_dsp_GatedTimer_events);
+    RUN_TEST(test_sig_dsp_ToggleGate_events);
+    RUN_TEST(test_sig_dsp_TimedGate_events);
+    RUN_TEST(test_sig_dsp_ClockDetector_events);
+    RUN_TEST(test_sig_dsp_ClockSource_events);
+    RUN_TEST(test_sig_dsp_MidiNote);
+    RUN_TEST(test_sig_dsp_MidiCC);
+    RUN_TEST(test_sig_dsp_MidiClock);
     RUN_TEST(test_sig_dsp_Mul);
+    RUN_TEST(test_sig_dsp_Mixer);
+    RUN_TEST(test_sig_dsp_Mixer_stereo);
+    RUN_TEST(test_sig_dsp_ModMatrix);
+    RUN_TEST(test_sig_dsp_ModMatrix_defersPartialChanges);
+    RUN_TEST(test_sig_dsp_Telemetry);
     RUN_TEST(test_sig_dsp_SineOscillator);
     RUN_TEST(test_sig_dsp_SineOscillator_accumulatesPhase);
     RUN_TEST(test_sig_dsp_SineOscillator_phaseWrapsAt2PI);
+    RUN_TEST(test_sig_dsp_BLEPSaw);
+    RUN_TEST(test_sig_dsp_BLEPSquare);
+    RUN_TEST(test_sig_dsp_BLEPTriangle);
+    RUN_TEST(test_sig_dsp_BLEPSaw_sync);
+    RUN_TEST(test_sig_dsp_SineBank);
+    RUN_TEST(test_sig_dsp_SineBank_cullsPartialsAboveNyquist);
+    RUN_TEST(test_sig_dsp_SineBank_isStable);
+    RUN_TEST(test_sig_dsp_FMOperatorBank_algorithms);
+    RUN_TEST(test_sig_dsp_FMOperatorBank_sidebands);
+    RUN_TEST(test_sig_dsp_FMOperatorBank_additiveAndFeedback);
+    RUN_TEST(test_sig_dsp_FMOperatorBank_sharesSineTable);
+    RUN_TEST(test_sig_dsp_FDNReverb_new);
+    RUN_TEST(test_sig_dsp_FDNReverb_decay);
+    RUN_TEST(test_sig_dsp_FDNReverb_dampingAndModulation);
+    RUN_TEST(test_sig_dsp_CombBank_matchesCombs);
+    RUN_TEST(test_sig_dsp_CombBank_scalesDelayTimeAndFeedback);
+    RUN_TEST(test_sig_dsp_AllpassChain_matchesAllpasses);
+    RUN_TEST(test_sig_dsp_AllpassChain_bypass);
+    RUN_TEST(test_sig_dsp_VoiceBank_matchesVoiceGraph);
+    RUN_TEST(test_sig_dsp_VoiceBank_allocatesAndStealsVoices);
+    RUN_TEST(test_sig_dsp_VoiceBank_envelope);
     RUN_TEST(test_test_sig_dsp_SineOscillator_isOffset);
     RUN_TEST(test_sig_dsp_Dust);
+    RUN_TEST(test_sig_dsp_Dust_sparse);
+    RUN_TEST(test_sig_dsp_Dust_modulatedDensity);
+    RUN_TEST(test_sig_dsp_DustGate);
+    RUN_TEST(test_sig_dsp_Dust_isSeededFromContext);
+    RUN_TEST(test_sig_dsp_WhiteNoise);
+    RUN_TEST(test_sig_dsp_PinkNoise);
+    RUN_TEST(test_sig_dsp_BrownNoise);
+    RUN_TEST(test_sig_dsp_TwoOpFM_sharesSineTable);
     RUN_TEST(test_sig_dsp_ClockDetector_square);
     RUN_TEST(test_sig_dsp_ClockDetector_sine);
     RUN_TEST(test_sig_dsp_ClockDetector_slowDown);
@@ -1350,6 +4670,28 @@ int main(void) {
     RUN_TEST(test_sig_dsp_List_noList);
     RUN_TEST(test_sig_dsp_DCBlock_AC);
     RUN_TEST(test_sig_dsp_DCBlock_DC);
+    RUN_TEST(test_sig_dsp_OnePole_decaysToSilence);
+    RUN_TEST(test_sig_DelayLine_flushDenormals);
+    RUN_TEST(test_sig_dsp_OnePole_interpolatesModulatedFrequency);
+    RUN_TEST(test_sig_dsp_BinaryOp_multichannel);
+    RUN_TEST(test_sig_dsp_BinaryOp_multichannelBroadcastsMonoInputs);
+    RUN_TEST(test_sig_dsp_ScaleOffset_multichannel);
+    RUN_TEST(test_sig_dsp_OnePole_multichannel);
+    RUN_TEST(test_sig_dsp_Ladder_multichannel);
+    RUN_TEST(test_sig_dsp_DelayTap_multichannel);
+    RUN_TEST(test_sig_dsp_Chorus_multichannel);
+    RUN_TEST(test_sig_dsp_detectInputChange);
+    RUN_TEST(test_sig_dsp_TiltEQ_constantInputs);
+    RUN_TEST(test_sig_filter_Halfband);
+    RUN_TEST(test_sig_dsp_Oversampler);
+    RUN_TEST(test_sig_dsp_Oversampler_childContext);
+    RUN_TEST(test_sig_FFT_new);
+    RUN_TEST(test_sig_FFT_matchesDFT);
+    RUN_TEST(test_sig_FFT_roundTrip);
+    RUN_TEST(test_sig_dsp_Convolver_shortIR);
+    RUN_TEST(test_sig_dsp_Convolver_longIR);
+    RUN_TEST(test_sig_dsp_Convolver_unalignedBlockSize);
+    RUN_TEST(test_sig_dsp_Convolver_identity);
 
     return UNITY_END();
 }
@@ -0,0 +1,277 @@
+/*! \file generate-tables.c
+    \brief Generates Signaletic's precomputed lookup tables.
+
+    This program is run at build time to produce a C source file
+    and header containing constant lookup tables, so that they
+    can be stored in read-only memory instead of being computed
+    at startup.
+
+    Usage: signaletic-table-generator <output.c> <output.h>
+*/
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define PI 3.14159265358979323846
+#define TWOPI (2.0 * PI)
+
+// These must be kept in sync with sig_TABLE_TANH_RANGE
+// in libsignaletic.h
+#define TANH_RANGE 4.0
+
+// The sine table must match the one requested by the FM Signals
+// (sig_dsp_FM_SINE_TABLE_LENGTH, with no guard points),
+// so that they read it instead of building their own.
+#define SINE_LENGTH 8192
+#define SINE_NUM_GUARD_POINTS 0
+#define TANH_LENGTH 2048
+#define EXP2_LENGTH 256
+#define NUM_GUARD_POINTS 1
+
+#define MIPMAP_LENGTH 1024
+#define MIPMAP_NUM_LEVELS 10
+#define VALUES_PER_LINE 4
+
+typedef double (*table_fn)(double x);
+
+double sine(double x) {
+    return sin(x * TWOPI);
+}
+
+double hyperbolicTangent(double x) {
+    return tanh((2.0 * x - 1.0) * TANH_RANGE);
+}
+
+double exponential2(double x) {
+    return pow(2.0, x);
+}
+
+/**
+ * Returns the amplitude of the specified harmonic for each waveform,
+ * and whether it is a sine (0) or cosine (1) partial.
+ * The series match the phase and polarity of the naive
+ * sig_waveform_saw, sig_waveform_square, and sig_waveform_triangle
+ * functions.
+ */
+typedef double (*harmonic_fn)(int harmonic, int* isCosine);
+
+double sawHarmonic(int harmonic, int* isCosine) {
+    *isCosine = 0;
+    return -2.0 / (PI * harmonic);
+}
+
+double squareHarmonic(int harmonic, int* isCosine) {
+    *isCosine = 0;
+    return harmonic % 2 == 0 ? 0.0 : 4.0 / (PI * harmonic);
+}
+
+double triangleHarmonic(int harmonic, int* isCosine) {
+    *isCosine = 1;
+    return harmonic % 2 == 0 ? 0.0 :
+        8.0 / (PI * PI * harmonic * harmonic);
+}
+
+void writeValues(FILE* out, double* values, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (i % VALUES_PER_LINE == 0) {
+            fputs("    ", out);
+        }
+
+        fprintf(out, "%.9ef", values[i]);
+
+        if (i < length - 1) {
+            fputs(i % VALUES_PER_LINE == VALUES_PER_LINE - 1 ?
+                ",\n" : ", ", out);
+        }
+    }
+
+    fputs("\n};\n\n", out);
+}
+
+void writeFunctionTable(FILE* out, const char* name, table_fn fn,
+    size_t length, size_t numGuardPoints) {
+    size_t numPoints = length + numGuardPoints;
+    double* values = (double*) malloc(sizeof(double) * numPoints);
+
+    for (size_t i = 0; i < numPoints; i++) {
+        values[i] = fn((double) i / (double) length);
+    }
+
+    fprintf(out, "const float %s[%zu] = {\n", name, numPoints);
+    writeValues(out, values, numPoints);
+    free(values);
+}
+
+void writeMipmapTable(FILE* out, const char* name, harmonic_fn harmonics) {
+    size_t numPoints = MIPMAP_LENGTH * MIPMAP_NUM_LEVELS;
+    double* values = (double*) calloc(numPoints, sizeof(double));
+
+    // Each level contains half as many harmonics as the one before it,
+    // starting from the maximum number that can be represented
+    // by the table, and ending with a single harmonic.
+    for (size_t level = 0; level < MIPMAP_NUM_LEVELS; level++) {
+        int numHarmonics = (MIPMAP_LENGTH / 2) >> level;
+        double* table = values + (level * MIPMAP_LENGTH);
+
+        for (int h = 1; h <= numHarmonics; h++) {
+            int isCosine = 0;
+            double amp = harmonics(h, &isCosine);
+            if (amp == 0.0) {
+                continue;
+            }
+
+            for (size_t i = 0; i < MIPMAP_LENGTH; i++) {
+                double phase = TWOPI * h * ((double) i / MIPMAP_LENGTH);
+                table[i] += amp * (isCosine ? cos(phase) : sin(phase));
+            }
+        }
+    }
+
+    fprintf(out, "const float %s[%zu] = {\n", name, numPoints);
+    writeValues(out, values, numPoints);
+    free(values);
+}
+
+void writeHeader(FILE* out) {
+    fputs("// This file was generated by signaletic-table-generator.\n"
+        "// Do not edit it by hand.\n\n"
+        "#ifndef LIBSIGNALETIC_TABLES_H\n"
+        "#define LIBSIGNALETIC_TABLES_H\n\n"
+        "#ifdef __cplusplus\n"
+        "extern \"C\" {\n"
+        "#endif\n\n"
+        "#include <libsignaletic.h>\n\n", out);
+
+    fprintf(out, "#define sig_tables_NUM_GUARD_POINTS %d\n", NUM_GUARD_POINTS);
+    fprintf(out, "#define sig_tables_SINE_LENGTH %d\n", SINE_LENGTH);
+    fprintf(out, "#define sig_tables_SINE_NUM_GUARD_POINTS %d\n",
+        SINE_NUM_GUARD_POINTS);
+    fprintf(out, "#define sig_tables_TANH_LENGTH %d\n", TANH_LENGTH);
+    fprintf(out, "#define sig_tables_EXP2_LENGTH %d\n", EXP2_LENGTH);
+    fprintf(out, "#define sig_tables_MIPMAP_LENGTH %d\n", MIPMAP_LENGTH);
+    fprintf(out, "#define sig_tables_MIPMAP_NUM_LEVELS %d\n\n",
+        MIPMAP_NUM_LEVELS);
+
+    fputs("/**\n"
+        " * One cycle of a sine wave (see sig_table_sine),\n"
+        " * followed by sig_tables_SINE_NUM_GUARD_POINTS guard points.\n"
+        " * It has the same length as the table used by the FM Signals.\n"
+        " */\n"
+        "extern const float sig_tables_sine[sig_tables_SINE_LENGTH +\n"
+        "    sig_tables_SINE_NUM_GUARD_POINTS];\n\n"
+        "/**\n"
+        " * The hyperbolic tangent (see sig_table_tanh),\n"
+        " * followed by sig_tables_NUM_GUARD_POINTS guard points.\n"
+        " */\n"
+        "extern const float sig_tables_tanh[sig_tables_TANH_LENGTH +\n"
+        "    sig_tables_NUM_GUARD_POINTS];\n\n"
+        "/**\n"
+        " * One octave of 2^x (see sig_table_exp2),\n"
+        " * followed by sig_tables_NUM_GUARD_POINTS guard points.\n"
+        " */\n"
+        "extern const float sig_tables_exp2[sig_tables_EXP2_LENGTH +\n"
+        "    sig_tables_NUM_GUARD_POINTS];\n\n"
+        "/**\n"
+        " * Band-limited mipmaps, stored contiguously.\n"
+        " * Each level contains half as many harmonics as the previous one,\n"
+        " * starting with sig_tables_MIPMAP_LENGTH / 2 harmonics.\n"
+        " * Use sig_WavetableBankView_newMipmapped() to read them\n"
+        " * as a band-limited sig_WavetableBank.\n"
+        " */\n"
+        "extern const float sig_tables_sawMipmaps[\n"
+        "    sig_tables_MIPMAP_LENGTH * sig_tables_MIPMAP_NUM_LEVELS];\n"
+        "extern const float sig_tables_squareMipmaps[\n"
+        "    sig_tables_MIPMAP_LENGTH * sig_tables_MIPMAP_NUM_LEVELS];\n"
+        "extern const float sig_tables_triangleMipmaps[\n"
+        "    sig_tables_MIPMAP_LENGTH * sig_tables_MIPMAP_NUM_LEVELS];\n\n"
+        "/**\n"
+        " * @brief Registers the precomputed sine, tanh, and exp2 tables\n"
+        " * with a lookup table cache, so that Signals which request them\n"
+        " * will read from read-only memory instead of building them.\n"
+        " *\n"
+        " * @param cache the cache to register the tables with\n"
+        " * @param allocator the allocator to use\n"
+        " */\n"
+        "void sig_tables_provide(struct sig_LookupTableCache* cache,\n"
+        "    struct sig_Allocator* allocator);\n\n"
+        "#ifdef __cplusplus\n"
+        "}\n"
+        "#endif\n\n"
+        "#endif /* LIBSIGNALETIC_TABLES_H */\n", out);
+}
+
+void writeSource(FILE* out, const char* headerName) {
+    fprintf(out, "// This file was generated by signaletic-table-generator.\n"
+        "// Do not edit it by hand.\n\n"
+        "#include \"%s\"\n\n", headerName);
+
+    fputs("_Static_assert(sig_tables_SINE_LENGTH == "
+        "sig_dsp_FM_SINE_TABLE_LENGTH,\n"
+        "    \"The sine table must match the FM Signals' table.\");\n\n",
+        out);
+
+    writeFunctionTable(out, "sig_tables_sine", sine,
+        SINE_LENGTH, SINE_NUM_GUARD_POINTS);
+    writeFunctionTable(out, "sig_tables_tanh", hyperbolicTangent,
+        TANH_LENGTH, NUM_GUARD_POINTS);
+    writeFunctionTable(out, "sig_tables_exp2", exponential2,
+        EXP2_LENGTH, NUM_GUARD_POINTS);
+    writeMipmapTable(out, "sig_tables_sawMipmaps", sawHarmonic);
+    writeMipmapTable(out, "sig_tables_squareMipmaps", squareHarmonic);
+    writeMipmapTable(out, "sig_tables_triangleMipmaps", triangleHarmonic);
+
+    fputs("void sig_tables_provide(struct sig_LookupTableCache* cache,\n"
+        "    struct sig_Allocator* allocator) {\n"
+        "    sig_LookupTableCache_provide(cache, allocator, sig_table_sine,\n"
+        "        sig_tables_SINE_LENGTH, sig_tables_SINE_NUM_GUARD_POINTS,\n"
+        "        (float_array_ptr) sig_tables_sine);\n"
+        "    sig_LookupTableCache_provide(cache, allocator, sig_table_tanh,\n"
+        "        sig_tables_TANH_LENGTH, sig_tables_NUM_GUARD_POINTS,\n"
+        "        (float_array_ptr) sig_tables_tanh);\n"
+        "    sig_LookupTableCache_provide(cache, allocator, sig_table_exp2,\n"
+        "        sig_tables_EXP2_LENGTH, sig_tables_NUM_GUARD_POINTS,\n"
+        "        (float_array_ptr) sig_tables_exp2);\n"
+        "}\n", out);
+}
+
+const char* baseName(const char* path) {
+    const char* name = path;
+    for (const char* c = path; *c != '\0'; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+
+    return name;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr,
+            "Usage: signaletic-table-generator <output.c> <output.h>\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE* source = fopen(argv[1], "w");
+    if (source == NULL) {
+        fprintf(stderr, "Couldn't open %s for writing.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    FILE* header = fopen(argv[2], "w");
+    if (header == NULL) {
+        fprintf(stderr, "Couldn't open %s for writing.\n", argv[2]);
+        fclose(source);
+        return EXIT_FAILURE;
+    }
+
+    writeSource(source, baseName(argv[2]));
+    writeHeader(header);
+
+    fclose(source);
+    fclose(header);
+
+    return EXIT_SUCCESS;
+}
@@ -72,6 +72,14 @@ public:
         return sig_dsp_ConstantValue_new(allocator, context, value);
     }
 
+    struct sig_dsp_ConstantValue* ConstantValue_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context,
+        size_t numChannels, float value) {
+        return sig_dsp_ConstantValue_newMultichannel(allocator, context,
+            numChannels, value);
+    }
+
     void ConstantValue_init(struct sig_dsp_ConstantValue* self,
         struct sig_SignalContext* context, float value) {
         sig_dsp_ConstantValue_init(self, context, value);
@@ -128,6 +136,13 @@ public:
         return sig_dsp_ScaleOffset_new(allocator, context);
     }
 
+    struct sig_dsp_ScaleOffset* ScaleOffset_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_ScaleOffset_newMultichannel(allocator, context,
+            numChannels);
+    }
+
     void ScaleOffset_init(struct sig_dsp_ScaleOffset* self,
         struct sig_SignalContext* context) {
         sig_dsp_ScaleOffset_init(self, context);
@@ -170,6 +185,12 @@ public:
         return sig_dsp_Add_new(allocator, context);
     }
 
+    struct sig_dsp_BinaryOp* Add_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Add_newMultichannel(allocator, context, numChannels);
+    }
+
     void Add_init(struct sig_dsp_BinaryOp* self,
         struct sig_SignalContext* context) {
         sig_dsp_Add_init(self, context);
@@ -190,6 +211,12 @@ public:
         return sig_dsp_Sub_new(allocator, context);
     }
 
+    struct sig_dsp_BinaryOp* Sub_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Sub_newMultichannel(allocator, context, numChannels);
+    }
+
     void Sub_init(struct sig_dsp_BinaryOp* self,
         struct sig_SignalContext* context) {
         sig_dsp_Sub_init(self, context);
@@ -210,6 +237,12 @@ public:
         return sig_dsp_Mul_new(allocator, context);
     }
 
+    struct sig_dsp_BinaryOp* Mul_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Mul_newMultichannel(allocator, context, numChannels);
+    }
+
     void Mul_init(struct sig_dsp_BinaryOp* self,
         struct sig_SignalContext* context) {
         sig_dsp_Mul_init(self, context);
@@ -230,6 +263,12 @@ public:
         return sig_dsp_Div_new(allocator, context);
     }
 
+    struct sig_dsp_BinaryOp* Div_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Div_newMultichannel(allocator, context, numChannels);
+    }
+
     void Div_init(struct sig_dsp_BinaryOp* self,
         struct sig_SignalContext* context) {
         sig_dsp_Div_init(self, context);
@@ -284,6 +323,44 @@ public:
         return sig_dsp_Accumulate_destroy(allocator, self);
     }
 
+    struct sig_dsp_BlockToEvents* BlockToEvents_new(
+        struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+        return sig_dsp_BlockToEvents_new(allocator, context);
+    }
+
+    void BlockToEvents_init(struct sig_dsp_BlockToEvents* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_BlockToEvents_init(self, context);
+    }
+
+    void BlockToEvents_generate(void* signal) {
+        sig_dsp_BlockToEvents_generate(signal);
+    }
+
+    void BlockToEvents_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_BlockToEvents* self) {
+        return sig_dsp_BlockToEvents_destroy(allocator, self);
+    }
+
+    struct sig_dsp_EventsToBlock* EventsToBlock_new(
+        struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+        return sig_dsp_EventsToBlock_new(allocator, context);
+    }
+
+    void EventsToBlock_init(struct sig_dsp_EventsToBlock* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_EventsToBlock_init(self, context);
+    }
+
+    void EventsToBlock_generate(void* signal) {
+        sig_dsp_EventsToBlock_generate(signal);
+    }
+
+    void EventsToBlock_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_EventsToBlock* self) {
+        return sig_dsp_EventsToBlock_destroy(allocator, self);
+    }
+
     struct sig_dsp_GatedTimer* GatedTimer_new(
         struct sig_Allocator* allocator,
         struct sig_SignalContext* context) {
@@ -403,6 +480,88 @@ public:
         return sig_dsp_LFTriangle_destroy(allocator, self);
     }
 
+    struct sig_dsp_BLEPOscillator* BLEPSaw_new(
+        struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+        return sig_dsp_BLEPSaw_new(allocator, context);
+    }
+
+    void BLEPSaw_init(struct sig_dsp_BLEPOscillator* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_BLEPSaw_init(self, context);
+    }
+
+    void BLEPSaw_generate(void* signal) {
+        sig_dsp_BLEPSaw_generate(signal);
+    }
+
+    void BLEPSaw_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_BLEPOscillator* self) {
+        return sig_dsp_BLEPSaw_destroy(allocator, self);
+    }
+
+    struct sig_dsp_BLEPOscillator* BLEPSquare_new(
+        struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+        return sig_dsp_BLEPSquare_new(allocator, context);
+    }
+
+    void BLEPSquare_init(struct sig_dsp_BLEPOscillator* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_BLEPSquare_init(self, context);
+    }
+
+    void BLEPSquare_generate(void* signal) {
+        sig_dsp_BLEPSquare_generate(signal);
+    }
+
+    void BLEPSquare_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_BLEPOscillator* self) {
+        return sig_dsp_BLEPSquare_destroy(allocator, self);
+    }
+
+    struct sig_dsp_BLEPOscillator* BLEPTriangle_new(
+        struct sig_Allocator* allocator, struct sig_SignalContext* context) {
+        return sig_dsp_BLEPTriangle_new(allocator, context);
+    }
+
+    void BLEPTriangle_init(struct sig_dsp_BLEPOscillator* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_BLEPTriangle_init(self, context);
+    }
+
+    void BLEPTriangle_generate(void* signal) {
+        sig_dsp_BLEPTriangle_generate(signal);
+    }
+
+    void BLEPTriangle_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_BLEPOscillator* self) {
+        return sig_dsp_BLEPTriangle_destroy(allocator, self);
+    }
+
+    struct sig_dsp_SineBank* SineBank_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context,
+        size_t numPartials) {
+        return sig_dsp_SineBank_new(allocator, context, numPartials);
+    }
+
+    void SineBank_init(struct sig_dsp_SineBank* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_SineBank_init(self, context);
+    }
+
+    void SineBank_resetPhases(struct sig_dsp_SineBank* self) {
+        sig_dsp_SineBank_resetPhases(self);
+    }
+
+    void SineBank_generate(void* signal) {
+        sig_dsp_SineBank_generate(signal);
+    }
+
+    void SineBank_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_SineBank* self) {
+        return sig_dsp_SineBank_destroy(allocator, self);
+    }
+
     void WaveOscillator_init(struct sig_dsp_WavetableOscillator* self,
         struct sig_SignalContext* context) {
         sig_dsp_WavetableOscillator_init(self, context);
@@ -504,6 +663,13 @@ public:
         return sig_dsp_OnePole_new(allocator, context);
     }
 
+    struct sig_dsp_OnePole* OnePole_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_OnePole_newMultichannel(allocator, context,
+            numChannels);
+    }
+
     void OnePole_init(struct sig_dsp_OnePole* self,
         struct sig_SignalContext* context) {
         sig_dsp_OnePole_init(self, context);
@@ -585,6 +751,63 @@ public:
         return sig_dsp_Dust_destroy(allocator, self);
     }
 
+    struct sig_dsp_WhiteNoise* WhiteNoise_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context) {
+        return sig_dsp_WhiteNoise_new(allocator, context);
+    }
+
+    void WhiteNoise_init(struct sig_dsp_WhiteNoise* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_WhiteNoise_init(self, context);
+    }
+
+    void WhiteNoise_generate(void* signal) {
+        sig_dsp_WhiteNoise_generate(signal);
+    }
+
+    void WhiteNoise_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_WhiteNoise* self) {
+        return sig_dsp_WhiteNoise_destroy(allocator, self);
+    }
+
+    struct sig_dsp_PinkNoise* PinkNoise_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context) {
+        return sig_dsp_PinkNoise_new(allocator, context);
+    }
+
+    void PinkNoise_init(struct sig_dsp_PinkNoise* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_PinkNoise_init(self, context);
+    }
+
+    void PinkNoise_generate(void* signal) {
+        sig_dsp_PinkNoise_generate(signal);
+    }
+
+    void PinkNoise_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_PinkNoise* self) {
+        return sig_dsp_PinkNoise_destroy(allocator, self);
+    }
+
+    struct sig_dsp_BrownNoise* BrownNoise_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context) {
+        return sig_dsp_BrownNoise_new(allocator, context);
+    }
+
+    void BrownNoise_init(struct sig_dsp_BrownNoise* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_BrownNoise_init(self, context);
+    }
+
+    void BrownNoise_generate(void* signal) {
+        sig_dsp_BrownNoise_generate(signal);
+    }
+
+    void BrownNoise_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_BrownNoise* self) {
+        return sig_dsp_BrownNoise_destroy(allocator, self);
+    }
+
     struct sig_dsp_TimedGate* TimedGate_new(struct sig_Allocator* allocator,
         struct sig_SignalContext* context) {
         return sig_dsp_TimedGate_new(allocator, context);
@@ -676,6 +899,76 @@ public:
         return sig_dsp_ClockDetector_destroy(allocator, self);
     }
 
+    struct sig_dsp_MidiNote* MidiNote_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context) {
+        return sig_dsp_MidiNote_new(allocator, context);
+    }
+
+    void MidiNote_init(struct sig_dsp_MidiNote* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_MidiNote_init(self, context);
+    }
+
+    void MidiNote_Outputs_newAudioBlocks(struct sig_Allocator* allocator,
+        struct sig_AudioSettings* audioSettings,
+        struct sig_dsp_MidiNote_Outputs* outputs) {
+        sig_dsp_MidiNote_Outputs_newAudioBlocks(allocator, audioSettings,
+            outputs);
+    }
+
+    void MidiNote_Outputs_destroyAudioBlocks(
+        struct sig_Allocator* allocator,
+        struct sig_dsp_MidiNote_Outputs* outputs) {
+        sig_dsp_MidiNote_Outputs_destroyAudioBlocks(allocator, outputs);
+    }
+
+    void MidiNote_generate(void* signal) {
+        sig_dsp_MidiNote_generate(signal);
+    }
+
+    void MidiNote_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_MidiNote* self) {
+        sig_dsp_MidiNote_destroy(allocator, self);
+    }
+
+    struct sig_dsp_MidiCC* MidiCC_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context) {
+        return sig_dsp_MidiCC_new(allocator, context);
+    }
+
+    void MidiCC_init(struct sig_dsp_MidiCC* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_MidiCC_init(self, context);
+    }
+
+    void MidiCC_generate(void* signal) {
+        sig_dsp_MidiCC_generate(signal);
+    }
+
+    void MidiCC_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_MidiCC* self) {
+        sig_dsp_MidiCC_destroy(allocator, self);
+    }
+
+    struct sig_dsp_MidiClock* MidiClock_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context) {
+        return sig_dsp_MidiClock_new(allocator, context);
+    }
+
+    void MidiClock_init(struct sig_dsp_MidiClock* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_MidiClock_init(self, context);
+    }
+
+    void MidiClock_generate(void* signal) {
+        sig_dsp_MidiClock_generate(signal);
+    }
+
+    void MidiClock_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_MidiClock* self) {
+        sig_dsp_MidiClock_destroy(allocator, self);
+    }
+
     struct sig_dsp_LinearToFreq* LinearToFreq_new(
         struct sig_Allocator* allocator,
         struct sig_SignalContext* context) {
@@ -792,6 +1085,32 @@ public:
         return sig_dsp_TwoOpFM_destroy(allocator, self);
     }
 
+    struct sig_dsp_FMOperatorBank* FMOperatorBank_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context,
+        size_t numOperators) {
+        return sig_dsp_FMOperatorBank_new(allocator, context, numOperators);
+    }
+
+    void FMOperatorBank_init(struct sig_dsp_FMOperatorBank* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_FMOperatorBank_init(self, context);
+    }
+
+    void FMOperatorBank_setAlgorithm(struct sig_dsp_FMOperatorBank* self,
+        enum sig_dsp_FMOperatorBank_Algorithm algorithm) {
+        sig_dsp_FMOperatorBank_setAlgorithm(self, algorithm);
+    }
+
+    void FMOperatorBank_generate(void* signal) {
+        sig_dsp_FMOperatorBank_generate(signal);
+    }
+
+    void FMOperatorBank_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_FMOperatorBank* self) {
+        return sig_dsp_FMOperatorBank_destroy(allocator, self);
+    }
+
     void FourPoleFilter_Outputs_newAudioBlocks(
         struct sig_Allocator* allocator,
         struct sig_AudioSettings* audioSettings,
@@ -837,6 +1156,13 @@ public:
         return sig_dsp_Ladder_new(allocator, context);
     }
 
+    struct sig_dsp_Ladder* Ladder_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Ladder_newMultichannel(allocator, context,
+            numChannels);
+    }
+
     void Ladder_init(
         struct sig_dsp_Ladder* self,
         struct sig_SignalContext* context) {
@@ -849,8 +1175,8 @@ public:
     }
 
     float Ladder_calcStage(
-        struct sig_dsp_Ladder* self, float s, uint8_t i) {
-        return sig_dsp_Ladder_calcStage(self, s, i);
+        struct sig_dsp_Ladder* self, size_t channel, float s, uint8_t i) {
+        return sig_dsp_Ladder_calcStage(self, channel, s, i);
     }
 
     void Ladder_generate(void* signal) {
@@ -862,6 +1188,43 @@ public:
         return sig_dsp_Ladder_destroy(allocator, self);
     }
 
+    struct sig_dsp_VoiceBank* VoiceBank_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numVoices) {
+        return sig_dsp_VoiceBank_new(allocator, context, numVoices);
+    }
+
+    void VoiceBank_init(struct sig_dsp_VoiceBank* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_VoiceBank_init(self, context);
+    }
+
+    size_t VoiceBank_noteOn(struct sig_dsp_VoiceBank* self,
+        int32_t note, float frequency, float velocity) {
+        return sig_dsp_VoiceBank_noteOn(self, note, frequency, velocity);
+    }
+
+    void VoiceBank_noteOff(struct sig_dsp_VoiceBank* self, int32_t note) {
+        sig_dsp_VoiceBank_noteOff(self, note);
+    }
+
+    void VoiceBank_allNotesOff(struct sig_dsp_VoiceBank* self) {
+        sig_dsp_VoiceBank_allNotesOff(self);
+    }
+
+    size_t VoiceBank_numActiveVoices(struct sig_dsp_VoiceBank* self) {
+        return sig_dsp_VoiceBank_numActiveVoices(self);
+    }
+
+    void VoiceBank_generate(void* signal) {
+        sig_dsp_VoiceBank_generate(signal);
+    }
+
+    void VoiceBank_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_VoiceBank* self) {
+        return sig_dsp_VoiceBank_destroy(allocator, self);
+    }
+
     struct sig_dsp_TiltEQ* TiltEQ_new(
         struct sig_Allocator* allocator,
         struct sig_SignalContext* context) {
@@ -882,12 +1245,71 @@ public:
         return sig_dsp_TiltEQ_destroy(allocator, self);
     }
 
+    struct sig_dsp_Oversampler* Oversampler_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context,
+        size_t factor, size_t maxNumSignals) {
+        return sig_dsp_Oversampler_new(allocator, context, factor,
+            maxNumSignals);
+    }
+
+    void Oversampler_init(struct sig_dsp_Oversampler* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_Oversampler_init(self, context);
+    }
+
+    void Oversampler_generate(void* signal) {
+        sig_dsp_Oversampler_generate(signal);
+    }
+
+    float Oversampler_latency(struct sig_dsp_Oversampler* self) {
+        return sig_dsp_Oversampler_latency(self);
+    }
+
+    void Oversampler_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_Oversampler* self) {
+        return sig_dsp_Oversampler_destroy(allocator, self);
+    }
+
+    struct sig_dsp_Convolver* Convolver_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context,
+        size_t maxIRLength) {
+        return sig_dsp_Convolver_new(allocator, context, maxIRLength);
+    }
+
+    void Convolver_init(struct sig_dsp_Convolver* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_Convolver_init(self, context);
+    }
+
+    void Convolver_loadIR(struct sig_dsp_Convolver* self,
+        struct sig_Buffer* ir) {
+        sig_dsp_Convolver_loadIR(self, ir);
+    }
+
+    void Convolver_generate(void* signal) {
+        sig_dsp_Convolver_generate(signal);
+    }
+
+    void Convolver_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_Convolver* self) {
+        return sig_dsp_Convolver_destroy(allocator, self);
+    }
+
     struct sig_dsp_Delay* Delay_new(
         struct sig_Allocator* allocator,
         struct sig_SignalContext* context) {
         return sig_dsp_Delay_new(allocator, context);
     }
 
+    struct sig_dsp_Delay* Delay_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Delay_newMultichannel(allocator, context,
+            numChannels);
+    }
+
     void Delay_init(struct sig_dsp_Delay* self,
         struct sig_SignalContext* context) {
         sig_dsp_Delay_init(self, context);
@@ -913,6 +1335,13 @@ public:
         return sig_dsp_DelayTap_new(allocator, context);
     }
 
+    struct sig_dsp_Delay* DelayTap_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_DelayTap_newMultichannel(allocator, context,
+            numChannels);
+    }
+
     void DelayTap_init(struct sig_dsp_Delay* self,
         struct sig_SignalContext* context) {
         sig_dsp_DelayTap_init(self, context);
@@ -987,12 +1416,83 @@ public:
         return sig_dsp_Allpass_destroy(allocator, self);
     }
 
+    struct sig_dsp_FDNReverb* FDNReverb_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numLines) {
+        return sig_dsp_FDNReverb_new(allocator, context, numLines);
+    }
+
+    void FDNReverb_init(struct sig_dsp_FDNReverb* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_FDNReverb_init(self, context);
+    }
+
+    void FDNReverb_generate(void* signal) {
+        sig_dsp_FDNReverb_generate(signal);
+    }
+
+    void FDNReverb_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_FDNReverb* self) {
+        return sig_dsp_FDNReverb_destroy(allocator, self);
+    }
+
+    struct sig_dsp_CombBank* CombBank_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numLines,
+        float maxDelayTime) {
+        return sig_dsp_CombBank_new(allocator, context, numLines,
+            maxDelayTime);
+    }
+
+    void CombBank_init(struct sig_dsp_CombBank* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_CombBank_init(self, context);
+    }
+
+    void CombBank_generate(void* signal) {
+        sig_dsp_CombBank_generate(signal);
+    }
+
+    void CombBank_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_CombBank* self) {
+        return sig_dsp_CombBank_destroy(allocator, self);
+    }
+
+    struct sig_dsp_AllpassChain* AllpassChain_new(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numStages,
+        float maxDelayTime) {
+        return sig_dsp_AllpassChain_new(allocator, context, numStages,
+            maxDelayTime);
+    }
+
+    void AllpassChain_init(struct sig_dsp_AllpassChain* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_AllpassChain_init(self, context);
+    }
+
+    void AllpassChain_generate(void* signal) {
+        sig_dsp_AllpassChain_generate(signal);
+    }
+
+    void AllpassChain_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_AllpassChain* self) {
+        return sig_dsp_AllpassChain_destroy(allocator, self);
+    }
+
     struct sig_dsp_Chorus* Chorus_new(
         struct sig_Allocator* allocator,
         struct sig_SignalContext* context) {
         return sig_dsp_Chorus_new(allocator, context);
     }
 
+    struct sig_dsp_Chorus* Chorus_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numChannels) {
+        return sig_dsp_Chorus_newMultichannel(allocator, context,
+            numChannels);
+    }
+
     void Chorus_init(struct sig_dsp_Chorus* self,
         struct sig_SignalContext* context) {
         sig_dsp_Chorus_init(self, context);
@@ -1027,6 +1527,85 @@ public:
         return sig_dsp_LinearXFade_destroy(allocator, self);
     }
 
+    struct sig_dsp_Mixer* Mixer_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numInputs) {
+        return sig_dsp_Mixer_new(allocator, context, numInputs);
+    }
+
+    struct sig_dsp_Mixer* Mixer_newStereo(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t numInputs) {
+        return sig_dsp_Mixer_newStereo(allocator, context, numInputs);
+    }
+
+    void Mixer_init(struct sig_dsp_Mixer* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_Mixer_init(self, context);
+    }
+
+    void Mixer_generate(void* signal) {
+        sig_dsp_Mixer_generate(signal);
+    }
+
+    void Mixer_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_Mixer* self) {
+        return sig_dsp_Mixer_destroy(allocator, self);
+    }
+
+    struct sig_dsp_ModMatrix* ModMatrix_new(
+        struct sig_Allocator* allocator, struct sig_SignalContext* context,
+        size_t numSources, size_t numDestinations) {
+        return sig_dsp_ModMatrix_new(allocator, context,
+            numSources, numDestinations);
+    }
+
+    void ModMatrix_init(struct sig_dsp_ModMatrix* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_ModMatrix_init(self, context);
+    }
+
+    void ModMatrix_setDepth(struct sig_dsp_ModMatrix* self,
+        size_t source, size_t destination, float depth) {
+        sig_dsp_ModMatrix_setDepth(self, source, destination, depth);
+    }
+
+    void ModMatrix_setDepths(struct sig_dsp_ModMatrix* self,
+        float* depths) {
+        sig_dsp_ModMatrix_setDepths(self, depths);
+    }
+
+    void ModMatrix_generate(void* signal) {
+        sig_dsp_ModMatrix_generate(signal);
+    }
+
+    void ModMatrix_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_ModMatrix* self) {
+        return sig_dsp_ModMatrix_destroy(allocator, self);
+    }
+
+    struct sig_dsp_Telemetry* Telemetry_new(struct sig_Allocator* allocator,
+        struct sig_SignalContext* context, size_t capacity) {
+        return sig_dsp_Telemetry_new(allocator, context, capacity);
+    }
+
+    void Telemetry_init(struct sig_dsp_Telemetry* self,
+        struct sig_SignalContext* context) {
+        sig_dsp_Telemetry_init(self, context);
+    }
+
+    void Telemetry_generate(void* signal) {
+        sig_dsp_Telemetry_generate(signal);
+    }
+
+    bool Telemetry_readLatest(struct sig_dsp_Telemetry* self,
+        float* value) {
+        return sig_dsp_Telemetry_readLatest(self, value);
+    }
+
+    void Telemetry_destroy(struct sig_Allocator* allocator,
+        struct sig_dsp_Telemetry* self) {
+        sig_dsp_Telemetry_destroy(allocator, self);
+    }
+
     void Calibrator_Node_init(struct sig_dsp_Calibrator_Node* nodes,
         float_array_ptr targetValues, size_t numNodes) {
         sig_dsp_Calibrator_Node_init(nodes, targetValues, numNodes);
@@ -1160,6 +1739,10 @@ public:
         return sig_randf();
     }
 
+    void randSeed(uint32_t seed) {
+        sig_randSeed(seed);
+    }
+
     float fastTanhf(float x) {
         return sig_fastTanhf(x);
     }
@@ -1475,6 +2058,12 @@ public:
         return sig_SignalContext_new(allocator, audioSettings);
     }
 
+    struct sig_SignalContext* SignalContext_newChild(
+        struct sig_Allocator* allocator, struct sig_SignalContext* parent,
+        struct sig_AudioSettings* audioSettings) {
+        return sig_SignalContext_newChild(allocator, parent, audioSettings);
+    }
+
     void SignalContext_destroy(struct sig_Allocator* allocator,
         struct sig_SignalContext* self) {
         sig_SignalContext_destroy(allocator, self);
@@ -1537,6 +2126,25 @@ public:
         return sig_WavetableBank_readLinearAtPhase(wavetable, tableIdx, phase);
     }
 
+    void WavetableBank_generateMipmaps(struct sig_Allocator* allocator,
+        struct sig_WavetableBank* wavetable) {
+        sig_WavetableBank_generateMipmaps(allocator, wavetable);
+    }
+
+    float WavetableBank_readMipmapLevelAtPhase(
+        struct sig_WavetableBank* wavetable, size_t level, float fade,
+        float tableIdx, float phase) {
+        return sig_WavetableBank_readMipmapLevelAtPhase(wavetable, level,
+            fade, tableIdx, phase);
+    }
+
+    float WavetableBank_readBandlimitedAtPhase(
+        struct sig_WavetableBank* wavetable, float tableIdx, float phase,
+        float phaseIncrement) {
+        return sig_WavetableBank_readBandlimitedAtPhase(wavetable, tableIdx,
+            phase, phaseIncrement);
+    }
+
     void WavetableBank_destroy(struct sig_Allocator* allocator,
         struct sig_WavetableBank* wavetable) {
         return sig_WavetableBank_destroy(allocator, wavetable);
@@ -1560,6 +2168,121 @@ public:
         return sig_AudioBlock_destroy(allocator, self);
     }
 
+    float_array_ptr AudioBlock_newMultichannel(
+        struct sig_Allocator* allocator,
+        struct sig_AudioSettings* audioSettings, size_t numChannels) {
+        return sig_AudioBlock_newMultichannel(allocator, audioSettings,
+            numChannels);
+    }
+
+    float_array_ptr AudioBlock_channel(
+        struct sig_AudioSettings* audioSettings, float_array_ptr self,
+        size_t channel) {
+        return sig_AudioBlock_channel(audioSettings, self, channel);
+    }
+
+    struct sig_EventBlock* EventBlock_new(struct sig_Allocator* allocator,
+        size_t capacity) {
+        return sig_EventBlock_new(allocator, capacity);
+    }
+
+    void EventBlock_clear(struct sig_EventBlock* self) {
+        sig_EventBlock_clear(self);
+    }
+
+    bool EventBlock_push(struct sig_EventBlock* self, uint32_t offset,
+        float value) {
+        return sig_EventBlock_push(self, offset, value);
+    }
+
+    void EventBlock_readBlock(struct sig_EventBlock* self,
+        float_array_ptr source, size_t blockSize, float* previousValue) {
+        sig_EventBlock_readBlock(self, source, blockSize, previousValue);
+    }
+
+    void EventBlock_writeBlock(struct sig_EventBlock* self,
+        float_array_ptr output, size_t blockSize, float* currentValue) {
+        sig_EventBlock_writeBlock(self, output, blockSize, currentValue);
+    }
+
+    void EventBlock_destroy(struct sig_Allocator* allocator,
+        struct sig_EventBlock* self) {
+        sig_EventBlock_destroy(allocator, self);
+    }
+
+    struct sig_midi_EventQueue* midi_EventQueue_new(
+        struct sig_Allocator* allocator, size_t capacity) {
+        return sig_midi_EventQueue_new(allocator, capacity);
+    }
+
+    void midi_EventQueue_init(struct sig_midi_EventQueue* self) {
+        sig_midi_EventQueue_init(self);
+    }
+
+    void midi_EventQueue_clear(struct sig_midi_EventQueue* self) {
+        sig_midi_EventQueue_clear(self);
+    }
+
+    bool midi_EventQueue_push(struct sig_midi_EventQueue* self,
+        uint32_t offset, struct sig_midi_Message* message) {
+        return sig_midi_EventQueue_push(self, offset, *message);
+    }
+
+    size_t midi_EventQueue_writeBytes(struct sig_midi_EventQueue* self,
+        void* bytes, size_t numBytes, uint32_t offset) {
+        return sig_midi_EventQueue_writeBytes(self, (const uint8_t*) bytes,
+            numBytes, offset);
+    }
+
+    void midi_EventQueue_destroy(struct sig_Allocator* allocator,
+        struct sig_midi_EventQueue* self) {
+        sig_midi_EventQueue_destroy(allocator, self);
+    }
+
+    struct sig_RingBuffer* RingBuffer_new(struct sig_Allocator* allocator,
+        size_t capacity, size_t itemSize) {
+        return sig_RingBuffer_new(allocator, capacity, itemSize);
+    }
+
+    void RingBuffer_init(struct sig_RingBuffer* self) {
+        sig_RingBuffer_init(self);
+    }
+
+    size_t RingBuffer_readable(struct sig_RingBuffer* self) {
+        return sig_RingBuffer_readable(self);
+    }
+
+    size_t RingBuffer_writeable(struct sig_RingBuffer* self) {
+        return sig_RingBuffer_writeable(self);
+    }
+
+    size_t RingBuffer_pushSpan(struct sig_RingBuffer* self, void* items,
+        size_t numItems) {
+        return sig_RingBuffer_pushSpan(self, items, numItems);
+    }
+
+    size_t RingBuffer_popSpan(struct sig_RingBuffer* self, void* items,
+        size_t maxItems) {
+        return sig_RingBuffer_popSpan(self, items, maxItems);
+    }
+
+    bool RingBuffer_push(struct sig_RingBuffer* self, void* item) {
+        return sig_RingBuffer_push(self, item);
+    }
+
+    bool RingBuffer_pop(struct sig_RingBuffer* self, void* item) {
+        return sig_RingBuffer_pop(self, item);
+    }
+
+    size_t RingBuffer_flush(struct sig_RingBuffer* self) {
+        return sig_RingBuffer_flush(self);
+    }
+
+    void RingBuffer_destroy(struct sig_Allocator* allocator,
+        struct sig_RingBuffer* self) {
+        sig_RingBuffer_destroy(allocator, self);
+    }
+
     struct sig_DelayLine* DelayLine_new(struct sig_Allocator* allocator,
         size_t maxDelayLength) {
         return sig_DelayLine_new(allocator, maxDelayLength);